@@ -32,13 +32,19 @@ extern "C" {
 
 /* USER CODE END Includes */
 
+extern UART_HandleTypeDef hlpuart1;
+
 extern UART_HandleTypeDef huart1;
 
+extern UART_HandleTypeDef huart3;
+
 /* USER CODE BEGIN Private defines */
 
 /* USER CODE END Private defines */
 
+void MX_LPUART1_UART_Init(void);
 void MX_USART1_UART_Init(void);
+void MX_USART3_UART_Init(void);
 
 /* USER CODE BEGIN Prototypes */
 
@@ -18,15 +18,34 @@
 /* USER CODE END Header */
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
+#include "adc.h"
+#include "crc.h"
+#include "dfsdm.h"
 #include "dma.h"
+#include "tim.h"
 #include "usart.h"
 #include "gpio.h"
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "app_drv_serial_rx.h"
 #include "app_drv_fifo.h"
+#include "app_drv_console.h"
+#include "app_drv_adc_pipe.h"
+#include "app_drv_dfsdm_pipe.h"
+#include "app_drv_telemetry.h"
+#include "app_drv_lz.h"
+#include "app_drv_bridge.h"
+#include "app_drv_irq.h"
+#include "app_drv_arq.h"
+#include "app_drv_flash_log.h"
+#include "app_drv_fw_update.h"
+#ifdef DSP_BENCH
+#include "dsp_bench.h"
+#endif
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -49,11 +68,32 @@
 /* USER CODE BEGIN PV */
 extern DMA_HandleTypeDef hdma_usart1_rx;
 USART_DMA_Context USART1_DMA_Context;
-extern DMA_HandleTypeDef hdma_usart2_rx;
-USART_DMA_Context USART2_DMA_Context;
+extern DMA_HandleTypeDef hdma_usart3_rx;
+USART_DMA_Context USART3_DMA_Context;
+extern DMA_HandleTypeDef hdma_lpuart_rx;
+USART_DMA_Context LPUART1_DMA_Context;
 
 // DMA发送状态标志
 volatile uint8_t usart1_tx_busy = 0;
+
+// 中断优先级（数值越小越高，0 保留）：接收路径最高，数据块处理与 Flash 编程完成其次，发送完成和负载发生器最低；
+// 同一串口的接收 DMA 与串口中断同级，驱动中两者共享的状态不会被互相打断
+static const IRQ_Config irq_config[] = {
+  { USART1_IRQn,         1, "usart1" },
+  { DMA1_Channel5_IRQn,  1, "usart1 rx" },
+  { USART3_IRQn,         1, "usart3" },
+  { DMA1_Channel3_IRQn,  1, "usart3 rx" },
+  { LPUART1_IRQn,        1, "lpuart1" },
+  { DMA2_Channel7_IRQn,  1, "lpuart1 rx" },
+  { DMA1_Channel1_IRQn,  2, "adc" },
+  { DMA1_Channel6_IRQn,  2, "dfsdm" },
+  { FLASH_IRQn,          2, "flash" },
+  { DMA1_Channel4_IRQn,  3, "usart1 tx" },
+  { DMA1_Channel2_IRQn,  3, "usart3 tx" },
+  { DMA2_Channel6_IRQn,  3, "lpuart1 tx" },
+  { TIM7_IRQn,           3, "load" },
+};
+IRQ_Monitor irq_monitor;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -74,6 +114,28 @@ static uint8_t usart1_rx_fifo_buffer[RX_FIFO_SIZE];
 // FIFO 实例
 static app_drv_fifo_t usart1_rx_fifo;
 
+// USART1 接收时间戳侧队列（TIM2 自由运行，125 ns 分辨率）
+#define RX_TS_QUEUE_SIZE 16
+static USART_Rx_Timestamp usart1_rx_ts[RX_TS_QUEUE_SIZE];
+static USART_Rx_Timestamp usart1_rx_ts_last;
+static uint16_t usart1_rx_ts_length;
+
+// USART1 接收数据 Flash 日志：每段接收数据 (IDLE/HT/TC) 加 2 字节长度前缀进入暂存 FIFO，
+// 主循环取出后作为一条记录追加，收到 IDLE 时间戳后刷新暂存行；页擦除期间由暂存 FIFO 缓冲
+#define RX_LOG_FIFO_SIZE 1024
+static uint8_t rx_log_fifo_buffer[RX_LOG_FIFO_SIZE];
+static app_drv_fifo_t rx_log_fifo;
+static uint8_t rx_log_record[USART_DMA_BUFFER_SIZE];
+static FLASH_Log_Context flash_log;
+static volatile uint8_t rx_log_enabled;
+static uint8_t rx_log_idle;             // 收到 IDLE，暂存数据写完后刷新
+static volatile uint32_t rx_log_dropped; // 暂存 FIFO 满时丢弃的字节数
+
+// USART1 遥测发送 FIFO（编码器直接写入，DMA 直接从中发送）
+#define TX_FIFO_SIZE 512
+static uint8_t usart1_tx_fifo_buffer[TX_FIFO_SIZE];
+static app_drv_fifo_t usart1_tx_fifo;
+
 // 通用的批量队列写入函数（所有串口共用）
 uint32_t USART_Queue_Write(void* user_queue, uint8_t* data, uint16_t length)
 {
@@ -85,6 +147,25 @@ uint32_t USART_Queue_Write(void* user_queue, uint8_t* data, uint16_t length)
     return 0;
 }
 
+// USART1 接收队列写入：数据交给控制台 FIFO，同时整段复制到日志暂存 FIFO（中断中调用）
+static uint32_t Usart1_Queue_Write(void* user_queue, uint8_t* data, uint16_t length)
+{
+  if (rx_log_enabled) {
+    uint8_t header[2] = { (uint8_t)length, (uint8_t)(length >> 8) };
+    uint16_t written = sizeof(header);
+
+    if (length <= sizeof(rx_log_record) &&
+        rx_log_fifo.size - app_drv_fifo_length(&rx_log_fifo) >= sizeof(header) + length) {
+      app_drv_fifo_write(&rx_log_fifo, header, &written);
+      written = length;
+      app_drv_fifo_write(&rx_log_fifo, data, &written);
+    } else {
+      rx_log_dropped += length;
+    }
+  }
+  return USART_Queue_Write(user_queue, data, length);
+}
+
 // 通用的队列可用空间查询函数（所有串口共用）
 uint32_t USART_Queue_Available(void* user_queue)
 {
@@ -118,6 +199,816 @@ int _write(int file, char *ptr, int len)
   return len;
 }
 
+// 控制台实例
+static CONSOLE_Context console;
+
+// 内部温度传感器采样流水线
+static ADC_Pipe_Context adc_pipe;
+static volatile q15_t temperature_mean;   // 最近一块的平均温度，1/256 °C
+
+// 每块温度取平均（DMA 中断中调用）
+static void Temperature_Block(void* user, const q15_t* block, uint16_t length)
+{
+  q15_t mean;
+
+  arm_mean_q15((q15_t*)block, length, &mean);
+  temperature_mean = mean;
+}
+
+// DFSDM Σ-Δ 输入流水线
+static DFSDM_Pipe_Context dfsdm_pipe;
+static volatile q31_t dfsdm_rms;           // 最近一块滤波输出的 RMS
+
+// 每块计算 RMS（DMA 中断中调用）
+static void Dfsdm_Block(void* user, const q31_t* block, uint16_t length)
+{
+  q31_t rms;
+
+  arm_rms_q31((q31_t*)block, length, &rms);
+  dfsdm_rms = rms;
+}
+
+// 遥测流
+#define STREAM_PERIOD_MS  100U
+#define STREAM_LZ_FLUSH   10U     // 压缩模式每 10 条记录（1 s）刷新一次
+
+typedef enum {
+  STREAM_OFF = 0,
+  STREAM_BINARY,    // CBOR 记录
+  STREAM_TEXT,      // printf 文本（对照）
+  STREAM_LZ,        // CBOR 记录经 LZ 压缩
+} Stream_Mode;
+
+static TLM_Context telemetry;
+
+// 压缩模式：记录先写入明文 FIFO，压缩后进入发送 FIFO
+static uint8_t stream_plain_buffer[256];
+static app_drv_fifo_t stream_plain_fifo;
+static TLM_Context telemetry_plain;
+static LZ_Encoder stream_lz;
+static uint8_t stream_lz_flush;
+static Stream_Mode stream_mode = STREAM_OFF;
+static uint32_t stream_seq;
+static uint32_t stream_last_ms;
+static TLM_Delta stream_tick_delta;
+static TLM_Delta stream_temp_delta;
+static TLM_Delta stream_rx_delta;
+static uint32_t stream_cycles_last;     // 最近一条记录的格式化耗时，DWT 周期
+static uint32_t stream_cycles_max;
+static uint32_t stream_bytes;           // 已生成的记录字节数
+
+// 遥测发送函数（非阻塞，链路忙时返回失败，由发送完成回调接续）
+static int Telemetry_Send(void* user, const uint8_t* data, uint16_t length)
+{
+  if (usart1_tx_busy != 0) {
+    return -1;
+  }
+  usart1_tx_busy = 1;
+  if (HAL_UART_Transmit_DMA((UART_HandleTypeDef*)user, (uint8_t*)data, length) != HAL_OK) {
+    usart1_tx_busy = 0;
+    return -1;
+  }
+  return 0;
+}
+
+// 生成一条遥测记录：[序号, 时间, 温度, 输入电平, 接收字节数]
+static void Telemetry_Record(uint32_t now_ms)
+{
+  uint32_t received, dropped, overflow;
+  uint32_t start;
+  int32_t temp = temperature_mean;
+  q31_t rms = dfsdm_rms;
+
+  USART_GetStatistics(&USART1_DMA_Context, &received, &dropped, &overflow);
+  start = DWT->CYCCNT;
+
+  if (stream_mode == STREAM_BINARY || stream_mode == STREAM_LZ) {
+    TLM_Writer w;
+    uint8_t key = TLM_IsKeyframe(stream_seq);
+    uint16_t record_start;
+
+    TLM_Begin(&w, (stream_mode == STREAM_LZ) ? &telemetry_plain : &telemetry);
+    record_start = w.pos;
+    TLM_CborArray(&w, 5);
+    TLM_CborUint(&w, stream_seq);
+    TLM_CborDelta(&w, &stream_tick_delta, (int32_t)now_ms, key);
+    TLM_CborDelta(&w, &stream_temp_delta, temp, key);
+    TLM_CborInt(&w, rms >> 16);
+    TLM_CborDelta(&w, &stream_rx_delta, (int32_t)received, key);
+    if (TLM_End(&w) == 0) {
+      stream_bytes += (uint16_t)(w.pos - record_start);
+    }
+    if (stream_mode == STREAM_LZ) {
+      if ((stream_seq % STREAM_LZ_FLUSH) == STREAM_LZ_FLUSH - 1U) {
+        stream_lz_flush = 1;
+      }
+      LZ_Compress(&stream_lz, &stream_plain_fifo, &usart1_tx_fifo, stream_lz_flush);
+    }
+  } else {
+    int len = printf("%lu,%lu,%.2f,%.5f,%lu\r\n", (unsigned long)stream_seq, (unsigned long)now_ms,
+                     temp / (float)ADC_PIPE_TEMP_LSB_PER_C, rms / 2147483648.0f, (unsigned long)received);
+    if (len > 0) {
+      stream_bytes += (uint32_t)len;
+    }
+  }
+
+  stream_cycles_last = DWT->CYCCNT - start;
+  if (stream_cycles_last > stream_cycles_max) {
+    stream_cycles_max = stream_cycles_last;
+  }
+  stream_seq++;
+}
+
+// 主循环中调用：按周期生成遥测记录
+static void Telemetry_Poll(void)
+{
+  uint32_t now = HAL_GetTick();
+
+  // 发送 FIFO 满时积压的明文，刷新完成后清除标志
+  if (stream_mode == STREAM_LZ) {
+    LZ_Compress(&stream_lz, &stream_plain_fifo, &usart1_tx_fifo, stream_lz_flush);
+    if (!stream_lz.dirty) {
+      stream_lz_flush = 0;
+    }
+  }
+
+  // 控制台占用链路期间积压的记录
+  TLM_Kick(&telemetry);
+
+  if (stream_mode == STREAM_OFF || now - stream_last_ms < STREAM_PERIOD_MS) {
+    return;
+  }
+  stream_last_ms = now;
+  Telemetry_Record(now);
+}
+
+// 控制台输出函数（阻塞发送）
+static void Console_Write(void* user, const char* data, uint16_t length)
+{
+  UART_HandleTypeDef* huart = (UART_HandleTypeDef*)user;
+
+  while (usart1_tx_busy != 0) {
+    __NOP();
+  }
+  usart1_tx_busy = 1;
+  HAL_UART_Transmit(huart, (uint8_t*)data, length, HAL_MAX_DELAY);
+  usart1_tx_busy = 0;
+}
+
+// 取出时间戳记录，保留最近一段数据的到达时刻和长度
+static void Rx_Timestamp_Poll(void)
+{
+  USART_Rx_Timestamp ts;
+
+  while (USART_Rx_DMA_GetTimestamp(&USART1_DMA_Context, &ts)) {
+    usart1_rx_ts_length = (uint16_t)(ts.end - usart1_rx_ts_last.end);
+    usart1_rx_ts_last = ts;
+    if (ts.event == USART_TS_IDLE) {
+      rx_log_idle = 1;
+    }
+  }
+}
+
+// 主循环中调用：暂存的接收数据逐段追加到 Flash 日志，一段突发结束 (IDLE) 后落盘
+static void Rx_Log_Poll(void)
+{
+  uint8_t header[2];
+  uint16_t length;
+
+  while (app_drv_fifo_length(&rx_log_fifo) >= sizeof(header)) {
+    // 长度前缀与数据在同一次中断中写入，读到前缀时数据已完整
+    length = sizeof(header);
+    app_drv_fifo_read(&rx_log_fifo, header, &length);
+    length = (uint16_t)(header[0] | (header[1] << 8));
+    app_drv_fifo_read(&rx_log_fifo, rx_log_record, &length);
+    FLASH_Log_Append(&flash_log, rx_log_record, length);
+  }
+  if (rx_log_idle) {
+    rx_log_idle = 0;
+    FLASH_Log_Flush(&flash_log);
+  }
+}
+
+static void Cmd_Stats(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  uint32_t received, dropped, overflow;
+
+  USART_GetStatistics(&USART1_DMA_Context, &received, &dropped, &overflow);
+  CONSOLE_Printf(ctx, "usart1 rx %lu dropped %lu overflow %lu, rts stops %lu%s\r\n",
+                 (unsigned long)received, (unsigned long)dropped, (unsigned long)overflow,
+                 (unsigned long)USART1_DMA_Context.flow_stop_count,
+                 USART1_DMA_Context.flow_stopped ? " (stopped)" : "");
+  if (usart1_rx_ts_length != 0U) {
+    static const char* const events[] = { "idle", "ht", "tc", "other" };
+
+    CONSOLE_Printf(ctx, "last rx %u bytes at %lu us (%s), timestamps dropped %lu\r\n",
+                   (unsigned)usart1_rx_ts_length,
+                   (unsigned long)(usart1_rx_ts_last.time / (HAL_RCC_GetPCLK1Freq() / 1000000U)),
+                   events[usart1_rx_ts_last.event & 3U], (unsigned long)USART1_DMA_Context.ts_dropped);
+  }
+  CONSOLE_Printf(ctx, "console lines %lu unknown %lu too long %lu\r\n",
+                 (unsigned long)ctx->line_count, (unsigned long)ctx->unknown_count,
+                 (unsigned long)ctx->overflow_count);
+}
+
+static void Cmd_Clear(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  USART_ResetStatistics(&USART1_DMA_Context);
+  IRQ_ResetStats(&irq_monitor);
+  ctx->dispatch_cycles_max = 0;
+  CONSOLE_Puts(ctx, "statistics cleared\r\n");
+}
+
+// 负载发生器：TIM7 (1 MHz 计数) 每 1/hz 秒中断一次，忙等 us 微秒并探测一个向量
+static void Isr_Load(CONSOLE_Context* ctx, uint8_t argc, char* argv[], uint32_t mhz)
+{
+  uint32_t hz, us, prio;
+
+  if (argc > 2 && strcmp(argv[2], "off") == 0) {
+    HAL_TIM_Base_Stop_IT(&htim7);
+    IRQ_SetLoad(&irq_monitor, TIM7_IRQn, 0);
+    return;
+  }
+  hz = (argc > 2) ? strtoul(argv[2], NULL, 10) : 0U;
+  us = (argc > 3) ? strtoul(argv[3], NULL, 10) : 0U;
+  prio = (argc > 4) ? strtoul(argv[4], NULL, 10) : IRQ_GetPriority(TIM7_IRQn);
+  if (hz == 0U || hz > 100000U || us == 0U || us >= 1000000U / hz || prio > 15U) {
+    CONSOLE_Puts(ctx, "usage: isr load <hz> <us> [prio] | isr load off\r\n");
+    return;
+  }
+
+  HAL_TIM_Base_Stop_IT(&htim7);
+  HAL_NVIC_SetPriority(TIM7_IRQn, prio, 0);
+  IRQ_SetLoad(&irq_monitor, TIM7_IRQn, us * mhz);
+  __HAL_TIM_SET_AUTORELOAD(&htim7, 1000000U / hz - 1U);
+  __HAL_TIM_SET_COUNTER(&htim7, 0);
+  HAL_TIM_Base_Start_IT(&htim7);
+}
+
+static void Cmd_Isr(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  uint32_t count, last, max;
+  uint32_t mhz = HAL_RCC_GetHCLKFreq() / 1000000U;
+
+  if (mhz == 0U) {
+    mhz = 1U;
+  }
+  if (argc > 1 && strcmp(argv[1], "load") == 0) {
+    Isr_Load(ctx, argc, argv, mhz);
+    return;
+  }
+  USART_GetIsrTiming(&USART1_DMA_Context, &count, &last, &max);
+  CONSOLE_Printf(ctx, "usart1 isr %lu calls, last %lu cyc, max %lu cyc (%lu us)\r\n",
+                 (unsigned long)count, (unsigned long)last, (unsigned long)max,
+                 (unsigned long)(max / mhz));
+  CONSOLE_Printf(ctx, "console dispatch last %lu cyc, max %lu cyc\r\n",
+                 (unsigned long)ctx->dispatch_cycles_last, (unsigned long)ctx->dispatch_cycles_max);
+
+  // 各向量：优先级、进入次数、最长执行时间、探测到的最长响应延迟
+  CONSOLE_Printf(ctx, "load %lu cyc, %lu ticks\r\n",
+                 (unsigned long)irq_monitor.load_cycles, (unsigned long)irq_monitor.load_count);
+  for (uint8_t i = 0; i < irq_monitor.count; i++) {
+    const IRQ_Vector_Stats* s = &irq_monitor.stats[i];
+
+    CONSOLE_Printf(ctx, "%-10s p%u %8lu calls, exec max %6lu cyc, latency max %6lu cyc (%lu probes)\r\n",
+                   irq_monitor.config[i].name, (unsigned)IRQ_GetPriority(irq_monitor.config[i].irqn),
+                   (unsigned long)s->count, (unsigned long)s->duration_max,
+                   (unsigned long)s->latency_max, (unsigned long)s->probe_count);
+  }
+}
+
+static void Cmd_Pools(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  extern uint32_t _sdata, _ebss, _estack;
+  uint32_t sp = __get_MSP();
+
+  CONSOLE_Printf(ctx, "usart1 rx fifo %u / %u\r\n",
+                 app_drv_fifo_length(&usart1_rx_fifo), usart1_rx_fifo.size);
+  CONSOLE_Printf(ctx, "usart1 dma buffer %u\r\n", (unsigned)USART_DMA_BUFFER_SIZE);
+  CONSOLE_Printf(ctx, "console tokens %u\r\n", (unsigned)CONSOLE_LINE_MAX);
+  CONSOLE_Printf(ctx, "ram static %lu, free %lu, stack %lu\r\n",
+                 (unsigned long)((uintptr_t)&_ebss - (uintptr_t)&_sdata),
+                 (unsigned long)(sp - (uintptr_t)&_ebss),
+                 (unsigned long)((uintptr_t)&_estack - sp));
+}
+
+static void Cmd_Temp(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  int32_t centi = ((int32_t)temperature_mean * 100) / ADC_PIPE_TEMP_LSB_PER_C;
+  int32_t whole = centi / 100;
+  int32_t frac = (centi < 0) ? -(centi % 100) : (centi % 100);
+
+  CONSOLE_Printf(ctx, "temperature %s%ld.%02ld C\r\n",
+                 (centi < 0 && whole == 0) ? "-" : "", (long)whole, (long)frac);
+  CONSOLE_Printf(ctx, "adc blocks %lu overrun %lu, convert last %lu cyc max %lu cyc / %u samples\r\n",
+                 (unsigned long)adc_pipe.block_count, (unsigned long)adc_pipe.overrun_count,
+                 (unsigned long)adc_pipe.convert_cycles_last, (unsigned long)adc_pipe.convert_cycles_max,
+                 (unsigned)ADC_PIPE_BLOCK_SIZE);
+}
+
+static void Cmd_Dfsdm(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  CONSOLE_Printf(ctx, "dfsdm rms %ld (%lu/10000 FS)\r\n",
+                 (long)dfsdm_rms, (unsigned long)(((uint64_t)dfsdm_rms * 10000U) >> 31));
+  CONSOLE_Printf(ctx, "dfsdm blocks %lu overrun %lu, filter last %lu cyc max %lu cyc / %u samples\r\n",
+                 (unsigned long)dfsdm_pipe.block_count, (unsigned long)dfsdm_pipe.overrun_count,
+                 (unsigned long)dfsdm_pipe.filter_cycles_last, (unsigned long)dfsdm_pipe.filter_cycles_max,
+                 (unsigned)DFSDM_PIPE_BLOCK_SIZE);
+}
+
+static void Cmd_Stream(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  if (argc > 1) {
+    if (strcmp(argv[1], "bin") == 0) {
+      stream_mode = STREAM_BINARY;
+    } else if (strcmp(argv[1], "text") == 0) {
+      stream_mode = STREAM_TEXT;
+    } else if (strcmp(argv[1], "lz") == 0) {
+      // 压缩流从头开始，接收端同时重新开始解压
+      app_drv_fifo_flush(&stream_plain_fifo);
+      LZ_EncoderInit(&stream_lz);
+      stream_lz_flush = 0;
+      stream_mode = STREAM_LZ;
+    } else if (strcmp(argv[1], "off") == 0) {
+      stream_mode = STREAM_OFF;
+    } else {
+      CONSOLE_Puts(ctx, "usage: stream [bin|text|lz|off]\r\n");
+      return;
+    }
+    // 重新开始计数，首条记录为关键帧
+    stream_seq = 0;
+    stream_bytes = 0;
+    stream_cycles_max = 0;
+    return;
+  }
+
+  CONSOLE_Printf(ctx, "stream %s, %lu records, %lu bytes, format last %lu cyc max %lu cyc\r\n",
+                 (stream_mode == STREAM_BINARY) ? "bin" : (stream_mode == STREAM_TEXT) ? "text" :
+                 (stream_mode == STREAM_LZ) ? "lz" : "off",
+                 (unsigned long)stream_seq, (unsigned long)stream_bytes,
+                 (unsigned long)stream_cycles_last, (unsigned long)stream_cycles_max);
+  CONSOLE_Printf(ctx, "tlm committed %lu dropped %lu sent %lu bytes\r\n",
+                 (unsigned long)telemetry.record_count, (unsigned long)telemetry.dropped_count,
+                 (unsigned long)telemetry.tx_bytes);
+  if (stream_mode == STREAM_LZ) {
+    CONSOLE_Printf(ctx, "lz in %lu bytes out %lu bytes\r\n",
+                   (unsigned long)stream_lz.in_bytes, (unsigned long)stream_lz.out_bytes);
+  }
+}
+
+// USART3 <-> LPUART1 双向桥接
+static BRIDGE_Context bridge_usart3_lpuart1;
+static BRIDGE_Context bridge_lpuart1_usart3;
+
+static void Bridge_Report(CONSOLE_Context* ctx, const char* name, BRIDGE_Context* bridge)
+{
+  CONSOLE_Printf(ctx, "%s: %lu bytes %lu spans, backlog max %u, throttled %lu, rx dropped %lu\r\n",
+                 name, (unsigned long)bridge->forwarded_bytes, (unsigned long)bridge->span_count,
+                 (unsigned)bridge->backlog_max, (unsigned long)bridge->throttled_count,
+                 (unsigned long)bridge->rx->total_dropped_bytes);
+}
+
+static void Cmd_Bridge(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  if (argc > 2 && strcmp(argv[1], "rate") == 0) {
+    uint32_t rate = strtoul(argv[2], NULL, 10);
+    uint32_t burst = (argc > 3) ? strtoul(argv[3], NULL, 10) : USART_DMA_BUFFER_SIZE / 4U;
+
+    BRIDGE_SetRate(&bridge_usart3_lpuart1, rate, burst);
+    BRIDGE_SetRate(&bridge_lpuart1_usart3, rate, burst);
+    return;
+  }
+  if (argc > 1) {
+    CONSOLE_Puts(ctx, "usage: bridge [rate <bytes/s> [burst]]\r\n");
+    return;
+  }
+
+  Bridge_Report(ctx, "usart3 -> lpuart1", &bridge_usart3_lpuart1);
+  Bridge_Report(ctx, "lpuart1 -> usart3", &bridge_lpuart1_usart3);
+  if (bridge_usart3_lpuart1.rate != 0U) {
+    CONSOLE_Printf(ctx, "rate %lu bytes/s burst %lu\r\n",
+                   (unsigned long)bridge_usart3_lpuart1.rate, (unsigned long)bridge_usart3_lpuart1.burst);
+  }
+}
+
+static void Cmd_Baudrate(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  HAL_StatusTypeDef status;
+  uint32_t baud;
+
+  if (argc < 2) {
+    CONSOLE_Printf(ctx, "usart1 %lu baud%s, autobaud errors %lu\r\n",
+                   (unsigned long)USART_Rx_DMA_GetBaudRate(&USART1_DMA_Context),
+                   (USART1_DMA_Context.autobaud == USART_AUTOBAUD_WAIT) ? " (detecting)" : "",
+                   (unsigned long)USART1_DMA_Context.autobaud_errors);
+    return;
+  }
+  if (strcmp(argv[1], "auto") == 0) {
+    // 应答以旧波特率发出后再开始检测，对端随后以新波特率发送 'U'
+    CONSOLE_Puts(ctx, "send 'U' at the new baud rate\r\n");
+    if (USART_Rx_DMA_StartAutoBaud(&USART1_DMA_Context, UART_ADVFEATURE_AUTOBAUDRATE_ON0X55FRAME) != HAL_OK) {
+      CONSOLE_Puts(ctx, "autobaud not supported\r\n");
+    }
+    return;
+  }
+
+  baud = strtoul(argv[1], NULL, 10);
+  CONSOLE_Printf(ctx, "switching to %lu baud\r\n", (unsigned long)baud);
+  // 占用发送链路，切换期间遥测不会启动 DMA 发送
+  while (usart1_tx_busy != 0) {
+    __NOP();
+  }
+  usart1_tx_busy = 1;
+  status = USART_Rx_DMA_SetBaudRate(&USART1_DMA_Context, baud);
+  usart1_tx_busy = 0;
+  if (status != HAL_OK) {
+    CONSOLE_Printf(ctx, "switch failed (%d), staying at %lu baud\r\n",
+                   (int)status, (unsigned long)huart1.Init.BaudRate);
+  }
+}
+
+// ARQ 批量传输：会话期间 USART1 接收数据全部交给 ARQ，控制台暂停解析
+#define ARQ_IDLE_TIMEOUT_MS  5000U   // 链路无数据超时，放弃会话
+#define ARQ_LINGER_MS        300U    // EOF 交付后继续应答重复帧的时间
+
+typedef enum {
+  ARQ_MODE_OFF = 0,
+  ARQ_MODE_RECV,    // 接收主机数据，计算 CRC32 后丢弃
+  ARQ_MODE_SEND,    // 发送测试数据
+} Arq_Mode;
+
+static ARQ_Context arq;
+static Arq_Mode arq_mode = ARQ_MODE_OFF;
+// USART1 有硬件 RTS 流控，窗口不受 DMA 接收环限制；无流控的串口用
+// ARQ_WINDOW_FOR(USART_DMA_BUFFER_SIZE + RX_FIFO_SIZE)
+static uint8_t arq_window = ARQ_WINDOW_MAX;
+static uint8_t arq_session;
+static uint32_t arq_total;              // 发送模式：总字节数
+static uint32_t arq_offset;             // 发送模式：已写入字节数
+static uint32_t arq_crc;                // 已收发数据的 CRC32（与 zlib 一致）
+static uint32_t arq_start_ms;
+static uint32_t arq_last_rx_ms;
+static uint32_t arq_elapsed_ms;
+
+// ARQ 发送函数：与遥测共用 USART1 发送 DMA
+static int Arq_Send(void* user, const uint8_t* data, uint16_t length)
+{
+  if (usart1_tx_busy != 0) {
+    return -1;
+  }
+  usart1_tx_busy = 1;
+  if (HAL_UART_Transmit_DMA((UART_HandleTypeDef*)user, (uint8_t*)data, length) != HAL_OK) {
+    usart1_tx_busy = 0;
+    return -1;
+  }
+  return 0;
+}
+
+// 按序交付：只累计 CRC，由主机比对
+static void Arq_Deliver(void* user, const uint8_t* data, uint16_t length)
+{
+  arq_crc = ARQ_Crc32(arq_crc, data, length);
+}
+
+// 测试数据：由偏移决定，写入被拒绝的部分下次可原样重新生成
+static uint16_t Arq_Pattern(uint8_t* data, uint16_t length)
+{
+  for (uint16_t i = 0; i < length; i++) {
+    uint32_t x = (arq_offset + i) * 0x9E3779B1U;
+
+    data[i] = (uint8_t)((x ^ (x >> 15)) >> 24);
+  }
+  return length;
+}
+
+static void Arq_Start(Arq_Mode mode, uint32_t total)
+{
+  uint32_t now = HAL_GetTick();
+
+  stream_mode = STREAM_OFF;
+  ARQ_Init(&arq, arq_window, Arq_Send, &huart1, Arq_Deliver, NULL);
+  arq_total = total;
+  arq_offset = 0;
+  arq_crc = 0;
+  arq_start_ms = now;
+  arq_last_rx_ms = now;
+  arq_mode = mode;
+  if (mode == ARQ_MODE_SEND) {
+    ARQ_Open(&arq, ++arq_session, now);
+  }
+}
+
+// 主循环中调用：接收数据交给 ARQ，发送模式下填满窗口，会话结束后恢复控制台
+static void Arq_Process(void)
+{
+  uint8_t buffer[64];
+  uint16_t length = sizeof(buffer);
+  uint32_t now = HAL_GetTick();
+  uint8_t finished;
+
+  while (app_drv_fifo_read(&usart1_rx_fifo, buffer, &length) == APP_DRV_FIFO_RESULT_SUCCESS) {
+    ARQ_Input(&arq, buffer, length, now);
+    arq_last_rx_ms = now;
+    length = sizeof(buffer);
+  }
+
+  if (arq_mode == ARQ_MODE_SEND) {
+    while (arq_offset < arq_total) {
+      uint32_t remain = arq_total - arq_offset;
+      uint16_t written;
+
+      length = Arq_Pattern(buffer, (remain < sizeof(buffer)) ? (uint16_t)remain : (uint16_t)sizeof(buffer));
+      written = ARQ_Write(&arq, buffer, length);
+      arq_crc = ARQ_Crc32(arq_crc, buffer, written);
+      arq_offset += written;
+      if (written < length) {
+        break;
+      }
+    }
+    if (arq_offset == arq_total) {
+      ARQ_Close(&arq);
+    }
+  }
+  ARQ_Poll(&arq, now);
+
+  if (arq_mode == ARQ_MODE_SEND) {
+    finished = (arq.tx_state == ARQ_TX_DONE || arq.tx_state == ARQ_TX_FAILED);
+  } else {
+    finished = arq.rx_eof && now - arq_last_rx_ms >= ARQ_LINGER_MS;
+  }
+  if (!finished && now - arq_last_rx_ms < ARQ_IDLE_TIMEOUT_MS) {
+    return;
+  }
+
+  arq_elapsed_ms = now - arq_start_ms;
+  arq_mode = ARQ_MODE_OFF;
+  CONSOLE_Printf(&console, "\r\narq %s %lu bytes crc %08lx in %lu ms\r\n",
+                 (arq.tx_state == ARQ_TX_DONE || arq.rx_eof) ? "done" : "aborted",
+                 (unsigned long)((arq.tx_state != ARQ_TX_IDLE) ? arq.tx_bytes : arq.rx_bytes),
+                 (unsigned long)arq_crc, (unsigned long)arq_elapsed_ms);
+}
+
+static void Cmd_Arq(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  uint32_t bytes;
+
+  if (argc > 1 && strcmp(argv[1], "recv") == 0) {
+    Arq_Start(ARQ_MODE_RECV, 0);
+    return;
+  }
+  if (argc > 2 && strcmp(argv[1], "send") == 0) {
+    Arq_Start(ARQ_MODE_SEND, strtoul(argv[2], NULL, 10));
+    return;
+  }
+  if (argc > 2 && strcmp(argv[1], "window") == 0) {
+    arq_window = (uint8_t)strtoul(argv[2], NULL, 10);
+    if (arq_window == 0U || arq_window > ARQ_WINDOW_MAX) {
+      arq_window = ARQ_WINDOW_MAX;
+    }
+    return;
+  }
+  if (argc > 1) {
+    CONSOLE_Puts(ctx, "usage: arq [recv|send <bytes>|window <blocks>]\r\n");
+    return;
+  }
+
+  bytes = (arq.tx_state != ARQ_TX_IDLE) ? arq.tx_bytes : arq.rx_bytes;
+  CONSOLE_Printf(ctx, "arq window %u/%u blocks of %u, last %lu bytes in %lu ms (%lu B/s)\r\n",
+                 (unsigned)arq_window, (unsigned)ARQ_WINDOW_MAX, (unsigned)ARQ_BLOCK_SIZE,
+                 (unsigned long)bytes, (unsigned long)arq_elapsed_ms,
+                 (unsigned long)((arq_elapsed_ms != 0U) ? (uint64_t)bytes * 1000U / arq_elapsed_ms : 0U));
+  CONSOLE_Printf(ctx, "frames %lu, sack retx %lu, timeout %lu, crc error %lu, duplicate %lu, rto %lu ms\r\n",
+                 (unsigned long)arq.tx_frames, (unsigned long)arq.retransmit_count,
+                 (unsigned long)arq.timeout_count, (unsigned long)arq.crc_error_count,
+                 (unsigned long)arq.duplicate_count, (unsigned long)arq.rto);
+}
+
+// 固件升级：会话期间 USART1 接收数据全部交给升级协议，控制台暂停解析，Flash 日志暂停记录
+// （日志区在目标 Bank 末尾，START 批量擦除后由升级驱动重新格式化）
+#define FW_IDLE_TIMEOUT_MS  10000U  // 链路无数据超时，放弃升级
+
+static FW_Update_Context fw_update;
+static uint8_t fw_active;
+static uint8_t fw_log_enabled;          // 升级前的日志记录状态，放弃升级时恢复
+static uint32_t fw_rx_bytes;
+static uint32_t fw_last_rx_ms;
+
+// 升级应答（阻塞发送）：返回时应答已发送完毕，FINISH 应答之后即可切换 Bank 复位
+static int Fw_Send(void* user, const uint8_t* data, uint16_t length)
+{
+  HAL_StatusTypeDef status;
+
+  while (usart1_tx_busy != 0) {
+    __NOP();
+  }
+  usart1_tx_busy = 1;
+  status = HAL_UART_Transmit((UART_HandleTypeDef*)user, (uint8_t*)data, length, HAL_MAX_DELAY);
+  usart1_tx_busy = 0;
+  return (status == HAL_OK) ? 0 : -1;
+}
+
+// 主循环中调用：接收数据交给升级协议，校验通过后切换 Bank，超时放弃并恢复控制台
+static void Fw_Process(void)
+{
+  uint32_t received, dropped, overflow;
+  uint32_t now = HAL_GetTick();
+
+  if (FW_Update_Process(&fw_update, &usart1_rx_fifo) == FW_UPDATE_STATE_READY_TO_SWAP) {
+    // 成功时复位，不返回
+    FW_Update_SwapBank(&fw_update);
+    CONSOLE_Puts(&console, "\r\nfw bank swap failed\r\n");
+  } else {
+    USART_GetStatistics(&USART1_DMA_Context, &received, &dropped, &overflow);
+    if (received != fw_rx_bytes) {
+      fw_rx_bytes = received;
+      fw_last_rx_ms = now;
+    }
+    if (now - fw_last_rx_ms < FW_IDLE_TIMEOUT_MS) {
+      return;
+    }
+    CONSOLE_Printf(&console, "\r\nfw update aborted at %lu / %lu bytes, frame errors %lu, retransmits %lu\r\n",
+                   (unsigned long)fw_update.next_offset, (unsigned long)fw_update.image_size,
+                   (unsigned long)fw_update.frame_error_count, (unsigned long)fw_update.retransmit_count);
+  }
+
+  fw_active = 0;
+  rx_log_enabled = fw_log_enabled;
+}
+
+static void Cmd_Fw(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  uint32_t dropped, overflow;
+
+  if (argc > 1) {
+    CONSOLE_Puts(ctx, "usage: fw\r\n");
+    return;
+  }
+
+  // 日志与升级共用 Flash 控制器：先停止记录并把暂存数据落盘
+  fw_log_enabled = rx_log_enabled;
+  rx_log_enabled = 0;
+  Rx_Log_Poll();
+  FLASH_Log_Flush(&flash_log);
+
+  stream_mode = STREAM_OFF;
+  FW_Update_Init(&fw_update, &hcrc, &flash_log, Fw_Send, &huart1);
+  USART_GetStatistics(&USART1_DMA_Context, &fw_rx_bytes, &dropped, &overflow);
+  fw_last_rx_ms = HAL_GetTick();
+  fw_active = 1;
+  CONSOLE_Printf(ctx, "fw update: send image, max %lu bytes\r\n", (unsigned long)FW_UPDATE_IMAGE_MAX);
+}
+
+#ifdef DSP_BENCH
+static uint32_t Bench_Cycles(void)
+{
+  return DWT->CYCCNT;
+}
+
+static void Bench_Print(void* user, const char* line)
+{
+  CONSOLE_Puts((CONSOLE_Context*)user, line);
+  CONSOLE_Puts((CONSOLE_Context*)user, "\r\n");
+}
+
+// CMSIS-DSP 基准，CSV 逐行输出；运行期间主循环暂停（每个测点 50 ms）
+static void Cmd_Bench(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  dsp_bench_config cfg = {
+    .cycles = Bench_Cycles,
+    .cycle_hz = SystemCoreClock,
+    .min_cycles = SystemCoreClock / 20U,
+    .print = Bench_Print,
+    .user = ctx,
+    .filter = (argc > 1) ? argv[1] : NULL,
+  };
+
+  CONSOLE_Printf(ctx, "%lu points\r\n", (unsigned long)dsp_bench_run(&cfg));
+}
+
+#define CONSOLE_BENCH_COMMAND(X) \
+  X("bench",  5, 'b', 'h', Cmd_Bench,       "CMSIS-DSP benchmark CSV [filter]")
+#else
+#define CONSOLE_BENCH_COMMAND(X)
+#endif
+
+// 从读指针开始以十六进制输出 count 条记录，再次执行继续向后输出
+static void Log_Dump(CONSOLE_Context* ctx, uint32_t count)
+{
+  static const char hex[] = "0123456789abcdef";
+  char line[2U * 32U + 3U];
+  FLASH_Log_Result result;
+  uint16_t length;
+
+  // 暂存行中的数据不可读，先落盘
+  FLASH_Log_Flush(&flash_log);
+  while (count-- > 0U) {
+    length = sizeof(rx_log_record);
+    result = FLASH_Log_Read(&flash_log, rx_log_record, &length);
+    if (result == FLASH_LOG_EMPTY) {
+      CONSOLE_Puts(ctx, "end of log\r\n");
+      return;
+    }
+    if (result == FLASH_LOG_PARAM_ERROR) {
+      CONSOLE_Printf(ctx, "record of %u bytes too long, log rewind to restart\r\n", (unsigned)length);
+      return;
+    }
+    CONSOLE_Printf(ctx, "%u bytes%s\r\n", (unsigned)length, (result == FLASH_LOG_CRC_ERROR) ? " (crc error)" : "");
+    for (uint16_t i = 0; i < length; i += 32U) {
+      uint16_t n = (length - i < 32U) ? (uint16_t)(length - i) : 32U;
+      uint16_t pos = 0;
+
+      for (uint16_t j = 0; j < n; j++) {
+        line[pos++] = hex[rx_log_record[i + j] >> 4];
+        line[pos++] = hex[rx_log_record[i + j] & 0x0FU];
+      }
+      line[pos++] = '\r';
+      line[pos++] = '\n';
+      line[pos] = '\0';
+      CONSOLE_Puts(ctx, line);
+    }
+  }
+}
+
+static void Cmd_Log(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  if (argc > 1) {
+    if (strcmp(argv[1], "dump") == 0) {
+      Log_Dump(ctx, (argc > 2) ? strtoul(argv[2], NULL, 10) : 16U);
+    } else if (strcmp(argv[1], "rewind") == 0) {
+      FLASH_Log_Rewind(&flash_log);
+    } else if (strcmp(argv[1], "on") == 0) {
+      rx_log_enabled = 1;
+    } else if (strcmp(argv[1], "off") == 0) {
+      rx_log_enabled = 0;
+    } else if (strcmp(argv[1], "format") == 0) {
+      uint8_t enabled = rx_log_enabled;
+
+      // 暂停记录，清空暂存 FIFO 时中断不再写入
+      rx_log_enabled = 0;
+      app_drv_fifo_flush(&rx_log_fifo);
+      if (FLASH_Log_Format(&flash_log) != FLASH_LOG_OK) {
+        CONSOLE_Puts(ctx, "format failed\r\n");
+      }
+      rx_log_enabled = enabled;
+    } else {
+      CONSOLE_Puts(ctx, "usage: log [on|off|dump [records]|rewind|format]\r\n");
+    }
+    return;
+  }
+
+  CONSOLE_Printf(ctx, "log %s, %lu bytes written, page %u seq %lu offset %u, oldest page %u\r\n",
+                 rx_log_enabled ? "on" : "off", (unsigned long)flash_log.total_written_bytes,
+                 (unsigned)flash_log.head_page, (unsigned long)flash_log.head_seq,
+                 (unsigned)flash_log.head_offset, (unsigned)flash_log.tail_page);
+  CONSOLE_Printf(ctx, "erases %lu, overwritten pages %lu, crc errors %lu, staging dropped %lu bytes\r\n",
+                 (unsigned long)flash_log.erase_count, (unsigned long)flash_log.dropped_pages,
+                 (unsigned long)flash_log.crc_error_count, (unsigned long)rx_log_dropped);
+}
+
+static void Cmd_Reboot(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+  CONSOLE_Puts(ctx, "rebooting\r\n");
+  NVIC_SystemReset();
+}
+
+// 命令列表：名称, 长度, 首字符, 尾字符, 处理函数, 说明
+#define CONSOLE_COMMANDS(X) \
+  X("help",   4, 'h', 'p', CONSOLE_CmdHelp, "list commands") \
+  X("stats",  5, 's', 's', Cmd_Stats,       "receive statistics") \
+  X("clear",  5, 'c', 'r', Cmd_Clear,       "reset statistics") \
+  X("isr",    3, 'i', 'r', Cmd_Isr,         "interrupt timing [load <hz> <us> [prio]|load off]") \
+  X("pools",  5, 'p', 's', Cmd_Pools,       "buffer and RAM usage") \
+  X("temp",   4, 't', 'p', Cmd_Temp,        "internal temperature") \
+  X("dfsdm",  5, 'd', 'm', Cmd_Dfsdm,       "sigma-delta input level") \
+  X("stream", 6, 's', 'm', Cmd_Stream,      "telemetry stream [bin|text|lz|off]") \
+  X("bridge", 6, 'b', 'e', Cmd_Bridge,      "uart bridge [rate <bytes/s> [burst]]") \
+  X("baudrate", 8, 'b', 'e', Cmd_Baudrate, "usart1 baud rate [<rate>|auto]") \
+  X("arq",    3, 'a', 'q', Cmd_Arq,         "bulk transfer [recv|send <bytes>|window <blocks>]") \
+  X("fw",     2, 'f', 'w', Cmd_Fw,          "firmware update over usart1") \
+  X("log",    3, 'l', 'g', Cmd_Log,         "flash rx log [on|off|dump [records]|rewind|format]") \
+  CONSOLE_BENCH_COMMAND(X) \
+  X("reboot", 6, 'r', 't', Cmd_Reboot,      "system reset")
+
+#define CONSOLE_TABLE_ENTRY(name, len, first, last, handler, help) \
+  [CONSOLE_HASH(len, first, last)] = { name, handler, help },
+#define CONSOLE_CASE_ENTRY(name, len, first, last, handler, help) \
+  case CONSOLE_HASH(len, first, last):
+
+// 按哈希槽位放置的命令表
+static const CONSOLE_Command console_commands[CONSOLE_HASH_SIZE] = {
+  CONSOLE_COMMANDS(CONSOLE_TABLE_ENTRY)
+};
+
+// 槽位冲突时产生 duplicate case value 编译错误，无需运行
+static inline void Console_CheckSlots(uint32_t slot)
+{
+  switch (slot) {
+  CONSOLE_COMMANDS(CONSOLE_CASE_ENTRY)
+  default:
+    break;
+  }
+}
+
 /* USER CODE END 0 */
 
 /**
@@ -151,21 +1042,79 @@ int main(void)
   MX_GPIO_Init();
   MX_DMA_Init();
   MX_USART1_UART_Init();
+  MX_CRC_Init();
+  MX_ADC1_Init();
+  MX_TIM6_Init();
+  MX_DFSDM1_Init();
+  MX_USART3_UART_Init();
+  MX_LPUART1_UART_Init();
+  MX_TIM2_Init();
+  MX_TIM7_Init();
   /* USER CODE BEGIN 2 */
+
+  // 统一设置中断优先级（覆盖各 MX_xxx_Init 中的 0/0）
+  IRQ_ApplyPriorities(&irq_monitor, irq_config, (uint8_t)(sizeof(irq_config) / sizeof(irq_config[0])));
   
   // 初始化用户自定义的 FIFO 队列
   app_drv_fifo_init(&usart1_rx_fifo, usart1_rx_fifo_buffer, RX_FIFO_SIZE);
+
+  // 恢复 Flash 日志头尾指针（链接脚本 FLASH_LOG 区域），之后 USART1 接收数据逐段记录
+  app_drv_fifo_init(&rx_log_fifo, rx_log_fifo_buffer, RX_LOG_FIFO_SIZE);
+  if (FLASH_Log_Init(&flash_log, FLASH_LOG_START_ADDR, FLASH_LOG_PAGE_COUNT, NULL) == FLASH_LOG_OK) {
+    rx_log_enabled = 1;
+  } else {
+    printf("flash log init failed\r\n");
+  }
   
   // 初始化 USART DMA IDLE 接收
   USART_Rx_DMA_Init(&USART1_DMA_Context, &huart1, &hdma_usart1_rx);
   
   // 设置用户队列指针
   
-  // 注册用户自定义队列指针和操作函数
-  USART_RegisterQueueOps(&USART1_DMA_Context, &usart1_rx_fifo, USART_Queue_Write, USART_Queue_Available);
+  // 注册用户自定义队列指针和操作函数（USART1 同时把接收数据交给 Flash 日志）
+  USART_RegisterQueueOps(&USART1_DMA_Context, &usart1_rx_fifo, Usart1_Queue_Write, USART_Queue_Available);
+
+  // FIFO 剩余不足 1/4 时撤销 RTS (PA12)，主循环取走数据后剩余超过 1/2 再恢复；
+  // 硬件 RTS 要求对端在当前字符结束时停止，对端带发送 FIFO 时改用 USART_FLOW_RTS_GPIO
+  USART_Rx_DMA_EnableFlowControl(&USART1_DMA_Context, USART_FLOW_RTS_HW, RX_FIFO_SIZE / 4, RX_FIFO_SIZE / 2);
+
+  // 每次 IDLE/HT/TC 中断锁存 TIM2 计数，记录每段数据的到达时刻
+  HAL_TIM_Base_Start(&htim2);
+  USART_Rx_DMA_EnableTimestamp(&USART1_DMA_Context, &htim2.Instance->CNT, usart1_rx_ts, RX_TS_QUEUE_SIZE);
   
   printf("USART DMA IDLE Reception initialized\r\n");
 
+  // 启动内部温度传感器采样（TIM6 1 kHz 触发，16 倍过采样）
+  ADC_Pipe_Init(&adc_pipe, &hadc1, &htim6);
+  ADC_Pipe_RegisterBlockCallback(&adc_pipe, Temperature_Block, NULL);
+  if (ADC_Pipe_Start(&adc_pipe) != HAL_OK) {
+    printf("ADC pipeline start failed\r\n");
+  }
+
+  // 启动 DFSDM 输入（PE9 输出 1 MHz 位流时钟，PE7 输入数据）
+  DFSDM_Pipe_Init(&dfsdm_pipe, &hdfsdm1_filter2);
+  DFSDM_Pipe_RegisterBlockCallback(&dfsdm_pipe, Dfsdm_Block, NULL);
+  if (DFSDM_Pipe_Start(&dfsdm_pipe) != HAL_OK) {
+    printf("DFSDM pipeline start failed\r\n");
+  }
+
+  // 遥测发送 FIFO，由 "stream bin" 命令开启
+  app_drv_fifo_init(&usart1_tx_fifo, usart1_tx_fifo_buffer, TX_FIFO_SIZE);
+  TLM_Init(&telemetry, &usart1_tx_fifo, Telemetry_Send, &huart1);
+  app_drv_fifo_init(&stream_plain_fifo, stream_plain_buffer, sizeof(stream_plain_buffer));
+  TLM_Init(&telemetry_plain, &stream_plain_fifo, NULL, NULL);
+
+  // USART3 与 LPUART1 互相转发，接收 DMA 缓冲区直接作为对方的发送源
+  USART_Rx_DMA_Init(&USART3_DMA_Context, &huart3, &hdma_usart3_rx);
+  USART_Rx_DMA_Init(&LPUART1_DMA_Context, &hlpuart1, &hdma_lpuart_rx);
+  BRIDGE_Init(&bridge_usart3_lpuart1, &USART3_DMA_Context, &hlpuart1);
+  BRIDGE_Init(&bridge_lpuart1_usart3, &LPUART1_DMA_Context, &huart3);
+
+  // 初始化控制台（同时使能 DWT 周期计数器，用于中断耗时统计）
+  if (CONSOLE_Init(&console, console_commands, Console_Write, &huart1) != 0) {
+    printf("console command table mismatch\r\n");
+  }
+
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -175,19 +1124,23 @@ int main(void)
     /* USER CODE END WHILE */
 
 /* USER CODE BEGIN 3 */
-    // 检查 USART1 FIFO 中是否有数据
-    uint16_t usart1_len = app_drv_fifo_length(&usart1_rx_fifo);
-    if (usart1_len > 0 && usart1_tx_busy == 0) {
-        static uint8_t temp_buf[128];
-        uint16_t read_len = (usart1_len > sizeof(temp_buf)) ? sizeof(temp_buf) : usart1_len;
-        uint16_t actual_read = read_len;
-        app_drv_fifo_result_t result = app_drv_fifo_read(&usart1_rx_fifo, temp_buf, &actual_read);
-        if (result == APP_DRV_FIFO_RESULT_SUCCESS && actual_read > 0) {
-            // 将接收到的数据回显到 USART1
-            usart1_tx_busy = 1;
-            HAL_UART_Transmit_DMA(&huart1, temp_buf, actual_read);
-        }
+    // 控制台直接从 USART1 FIFO 解析命令，ARQ 会话或固件升级期间数据交给对应协议
+    if (fw_active) {
+      Fw_Process();
+    } else if (arq_mode != ARQ_MODE_OFF) {
+      Arq_Process();
+    } else {
+      CONSOLE_Process(&console, &usart1_rx_fifo);
+    }
+    USART_Rx_DMA_FlowPoll(&USART1_DMA_Context);
+    Rx_Timestamp_Poll();
+    // 升级期间不写日志（见 app_drv_fw_update.h）
+    if (!fw_active) {
+      Rx_Log_Poll();
     }
+    Telemetry_Poll();
+    BRIDGE_Poll(&bridge_usart3_lpuart1);
+    BRIDGE_Poll(&bridge_lpuart1_usart3);
   }
   /* USER CODE END 3 */
 }
@@ -249,6 +1202,53 @@ void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
 {
   if (huart->Instance == USART1) {
     usart1_tx_busy = 0;
+    TLM_TxComplete(&telemetry);
+    ARQ_TxComplete(&arq);
+  } else if (huart->Instance == LPUART1) {
+    BRIDGE_TxComplete(&bridge_usart3_lpuart1);
+  } else if (huart->Instance == USART3) {
+    BRIDGE_TxComplete(&bridge_lpuart1_usart3);
+  }
+}
+
+// Flash 中断编程完成/出错回调函数（固件升级流水线）
+void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
+{
+  FW_Update_FlashCallback(&fw_update, 1);
+}
+
+void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue)
+{
+  FW_Update_FlashCallback(&fw_update, 0);
+}
+
+// ADC DMA 半传输/传输完成回调函数
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+  if (hadc->Instance == ADC1) {
+    ADC_Pipe_HalfComplete(&adc_pipe);
+  }
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+  if (hadc->Instance == ADC1) {
+    ADC_Pipe_Complete(&adc_pipe);
+  }
+}
+
+// DFSDM DMA 半传输/传输完成回调函数
+void HAL_DFSDM_FilterRegConvHalfCpltCallback(DFSDM_Filter_HandleTypeDef *hdfsdm_filter)
+{
+  if (hdfsdm_filter->Instance == DFSDM1_Filter2) {
+    DFSDM_Pipe_HalfComplete(&dfsdm_pipe);
+  }
+}
+
+void HAL_DFSDM_FilterRegConvCpltCallback(DFSDM_Filter_HandleTypeDef *hdfsdm_filter)
+{
+  if (hdfsdm_filter->Instance == DFSDM1_Filter2) {
+    DFSDM_Pipe_Complete(&dfsdm_pipe);
   }
 }
 
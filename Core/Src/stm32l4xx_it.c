@@ -23,6 +23,7 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "app_drv_serial_rx.h"
+#include "app_drv_irq.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -56,10 +57,20 @@
 /* USER CODE END 0 */
 
 /* External variables --------------------------------------------------------*/
+extern DMA_HandleTypeDef hdma_adc1;
+extern DMA_HandleTypeDef hdma_dfsdm1_flt2;
+extern DMA_HandleTypeDef hdma_lpuart_rx;
+extern DMA_HandleTypeDef hdma_lpuart_tx;
 extern DMA_HandleTypeDef hdma_usart1_rx;
 extern DMA_HandleTypeDef hdma_usart1_tx;
+extern DMA_HandleTypeDef hdma_usart3_rx;
+extern DMA_HandleTypeDef hdma_usart3_tx;
+extern TIM_HandleTypeDef htim7;
+extern UART_HandleTypeDef hlpuart1;
 extern UART_HandleTypeDef huart1;
+extern UART_HandleTypeDef huart3;
 /* USER CODE BEGIN EV */
+extern IRQ_Monitor irq_monitor;
 
 /* USER CODE END EV */
 
@@ -201,17 +212,75 @@ void SysTick_Handler(void)
 /* please refer to the startup file (startup_stm32l4xx.s).                    */
 /******************************************************************************/
 
+/**
+  * @brief This function handles Flash global interrupt.
+  */
+void FLASH_IRQHandler(void)
+{
+  /* USER CODE BEGIN FLASH_IRQn 0 */
+  IRQ_PROFILE_ENTER(&irq_monitor, FLASH_IRQn);
+  /* USER CODE END FLASH_IRQn 0 */
+  HAL_FLASH_IRQHandler();
+  /* USER CODE BEGIN FLASH_IRQn 1 */
+  IRQ_PROFILE_EXIT(&irq_monitor, FLASH_IRQn);
+  /* USER CODE END FLASH_IRQn 1 */
+}
+
+/**
+  * @brief This function handles DMA1 channel1 global interrupt.
+  */
+void DMA1_Channel1_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA1_Channel1_IRQn 0 */
+  IRQ_PROFILE_ENTER(&irq_monitor, DMA1_Channel1_IRQn);
+  /* USER CODE END DMA1_Channel1_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_adc1);
+  /* USER CODE BEGIN DMA1_Channel1_IRQn 1 */
+  IRQ_PROFILE_EXIT(&irq_monitor, DMA1_Channel1_IRQn);
+  /* USER CODE END DMA1_Channel1_IRQn 1 */
+}
+
+/**
+  * @brief This function handles DMA1 channel2 global interrupt.
+  */
+void DMA1_Channel2_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA1_Channel2_IRQn 0 */
+  IRQ_PROFILE_ENTER(&irq_monitor, DMA1_Channel2_IRQn);
+  /* USER CODE END DMA1_Channel2_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_usart3_tx);
+  /* USER CODE BEGIN DMA1_Channel2_IRQn 1 */
+  IRQ_PROFILE_EXIT(&irq_monitor, DMA1_Channel2_IRQn);
+  /* USER CODE END DMA1_Channel2_IRQn 1 */
+}
+
+/**
+  * @brief This function handles DMA1 channel3 global interrupt.
+  */
+void DMA1_Channel3_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA1_Channel3_IRQn 0 */
+  IRQ_PROFILE_ENTER(&irq_monitor, DMA1_Channel3_IRQn);
+  extern USART_DMA_Context USART3_DMA_Context;
+  USART_Rx_DMA_IRQHandler_Process(&USART3_DMA_Context);
+  /* USER CODE END DMA1_Channel3_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_usart3_rx);
+  /* USER CODE BEGIN DMA1_Channel3_IRQn 1 */
+  IRQ_PROFILE_EXIT(&irq_monitor, DMA1_Channel3_IRQn);
+  /* USER CODE END DMA1_Channel3_IRQn 1 */
+}
+
 /**
   * @brief This function handles DMA1 channel4 global interrupt.
   */
 void DMA1_Channel4_IRQHandler(void)
 {
   /* USER CODE BEGIN DMA1_Channel4_IRQn 0 */
-
+  IRQ_PROFILE_ENTER(&irq_monitor, DMA1_Channel4_IRQn);
   /* USER CODE END DMA1_Channel4_IRQn 0 */
   HAL_DMA_IRQHandler(&hdma_usart1_tx);
   /* USER CODE BEGIN DMA1_Channel4_IRQn 1 */
-
+  IRQ_PROFILE_EXIT(&irq_monitor, DMA1_Channel4_IRQn);
   /* USER CODE END DMA1_Channel4_IRQn 1 */
 }
 
@@ -221,30 +290,123 @@ void DMA1_Channel4_IRQHandler(void)
 void DMA1_Channel5_IRQHandler(void)
 {
   /* USER CODE BEGIN DMA1_Channel5_IRQn 0 */
+  IRQ_PROFILE_ENTER(&irq_monitor, DMA1_Channel5_IRQn);
   extern USART_DMA_Context USART1_DMA_Context;
   USART_Rx_DMA_IRQHandler_Process(&USART1_DMA_Context);
   /* USER CODE END DMA1_Channel5_IRQn 0 */
   HAL_DMA_IRQHandler(&hdma_usart1_rx);
   /* USER CODE BEGIN DMA1_Channel5_IRQn 1 */
-
+  IRQ_PROFILE_EXIT(&irq_monitor, DMA1_Channel5_IRQn);
   /* USER CODE END DMA1_Channel5_IRQn 1 */
 }
 
+/**
+  * @brief This function handles DMA1 channel6 global interrupt.
+  */
+void DMA1_Channel6_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA1_Channel6_IRQn 0 */
+  IRQ_PROFILE_ENTER(&irq_monitor, DMA1_Channel6_IRQn);
+  /* USER CODE END DMA1_Channel6_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_dfsdm1_flt2);
+  /* USER CODE BEGIN DMA1_Channel6_IRQn 1 */
+  IRQ_PROFILE_EXIT(&irq_monitor, DMA1_Channel6_IRQn);
+  /* USER CODE END DMA1_Channel6_IRQn 1 */
+}
+
 /**
   * @brief This function handles USART1 global interrupt.
   */
 void USART1_IRQHandler(void)
 {
   /* USER CODE BEGIN USART1_IRQn 0 */
+  IRQ_PROFILE_ENTER(&irq_monitor, USART1_IRQn);
   extern USART_DMA_Context USART1_DMA_Context;
   USART_Rx_DMA_IRQHandler_Process(&USART1_DMA_Context);
   /* USER CODE END USART1_IRQn 0 */
   HAL_UART_IRQHandler(&huart1);
   /* USER CODE BEGIN USART1_IRQn 1 */
-
+  IRQ_PROFILE_EXIT(&irq_monitor, USART1_IRQn);
   /* USER CODE END USART1_IRQn 1 */
 }
 
+/**
+  * @brief This function handles USART3 global interrupt.
+  */
+void USART3_IRQHandler(void)
+{
+  /* USER CODE BEGIN USART3_IRQn 0 */
+  IRQ_PROFILE_ENTER(&irq_monitor, USART3_IRQn);
+  extern USART_DMA_Context USART3_DMA_Context;
+  USART_Rx_DMA_IRQHandler_Process(&USART3_DMA_Context);
+  /* USER CODE END USART3_IRQn 0 */
+  HAL_UART_IRQHandler(&huart3);
+  /* USER CODE BEGIN USART3_IRQn 1 */
+  IRQ_PROFILE_EXIT(&irq_monitor, USART3_IRQn);
+  /* USER CODE END USART3_IRQn 1 */
+}
+
+/**
+  * @brief This function handles TIM7 global interrupt.
+  */
+void TIM7_IRQHandler(void)
+{
+  /* USER CODE BEGIN TIM7_IRQn 0 */
+  IRQ_PROFILE_ENTER(&irq_monitor, TIM7_IRQn);
+  /* USER CODE END TIM7_IRQn 0 */
+  HAL_TIM_IRQHandler(&htim7);
+  /* USER CODE BEGIN TIM7_IRQn 1 */
+  IRQ_LoadTick(&irq_monitor);
+  IRQ_PROFILE_EXIT(&irq_monitor, TIM7_IRQn);
+  /* USER CODE END TIM7_IRQn 1 */
+}
+
+/**
+  * @brief This function handles DMA2 channel6 global interrupt.
+  */
+void DMA2_Channel6_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA2_Channel6_IRQn 0 */
+  IRQ_PROFILE_ENTER(&irq_monitor, DMA2_Channel6_IRQn);
+  /* USER CODE END DMA2_Channel6_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_lpuart_tx);
+  /* USER CODE BEGIN DMA2_Channel6_IRQn 1 */
+  IRQ_PROFILE_EXIT(&irq_monitor, DMA2_Channel6_IRQn);
+  /* USER CODE END DMA2_Channel6_IRQn 1 */
+}
+
+/**
+  * @brief This function handles DMA2 channel7 global interrupt.
+  */
+void DMA2_Channel7_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA2_Channel7_IRQn 0 */
+  IRQ_PROFILE_ENTER(&irq_monitor, DMA2_Channel7_IRQn);
+  extern USART_DMA_Context LPUART1_DMA_Context;
+  USART_Rx_DMA_IRQHandler_Process(&LPUART1_DMA_Context);
+  /* USER CODE END DMA2_Channel7_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_lpuart_rx);
+  /* USER CODE BEGIN DMA2_Channel7_IRQn 1 */
+  IRQ_PROFILE_EXIT(&irq_monitor, DMA2_Channel7_IRQn);
+  /* USER CODE END DMA2_Channel7_IRQn 1 */
+}
+
+/**
+  * @brief This function handles LPUART1 global interrupt.
+  */
+void LPUART1_IRQHandler(void)
+{
+  /* USER CODE BEGIN LPUART1_IRQn 0 */
+  IRQ_PROFILE_ENTER(&irq_monitor, LPUART1_IRQn);
+  extern USART_DMA_Context LPUART1_DMA_Context;
+  USART_Rx_DMA_IRQHandler_Process(&LPUART1_DMA_Context);
+  /* USER CODE END LPUART1_IRQn 0 */
+  HAL_UART_IRQHandler(&hlpuart1);
+  /* USER CODE BEGIN LPUART1_IRQn 1 */
+  IRQ_PROFILE_EXIT(&irq_monitor, LPUART1_IRQn);
+  /* USER CODE END LPUART1_IRQn 1 */
+}
+
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
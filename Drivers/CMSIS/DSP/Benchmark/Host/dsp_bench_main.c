@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench_main.c
+ * Description:  主机端基准入口（Linux）
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * 用法：dsp_bench [-t ms] [filter] > result.csv
+ *       dsp_bench -v [filter]
+ *   -t      每个测点的计时长度，默认 20 ms
+ *   -v      不计时，校验内核误差（dsp_bench_avx2 另对比 AVX2 与标量版本，见 dsp_verify.c）
+ *   filter  只运行模块名或内核名包含该字符串的用例，如 filtering、fir_q31、cfft
+ *
+ * x86 上用 TSC 计数（启动时按 CLOCK_MONOTONIC 标定频率），cycles 为 TSC 标称频率下的参考周期，
+ * 开启睿频时与核心实际周期不同；其他架构以纳秒计数 (cycle_hz = 1e9)。
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "dsp_bench.h"
+#include "dsp_verify.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HOST_HAVE_TSC   1
+#endif
+
+static uint64_t host_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+#ifdef HOST_HAVE_TSC
+static uint32_t host_cycles(void)
+{
+    return (uint32_t)__rdtsc();
+}
+
+// 按单调时钟标定 TSC 频率 (100 ms)，4 GHz 以上的 TSC 超出 uint32_t
+static uint64_t host_cycle_hz(void)
+{
+    uint64_t ns0 = host_ns();
+    uint64_t tsc0 = __rdtsc();
+    uint64_t ns1;
+
+    do {
+        ns1 = host_ns();
+    } while (ns1 - ns0 < 100000000ULL);
+    return (__rdtsc() - tsc0) * 1000000000ULL / (ns1 - ns0);
+}
+#else
+static uint32_t host_cycles(void)
+{
+    return (uint32_t)host_ns();
+}
+
+static uint64_t host_cycle_hz(void)
+{
+    return 1000000000U;
+}
+#endif
+
+static void host_print(void* user, const char* line)
+{
+    fputs(line, (FILE*)user);
+    fputc('\n', (FILE*)user);
+    fflush((FILE*)user);
+}
+
+int main(int argc, char* argv[])
+{
+    dsp_bench_config cfg;
+    uint32_t ms = 20;
+    uint64_t min_cycles;
+    int verify = 0;
+    int i;
+
+    memset(&cfg, 0, sizeof(cfg));
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            ms = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "-v") == 0) {
+            verify = 1;
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: %s [-t ms | -v] [filter]\n", argv[0]);
+            return 2;
+        } else {
+            cfg.filter = argv[i];
+        }
+    }
+
+    if (verify) {
+        return (dsp_verify_run(cfg.filter, stdout) == 0U) ? 0 : 1;
+    }
+
+    cfg.cycles = host_cycles;
+    cfg.cycle_hz = host_cycle_hz();
+    // 单批耗时须小于计数器回绕周期 (2^32 / cycle_hz)，测点长度限制在半个回绕周期以内
+    if (ms == 0U || ms > 1000U) {
+        ms = 1000U;
+    }
+    min_cycles = cfg.cycle_hz * ms / 1000U;
+    if (min_cycles > 0x7FFFFFFFULL) {
+        min_cycles = 0x7FFFFFFFULL;
+        fprintf(stderr, "-t limited to %lu ms by the 32-bit counter\n",
+                (unsigned long)(min_cycles * 1000U / cfg.cycle_hz));
+    }
+    cfg.min_cycles = (uint32_t)min_cycles;
+    cfg.print = host_print;
+    cfg.user = stdout;
+
+    return (dsp_bench_run(&cfg) != 0U) ? 0 : 1;
+}
@@ -0,0 +1,842 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_verify.c
+ * Description:  内核精度校验（主机）：AVX2 与标量对照、双精度参考
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * 每个内核在一组尺寸上用相同输入分别调用被测版本与参考版本，每个内核输出一行：
+ *
+ *   kernel,points,worst_param,worst_size,max_abs,max_rel,tolerance,result
+ *
+ *   max_abs    所有测点中两者输出之差的最大绝对值
+ *   max_rel    max_abs 除以该测点参考输出的峰值（点积除以 sum |a[i] * b[i]|，不受相消影响）
+ *   tolerance  max_rel 的上限，超过即 FAIL
+ *
+ * 双精度参考（两种构建都运行）：
+ *   percentile_f32_exact   秩 p * (N - 1) / 100 为整数的测点（如 N = 36、p = 60），结果须逐位等于该秩的样本，容差 0
+ *   percentile_f32         其余测点对照 double 排序后线性插值，容差 2.4e-7（2 个 eps，插值一次乘加）；
+ *                          参考秩为精确秩舍入到 float 的值，float32 秩本身的舍入不计入
+ *   百分位取 0 ~ 100 的整数，N = 1 ~ 4096（含 36）。
+ *
+ * 随后输出混合基对照表，帧长为基准的 dsp_bench_mixed_sizes（含 100、240、1000），每行一个帧长：
+ *
+ *   frame,padded,cfft_mixed_f32,cfft_padded_f32,rfft_mixed_f32,rfft_padded_f32,tolerance,result
+ *
+ *   *_mixed_f32 按帧长变换，*_padded_f32 为补零到 padded 点后的 arm_cfft_f32 / arm_rfft_fast_f32，
+ *   各列为正反变换中较大的 max_rel，参考为同长度的 double 直接 DFT（O(N^2)），-1 表示该长度不受支持。
+ *   混合基两列超过 1e-6 即 FAIL（实测最大 2.4e-7，与补零版本同一量级）。
+ *
+ * 最后输出块浮点 CFFT 的 SNR 表，N = 128 ~ 4096，输入幅度 -6、-36、-60 dBFS，每行一个点数与幅度：
+ *
+ *   size,level_db,cfft_bfp_q15,cfft_q15,cfft_bfp_q31,cfft_q31,cfft_f32,limit_q15,limit_q31,result
+ *
+ *   各列为正变换对照双精度 DFT 的 SNR (dB)。固定移位版本按级缩小，SNR 随输入幅度下降；
+ *   块浮点版本与幅度无关，低于 limit_q15 (60 dB) / limit_q31 (150 dB) 即 FAIL。
+ *
+ * AVX2 对照（只在 dsp_bench_avx2 中）：含不是 8 的倍数的尾部长度、FIR 抽头数与矩阵维数，
+ * 有状态的内核连续处理两块以覆盖状态搬移，参考为 dsp_verify_ref.c 中的标量版本：
+ *                逐元素运算     0      （同样的单次 IEEE 运算，须逐位一致）
+ *                点积 / FIR / 矩阵乘 / biquad   2e-6   （求和顺序与 FMA 不同；约 17 个 eps，实测最大 5e-7）
+ *                CFFT / RFFT    2e-6   （AVX2 为基 2，标量为基 8/4，蝶形顺序不同；实测最大 2e-7）
+ *
+ * CFFT 只校验 bitReverseFlag = 1：AVX2 版本在 0 时输出二进制位反转顺序，与标量的基 8 顺序不同（见 arm_math.h）。
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dsp_verify.h"
+#include "dsp_bench_cases.h"
+#include "arm_const_structs.h"
+
+#define DSP_VERIFY_EXACT          (0.0)
+#define DSP_VERIFY_SUM            (2e-6)
+#define DSP_VERIFY_FFT            (2e-6)
+#define DSP_VERIFY_INTERP         (2.4e-7)
+#define DSP_VERIFY_DFT            (1e-6)
+#define DSP_VERIFY_SNR_Q15        (60.0)
+#define DSP_VERIFY_SNR_Q31        (150.0)
+
+#define DSP_VERIFY_MAX            DSP_BENCH_MAX_BLOCK
+
+typedef struct {
+    uint32_t points;
+    uint32_t worst_param;
+    uint32_t worst_size;
+    double max_abs;
+    double max_rel;
+} dsp_verify_result;
+
+typedef struct {
+    const char* kernel;
+    double tolerance;
+    void (*check)(dsp_verify_result* r);
+} dsp_verify_case;
+
+static float32_t src_a[2U * DSP_VERIFY_MAX];
+static float32_t out_ref[2U * DSP_VERIFY_MAX];
+static float32_t out_test[2U * DSP_VERIFY_MAX];
+static double sorted[DSP_VERIFY_MAX];
+
+static const uint16_t percentile_sizes[] = { 1, 2, 3, 5, 36, 100, 101, 1000, 4096, 0 };
+
+// 双精度 DFT 的输入、输出与 exp(-2j*pi*k/N) 表；混合基 FFT 的旋转因子计划与暂存区
+static double dft_in[2U * DSP_VERIFY_MAX];
+static double dft_out[2U * DSP_VERIFY_MAX];
+static double dft_tw[2U * DSP_VERIFY_MAX];
+static float32_t mixed_plan[2U * DSP_VERIFY_MAX];
+static float32_t mixed_scratch[2U * DSP_VERIFY_MAX];
+
+// 定点 CFFT 的输入与原地变换数据、转换为 double 的被测输出
+static q31_t fft_q31_in[2U * DSP_VERIFY_MAX];
+static q31_t fft_q31[2U * DSP_VERIFY_MAX];
+static q15_t fft_q15_in[2U * DSP_VERIFY_MAX];
+static q15_t fft_q15[2U * DSP_VERIFY_MAX];
+static double snr_test[2U * DSP_VERIFY_MAX];
+
+// SNR 表的点数与输入幅度（实部、虚部各自均匀分布于 ±amplitude）
+static const uint16_t snr_sizes[] = { 128, 256, 1024, 4096, 0 };
+static const float32_t snr_levels[] = { 0.5f, 1.0f / 64.0f, 1.0f / 1024.0f };
+
+#if defined(ARM_MATH_AVX2)
+static float32_t src_b[2U * DSP_VERIFY_MAX];
+static float32_t work_ref[2U * DSP_VERIFY_MAX];
+static float32_t work_test[2U * DSP_VERIFY_MAX];
+static float32_t state_ref[DSP_VERIFY_MAX + DSP_BENCH_TAPS_MAX];
+static float32_t state_test[DSP_VERIFY_MAX + DSP_BENCH_TAPS_MAX];
+static float32_t coeffs[DSP_BENCH_TAPS_MAX];
+
+// 向量长度：含 8 路 AVX2 循环的各种尾部
+static const uint16_t vector_sizes[] = { 1, 3, 7, 8, 9, 15, 16, 17, 31, 33, 100, 255, 1000, 1024, 4096, 0 };
+static const uint16_t fir_taps[] = { 1, 3, 8, 13, 32, 256, 0 };
+static const uint16_t biquad_stages[] = { 1, 2, 5, 0 };
+static const uint16_t fft_sizes[] = { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 0 };
+// 矩阵 (行, 内维, 列)
+static const uint8_t matrix_dims[][3] = {
+    { 1, 1, 1 }, { 3, 5, 7 }, { 8, 8, 8 }, { 9, 17, 10 }, { 16, 16, 16 }, { 33, 31, 35 }, { 64, 64, 64 },
+};
+
+static const float32_t biquad_lp[5] = { 0.0674553f, 0.1349105f, 0.0674553f, 1.1429805f, -0.4128016f };
+#endif
+
+/**
+ * @brief 比较 n 个输出，误差按 scale 归一化后计入结果
+ */
+static void dsp_verify_compare(dsp_verify_result* r, const float32_t* ref, const float32_t* test, uint32_t n,
+                               double scale, uint32_t param, uint32_t size)
+{
+    double max_abs = 0.0;
+    double rel;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        double d = fabs((double)test[i] - (double)ref[i]);
+
+        // NaN 与任何数比较都为假，单独当作无穷大误差
+        if (d > max_abs || d != d) {
+            max_abs = (d != d) ? INFINITY : d;
+        }
+    }
+    rel = (scale > 0.0) ? max_abs / scale : max_abs;
+    if (max_abs > r->max_abs) {
+        r->max_abs = max_abs;
+    }
+    if (r->points == 0U || rel > r->max_rel) {
+        r->max_rel = rel;
+        r->worst_param = param;
+        r->worst_size = size;
+    }
+    r->points++;
+}
+
+static const arm_cfft_instance_f32* dsp_verify_cfft_instance(uint32_t size)
+{
+    switch (size) {
+    case 16:   return &arm_cfft_sR_f32_len16;
+    case 32:   return &arm_cfft_sR_f32_len32;
+    case 64:   return &arm_cfft_sR_f32_len64;
+    case 128:  return &arm_cfft_sR_f32_len128;
+    case 256:  return &arm_cfft_sR_f32_len256;
+    case 512:  return &arm_cfft_sR_f32_len512;
+    case 1024: return &arm_cfft_sR_f32_len1024;
+    case 2048: return &arm_cfft_sR_f32_len2048;
+    case 4096: return &arm_cfft_sR_f32_len4096;
+    default:   return NULL;
+    }
+}
+
+#if defined(ARM_MATH_AVX2)
+// 标量输出的峰值
+static double dsp_verify_peak(const float32_t* ref, uint32_t n)
+{
+    double peak = 0.0;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        if (fabs((double)ref[i]) > peak) {
+            peak = fabs((double)ref[i]);
+        }
+    }
+    return peak;
+}
+
+static void dsp_verify_vector(dsp_verify_result* r,
+                              void (*ref)(const float32_t*, const float32_t*, float32_t*, uint32_t),
+                              void (*test)(const float32_t*, const float32_t*, float32_t*, uint32_t))
+{
+    const uint16_t* size;
+
+    for (size = vector_sizes; *size != 0U; size++) {
+        dsp_bench_fill_f32(src_a, *size, 1.0f);
+        dsp_bench_fill_f32(src_b, *size, 1.0f);
+        ref(src_a, src_b, out_ref, *size);
+        test(src_a, src_b, out_test, *size);
+        dsp_verify_compare(r, out_ref, out_test, *size, dsp_verify_peak(out_ref, *size), 0, *size);
+    }
+}
+
+static void check_add(dsp_verify_result* r)
+{
+    dsp_verify_vector(r, dsp_verify_ref_add_f32, arm_add_f32);
+}
+
+static void check_sub(dsp_verify_result* r)
+{
+    dsp_verify_vector(r, dsp_verify_ref_sub_f32, arm_sub_f32);
+}
+
+static void check_mult(dsp_verify_result* r)
+{
+    dsp_verify_vector(r, dsp_verify_ref_mult_f32, arm_mult_f32);
+}
+
+static void check_scale(dsp_verify_result* r)
+{
+    const uint16_t* size;
+
+    for (size = vector_sizes; *size != 0U; size++) {
+        dsp_bench_fill_f32(src_a, *size, 1.0f);
+        dsp_verify_ref_scale_f32(src_a, 0.75f, out_ref, *size);
+        arm_scale_f32(src_a, 0.75f, out_test, *size);
+        dsp_verify_compare(r, out_ref, out_test, *size, dsp_verify_peak(out_ref, *size), 0, *size);
+    }
+}
+
+static void check_offset(dsp_verify_result* r)
+{
+    const uint16_t* size;
+
+    for (size = vector_sizes; *size != 0U; size++) {
+        dsp_bench_fill_f32(src_a, *size, 1.0f);
+        dsp_verify_ref_offset_f32(src_a, 0.375f, out_ref, *size);
+        arm_offset_f32(src_a, 0.375f, out_test, *size);
+        dsp_verify_compare(r, out_ref, out_test, *size, dsp_verify_peak(out_ref, *size), 0, *size);
+    }
+}
+
+static void check_dot_prod(dsp_verify_result* r)
+{
+    const uint16_t* size;
+
+    for (size = vector_sizes; *size != 0U; size++) {
+        double magnitude = 0.0;
+        uint32_t i;
+
+        dsp_bench_fill_f32(src_a, *size, 1.0f);
+        dsp_bench_fill_f32(src_b, *size, 1.0f);
+        for (i = 0; i < *size; i++) {
+            magnitude += fabs((double)src_a[i] * (double)src_b[i]);
+        }
+        dsp_verify_ref_dot_prod_f32(src_a, src_b, *size, &out_ref[0]);
+        arm_dot_prod_f32(src_a, src_b, *size, &out_test[0]);
+        dsp_verify_compare(r, out_ref, out_test, 1, magnitude, 0, *size);
+    }
+}
+
+static void check_fir(dsp_verify_result* r)
+{
+    arm_fir_instance_f32 fir_ref;
+    arm_fir_instance_f32 fir_test;
+    const uint16_t* taps;
+    const uint16_t* size;
+
+    for (taps = fir_taps; *taps != 0U; taps++) {
+        for (size = vector_sizes; *size != 0U; size++) {
+            uint32_t n = 2U * *size;
+
+            if (n > 2U * DSP_VERIFY_MAX) {
+                continue;
+            }
+            dsp_bench_fill_f32(coeffs, *taps, 1.0f / (float32_t)*taps);
+            dsp_bench_fill_f32(src_a, n, 1.0f);
+            arm_fir_init_f32(&fir_ref, *taps, coeffs, state_ref, *size);
+            arm_fir_init_f32(&fir_test, *taps, coeffs, state_test, *size);
+            // 连续两块，第二块依赖状态缓冲区中搬移的历史数据
+            dsp_verify_ref_fir_f32(&fir_ref, src_a, out_ref, *size);
+            dsp_verify_ref_fir_f32(&fir_ref, &src_a[*size], &out_ref[*size], *size);
+            arm_fir_f32(&fir_test, src_a, out_test, *size);
+            arm_fir_f32(&fir_test, &src_a[*size], &out_test[*size], *size);
+            dsp_verify_compare(r, out_ref, out_test, n, dsp_verify_peak(out_ref, n), *taps, *size);
+        }
+    }
+}
+
+static void check_biquad_df2T(dsp_verify_result* r)
+{
+    arm_biquad_cascade_df2T_instance_f32 iir_ref;
+    arm_biquad_cascade_df2T_instance_f32 iir_test;
+    const uint16_t* stages;
+    const uint16_t* size;
+    uint32_t stage;
+
+    for (stages = biquad_stages; *stages != 0U; stages++) {
+        for (stage = 0; stage < *stages; stage++) {
+            memcpy(&coeffs[5U * stage], biquad_lp, sizeof(biquad_lp));
+        }
+        for (size = vector_sizes; *size != 0U; size++) {
+            uint32_t n = 2U * *size;
+
+            if (n > 2U * DSP_VERIFY_MAX) {
+                continue;
+            }
+            dsp_bench_fill_f32(src_a, n, 1.0f);
+            arm_biquad_cascade_df2T_init_f32(&iir_ref, (uint8_t)*stages, coeffs, state_ref);
+            arm_biquad_cascade_df2T_init_f32(&iir_test, (uint8_t)*stages, coeffs, state_test);
+            dsp_verify_ref_biquad_cascade_df2T_f32(&iir_ref, src_a, out_ref, *size);
+            dsp_verify_ref_biquad_cascade_df2T_f32(&iir_ref, &src_a[*size], &out_ref[*size], *size);
+            arm_biquad_cascade_df2T_f32(&iir_test, src_a, out_test, *size);
+            arm_biquad_cascade_df2T_f32(&iir_test, &src_a[*size], &out_test[*size], *size);
+            dsp_verify_compare(r, out_ref, out_test, n, dsp_verify_peak(out_ref, n), *stages, *size);
+        }
+    }
+}
+
+static void check_mat_mult(dsp_verify_result* r)
+{
+    arm_matrix_instance_f32 a;
+    arm_matrix_instance_f32 b;
+    arm_matrix_instance_f32 c_ref;
+    arm_matrix_instance_f32 c_test;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(matrix_dims) / sizeof(matrix_dims[0]); i++) {
+        uint16_t m = matrix_dims[i][0];
+        uint16_t k = matrix_dims[i][1];
+        uint16_t n = matrix_dims[i][2];
+
+        arm_mat_init_f32(&a, m, k, src_a);
+        arm_mat_init_f32(&b, k, n, src_b);
+        arm_mat_init_f32(&c_ref, m, n, out_ref);
+        arm_mat_init_f32(&c_test, m, n, out_test);
+        dsp_bench_fill_f32(src_a, (uint32_t)m * k, 1.0f);
+        dsp_bench_fill_f32(src_b, (uint32_t)k * n, 1.0f);
+        (void)dsp_verify_ref_mat_mult_f32(&a, &b, &c_ref);
+        (void)arm_mat_mult_f32(&a, &b, &c_test);
+        // param 为内维，size 为输出元素数
+        dsp_verify_compare(r, out_ref, out_test, (uint32_t)m * n, dsp_verify_peak(out_ref, (uint32_t)m * n),
+                           k, (uint32_t)m * n);
+    }
+}
+
+// param 为 ifftFlag
+static void check_cfft(dsp_verify_result* r)
+{
+    const uint16_t* size;
+    uint8_t inverse;
+
+    for (size = fft_sizes; *size != 0U; size++) {
+        const arm_cfft_instance_f32* S = dsp_verify_cfft_instance(*size);
+        uint32_t n = 2U * *size;
+
+        if (S == NULL || *size > DSP_VERIFY_MAX) {
+            continue;
+        }
+        for (inverse = 0; inverse <= 1U; inverse++) {
+            dsp_bench_fill_f32(src_a, n, 1.0f);
+            memcpy(out_ref, src_a, n * sizeof(float32_t));
+            memcpy(out_test, src_a, n * sizeof(float32_t));
+            dsp_verify_ref_cfft_f32(S, out_ref, inverse, 1);
+            arm_cfft_f32(S, out_test, inverse, 1);
+            dsp_verify_compare(r, out_ref, out_test, n, dsp_verify_peak(out_ref, n), inverse, *size);
+        }
+    }
+}
+
+// param 为 ifftFlag；arm_rfft_fast_f32 会改写输入，每次调用前重新复制
+static void check_rfft_fast(dsp_verify_result* r)
+{
+    arm_rfft_fast_instance_f32 S;
+    const uint16_t* size;
+    uint8_t inverse;
+
+    for (size = fft_sizes; *size != 0U; size++) {
+        if (*size < 32U || *size > DSP_VERIFY_MAX || arm_rfft_fast_init_f32(&S, *size) != ARM_MATH_SUCCESS) {
+            continue;
+        }
+        for (inverse = 0; inverse <= 1U; inverse++) {
+            dsp_bench_fill_f32(src_a, *size, 1.0f);
+            memcpy(work_ref, src_a, *size * sizeof(float32_t));
+            memcpy(work_test, src_a, *size * sizeof(float32_t));
+            dsp_verify_ref_rfft_fast_f32(&S, work_ref, out_ref, inverse);
+            arm_rfft_fast_f32(&S, work_test, out_test, inverse);
+            dsp_verify_compare(r, out_ref, out_test, *size, dsp_verify_peak(out_ref, *size), inverse, *size);
+        }
+    }
+}
+
+#endif /* defined(ARM_MATH_AVX2) */
+
+static int dsp_verify_cmp_f64(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief arm_percentile_f32 对照 double 排序后按秩插值，exact 只统计整数秩的测点，否则只统计插值测点
+ */
+static void dsp_verify_percentile(dsp_verify_result* r, int exact)
+{
+    const uint16_t* size;
+    uint32_t p;
+    uint32_t i;
+
+    for (size = percentile_sizes; *size != 0U; size++) {
+        if (*size > DSP_VERIFY_MAX) {
+            continue;
+        }
+        dsp_bench_fill_f32(src_a, *size, 1.0f);
+        for (i = 0; i < *size; i++) {
+            sorted[i] = (double)src_a[i];
+        }
+        qsort(sorted, *size, sizeof(sorted[0]), dsp_verify_cmp_f64);
+
+        for (p = 0; p <= 100U; p++) {
+            // 秩 = p * (N - 1) / 100，整数运算判断是否为整数秩；插值测点的参考秩为精确秩舍入到 float
+            uint32_t scaled = p * (*size - 1U);
+            double rank = (double)(float32_t)((double)scaled / 100.0);
+            uint32_t k = (uint32_t)rank;
+            double frac = rank - (double)k;
+            float32_t result;
+
+            if (exact != (scaled % 100U == 0U)) {
+                continue;
+            }
+            if (k + 1U >= *size) {
+                frac = 0.0;
+            }
+            out_ref[0] = (float32_t)((frac == 0.0) ? sorted[k] : sorted[k] + frac * (sorted[k + 1U] - sorted[k]));
+            memcpy(out_test, src_a, *size * sizeof(float32_t));
+            arm_percentile_f32(out_test, *size, (float32_t)p, &result);
+            out_test[0] = result;
+            dsp_verify_compare(r, out_ref, out_test, 1, fabs(sorted[0]) > fabs(sorted[*size - 1U]) ?
+                               fabs(sorted[0]) : fabs(sorted[*size - 1U]), p, *size);
+        }
+    }
+}
+
+static void check_percentile_exact(dsp_verify_result* r)
+{
+    dsp_verify_percentile(r, 1);
+}
+
+static void check_percentile(dsp_verify_result* r)
+{
+    dsp_verify_percentile(r, 0);
+}
+
+/**
+ * @brief n 点复数 DFT (dft_in -> dft_out)，double 精度直接求和；inverse 时取共轭指数并乘 1/n
+ */
+static void dsp_verify_dft(uint32_t n, int inverse)
+{
+    double sign = inverse ? 1.0 : -1.0;
+    uint32_t i;
+    uint32_t k;
+
+    for (k = 0; k < n; k++) {
+        double phase = 2.0 * M_PI * (double)k / (double)n;
+
+        dft_tw[2U * k] = cos(phase);
+        dft_tw[2U * k + 1U] = sign * sin(phase);
+    }
+    for (k = 0; k < n; k++) {
+        double re = 0.0;
+        double im = 0.0;
+        uint32_t m = 0;
+
+        // 相位下标 k * i 按 n 取模累加，不经过大整数乘法
+        for (i = 0; i < n; i++) {
+            double xr = dft_in[2U * i];
+            double xi = dft_in[2U * i + 1U];
+
+            re += xr * dft_tw[2U * m] - xi * dft_tw[2U * m + 1U];
+            im += xr * dft_tw[2U * m + 1U] + xi * dft_tw[2U * m];
+            m += k;
+            if (m >= n) {
+                m -= n;
+            }
+        }
+        dft_out[2U * k] = inverse ? re / (double)n : re;
+        dft_out[2U * k + 1U] = inverse ? im / (double)n : im;
+    }
+}
+
+// 最大绝对误差除以参考输出的峰值
+static double dsp_verify_error_f64(const double* ref, const float32_t* test, uint32_t n)
+{
+    double max_abs = 0.0;
+    double peak = 0.0;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        double d = fabs((double)test[i] - ref[i]);
+
+        if (d > max_abs || d != d) {
+            max_abs = (d != d) ? INFINITY : d;
+        }
+        if (fabs(ref[i]) > peak) {
+            peak = fabs(ref[i]);
+        }
+    }
+    return (peak > 0.0) ? max_abs / peak : max_abs;
+}
+
+/**
+ * @brief 复数 FFT 正反变换对照 n 点双精度 DFT，输入为前 frame 个随机复数、其后补零（不补零时 frame = n）
+ * @param mixed 为 1 时用 arm_cfft_mixed_f32，否则用 arm_cfft_f32
+ * @return 正反两个方向中较大的相对误差，n 不受支持时为负
+ */
+static double dsp_verify_cfft_dft(uint32_t frame, uint32_t n, int mixed)
+{
+    arm_cfft_mixed_instance_f32 S_mixed;
+    const arm_cfft_instance_f32* S = dsp_verify_cfft_instance(n);
+    double worst = 0.0;
+    uint8_t inverse;
+    uint32_t i;
+
+    if (mixed ? (arm_cfft_mixed_init_f32(&S_mixed, (uint16_t)n, mixed_plan) != ARM_MATH_SUCCESS) : (S == NULL)) {
+        return -1.0;
+    }
+    for (inverse = 0; inverse <= 1U; inverse++) {
+        dsp_bench_fill_f32(out_test, 2U * frame, 1.0f);
+        memset(&out_test[2U * frame], 0, 2U * (n - frame) * sizeof(float32_t));
+        for (i = 0; i < 2U * n; i++) {
+            dft_in[i] = (double)out_test[i];
+        }
+        dsp_verify_dft(n, inverse);
+        if (mixed) {
+            arm_cfft_mixed_f32(&S_mixed, out_test, mixed_scratch, inverse);
+        } else {
+            arm_cfft_f32(S, out_test, inverse, 1);
+        }
+        worst = fmax(worst, dsp_verify_error_f64(dft_out, out_test, 2U * n));
+    }
+    return worst;
+}
+
+/**
+ * @brief 实数 FFT 正反变换对照 n 点双精度 DFT，频谱按 arm_rfft_fast_f32 的格式打包
+ *
+ * 正变换输入为前 frame 个随机实数、其后补零；反变换输入为 n 个随机值组成的打包频谱，
+ * 参考按共轭对称展开后做复数逆 DFT 取实部。
+ * @param mixed 为 1 时用 arm_rfft_mixed_f32，否则用 arm_rfft_fast_f32
+ * @return 正反两个方向中较大的相对误差，n 不受支持时为负
+ */
+static double dsp_verify_rfft_dft(uint32_t frame, uint32_t n, int mixed)
+{
+    arm_rfft_mixed_instance_f32 S_mixed;
+    arm_rfft_fast_instance_f32 S;
+    double worst = 0.0;
+    uint8_t inverse;
+    uint32_t i;
+
+    if (mixed ? (arm_rfft_mixed_init_f32(&S_mixed, (uint16_t)n, mixed_plan) != ARM_MATH_SUCCESS) :
+                (n < 32U || arm_rfft_fast_init_f32(&S, (uint16_t)n) != ARM_MATH_SUCCESS)) {
+        return -1.0;
+    }
+    for (inverse = 0; inverse <= 1U; inverse++) {
+        memset(dft_in, 0, 2U * n * sizeof(double));
+        if (inverse == 0U) {
+            dsp_bench_fill_f32(src_a, frame, 1.0f);
+            memset(&src_a[frame], 0, (n - frame) * sizeof(float32_t));
+            for (i = 0; i < n; i++) {
+                dft_in[2U * i] = (double)src_a[i];
+            }
+        } else {
+            dsp_bench_fill_f32(src_a, n, 1.0f);
+            dft_in[0] = (double)src_a[0];
+            dft_in[n] = (double)src_a[1];
+            for (i = 1; i < n / 2U; i++) {
+                dft_in[2U * i] = (double)src_a[2U * i];
+                dft_in[2U * i + 1U] = (double)src_a[2U * i + 1U];
+                dft_in[2U * (n - i)] = (double)src_a[2U * i];
+                dft_in[2U * (n - i) + 1U] = -(double)src_a[2U * i + 1U];
+            }
+        }
+        dsp_verify_dft(n, inverse);
+        // 参考整理成与被测输出相同的排列：正变换为打包频谱，反变换为实部
+        if (inverse == 0U) {
+            dft_out[1] = dft_out[n];
+        } else {
+            for (i = 0; i < n; i++) {
+                dft_out[i] = dft_out[2U * i];
+            }
+        }
+        if (mixed) {
+            memcpy(out_test, src_a, n * sizeof(float32_t));
+            arm_rfft_mixed_f32(&S_mixed, out_test, mixed_scratch, inverse);
+        } else {
+            // arm_rfft_fast_f32 会改写输入
+            arm_rfft_fast_f32(&S, src_a, out_test, inverse);
+        }
+        worst = fmax(worst, dsp_verify_error_f64(dft_out, out_test, n));
+    }
+    return worst;
+}
+
+/**
+ * @brief 混合基 FFT 与补零到 2 的幂的 arm_cfft_f32 / arm_rfft_fast_f32 对照双精度 DFT，每个帧长一行
+ *
+ * 帧长取基准的 dsp_bench_mixed_sizes，补零长度与基准的 *_padded_f32 用例相同；
+ * 混合基的误差超出容差即 FAIL，补零版本只作对照。
+ * @return 超出容差的帧长数
+ */
+static uint32_t dsp_verify_mixed(FILE* out)
+{
+    const uint16_t* size;
+    uint32_t failed = 0;
+
+    fprintf(out, "frame,padded,cfft_mixed_f32,cfft_padded_f32,rfft_mixed_f32,rfft_padded_f32,tolerance,result\n");
+    for (size = dsp_bench_mixed_sizes; *size != 0U; size++) {
+        uint32_t cfft_len;
+        uint32_t rfft_len;
+        double cfft_mixed;
+        double rfft_mixed;
+        int pass;
+
+        for (cfft_len = 16U; cfft_len < *size; cfft_len <<= 1U) {
+        }
+        for (rfft_len = 32U; rfft_len < *size; rfft_len <<= 1U) {
+        }
+        if (cfft_len > DSP_VERIFY_MAX || rfft_len > DSP_VERIFY_MAX) {
+            continue;
+        }
+        cfft_mixed = dsp_verify_cfft_dft(*size, *size, 1);
+        rfft_mixed = dsp_verify_rfft_dft(*size, *size, 1);
+        pass = (cfft_mixed >= 0.0) && (cfft_mixed <= DSP_VERIFY_DFT) &&
+               (rfft_mixed >= 0.0) && (rfft_mixed <= DSP_VERIFY_DFT);
+        fprintf(out, "%u,%u,%.3g,%.3g,%.3g,%.3g,%.2g,%s\n", (unsigned)*size, (unsigned)cfft_len, cfft_mixed,
+                dsp_verify_cfft_dft(*size, cfft_len, 0), rfft_mixed, dsp_verify_rfft_dft(*size, rfft_len, 0),
+                DSP_VERIFY_DFT, pass ? "PASS" : "FAIL");
+        if (!pass) {
+            failed++;
+        }
+    }
+    return failed;
+}
+
+static const arm_cfft_instance_q15* dsp_verify_cfft_instance_q15(uint32_t size)
+{
+    switch (size) {
+    case 128:  return &arm_cfft_sR_q15_len128;
+    case 256:  return &arm_cfft_sR_q15_len256;
+    case 1024: return &arm_cfft_sR_q15_len1024;
+    case 4096: return &arm_cfft_sR_q15_len4096;
+    default:   return NULL;
+    }
+}
+
+static const arm_cfft_instance_q31* dsp_verify_cfft_instance_q31(uint32_t size)
+{
+    switch (size) {
+    case 128:  return &arm_cfft_sR_q31_len128;
+    case 256:  return &arm_cfft_sR_q31_len256;
+    case 1024: return &arm_cfft_sR_q31_len1024;
+    case 4096: return &arm_cfft_sR_q31_len4096;
+    default:   return NULL;
+    }
+}
+
+// 10 * log10(sum |ref|^2 / sum |snr_test - ref|^2)，dB
+static double dsp_verify_snr(uint32_t n)
+{
+    double signal = 0.0;
+    double noise = 0.0;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        double d = snr_test[i] - dft_out[i];
+
+        signal += dft_out[i] * dft_out[i];
+        noise += d * d;
+    }
+    return (noise > 0.0) ? 10.0 * log10(signal / noise) : INFINITY;
+}
+
+/**
+ * @brief 块浮点、固定移位与浮点 CFFT 正变换的 SNR，参考为各自输入的双精度 DFT，每个点数与输入幅度一行
+ *
+ * q31 输入由 dsp_bench_fill_q31 生成，q15 输入为其舍入到高 16 位，f32 输入为 q31 除以 2^31。
+ * 输出换算到输入单位后与参考比较：块浮点乘 2^e，arm_cfft_q15 / arm_cfft_q31 按级缩小共 1/N，乘 N。
+ * 块浮点两列低于 DSP_VERIFY_SNR_Q15 / DSP_VERIFY_SNR_Q31 即 FAIL，其余列只作对照。
+ * @return 不达标的行数
+ */
+static uint32_t dsp_verify_bfp(FILE* out)
+{
+    const uint16_t* size;
+    uint32_t failed = 0;
+    uint32_t level;
+    uint32_t i;
+
+    fprintf(out, "size,level_db,cfft_bfp_q15,cfft_q15,cfft_bfp_q31,cfft_q31,cfft_f32,limit_q15,limit_q31,result\n");
+    for (size = snr_sizes; *size != 0U; size++) {
+        const arm_cfft_instance_q15* S_q15 = dsp_verify_cfft_instance_q15(*size);
+        const arm_cfft_instance_q31* S_q31 = dsp_verify_cfft_instance_q31(*size);
+        const arm_cfft_instance_f32* S_f32 = dsp_verify_cfft_instance(*size);
+        uint32_t n = 2U * *size;
+
+        if (*size > DSP_VERIFY_MAX || S_q15 == NULL || S_q31 == NULL || S_f32 == NULL) {
+            continue;
+        }
+        for (level = 0; level < DSP_BENCH_COUNT(snr_levels); level++) {
+            double bfp_q15;
+            double fixed_q15;
+            double bfp_q31;
+            double fixed_q31;
+            double snr_f32;
+            double scale;
+            int pass;
+
+            dsp_bench_fill_q31(fft_q31_in, n, snr_levels[level]);
+            for (i = 0; i < n; i++) {
+                fft_q15_in[i] = (q15_t)((fft_q31_in[i] + 0x8000) >> 16);
+            }
+
+            // q15：参考为 q15 输入的 DFT
+            for (i = 0; i < n; i++) {
+                dft_in[i] = (double)fft_q15_in[i] / 32768.0;
+            }
+            dsp_verify_dft(*size, 0);
+            memcpy(fft_q15, fft_q15_in, n * sizeof(q15_t));
+            scale = ldexp(1.0, arm_cfft_bfp_q15(S_q15, fft_q15, 0, 1)) / 32768.0;
+            for (i = 0; i < n; i++) {
+                snr_test[i] = (double)fft_q15[i] * scale;
+            }
+            bfp_q15 = dsp_verify_snr(n);
+            memcpy(fft_q15, fft_q15_in, n * sizeof(q15_t));
+            arm_cfft_q15(S_q15, fft_q15, 0, 1);
+            for (i = 0; i < n; i++) {
+                snr_test[i] = (double)fft_q15[i] * (double)*size / 32768.0;
+            }
+            fixed_q15 = dsp_verify_snr(n);
+
+            // q31 与 f32：参考为 q31 输入的 DFT
+            for (i = 0; i < n; i++) {
+                dft_in[i] = (double)fft_q31_in[i] / 2147483648.0;
+            }
+            dsp_verify_dft(*size, 0);
+            memcpy(fft_q31, fft_q31_in, n * sizeof(q31_t));
+            scale = ldexp(1.0, arm_cfft_bfp_q31(S_q31, fft_q31, 0, 1)) / 2147483648.0;
+            for (i = 0; i < n; i++) {
+                snr_test[i] = (double)fft_q31[i] * scale;
+            }
+            bfp_q31 = dsp_verify_snr(n);
+            memcpy(fft_q31, fft_q31_in, n * sizeof(q31_t));
+            arm_cfft_q31(S_q31, fft_q31, 0, 1);
+            for (i = 0; i < n; i++) {
+                snr_test[i] = (double)fft_q31[i] * (double)*size / 2147483648.0;
+            }
+            fixed_q31 = dsp_verify_snr(n);
+            for (i = 0; i < n; i++) {
+                out_test[i] = (float32_t)dft_in[i];
+            }
+            arm_cfft_f32(S_f32, out_test, 0, 1);
+            for (i = 0; i < n; i++) {
+                snr_test[i] = (double)out_test[i];
+            }
+            snr_f32 = dsp_verify_snr(n);
+
+            pass = (bfp_q15 >= DSP_VERIFY_SNR_Q15) && (bfp_q31 >= DSP_VERIFY_SNR_Q31);
+            fprintf(out, "%u,%.0f,%.1f,%.1f,%.1f,%.1f,%.1f,%.0f,%.0f,%s\n", (unsigned)*size,
+                    20.0 * log10((double)snr_levels[level]), bfp_q15, fixed_q15, bfp_q31, fixed_q31, snr_f32,
+                    DSP_VERIFY_SNR_Q15, DSP_VERIFY_SNR_Q31, pass ? "PASS" : "FAIL");
+            if (!pass) {
+                failed++;
+            }
+        }
+    }
+    return failed;
+}
+
+static const dsp_verify_case cases[] = {
+    { "percentile_f32_exact",     DSP_VERIFY_EXACT,  check_percentile_exact },
+    { "percentile_f32",           DSP_VERIFY_INTERP, check_percentile },
+#if defined(ARM_MATH_AVX2)
+    { "add_f32",                  DSP_VERIFY_EXACT, check_add },
+    { "sub_f32",                  DSP_VERIFY_EXACT, check_sub },
+    { "mult_f32",                 DSP_VERIFY_EXACT, check_mult },
+    { "scale_f32",                DSP_VERIFY_EXACT, check_scale },
+    { "offset_f32",               DSP_VERIFY_EXACT, check_offset },
+    { "dot_prod_f32",             DSP_VERIFY_SUM,   check_dot_prod },
+    { "fir_f32",                  DSP_VERIFY_SUM,   check_fir },
+    { "biquad_cascade_df2T_f32",  DSP_VERIFY_SUM,   check_biquad_df2T },
+    { "mat_mult_f32",             DSP_VERIFY_SUM,   check_mat_mult },
+    { "cfft_f32",                 DSP_VERIFY_FFT,   check_cfft },
+    { "rfft_fast_f32",            DSP_VERIFY_FFT,   check_rfft_fast },
+#endif
+};
+
+uint32_t dsp_verify_run(const char* filter, FILE* out)
+{
+    uint32_t failed = 0;
+    uint32_t i;
+
+#if defined(ARM_MATH_AVX2)
+    fprintf(out, "# double reference and ARM_MATH_AVX2 vs scalar, max block %u\n", (unsigned)DSP_VERIFY_MAX);
+#else
+    fprintf(out, "# double reference, max block %u\n", (unsigned)DSP_VERIFY_MAX);
+#endif
+    fprintf(out, "kernel,points,worst_param,worst_size,max_abs,max_rel,tolerance,result\n");
+    for (i = 0; i < DSP_BENCH_COUNT(cases); i++) {
+        dsp_verify_result r;
+        int pass;
+
+        if ((filter != NULL) && (strstr(cases[i].kernel, filter) == NULL)) {
+            continue;
+        }
+        memset(&r, 0, sizeof(r));
+        cases[i].check(&r);
+        pass = (r.max_rel <= cases[i].tolerance);
+        fprintf(out, "%s,%u,%u,%u,%.3g,%.3g,%.2g,%s\n", cases[i].kernel, (unsigned)r.points,
+                (unsigned)r.worst_param, (unsigned)r.worst_size, r.max_abs, r.max_rel, cases[i].tolerance,
+                pass ? "PASS" : "FAIL");
+        if (!pass) {
+            failed++;
+        }
+    }
+    // 表头中的内核名任一包含 filter 时输出混合基对照表
+    if ((filter == NULL) ||
+        (strstr("cfft_mixed_f32,cfft_padded_f32,rfft_mixed_f32,rfft_padded_f32", filter) != NULL)) {
+        fprintf(out, "# mixed-radix vs zero-padded power of two, max_rel vs double DFT (forward and inverse)\n");
+        failed += dsp_verify_mixed(out);
+    }
+    if ((filter == NULL) || (strstr("cfft_bfp_q15,cfft_q15,cfft_bfp_q31,cfft_q31,cfft_f32", filter) != NULL)) {
+        fprintf(out, "# block floating point vs fixed shift vs f32, forward CFFT SNR (dB) vs double DFT\n");
+        failed += dsp_verify_bfp(out);
+    }
+    return failed;
+}
@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_verify.h
+ * Description:  内核精度校验（主机）：AVX2 与标量对照、双精度参考
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _DSP_VERIFY_H
+#define _DSP_VERIFY_H
+
+/*
+ * dsp_bench_avx2 链接的是以 ARM_MATH_AVX2 编译的库，标量对照版本由 dsp_verify_ref.c
+ * 直接包含同一批源文件、不带 ARM_MATH_AVX2 编译得到，全局符号加 dsp_verify_ref_ 前缀。
+ * 这里只列出有 AVX2 实现的内核（及其所在源文件中的其他全局函数）。
+ * 标量构建 (dsp_bench) 没有对照版本，只运行双精度参考校验。
+ */
+#if defined(DSP_VERIFY_REF_BUILD)
+#define arm_add_f32                     dsp_verify_ref_add_f32
+#define arm_sub_f32                     dsp_verify_ref_sub_f32
+#define arm_mult_f32                    dsp_verify_ref_mult_f32
+#define arm_scale_f32                   dsp_verify_ref_scale_f32
+#define arm_offset_f32                  dsp_verify_ref_offset_f32
+#define arm_dot_prod_f32                dsp_verify_ref_dot_prod_f32
+#define arm_fir_f32                     dsp_verify_ref_fir_f32
+#define arm_biquad_cascade_df2T_f32     dsp_verify_ref_biquad_cascade_df2T_f32
+#define arm_mat_mult_f32                dsp_verify_ref_mat_mult_f32
+#define arm_cfft_f32                    dsp_verify_ref_cfft_f32
+#define arm_cfft_radix8by2_f32          dsp_verify_ref_cfft_radix8by2_f32
+#define arm_cfft_radix8by4_f32          dsp_verify_ref_cfft_radix8by4_f32
+#define arm_rfft_fast_f32               dsp_verify_ref_rfft_fast_f32
+#define stage_rfft_f32                  dsp_verify_ref_stage_rfft_f32
+#define merge_rfft_f32                  dsp_verify_ref_merge_rfft_f32
+#endif
+
+#include <stdio.h>
+#include "arm_math.h"
+
+#if defined(ARM_MATH_AVX2) && !defined(DSP_VERIFY_REF_BUILD)
+void dsp_verify_ref_add_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize);
+void dsp_verify_ref_sub_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize);
+void dsp_verify_ref_mult_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize);
+void dsp_verify_ref_scale_f32(const float32_t* pSrc, float32_t scale, float32_t* pDst, uint32_t blockSize);
+void dsp_verify_ref_offset_f32(const float32_t* pSrc, float32_t offset, float32_t* pDst, uint32_t blockSize);
+void dsp_verify_ref_dot_prod_f32(const float32_t* pSrcA, const float32_t* pSrcB, uint32_t blockSize,
+                                 float32_t* result);
+void dsp_verify_ref_fir_f32(const arm_fir_instance_f32* S, const float32_t* pSrc, float32_t* pDst,
+                            uint32_t blockSize);
+void dsp_verify_ref_biquad_cascade_df2T_f32(const arm_biquad_cascade_df2T_instance_f32* S,
+                                            const float32_t* pSrc, float32_t* pDst, uint32_t blockSize);
+arm_status dsp_verify_ref_mat_mult_f32(const arm_matrix_instance_f32* pSrcA, const arm_matrix_instance_f32* pSrcB,
+                                       arm_matrix_instance_f32* pDst);
+void dsp_verify_ref_cfft_f32(const arm_cfft_instance_f32* S, float32_t* p1, uint8_t ifftFlag,
+                             uint8_t bitReverseFlag);
+void dsp_verify_ref_rfft_fast_f32(const arm_rfft_fast_instance_f32* S, float32_t* p, float32_t* pOut,
+                                  uint8_t ifftFlag);
+#endif
+
+/**
+ * @brief 逐内核输出最大绝对/相对误差：AVX2 构建对比 AVX2 与标量版本，两种构建都对比双精度参考
+ * @param filter 只校验名称包含该字符串的内核，NULL 为全部
+ * @return 超出容差的内核数
+ */
+uint32_t dsp_verify_run(const char* filter, FILE* out);
+
+#endif /* _DSP_VERIFY_H */
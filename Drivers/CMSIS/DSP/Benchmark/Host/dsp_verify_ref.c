@@ -0,0 +1,36 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_verify_ref.c
+ * Description:  AVX2 校验用的标量对照内核
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: x86-64 Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * 与 dsp_bench_avx2 一同编译，但须走标量分支：CMakeLists.txt 对本文件追加 -mno-avx2 -mno-fma，
+ * 这里取消目标继承的 ARM_MATH_AVX2，编译结果与 dsp_bench 链接的标量库相同。
+ */
+#undef ARM_MATH_AVX2
+#define DSP_VERIFY_REF_BUILD
+
+#include "dsp_verify.h"
+
+#include "BasicMathFunctions/arm_add_f32.c"
+#include "BasicMathFunctions/arm_sub_f32.c"
+#include "BasicMathFunctions/arm_mult_f32.c"
+#include "BasicMathFunctions/arm_scale_f32.c"
+#include "BasicMathFunctions/arm_offset_f32.c"
+#include "BasicMathFunctions/arm_dot_prod_f32.c"
+#include "FilteringFunctions/arm_fir_f32.c"
+#include "FilteringFunctions/arm_biquad_cascade_df2T_f32.c"
+#include "MatrixFunctions/arm_mat_mult_f32.c"
+#include "TransformFunctions/arm_cfft_f32.c"
+#include "TransformFunctions/arm_rfft_fast_f32.c"
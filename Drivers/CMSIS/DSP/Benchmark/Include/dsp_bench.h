@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench.h
+ * Description:  CMSIS-DSP 基准测试接口（主机与设备共用）
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores / Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _DSP_BENCH_H
+#define _DSP_BENCH_H
+
+#include <stdint.h>
+
+/*
+ * CMSIS-DSP 内核吞吐量基准
+ *
+ * 按模块 (basic / filtering / transform / matrix / statistics) 组织用例，每个用例在一组尺寸上
+ * 扫描（块长、FFT 点数或矩阵维数），每个测点输出一行 CSV：
+ *
+ *   module,kernel,param,size,samples,calls,cycles_per_call,cycles_per_sample,samples_per_s
+ *
+ *   param    用例参数（FIR 抽头数、biquad 级数、抽取因子等），无则为 0
+ *   samples  每次调用处理的样本数（矩阵为输出元素数，重采样为输出样本数，滑动窗口统计为 1），吞吐量按它换算
+ *
+ * 计时只依赖调用方提供的 32 位自由运行计数器：设备上为 DWT->CYCCNT（HCLK 周期），
+ * 主机上为 TSC（x86，标称频率的参考周期）或 clock_gettime 纳秒。
+ * 每个测点先倍增调用次数直到一批耗时不少于 min_cycles / 3，再取 3 批中最快的一批，
+ * 单批耗时须远小于计数器回绕周期。
+ *
+ * 浮点变换正反交替执行，原位反复调用时数据保持有界；定点内核逐级缩放，数值不会溢出。
+ *
+ * 主机：Benchmark/CMakeLists.txt 生成 dsp_bench（直接编译 Source 下各模块的合并源文件）；
+ * 设备：顶层 CMakeLists.txt 打开 DSP_BENCH 选项后控制台加入 bench 命令。
+ */
+
+#ifndef DSP_BENCH_MAX_BLOCK
+  #define DSP_BENCH_MAX_BLOCK     (1024U)   // 最大块长 / FFT 点数，决定静态缓冲区大小
+#endif
+
+#ifndef DSP_BENCH_TAPS_MAX
+  #define DSP_BENCH_TAPS_MAX      (256U)    // FIR 最大抽头数
+#endif
+
+#define DSP_BENCH_LINE_MAX        (128U)    // 单行 CSV 最大长度
+
+// 32 位自由运行计数器
+typedef uint32_t (*dsp_bench_cycles_fn)(void);
+
+// 输出一行（不含换行符）
+typedef void (*dsp_bench_print_fn)(void* user, const char* line);
+
+typedef struct {
+    dsp_bench_cycles_fn cycles;
+    uint64_t cycle_hz;              // 计数频率，用于换算 samples/s（主机 TSC 可超过 4 GHz）
+    uint32_t min_cycles;            // 每个测点的计时长度
+    dsp_bench_print_fn print;
+    void* user;
+    const char* filter;             // 只运行模块名或内核名包含该字符串的用例，NULL 为全部
+} dsp_bench_config;
+
+typedef struct dsp_bench_case dsp_bench_case;
+
+// 用例：setup 准备数据与实例，返回每次调用处理的样本数，0 表示不支持该尺寸
+struct dsp_bench_case {
+    const char* kernel;
+    uint32_t param;
+    const uint16_t* sizes;          // 以 0 结尾
+    uint32_t (*setup)(const dsp_bench_case* c, uint32_t size);
+    void (*run)(void);
+};
+
+typedef struct {
+    const char* name;
+    const dsp_bench_case* cases;
+    uint16_t count;
+} dsp_bench_module;
+
+/**
+ * @brief 运行全部（或 filter 选中的）用例，逐行输出 CSV
+ * @return 输出的测点数
+ */
+uint32_t dsp_bench_run(const dsp_bench_config* cfg);
+
+#endif /* _DSP_BENCH_H */
@@ -0,0 +1,218 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench.c
+ * Description:  基准运行器：尺寸扫描、计时与 CSV 输出
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores / Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "dsp_bench_cases.h"
+
+#define DSP_BENCH_BATCHES         (3U)
+
+__ALIGNED(16) dsp_bench_buffer dsp_bench_src;
+__ALIGNED(16) dsp_bench_buffer dsp_bench_dst;
+__ALIGNED(16) dsp_bench_state_buffer dsp_bench_state;
+__ALIGNED(16) dsp_bench_coeff_buffer dsp_bench_coeffs;
+
+volatile float32_t dsp_bench_sink_f32;
+volatile q63_t dsp_bench_sink_q63;
+
+const uint16_t dsp_bench_block_sizes[] = { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 0 };
+const uint16_t dsp_bench_fir_sizes[] = { 1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 0 };
+const uint16_t dsp_bench_fft_sizes[] = { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 0 };
+const uint16_t dsp_bench_rfft_sizes[] = { 32, 64, 128, 256, 512, 1024, 2048, 4096, 0 };
+const uint16_t dsp_bench_mixed_sizes[] = { 60, 100, 120, 240, 256, 480, 1000, 1024, 2000, 4000, 0 };
+const uint16_t dsp_bench_matrix_sizes[] = { 4, 8, 16, 32, 64, 0 };
+
+static const dsp_bench_module* const dsp_bench_modules[] = {
+    &dsp_bench_basic,
+    &dsp_bench_filtering,
+    &dsp_bench_transform,
+    &dsp_bench_matrix,
+    &dsp_bench_statistics,
+};
+
+static uint32_t dsp_bench_seed;
+
+/**
+ * @brief 固定序列的 32 位伪随机数 (LCG)
+ */
+static uint32_t dsp_bench_rand(void)
+{
+    dsp_bench_seed = dsp_bench_seed * 1664525U + 1013904223U;
+    return dsp_bench_seed;
+}
+
+void dsp_bench_fill_f32(float32_t* dst, uint32_t n, float32_t amplitude)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        // 32 位有符号数映射到 [-1, 1)
+        dst[i] = amplitude * ((float32_t)(int32_t)dsp_bench_rand() * (1.0f / 2147483648.0f));
+    }
+}
+
+void dsp_bench_fill_q31(q31_t* dst, uint32_t n, float32_t amplitude)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        dst[i] = (q31_t)((float32_t)(int32_t)dsp_bench_rand() * amplitude);
+    }
+}
+
+void dsp_bench_fill_q15(q15_t* dst, uint32_t n, float32_t amplitude)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        dst[i] = (q15_t)((float32_t)((int32_t)dsp_bench_rand() >> 16) * amplitude);
+    }
+}
+
+/**
+ * @brief 64 位无符号数转十进制（newlib-nano 的 printf 不支持 %llu）
+ */
+static char* dsp_bench_u64(char* p, uint64_t value)
+{
+    char tmp[20];
+    uint32_t n = 0;
+
+    do {
+        tmp[n++] = (char)('0' + (uint32_t)(value % 10U));
+        value /= 10U;
+    } while (value != 0U);
+    while (n > 0U) {
+        *p++ = tmp[--n];
+    }
+    return p;
+}
+
+/**
+ * @brief 运行 calls 次，返回耗时
+ */
+static uint32_t dsp_bench_batch(const dsp_bench_config* cfg, const dsp_bench_case* c, uint32_t calls)
+{
+    uint32_t start = cfg->cycles();
+    uint32_t i;
+
+    for (i = 0; i < calls; i++) {
+        c->run();
+    }
+    return cfg->cycles() - start;
+}
+
+/**
+ * @brief 测量一个测点并输出一行
+ */
+static void dsp_bench_point(const dsp_bench_config* cfg, const char* module,
+                            const dsp_bench_case* c, uint32_t size, uint32_t samples)
+{
+    char line[DSP_BENCH_LINE_MAX];
+    char* p;
+    uint32_t calls = 1;
+    uint32_t best;
+    uint32_t elapsed;
+    uint32_t i;
+    uint64_t total;
+    uint64_t per_sample_x100;
+    uint64_t rate;
+
+    // 预热（缓存、分支预测、惰性初始化），再倍增调用次数直到一批足够长
+    c->run();
+    for (;;) {
+        elapsed = dsp_bench_batch(cfg, c, calls);
+        if ((elapsed >= cfg->min_cycles / DSP_BENCH_BATCHES) || (calls >= 0x40000000U)) {
+            break;
+        }
+        // 按已测耗时估算，最多放大 8 倍，避免计数分辨率造成的过冲
+        if (elapsed == 0U || (cfg->min_cycles / DSP_BENCH_BATCHES) / elapsed >= 8U) {
+            calls *= 8U;
+        } else {
+            calls *= 2U;
+        }
+    }
+
+    best = elapsed;
+    for (i = 1; i < DSP_BENCH_BATCHES; i++) {
+        elapsed = dsp_bench_batch(cfg, c, calls);
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+    if (best == 0U) {
+        best = 1U;
+    }
+
+    total = (uint64_t)calls * samples;
+    per_sample_x100 = ((uint64_t)best * 100U + total / 2U) / total;
+    rate = (uint64_t)((double)total * (double)cfg->cycle_hz / (double)best);
+
+    p = line + snprintf(line, sizeof(line), "%s,%s,%lu,%lu,%lu,%lu,%lu,",
+                        module, c->kernel, (unsigned long)c->param, (unsigned long)size,
+                        (unsigned long)samples, (unsigned long)calls,
+                        (unsigned long)((best + calls / 2U) / calls));
+    p = dsp_bench_u64(p, per_sample_x100 / 100U);
+    *p++ = '.';
+    *p++ = (char)('0' + (uint32_t)(per_sample_x100 % 100U) / 10U);
+    *p++ = (char)('0' + (uint32_t)(per_sample_x100 % 10U));
+    *p++ = ',';
+    p = dsp_bench_u64(p, rate);
+    *p = '\0';
+    cfg->print(cfg->user, line);
+}
+
+uint32_t dsp_bench_run(const dsp_bench_config* cfg)
+{
+    char line[DSP_BENCH_LINE_MAX];
+    char* p;
+    uint32_t points = 0;
+    uint32_t m;
+    uint32_t k;
+    const uint16_t* size;
+
+    p = dsp_bench_u64(line + snprintf(line, sizeof(line), "# cycle_hz "), cfg->cycle_hz);
+    snprintf(p, sizeof(line) - (size_t)(p - line), ", max block %u", (unsigned)DSP_BENCH_MAX_BLOCK);
+    cfg->print(cfg->user, line);
+    cfg->print(cfg->user, "module,kernel,param,size,samples,calls,cycles_per_call,cycles_per_sample,samples_per_s");
+
+    for (m = 0; m < sizeof(dsp_bench_modules) / sizeof(dsp_bench_modules[0]); m++) {
+        const dsp_bench_module* module = dsp_bench_modules[m];
+
+        for (k = 0; k < module->count; k++) {
+            const dsp_bench_case* c = &module->cases[k];
+
+            if ((cfg->filter != NULL) && (strstr(module->name, cfg->filter) == NULL) &&
+                (strstr(c->kernel, cfg->filter) == NULL)) {
+                continue;
+            }
+            for (size = c->sizes; *size != 0U; size++) {
+                uint32_t samples;
+
+                if (*size > DSP_BENCH_MAX_BLOCK) {
+                    break;
+                }
+                dsp_bench_seed = 1U;
+                samples = c->setup(c, *size);
+                if (samples == 0U) {
+                    continue;
+                }
+                dsp_bench_point(cfg, module->name, c, *size, samples);
+                points++;
+            }
+        }
+    }
+    return points;
+}
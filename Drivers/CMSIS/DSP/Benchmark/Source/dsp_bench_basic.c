@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench_basic.c
+ * Description:  基础运算基准用例（逐元素运算与点积）
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores / Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "dsp_bench_cases.h"
+
+// 两个输入向量分别位于 dsp_bench_src 的前后两半
+#define SRC_A_F32   (&dsp_bench_src.f32[0])
+#define SRC_B_F32   (&dsp_bench_src.f32[DSP_BENCH_MAX_BLOCK])
+#define SRC_A_Q31   (&dsp_bench_src.q31[0])
+#define SRC_B_Q31   (&dsp_bench_src.q31[DSP_BENCH_MAX_BLOCK])
+#define SRC_A_Q15   (&dsp_bench_src.q15[0])
+#define SRC_B_Q15   (&dsp_bench_src.q15[DSP_BENCH_MAX_BLOCK])
+
+static uint32_t block;
+
+static uint32_t setup_f32(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    dsp_bench_fill_f32(SRC_A_F32, size, 1.0f);
+    dsp_bench_fill_f32(SRC_B_F32, size, 1.0f);
+    block = size;
+    return size;
+}
+
+static uint32_t setup_q31(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    dsp_bench_fill_q31(SRC_A_Q31, size, 0.5f);
+    dsp_bench_fill_q31(SRC_B_Q31, size, 0.5f);
+    block = size;
+    return size;
+}
+
+static uint32_t setup_q15(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    dsp_bench_fill_q15(SRC_A_Q15, size, 0.5f);
+    dsp_bench_fill_q15(SRC_B_Q15, size, 0.5f);
+    block = size;
+    return size;
+}
+
+static void run_add_f32(void)
+{
+    arm_add_f32(SRC_A_F32, SRC_B_F32, dsp_bench_dst.f32, block);
+}
+
+static void run_mult_f32(void)
+{
+    arm_mult_f32(SRC_A_F32, SRC_B_F32, dsp_bench_dst.f32, block);
+}
+
+static void run_scale_f32(void)
+{
+    arm_scale_f32(SRC_A_F32, 0.75f, dsp_bench_dst.f32, block);
+}
+
+static void run_dot_prod_f32(void)
+{
+    float32_t result;
+
+    arm_dot_prod_f32(SRC_A_F32, SRC_B_F32, block, &result);
+    dsp_bench_sink_f32 = result;
+}
+
+static void run_add_q31(void)
+{
+    arm_add_q31(SRC_A_Q31, SRC_B_Q31, dsp_bench_dst.q31, block);
+}
+
+static void run_dot_prod_q31(void)
+{
+    q63_t result;
+
+    arm_dot_prod_q31(SRC_A_Q31, SRC_B_Q31, block, &result);
+    dsp_bench_sink_q63 = result;
+}
+
+static void run_add_q15(void)
+{
+    arm_add_q15(SRC_A_Q15, SRC_B_Q15, dsp_bench_dst.q15, block);
+}
+
+static void run_mult_q15(void)
+{
+    arm_mult_q15(SRC_A_Q15, SRC_B_Q15, dsp_bench_dst.q15, block);
+}
+
+static void run_scale_q15(void)
+{
+    arm_scale_q15(SRC_A_Q15, 0x6000, 0, dsp_bench_dst.q15, block);
+}
+
+static void run_dot_prod_q15(void)
+{
+    q63_t result;
+
+    arm_dot_prod_q15(SRC_A_Q15, SRC_B_Q15, block, &result);
+    dsp_bench_sink_q63 = result;
+}
+
+static const dsp_bench_case cases[] = {
+    { "add_f32",      0, dsp_bench_block_sizes, setup_f32, run_add_f32 },
+    { "mult_f32",     0, dsp_bench_block_sizes, setup_f32, run_mult_f32 },
+    { "scale_f32",    0, dsp_bench_block_sizes, setup_f32, run_scale_f32 },
+    { "dot_prod_f32", 0, dsp_bench_block_sizes, setup_f32, run_dot_prod_f32 },
+    { "add_q31",      0, dsp_bench_block_sizes, setup_q31, run_add_q31 },
+    { "dot_prod_q31", 0, dsp_bench_block_sizes, setup_q31, run_dot_prod_q31 },
+    { "add_q15",      0, dsp_bench_block_sizes, setup_q15, run_add_q15 },
+    { "mult_q15",     0, dsp_bench_block_sizes, setup_q15, run_mult_q15 },
+    { "scale_q15",    0, dsp_bench_block_sizes, setup_q15, run_scale_q15 },
+    { "dot_prod_q15", 0, dsp_bench_block_sizes, setup_q15, run_dot_prod_q15 },
+};
+
+const dsp_bench_module dsp_bench_basic = { "basic", cases, DSP_BENCH_COUNT(cases) };
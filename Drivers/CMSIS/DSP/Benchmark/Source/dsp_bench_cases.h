@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench_cases.h
+ * Description:  基准用例共用的缓冲区、尺寸表与数据生成
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores / Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _DSP_BENCH_CASES_H
+#define _DSP_BENCH_CASES_H
+
+#include "arm_math.h"
+#include "dsp_bench.h"
+
+#define DSP_BENCH_BUF_WORDS       (2U * DSP_BENCH_MAX_BLOCK)
+#define DSP_BENCH_STATE_WORDS     (2U * DSP_BENCH_MAX_BLOCK + DSP_BENCH_TAPS_MAX)
+
+/*
+ * 用例共用的静态缓冲区（同一时刻只运行一个用例），按 32 位字分配，
+ * 定点内核直接按 q31_t / q15_t 使用；16 字节对齐便于向量化实现。
+ * 复数数据交错存放，最多 DSP_BENCH_MAX_BLOCK 点。
+ */
+typedef union {
+    float32_t f32[DSP_BENCH_BUF_WORDS];
+    q31_t q31[DSP_BENCH_BUF_WORDS];
+    q15_t q15[2U * DSP_BENCH_BUF_WORDS];
+} dsp_bench_buffer;
+
+typedef union {
+    float32_t f32[DSP_BENCH_STATE_WORDS];
+    q31_t q31[DSP_BENCH_STATE_WORDS];
+    q15_t q15[2U * DSP_BENCH_STATE_WORDS];
+} dsp_bench_state_buffer;
+
+typedef union {
+    float32_t f32[DSP_BENCH_TAPS_MAX];
+    q31_t q31[DSP_BENCH_TAPS_MAX];
+    q15_t q15[2U * DSP_BENCH_TAPS_MAX];
+} dsp_bench_coeff_buffer;
+
+extern dsp_bench_buffer dsp_bench_src;
+extern dsp_bench_buffer dsp_bench_dst;
+extern dsp_bench_state_buffer dsp_bench_state;
+extern dsp_bench_coeff_buffer dsp_bench_coeffs;
+
+// 防止结果被优化掉
+extern volatile float32_t dsp_bench_sink_f32;
+extern volatile q63_t dsp_bench_sink_q63;
+
+// 尺寸表（以 0 结尾，超过 DSP_BENCH_MAX_BLOCK 的尺寸由运行器跳过）
+extern const uint16_t dsp_bench_block_sizes[];     // 16 ~ 4096
+extern const uint16_t dsp_bench_fir_sizes[];       // 1 ~ 4096（含短块，体现状态搬移开销）
+extern const uint16_t dsp_bench_fft_sizes[];       // 16 ~ 4096
+extern const uint16_t dsp_bench_rfft_sizes[];      // 32 ~ 4096
+extern const uint16_t dsp_bench_mixed_sizes[];     // 60 ~ 4000（因子 2/3/5 的长度，含 256、1024 作对照）
+extern const uint16_t dsp_bench_matrix_sizes[];    // 4 ~ 64（维数）
+
+// 均匀分布伪随机数 [-amplitude, amplitude)，序列固定
+void dsp_bench_fill_f32(float32_t* dst, uint32_t n, float32_t amplitude);
+void dsp_bench_fill_q31(q31_t* dst, uint32_t n, float32_t amplitude);
+void dsp_bench_fill_q15(q15_t* dst, uint32_t n, float32_t amplitude);
+
+// 各模块用例表
+extern const dsp_bench_module dsp_bench_basic;
+extern const dsp_bench_module dsp_bench_filtering;
+extern const dsp_bench_module dsp_bench_transform;
+extern const dsp_bench_module dsp_bench_matrix;
+extern const dsp_bench_module dsp_bench_statistics;
+
+#define DSP_BENCH_COUNT(a)        ((uint16_t)(sizeof(a) / sizeof((a)[0])))
+
+#endif /* _DSP_BENCH_CASES_H */
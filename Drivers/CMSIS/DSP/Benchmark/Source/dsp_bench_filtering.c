@@ -0,0 +1,411 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench_filtering.c
+ * Description:  滤波基准用例（FIR、环形状态 FIR、抽取 FIR、L/M 重采样、biquad）
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores / Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "dsp_bench_cases.h"
+
+#define DECIMATE_TAPS           (32U)   // 抽取用例的抽头数，param 为抽取因子
+#define RESAMPLE_TAPS_MAX       DSP_BENCH_TAPS_MAX  // 重采样原型滤波器抽头数上限，每相 RESAMPLE_TAPS_MAX / L 个
+
+/*
+ * 二阶 Butterworth 低通 (fc = 0.1 fs)，CMSIS 约定反馈系数取反：
+ * y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2]
+ * 定点版本系数减半，postShift = 1
+ */
+static const float32_t biquad_lp[5] = { 0.0674553f, 0.1349105f, 0.0674553f, 1.1429805f, -0.4128016f };
+
+static uint32_t block;
+
+static arm_fir_instance_f32 fir_f32;
+static arm_fir_instance_q31 fir_q31;
+static arm_fir_instance_q15 fir_q15;
+static arm_fir_circ_instance_f32 fir_circ_f32;
+static arm_fir_circ_instance_q31 fir_circ_q31;
+static arm_fir_circ_instance_q15 fir_circ_q15;
+static arm_fir_decimate_instance_f32 decimate_f32;
+static arm_fir_decimate_instance_q31 decimate_q31;
+static arm_fir_resample_instance_f32 resample_f32;
+static arm_fir_resample_instance_q31 resample_q31;
+static arm_fir_resample_instance_q15 resample_q15;
+static arm_fir_interpolate_instance_f32 cascade_interp_f32;
+static arm_fir_decimate_instance_f32 cascade_decim_f32;
+static float32_t cascade_unity = 1.0f;  // 级联方案中抽取级的单位滤波器，抗混叠已由插值滤波器完成
+static uint32_t resample_block;
+static arm_biquad_casd_df1_inst_f32 df1_f32;
+static arm_biquad_cascade_df2T_instance_f32 df2T_f32;
+static arm_biquad_casd_df1_inst_q31 df1_q31;
+static arm_biquad_casd_df1_inst_q15 df1_q15;
+
+static uint32_t setup_fir_f32(const dsp_bench_case* c, uint32_t size)
+{
+    dsp_bench_fill_f32(dsp_bench_src.f32, size, 1.0f);
+    dsp_bench_fill_f32(dsp_bench_coeffs.f32, c->param, 1.0f / (float32_t)c->param);
+    arm_fir_init_f32(&fir_f32, (uint16_t)c->param, dsp_bench_coeffs.f32, dsp_bench_state.f32, size);
+    block = size;
+    return size;
+}
+
+static uint32_t setup_fir_q31(const dsp_bench_case* c, uint32_t size)
+{
+    dsp_bench_fill_q31(dsp_bench_src.q31, size, 0.5f);
+    dsp_bench_fill_q31(dsp_bench_coeffs.q31, c->param, 1.0f / (float32_t)c->param);
+    arm_fir_init_q31(&fir_q31, (uint16_t)c->param, dsp_bench_coeffs.q31, dsp_bench_state.q31, size);
+    block = size;
+    return size;
+}
+
+static uint32_t setup_fir_q15(const dsp_bench_case* c, uint32_t size)
+{
+    dsp_bench_fill_q15(dsp_bench_src.q15, size, 0.5f);
+    dsp_bench_fill_q15(dsp_bench_coeffs.q15, c->param, 1.0f / (float32_t)c->param);
+    if (arm_fir_init_q15(&fir_q15, (uint16_t)c->param, dsp_bench_coeffs.q15,
+                         dsp_bench_state.q15, size) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    block = size;
+    return size;
+}
+
+static uint32_t setup_fir_circ_f32(const dsp_bench_case* c, uint32_t size)
+{
+    dsp_bench_fill_f32(dsp_bench_src.f32, size, 1.0f);
+    dsp_bench_fill_f32(dsp_bench_coeffs.f32, c->param, 1.0f / (float32_t)c->param);
+    arm_fir_circ_init_f32(&fir_circ_f32, (uint16_t)c->param, dsp_bench_coeffs.f32, dsp_bench_state.f32);
+    block = size;
+    return size;
+}
+
+static uint32_t setup_fir_circ_q31(const dsp_bench_case* c, uint32_t size)
+{
+    dsp_bench_fill_q31(dsp_bench_src.q31, size, 0.5f);
+    dsp_bench_fill_q31(dsp_bench_coeffs.q31, c->param, 1.0f / (float32_t)c->param);
+    arm_fir_circ_init_q31(&fir_circ_q31, (uint16_t)c->param, dsp_bench_coeffs.q31, dsp_bench_state.q31);
+    block = size;
+    return size;
+}
+
+static uint32_t setup_fir_circ_q15(const dsp_bench_case* c, uint32_t size)
+{
+    dsp_bench_fill_q15(dsp_bench_src.q15, size, 0.5f);
+    dsp_bench_fill_q15(dsp_bench_coeffs.q15, c->param, 1.0f / (float32_t)c->param);
+    arm_fir_circ_init_q15(&fir_circ_q15, (uint16_t)c->param, dsp_bench_coeffs.q15, dsp_bench_state.q15);
+    block = size;
+    return size;
+}
+
+static uint32_t setup_decimate_f32(const dsp_bench_case* c, uint32_t size)
+{
+    dsp_bench_fill_f32(dsp_bench_src.f32, size, 1.0f);
+    dsp_bench_fill_f32(dsp_bench_coeffs.f32, DECIMATE_TAPS, 1.0f / DECIMATE_TAPS);
+    if (arm_fir_decimate_init_f32(&decimate_f32, DECIMATE_TAPS, (uint8_t)c->param,
+                                  dsp_bench_coeffs.f32, dsp_bench_state.f32, size) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    block = size;
+    return size;
+}
+
+static uint32_t setup_decimate_q31(const dsp_bench_case* c, uint32_t size)
+{
+    dsp_bench_fill_q31(dsp_bench_src.q31, size, 0.5f);
+    dsp_bench_fill_q31(dsp_bench_coeffs.q31, DECIMATE_TAPS, 1.0f / DECIMATE_TAPS);
+    if (arm_fir_decimate_init_q31(&decimate_q31, DECIMATE_TAPS, (uint8_t)c->param,
+                                  dsp_bench_coeffs.q31, dsp_bench_state.q31, size) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    block = size;
+    return size;
+}
+
+/*
+ * 重采样用例 param = L * 1000 + M，原型滤波器 RESAMPLE_TAPS_MAX 抽头（每相 RESAMPLE_TAPS_MAX / L 个）。
+ * 输入块长取 size 向下对齐到 M 的倍数，每次调用恰好输出 block * L / M 个样本，samples 按输出计，
+ * 因此 cycles_per_sample 直接对应“每个输出的代价”：多相为 phaseLength 次乘加，
+ * 级联（先插值再抽取）为 M * phaseLength 次。
+ */
+static uint32_t resample_geometry(const dsp_bench_case* c, uint32_t size, uint16_t* L, uint16_t* M)
+{
+    *L = (uint16_t)(c->param / 1000U);
+    *M = (uint16_t)(c->param % 1000U);
+    resample_block = size - size % *M;
+    if (resample_block == 0U) {
+        return 0;
+    }
+    return resample_block * *L / *M;
+}
+
+static uint32_t setup_resample_f32(const dsp_bench_case* c, uint32_t size)
+{
+    uint16_t L, M;
+    uint32_t outputs = resample_geometry(c, size, &L, &M);
+    uint16_t num_taps = (uint16_t)(RESAMPLE_TAPS_MAX / L * L);
+
+    if (outputs == 0U || outputs > 2U * DSP_BENCH_MAX_BLOCK) {
+        return 0;
+    }
+    dsp_bench_fill_f32(dsp_bench_src.f32, resample_block, 1.0f);
+    dsp_bench_fill_f32(dsp_bench_coeffs.f32, num_taps, (float32_t)L / (float32_t)num_taps);
+    if (arm_fir_resample_init_f32(&resample_f32, L, M, num_taps, dsp_bench_coeffs.f32,
+                                  dsp_bench_state.f32, resample_block) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    return outputs;
+}
+
+static uint32_t setup_resample_q31(const dsp_bench_case* c, uint32_t size)
+{
+    uint16_t L, M;
+    uint32_t outputs = resample_geometry(c, size, &L, &M);
+    uint16_t num_taps = (uint16_t)(RESAMPLE_TAPS_MAX / L * L);
+
+    if (outputs == 0U || outputs > 2U * DSP_BENCH_MAX_BLOCK) {
+        return 0;
+    }
+    dsp_bench_fill_q31(dsp_bench_src.q31, resample_block, 0.5f);
+    dsp_bench_fill_q31(dsp_bench_coeffs.q31, num_taps, (float32_t)L / (float32_t)num_taps);
+    if (arm_fir_resample_init_q31(&resample_q31, L, M, num_taps, dsp_bench_coeffs.q31,
+                                  dsp_bench_state.q31, resample_block) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    return outputs;
+}
+
+static uint32_t setup_resample_q15(const dsp_bench_case* c, uint32_t size)
+{
+    uint16_t L, M;
+    uint32_t outputs = resample_geometry(c, size, &L, &M);
+    uint16_t num_taps = (uint16_t)(RESAMPLE_TAPS_MAX / L * L);
+
+    if (outputs == 0U || outputs > 2U * DSP_BENCH_MAX_BLOCK) {
+        return 0;
+    }
+    dsp_bench_fill_q15(dsp_bench_src.q15, resample_block, 0.5f);
+    dsp_bench_fill_q15(dsp_bench_coeffs.q15, num_taps, (float32_t)L / (float32_t)num_taps);
+    if (arm_fir_resample_init_q15(&resample_q15, L, M, num_taps, dsp_bench_coeffs.q15,
+                                  dsp_bench_state.q15, resample_block) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    return outputs;
+}
+
+// 级联：插值输出暂存 dsp_bench_dst，抽取状态放在 dsp_bench_state 后半，结果写入 dsp_bench_src 后半
+static uint32_t setup_resample_cascade_f32(const dsp_bench_case* c, uint32_t size)
+{
+    uint16_t L, M;
+    uint32_t outputs = resample_geometry(c, size, &L, &M);
+    uint16_t num_taps = (uint16_t)(RESAMPLE_TAPS_MAX / L * L);
+
+    if (outputs == 0U || resample_block * L > DSP_BENCH_MAX_BLOCK || L > 255U || M > 255U) {
+        return 0;
+    }
+    dsp_bench_fill_f32(dsp_bench_src.f32, resample_block, 1.0f);
+    dsp_bench_fill_f32(dsp_bench_coeffs.f32, num_taps, (float32_t)L / (float32_t)num_taps);
+    if (arm_fir_interpolate_init_f32(&cascade_interp_f32, (uint8_t)L, num_taps, dsp_bench_coeffs.f32,
+                                     dsp_bench_state.f32, resample_block) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    if (arm_fir_decimate_init_f32(&cascade_decim_f32, 1U, (uint8_t)M, &cascade_unity,
+                                  &dsp_bench_state.f32[DSP_BENCH_MAX_BLOCK + DSP_BENCH_TAPS_MAX],
+                                  resample_block * L) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    return outputs;
+}
+
+static uint32_t setup_biquad_f32(const dsp_bench_case* c, uint32_t size)
+{
+    uint32_t stage;
+
+    for (stage = 0; stage < c->param; stage++) {
+        memcpy(&dsp_bench_coeffs.f32[5U * stage], biquad_lp, sizeof(biquad_lp));
+    }
+    dsp_bench_fill_f32(dsp_bench_src.f32, size, 1.0f);
+    arm_biquad_cascade_df1_init_f32(&df1_f32, (uint8_t)c->param, dsp_bench_coeffs.f32, dsp_bench_state.f32);
+    arm_biquad_cascade_df2T_init_f32(&df2T_f32, (uint8_t)c->param, dsp_bench_coeffs.f32, dsp_bench_state.f32);
+    block = size;
+    return size;
+}
+
+static uint32_t setup_biquad_q31(const dsp_bench_case* c, uint32_t size)
+{
+    uint32_t stage;
+    uint32_t i;
+
+    for (stage = 0; stage < c->param; stage++) {
+        for (i = 0; i < 5U; i++) {
+            dsp_bench_coeffs.q31[5U * stage + i] = (q31_t)(biquad_lp[i] * 0.5f * 2147483648.0f);
+        }
+    }
+    dsp_bench_fill_q31(dsp_bench_src.q31, size, 0.5f);
+    arm_biquad_cascade_df1_init_q31(&df1_q31, (uint8_t)c->param, dsp_bench_coeffs.q31, dsp_bench_state.q31, 1);
+    block = size;
+    return size;
+}
+
+static uint32_t setup_biquad_q15(const dsp_bench_case* c, uint32_t size)
+{
+    uint32_t stage;
+
+    // q15 每级 6 个系数 {b0, 0, b1, b2, a1, a2}
+    for (stage = 0; stage < c->param; stage++) {
+        q15_t* coeffs = &dsp_bench_coeffs.q15[6U * stage];
+
+        coeffs[0] = (q15_t)(biquad_lp[0] * 0.5f * 32768.0f);
+        coeffs[1] = 0;
+        coeffs[2] = (q15_t)(biquad_lp[1] * 0.5f * 32768.0f);
+        coeffs[3] = (q15_t)(biquad_lp[2] * 0.5f * 32768.0f);
+        coeffs[4] = (q15_t)(biquad_lp[3] * 0.5f * 32768.0f);
+        coeffs[5] = (q15_t)(biquad_lp[4] * 0.5f * 32768.0f);
+    }
+    dsp_bench_fill_q15(dsp_bench_src.q15, size, 0.5f);
+    arm_biquad_cascade_df1_init_q15(&df1_q15, (uint8_t)c->param, dsp_bench_coeffs.q15, dsp_bench_state.q15, 1);
+    block = size;
+    return size;
+}
+
+static void run_fir_f32(void)
+{
+    arm_fir_f32(&fir_f32, dsp_bench_src.f32, dsp_bench_dst.f32, block);
+}
+
+static void run_fir_q31(void)
+{
+    arm_fir_q31(&fir_q31, dsp_bench_src.q31, dsp_bench_dst.q31, block);
+}
+
+static void run_fir_fast_q31(void)
+{
+    arm_fir_fast_q31(&fir_q31, dsp_bench_src.q31, dsp_bench_dst.q31, block);
+}
+
+static void run_fir_q15(void)
+{
+    arm_fir_q15(&fir_q15, dsp_bench_src.q15, dsp_bench_dst.q15, block);
+}
+
+static void run_fir_fast_q15(void)
+{
+    arm_fir_fast_q15(&fir_q15, dsp_bench_src.q15, dsp_bench_dst.q15, block);
+}
+
+static void run_fir_circ_f32(void)
+{
+    arm_fir_circ_f32(&fir_circ_f32, dsp_bench_src.f32, dsp_bench_dst.f32, block);
+}
+
+static void run_fir_circ_q31(void)
+{
+    arm_fir_circ_q31(&fir_circ_q31, dsp_bench_src.q31, dsp_bench_dst.q31, block);
+}
+
+static void run_fir_circ_q15(void)
+{
+    arm_fir_circ_q15(&fir_circ_q15, dsp_bench_src.q15, dsp_bench_dst.q15, block);
+}
+
+static void run_decimate_f32(void)
+{
+    arm_fir_decimate_f32(&decimate_f32, dsp_bench_src.f32, dsp_bench_dst.f32, block);
+}
+
+static void run_decimate_q31(void)
+{
+    arm_fir_decimate_q31(&decimate_q31, dsp_bench_src.q31, dsp_bench_dst.q31, block);
+}
+
+static void run_resample_f32(void)
+{
+    (void)arm_fir_resample_f32(&resample_f32, dsp_bench_src.f32, dsp_bench_dst.f32, resample_block);
+}
+
+static void run_resample_q31(void)
+{
+    (void)arm_fir_resample_q31(&resample_q31, dsp_bench_src.q31, dsp_bench_dst.q31, resample_block);
+}
+
+static void run_resample_q15(void)
+{
+    (void)arm_fir_resample_q15(&resample_q15, dsp_bench_src.q15, dsp_bench_dst.q15, resample_block);
+}
+
+static void run_resample_cascade_f32(void)
+{
+    arm_fir_interpolate_f32(&cascade_interp_f32, dsp_bench_src.f32, dsp_bench_dst.f32, resample_block);
+    arm_fir_decimate_f32(&cascade_decim_f32, dsp_bench_dst.f32, &dsp_bench_src.f32[DSP_BENCH_MAX_BLOCK],
+                         resample_block * cascade_interp_f32.L);
+}
+
+static void run_df1_f32(void)
+{
+    arm_biquad_cascade_df1_f32(&df1_f32, dsp_bench_src.f32, dsp_bench_dst.f32, block);
+}
+
+static void run_df2T_f32(void)
+{
+    arm_biquad_cascade_df2T_f32(&df2T_f32, dsp_bench_src.f32, dsp_bench_dst.f32, block);
+}
+
+static void run_df1_q31(void)
+{
+    arm_biquad_cascade_df1_q31(&df1_q31, dsp_bench_src.q31, dsp_bench_dst.q31, block);
+}
+
+static void run_df1_fast_q31(void)
+{
+    arm_biquad_cascade_df1_fast_q31(&df1_q31, dsp_bench_src.q31, dsp_bench_dst.q31, block);
+}
+
+static void run_df1_q15(void)
+{
+    arm_biquad_cascade_df1_q15(&df1_q15, dsp_bench_src.q15, dsp_bench_dst.q15, block);
+}
+
+/*
+ * FIR 与环形状态 FIR 用相同抽头数、从 1 个样本起扫描块长，两者 cycles_per_sample 的交点
+ * 即为状态搬移开销与双写开销持平的块长
+ */
+static const dsp_bench_case cases[] = {
+    { "fir_f32",                 32, dsp_bench_fir_sizes,   setup_fir_f32,              run_fir_f32 },
+    { "fir_f32",                256, dsp_bench_fir_sizes,   setup_fir_f32,              run_fir_f32 },
+    { "fir_circ_f32",            32, dsp_bench_fir_sizes,   setup_fir_circ_f32,         run_fir_circ_f32 },
+    { "fir_circ_f32",           256, dsp_bench_fir_sizes,   setup_fir_circ_f32,         run_fir_circ_f32 },
+    { "fir_q31",                 32, dsp_bench_fir_sizes,   setup_fir_q31,              run_fir_q31 },
+    { "fir_q31",                256, dsp_bench_fir_sizes,   setup_fir_q31,              run_fir_q31 },
+    { "fir_circ_q31",            32, dsp_bench_fir_sizes,   setup_fir_circ_q31,         run_fir_circ_q31 },
+    { "fir_circ_q31",           256, dsp_bench_fir_sizes,   setup_fir_circ_q31,         run_fir_circ_q31 },
+    { "fir_fast_q31",            32, dsp_bench_block_sizes, setup_fir_q31,              run_fir_fast_q31 },
+    { "fir_q15",                 32, dsp_bench_fir_sizes,   setup_fir_q15,              run_fir_q15 },
+    { "fir_q15",                256, dsp_bench_fir_sizes,   setup_fir_q15,              run_fir_q15 },
+    { "fir_circ_q15",            32, dsp_bench_fir_sizes,   setup_fir_circ_q15,         run_fir_circ_q15 },
+    { "fir_circ_q15",           256, dsp_bench_fir_sizes,   setup_fir_circ_q15,         run_fir_circ_q15 },
+    { "fir_fast_q15",            32, dsp_bench_block_sizes, setup_fir_q15,              run_fir_fast_q15 },
+    { "fir_decimate_f32",         4, dsp_bench_block_sizes, setup_decimate_f32,         run_decimate_f32 },
+    { "fir_decimate_q31",         4, dsp_bench_block_sizes, setup_decimate_q31,         run_decimate_q31 },
+    { "resample_f32",          2003, dsp_bench_block_sizes, setup_resample_f32,         run_resample_f32 },
+    { "resample_f32",         32025, dsp_bench_block_sizes, setup_resample_f32,         run_resample_f32 },
+    { "resample_cascade_f32",  2003, dsp_bench_block_sizes, setup_resample_cascade_f32, run_resample_cascade_f32 },
+    { "resample_cascade_f32", 32025, dsp_bench_block_sizes, setup_resample_cascade_f32, run_resample_cascade_f32 },
+    { "resample_q31",          2003, dsp_bench_block_sizes, setup_resample_q31,         run_resample_q31 },
+    { "resample_q31",         32025, dsp_bench_block_sizes, setup_resample_q31,         run_resample_q31 },
+    { "resample_q15",          2003, dsp_bench_block_sizes, setup_resample_q15,         run_resample_q15 },
+    { "resample_q15",         32025, dsp_bench_block_sizes, setup_resample_q15,         run_resample_q15 },
+    { "biquad_df1_f32",           4, dsp_bench_block_sizes, setup_biquad_f32,           run_df1_f32 },
+    { "biquad_df2T_f32",          4, dsp_bench_block_sizes, setup_biquad_f32,           run_df2T_f32 },
+    { "biquad_df1_q31",           4, dsp_bench_block_sizes, setup_biquad_q31,           run_df1_q31 },
+    { "biquad_df1_fast_q31",      4, dsp_bench_block_sizes, setup_biquad_q31,           run_df1_fast_q31 },
+    { "biquad_df1_q15",           4, dsp_bench_block_sizes, setup_biquad_q15,           run_df1_q15 },
+};
+
+const dsp_bench_module dsp_bench_filtering = { "filtering", cases, DSP_BENCH_COUNT(cases) };
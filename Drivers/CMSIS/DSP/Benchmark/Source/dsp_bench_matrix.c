@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench_matrix.c
+ * Description:  矩阵基准用例（方阵乘法、转置、加法）
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores / Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "dsp_bench_cases.h"
+
+/*
+ * 尺寸为方阵维数 n，samples 为输出元素数 n * n。
+ * A、B 分别位于 dsp_bench_src 的前后两半，每个矩阵最多 DSP_BENCH_MAX_BLOCK 个元素；
+ * q15 乘法的转置暂存区使用 dsp_bench_state。
+ */
+
+static arm_matrix_instance_f32 a_f32, b_f32, c_f32;
+static arm_matrix_instance_q31 a_q31, b_q31, c_q31;
+static arm_matrix_instance_q15 a_q15, b_q15, c_q15;
+
+static uint32_t setup_f32(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    uint32_t n = size * size;
+
+    if (n > DSP_BENCH_MAX_BLOCK) {
+        return 0;
+    }
+    arm_mat_init_f32(&a_f32, (uint16_t)size, (uint16_t)size, &dsp_bench_src.f32[0]);
+    arm_mat_init_f32(&b_f32, (uint16_t)size, (uint16_t)size, &dsp_bench_src.f32[DSP_BENCH_MAX_BLOCK]);
+    arm_mat_init_f32(&c_f32, (uint16_t)size, (uint16_t)size, dsp_bench_dst.f32);
+    dsp_bench_fill_f32(a_f32.pData, n, 1.0f);
+    dsp_bench_fill_f32(b_f32.pData, n, 1.0f);
+    return n;
+}
+
+static uint32_t setup_q31(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    uint32_t n = size * size;
+
+    if (n > DSP_BENCH_MAX_BLOCK) {
+        return 0;
+    }
+    arm_mat_init_q31(&a_q31, (uint16_t)size, (uint16_t)size, &dsp_bench_src.q31[0]);
+    arm_mat_init_q31(&b_q31, (uint16_t)size, (uint16_t)size, &dsp_bench_src.q31[DSP_BENCH_MAX_BLOCK]);
+    arm_mat_init_q31(&c_q31, (uint16_t)size, (uint16_t)size, dsp_bench_dst.q31);
+    dsp_bench_fill_q31(a_q31.pData, n, 1.0f / (float32_t)size);
+    dsp_bench_fill_q31(b_q31.pData, n, 0.5f);
+    return n;
+}
+
+static uint32_t setup_q15(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    uint32_t n = size * size;
+
+    if (n > DSP_BENCH_MAX_BLOCK) {
+        return 0;
+    }
+    arm_mat_init_q15(&a_q15, (uint16_t)size, (uint16_t)size, &dsp_bench_src.q15[0]);
+    arm_mat_init_q15(&b_q15, (uint16_t)size, (uint16_t)size, &dsp_bench_src.q15[DSP_BENCH_MAX_BLOCK]);
+    arm_mat_init_q15(&c_q15, (uint16_t)size, (uint16_t)size, dsp_bench_dst.q15);
+    dsp_bench_fill_q15(a_q15.pData, n, 1.0f / (float32_t)size);
+    dsp_bench_fill_q15(b_q15.pData, n, 0.5f);
+    return n;
+}
+
+static void run_mult_f32(void)
+{
+    arm_mat_mult_f32(&a_f32, &b_f32, &c_f32);
+}
+
+static void run_trans_f32(void)
+{
+    arm_mat_trans_f32(&a_f32, &c_f32);
+}
+
+static void run_add_f32(void)
+{
+    arm_mat_add_f32(&a_f32, &b_f32, &c_f32);
+}
+
+static void run_mult_q31(void)
+{
+    arm_mat_mult_q31(&a_q31, &b_q31, &c_q31);
+}
+
+static void run_mult_fast_q31(void)
+{
+    arm_mat_mult_fast_q31(&a_q31, &b_q31, &c_q31);
+}
+
+static void run_mult_q15(void)
+{
+    arm_mat_mult_q15(&a_q15, &b_q15, &c_q15, dsp_bench_state.q15);
+}
+
+static void run_mult_fast_q15(void)
+{
+    arm_mat_mult_fast_q15(&a_q15, &b_q15, &c_q15, dsp_bench_state.q15);
+}
+
+static const dsp_bench_case cases[] = {
+    { "mat_mult_f32",      0, dsp_bench_matrix_sizes, setup_f32, run_mult_f32 },
+    { "mat_trans_f32",     0, dsp_bench_matrix_sizes, setup_f32, run_trans_f32 },
+    { "mat_add_f32",       0, dsp_bench_matrix_sizes, setup_f32, run_add_f32 },
+    { "mat_mult_q31",      0, dsp_bench_matrix_sizes, setup_q31, run_mult_q31 },
+    { "mat_mult_fast_q31", 0, dsp_bench_matrix_sizes, setup_q31, run_mult_fast_q31 },
+    { "mat_mult_q15",      0, dsp_bench_matrix_sizes, setup_q15, run_mult_q15 },
+    { "mat_mult_fast_q15", 0, dsp_bench_matrix_sizes, setup_q15, run_mult_fast_q15 },
+};
+
+const dsp_bench_module dsp_bench_matrix = { "matrix", cases, DSP_BENCH_COUNT(cases) };
@@ -0,0 +1,427 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench_statistics.c
+ * Description:  统计基准用例（均值、方差、均方根、最值、滑动窗口统计、排序与中值）
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores / Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "dsp_bench_cases.h"
+
+/*
+ * window_* 用例的尺寸为窗口长度，每次调用推入 1 个新样本并读出均值、方差、最小值、最大值，samples 为 1：
+ * window_block_* 对整个窗口重新调用块函数 (O(N))，window_sliding_* 用 arm_sliding_stats_* 增量更新 (O(1))。
+ * 样本环位于 dsp_bench_state，最大/最小值队列位于 dsp_bench_dst 的前后两半。
+ *
+ * median_* 用例的尺寸同样为窗口长度，每次调用输出 1 个中值，samples 为 1：
+ * median_select_* 把窗口复制到 dsp_bench_dst 后用快速选择求 50% 分位数 (O(N))，
+ * percentile_f32 相同但求 param% 分位数（秩一般不是整数，多一次求后继最小值），
+ * median_filter_* 用 arm_median_filter_* 双堆增量更新 (O(log N))，堆索引位于 dsp_bench_dst。
+ * sort_* 的尺寸为块长，src -> dst，暂存区使用 dsp_bench_state。
+ */
+
+static uint32_t block;
+static uint32_t next;                   // 下一个推入样本在 dsp_bench_src 中的位置
+static float32_t percentile;            // select_f32 用例的百分位
+static arm_sliding_stats_instance_f32 sliding_f32;
+static arm_sliding_stats_instance_q31 sliding_q31;
+static arm_sliding_stats_instance_q15 sliding_q15;
+static arm_median_filter_instance_f32 median_f32;
+static arm_median_filter_instance_q31 median_q31;
+static arm_median_filter_instance_q15 median_q15;
+
+static uint32_t setup_f32(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    dsp_bench_fill_f32(dsp_bench_src.f32, size, 1.0f);
+    block = size;
+    return size;
+}
+
+static uint32_t setup_q31(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    dsp_bench_fill_q31(dsp_bench_src.q31, size, 0.5f);
+    block = size;
+    return size;
+}
+
+static uint32_t setup_q15(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    dsp_bench_fill_q15(dsp_bench_src.q15, size, 0.5f);
+    block = size;
+    return size;
+}
+
+static uint32_t setup_sliding_f32(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    dsp_bench_fill_f32(dsp_bench_src.f32, 2U * size, 1.0f);
+    arm_sliding_stats_init_f32(&sliding_f32, (uint16_t)size, dsp_bench_state.f32,
+                               (uint16_t*)&dsp_bench_dst.q15[0], (uint16_t*)&dsp_bench_dst.q15[DSP_BENCH_BUF_WORDS]);
+    arm_sliding_stats_f32(&sliding_f32, dsp_bench_src.f32, size);
+    block = size;
+    next = 0;
+    return 1;
+}
+
+static uint32_t setup_sliding_q31(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    dsp_bench_fill_q31(dsp_bench_src.q31, 2U * size, 0.5f);
+    arm_sliding_stats_init_q31(&sliding_q31, (uint16_t)size, dsp_bench_state.q31,
+                               (uint16_t*)&dsp_bench_dst.q15[0], (uint16_t*)&dsp_bench_dst.q15[DSP_BENCH_BUF_WORDS]);
+    arm_sliding_stats_q31(&sliding_q31, dsp_bench_src.q31, size);
+    block = size;
+    next = 0;
+    return 1;
+}
+
+static uint32_t setup_sliding_q15(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    dsp_bench_fill_q15(dsp_bench_src.q15, 2U * size, 0.5f);
+    arm_sliding_stats_init_q15(&sliding_q15, (uint16_t)size, dsp_bench_state.q15,
+                               (uint16_t*)&dsp_bench_dst.q15[0], (uint16_t*)&dsp_bench_dst.q15[DSP_BENCH_BUF_WORDS]);
+    arm_sliding_stats_q15(&sliding_q15, dsp_bench_src.q15, size);
+    block = size;
+    next = 0;
+    return 1;
+}
+
+static uint32_t setup_median_f32(const dsp_bench_case* c, uint32_t size)
+{
+    percentile = (c->param != 0U) ? (float32_t)c->param : 50.0f;
+    dsp_bench_fill_f32(dsp_bench_src.f32, 2U * size, 1.0f);
+    arm_median_filter_init_f32(&median_f32, (uint16_t)size, dsp_bench_state.f32, (uint16_t*)dsp_bench_dst.q15);
+    arm_median_filter_f32(&median_f32, dsp_bench_src.f32, &dsp_bench_state.f32[DSP_BENCH_MAX_BLOCK], size);
+    block = size;
+    next = 0;
+    return 1;
+}
+
+static uint32_t setup_median_q31(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    dsp_bench_fill_q31(dsp_bench_src.q31, 2U * size, 0.5f);
+    arm_median_filter_init_q31(&median_q31, (uint16_t)size, dsp_bench_state.q31, (uint16_t*)dsp_bench_dst.q15);
+    arm_median_filter_q31(&median_q31, dsp_bench_src.q31, &dsp_bench_state.q31[DSP_BENCH_MAX_BLOCK], size);
+    block = size;
+    next = 0;
+    return 1;
+}
+
+static uint32_t setup_median_q15(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    dsp_bench_fill_q15(dsp_bench_src.q15, 2U * size, 0.5f);
+    arm_median_filter_init_q15(&median_q15, (uint16_t)size, dsp_bench_state.q15, (uint16_t*)dsp_bench_dst.q15);
+    arm_median_filter_q15(&median_q15, dsp_bench_src.q15, &dsp_bench_state.q15[2U * DSP_BENCH_MAX_BLOCK], size);
+    block = size;
+    next = 0;
+    return 1;
+}
+
+static void run_mean_f32(void)
+{
+    float32_t result;
+
+    arm_mean_f32(dsp_bench_src.f32, block, &result);
+    dsp_bench_sink_f32 = result;
+}
+
+static void run_var_f32(void)
+{
+    float32_t result;
+
+    arm_var_f32(dsp_bench_src.f32, block, &result);
+    dsp_bench_sink_f32 = result;
+}
+
+static void run_std_f32(void)
+{
+    float32_t result;
+
+    arm_std_f32(dsp_bench_src.f32, block, &result);
+    dsp_bench_sink_f32 = result;
+}
+
+static void run_rms_f32(void)
+{
+    float32_t result;
+
+    arm_rms_f32(dsp_bench_src.f32, block, &result);
+    dsp_bench_sink_f32 = result;
+}
+
+static void run_max_f32(void)
+{
+    float32_t result;
+    uint32_t index;
+
+    arm_max_f32(dsp_bench_src.f32, block, &result, &index);
+    dsp_bench_sink_f32 = result;
+}
+
+static void run_mean_q31(void)
+{
+    q31_t result;
+
+    arm_mean_q31(dsp_bench_src.q31, block, &result);
+    dsp_bench_sink_q63 = result;
+}
+
+static void run_var_q31(void)
+{
+    q31_t result;
+
+    arm_var_q31(dsp_bench_src.q31, block, &result);
+    dsp_bench_sink_q63 = result;
+}
+
+static void run_rms_q31(void)
+{
+    q31_t result;
+
+    arm_rms_q31(dsp_bench_src.q31, block, &result);
+    dsp_bench_sink_q63 = result;
+}
+
+static void run_max_q31(void)
+{
+    q31_t result;
+    uint32_t index;
+
+    arm_max_q31(dsp_bench_src.q31, block, &result, &index);
+    dsp_bench_sink_q63 = result;
+}
+
+static void run_mean_q15(void)
+{
+    q15_t result;
+
+    arm_mean_q15(dsp_bench_src.q15, block, &result);
+    dsp_bench_sink_q63 = result;
+}
+
+static void run_var_q15(void)
+{
+    q15_t result;
+
+    arm_var_q15(dsp_bench_src.q15, block, &result);
+    dsp_bench_sink_q63 = result;
+}
+
+static void run_rms_q15(void)
+{
+    q15_t result;
+
+    arm_rms_q15(dsp_bench_src.q15, block, &result);
+    dsp_bench_sink_q63 = result;
+}
+
+static void run_max_q15(void)
+{
+    q15_t result;
+    uint32_t index;
+
+    arm_max_q15(dsp_bench_src.q15, block, &result, &index);
+    dsp_bench_sink_q63 = result;
+}
+
+// 窗口为 src[next, next + block)，每次调用前移一个样本
+static void run_window_block_f32(void)
+{
+    const float32_t* window = &dsp_bench_src.f32[next];
+    float32_t mean, var, min, max;
+    uint32_t index;
+
+    arm_mean_f32(window, block, &mean);
+    arm_var_f32(window, block, &var);
+    arm_min_f32(window, block, &min, &index);
+    arm_max_f32(window, block, &max, &index);
+    dsp_bench_sink_f32 = mean + var + min + max;
+    next = (next + 1U == block) ? 0U : next + 1U;
+}
+
+static void run_window_sliding_f32(void)
+{
+    float32_t mean, var, min, max;
+
+    arm_sliding_stats_f32(&sliding_f32, &dsp_bench_src.f32[next], 1);
+    arm_sliding_stats_mean_f32(&sliding_f32, &mean);
+    arm_sliding_stats_var_f32(&sliding_f32, &var);
+    arm_sliding_stats_min_f32(&sliding_f32, &min);
+    arm_sliding_stats_max_f32(&sliding_f32, &max);
+    dsp_bench_sink_f32 = mean + var + min + max;
+    next = (next + 1U == 2U * block) ? 0U : next + 1U;
+}
+
+static void run_window_block_q31(void)
+{
+    const q31_t* window = &dsp_bench_src.q31[next];
+    q31_t mean, var, min, max;
+    uint32_t index;
+
+    arm_mean_q31(window, block, &mean);
+    arm_var_q31(window, block, &var);
+    arm_min_q31(window, block, &min, &index);
+    arm_max_q31(window, block, &max, &index);
+    dsp_bench_sink_q63 = (q63_t)mean + var + min + max;
+    next = (next + 1U == block) ? 0U : next + 1U;
+}
+
+static void run_window_sliding_q31(void)
+{
+    q31_t mean, var, min, max;
+
+    arm_sliding_stats_q31(&sliding_q31, &dsp_bench_src.q31[next], 1);
+    arm_sliding_stats_mean_q31(&sliding_q31, &mean);
+    arm_sliding_stats_var_q31(&sliding_q31, &var);
+    arm_sliding_stats_min_q31(&sliding_q31, &min);
+    arm_sliding_stats_max_q31(&sliding_q31, &max);
+    dsp_bench_sink_q63 = (q63_t)mean + var + min + max;
+    next = (next + 1U == 2U * block) ? 0U : next + 1U;
+}
+
+static void run_window_block_q15(void)
+{
+    const q15_t* window = &dsp_bench_src.q15[next];
+    q15_t mean, var, min, max;
+    uint32_t index;
+
+    arm_mean_q15(window, block, &mean);
+    arm_var_q15(window, block, &var);
+    arm_min_q15(window, block, &min, &index);
+    arm_max_q15(window, block, &max, &index);
+    dsp_bench_sink_q63 = (q63_t)mean + var + min + max;
+    next = (next + 1U == block) ? 0U : next + 1U;
+}
+
+static void run_window_sliding_q15(void)
+{
+    q15_t mean, var, min, max;
+
+    arm_sliding_stats_q15(&sliding_q15, &dsp_bench_src.q15[next], 1);
+    arm_sliding_stats_mean_q15(&sliding_q15, &mean);
+    arm_sliding_stats_var_q15(&sliding_q15, &var);
+    arm_sliding_stats_min_q15(&sliding_q15, &min);
+    arm_sliding_stats_max_q15(&sliding_q15, &max);
+    dsp_bench_sink_q63 = (q63_t)mean + var + min + max;
+    next = (next + 1U == 2U * block) ? 0U : next + 1U;
+}
+
+static void run_sort_f32(void)
+{
+    arm_sort_f32(dsp_bench_src.f32, dsp_bench_dst.f32, dsp_bench_state.f32, block);
+}
+
+static void run_sort_q31(void)
+{
+    arm_sort_q31(dsp_bench_src.q31, dsp_bench_dst.q31, dsp_bench_state.q31, block);
+}
+
+static void run_sort_q15(void)
+{
+    arm_sort_q15(dsp_bench_src.q15, dsp_bench_dst.q15, dsp_bench_state.q15, block);
+}
+
+static void run_median_select_f32(void)
+{
+    float32_t result;
+
+    arm_copy_f32(&dsp_bench_src.f32[next], dsp_bench_dst.f32, block);
+    arm_percentile_f32(dsp_bench_dst.f32, block, percentile, &result);
+    dsp_bench_sink_f32 = result;
+    next = (next + 1U == block) ? 0U : next + 1U;
+}
+
+static void run_median_filter_f32(void)
+{
+    float32_t result;
+
+    arm_median_filter_f32(&median_f32, &dsp_bench_src.f32[next], &result, 1);
+    dsp_bench_sink_f32 = result;
+    next = (next + 1U == 2U * block) ? 0U : next + 1U;
+}
+
+static void run_median_select_q31(void)
+{
+    q31_t result;
+
+    arm_copy_q31(&dsp_bench_src.q31[next], dsp_bench_dst.q31, block);
+    arm_percentile_q31(dsp_bench_dst.q31, block, 0x40000000, &result);
+    dsp_bench_sink_q63 = result;
+    next = (next + 1U == block) ? 0U : next + 1U;
+}
+
+static void run_median_filter_q31(void)
+{
+    q31_t result;
+
+    arm_median_filter_q31(&median_q31, &dsp_bench_src.q31[next], &result, 1);
+    dsp_bench_sink_q63 = result;
+    next = (next + 1U == 2U * block) ? 0U : next + 1U;
+}
+
+static void run_median_select_q15(void)
+{
+    q15_t result;
+
+    arm_copy_q15(&dsp_bench_src.q15[next], dsp_bench_dst.q15, block);
+    arm_percentile_q15(dsp_bench_dst.q15, block, 0x4000, &result);
+    dsp_bench_sink_q63 = result;
+    next = (next + 1U == block) ? 0U : next + 1U;
+}
+
+static void run_median_filter_q15(void)
+{
+    q15_t result;
+
+    arm_median_filter_q15(&median_q15, &dsp_bench_src.q15[next], &result, 1);
+    dsp_bench_sink_q63 = result;
+    next = (next + 1U == 2U * block) ? 0U : next + 1U;
+}
+
+static const dsp_bench_case cases[] = {
+    { "mean_f32",           0, dsp_bench_block_sizes, setup_f32,         run_mean_f32 },
+    { "var_f32",            0, dsp_bench_block_sizes, setup_f32,         run_var_f32 },
+    { "std_f32",            0, dsp_bench_block_sizes, setup_f32,         run_std_f32 },
+    { "rms_f32",            0, dsp_bench_block_sizes, setup_f32,         run_rms_f32 },
+    { "max_f32",            0, dsp_bench_block_sizes, setup_f32,         run_max_f32 },
+    { "mean_q31",           0, dsp_bench_block_sizes, setup_q31,         run_mean_q31 },
+    { "var_q31",            0, dsp_bench_block_sizes, setup_q31,         run_var_q31 },
+    { "rms_q31",            0, dsp_bench_block_sizes, setup_q31,         run_rms_q31 },
+    { "max_q31",            0, dsp_bench_block_sizes, setup_q31,         run_max_q31 },
+    { "mean_q15",           0, dsp_bench_block_sizes, setup_q15,         run_mean_q15 },
+    { "var_q15",            0, dsp_bench_block_sizes, setup_q15,         run_var_q15 },
+    { "rms_q15",            0, dsp_bench_block_sizes, setup_q15,         run_rms_q15 },
+    { "max_q15",            0, dsp_bench_block_sizes, setup_q15,         run_max_q15 },
+    { "window_block_f32",   0, dsp_bench_block_sizes, setup_sliding_f32, run_window_block_f32 },
+    { "window_sliding_f32", 0, dsp_bench_block_sizes, setup_sliding_f32, run_window_sliding_f32 },
+    { "window_block_q31",   0, dsp_bench_block_sizes, setup_sliding_q31, run_window_block_q31 },
+    { "window_sliding_q31", 0, dsp_bench_block_sizes, setup_sliding_q31, run_window_sliding_q31 },
+    { "window_block_q15",   0, dsp_bench_block_sizes, setup_sliding_q15, run_window_block_q15 },
+    { "window_sliding_q15", 0, dsp_bench_block_sizes, setup_sliding_q15, run_window_sliding_q15 },
+    { "sort_f32",           0, dsp_bench_block_sizes, setup_f32,         run_sort_f32 },
+    { "sort_q31",           0, dsp_bench_block_sizes, setup_q31,         run_sort_q31 },
+    { "sort_q15",           0, dsp_bench_block_sizes, setup_q15,         run_sort_q15 },
+    { "median_select_f32",  0, dsp_bench_block_sizes, setup_median_f32,  run_median_select_f32 },
+    { "percentile_f32",    60, dsp_bench_block_sizes, setup_median_f32,  run_median_select_f32 },
+    { "median_filter_f32",  0, dsp_bench_block_sizes, setup_median_f32,  run_median_filter_f32 },
+    { "median_select_q31",  0, dsp_bench_block_sizes, setup_median_q31,  run_median_select_q31 },
+    { "median_filter_q31",  0, dsp_bench_block_sizes, setup_median_q31,  run_median_filter_q31 },
+    { "median_select_q15",  0, dsp_bench_block_sizes, setup_median_q15,  run_median_select_q15 },
+    { "median_filter_q15",  0, dsp_bench_block_sizes, setup_median_q15,  run_median_filter_q15 },
+};
+
+const dsp_bench_module dsp_bench_statistics = { "statistics", cases, DSP_BENCH_COUNT(cases) };
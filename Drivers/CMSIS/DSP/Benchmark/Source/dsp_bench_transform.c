@@ -0,0 +1,545 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench_transform.c
+ * Description:  变换基准用例（复数 FFT、块浮点 FFT、实数 FFT、混合基 FFT、流式实数 FFT、Goertzel、滑动 DFT）
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores / Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "dsp_bench_cases.h"
+#include "arm_const_structs.h"
+
+#define TONE_BINS_MAX           (16U)   // Goertzel / 滑动 DFT 用例的最大频点数
+
+/*
+ * cfft_bfp_* 与 cfft_q31 / cfft_q15 使用同一实例与输入，原地反复变换：定点版每次调用按级缩小，
+ * 数据逐渐衰减到零；块浮点版每级按实际余量缩放，数据始终保持满幅，耗时含逐级的余量统计。
+ */
+
+/*
+ * *_mixed_f32 用例按帧长直接做混合基 FFT，*_padded_f32 用例把帧补零到不小于帧长的 2 的幂
+ * 再调用 arm_cfft_f32 / arm_rfft_fast_f32（补零计入耗时），两者 samples 都是帧长，
+ * cycles_per_sample 可直接对比。混合基的旋转因子表使用 dsp_bench_state，暂存区使用 dsp_bench_dst。
+ */
+
+/*
+ * rfft_packed_* 与 rfft_* 输入相同：rfft_* 需要 N 点输入加 2N 点输出共 3N 个字，rfft_packed_* 原地输出 N 个字。
+ * rfft_stream_* / rfft_window_* 的 param 为每帧的跳步数（帧移 = N / param），每次调用输入 N 个样本、完成 param 帧：
+ * rfft_stream_* 每帧只占样本环 N 与输出 N 个字，加窗在装帧时完成；rfft_window_* 为常规写法，
+ * 每帧平移历史缓冲、arm_mult 加窗到临时帧再调用 arm_rfft，占历史 N、临时帧 N 与输出 2N 个字。
+ * 窗使用 dsp_bench_state 前半，历史/样本环在其后半，临时帧在 dsp_bench_src 后半。
+ */
+
+/*
+ * goertzel_* / sdft_* 用例的 param 为跟踪频点数 K，尺寸为帧长（窗长）N，每次调用输入 N 个样本，samples 为 N：
+ * goertzel_* 每次调用完成一帧并输出 K 个功率，与同尺寸 cfft / rfft 的 cycles_per_call 对比；
+ * sdft_* 的 cycles_per_sample 为每来一个样本刷新 K 个频点的代价，对应每个样本重做一次 N 点 FFT。
+ * 滑动 DFT 的旋转因子表使用 dsp_bench_state，样本环使用 dsp_bench_dst 前半，输出在其后半。
+ */
+
+static const arm_cfft_instance_f32* cfft_f32;
+static const arm_cfft_instance_q31* cfft_q31;
+static const arm_cfft_instance_q15* cfft_q15;
+static arm_rfft_fast_instance_f32 rfft_fast_f32;
+static arm_rfft_instance_q31 rfft_q31;
+static arm_rfft_instance_q15 rfft_q15;
+static arm_rfft_stream_instance_q31 rfft_stream_q31;
+static arm_rfft_stream_instance_q15 rfft_stream_q15;
+static arm_goertzel_instance_f32 goertzel_f32;
+static arm_goertzel_instance_q31 goertzel_q31;
+static arm_goertzel_instance_q15 goertzel_q15;
+static arm_sdft_instance_f32 sdft_f32;
+static arm_sdft_instance_q31 sdft_q31;
+static arm_sdft_instance_q15 sdft_q15;
+static arm_cfft_mixed_instance_f32 cfft_mixed_f32;
+static arm_rfft_mixed_instance_f32 rfft_mixed_f32;
+static uint32_t frame_len;              // 补零用例的帧长
+static uint32_t padded_len;             // 补零后的长度
+static uint32_t hop_len;                // 流式用例的帧移
+static uint16_t tone_bins[TONE_BINS_MAX];
+static uint32_t tone_len;
+static uint8_t inverse;                 // 浮点变换正反交替
+
+static uint32_t setup_cfft_f32(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    switch (size) {
+    case 16:   cfft_f32 = &arm_cfft_sR_f32_len16;   break;
+    case 32:   cfft_f32 = &arm_cfft_sR_f32_len32;   break;
+    case 64:   cfft_f32 = &arm_cfft_sR_f32_len64;   break;
+    case 128:  cfft_f32 = &arm_cfft_sR_f32_len128;  break;
+    case 256:  cfft_f32 = &arm_cfft_sR_f32_len256;  break;
+    case 512:  cfft_f32 = &arm_cfft_sR_f32_len512;  break;
+    case 1024: cfft_f32 = &arm_cfft_sR_f32_len1024; break;
+    case 2048: cfft_f32 = &arm_cfft_sR_f32_len2048; break;
+    case 4096: cfft_f32 = &arm_cfft_sR_f32_len4096; break;
+    default:   return 0;
+    }
+    dsp_bench_fill_f32(dsp_bench_src.f32, 2U * size, 1.0f);
+    inverse = 0;
+    return size;
+}
+
+static uint32_t setup_cfft_q31(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    switch (size) {
+    case 16:   cfft_q31 = &arm_cfft_sR_q31_len16;   break;
+    case 32:   cfft_q31 = &arm_cfft_sR_q31_len32;   break;
+    case 64:   cfft_q31 = &arm_cfft_sR_q31_len64;   break;
+    case 128:  cfft_q31 = &arm_cfft_sR_q31_len128;  break;
+    case 256:  cfft_q31 = &arm_cfft_sR_q31_len256;  break;
+    case 512:  cfft_q31 = &arm_cfft_sR_q31_len512;  break;
+    case 1024: cfft_q31 = &arm_cfft_sR_q31_len1024; break;
+    case 2048: cfft_q31 = &arm_cfft_sR_q31_len2048; break;
+    case 4096: cfft_q31 = &arm_cfft_sR_q31_len4096; break;
+    default:   return 0;
+    }
+    dsp_bench_fill_q31(dsp_bench_src.q31, 2U * size, 0.5f);
+    return size;
+}
+
+static uint32_t setup_cfft_q15(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    switch (size) {
+    case 16:   cfft_q15 = &arm_cfft_sR_q15_len16;   break;
+    case 32:   cfft_q15 = &arm_cfft_sR_q15_len32;   break;
+    case 64:   cfft_q15 = &arm_cfft_sR_q15_len64;   break;
+    case 128:  cfft_q15 = &arm_cfft_sR_q15_len128;  break;
+    case 256:  cfft_q15 = &arm_cfft_sR_q15_len256;  break;
+    case 512:  cfft_q15 = &arm_cfft_sR_q15_len512;  break;
+    case 1024: cfft_q15 = &arm_cfft_sR_q15_len1024; break;
+    case 2048: cfft_q15 = &arm_cfft_sR_q15_len2048; break;
+    case 4096: cfft_q15 = &arm_cfft_sR_q15_len4096; break;
+    default:   return 0;
+    }
+    dsp_bench_fill_q15(dsp_bench_src.q15, 2U * size, 0.5f);
+    return size;
+}
+
+static uint32_t setup_rfft_fast_f32(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    if (arm_rfft_fast_init_f32(&rfft_fast_f32, (uint16_t)size) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    dsp_bench_fill_f32(dsp_bench_src.f32, size, 1.0f);
+    inverse = 0;
+    return size;
+}
+
+static uint32_t setup_rfft_q31(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    if (arm_rfft_init_q31(&rfft_q31, size, 0, 1) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    dsp_bench_fill_q31(dsp_bench_src.q31, size, 0.5f);
+    return size;
+}
+
+static uint32_t setup_rfft_q15(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    if (arm_rfft_init_q15(&rfft_q15, size, 0, 1) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    dsp_bench_fill_q15(dsp_bench_src.q15, size, 0.5f);
+    return size;
+}
+
+static uint32_t setup_rfft_window_q31(const dsp_bench_case* c, uint32_t size)
+{
+    if (setup_rfft_q31(c, size) == 0U || size % c->param != 0U) {
+        return 0;
+    }
+    hop_len = size / c->param;
+    dsp_bench_fill_q31(dsp_bench_state.q31, size, 1.0f);
+    memset(&dsp_bench_state.q31[DSP_BENCH_MAX_BLOCK], 0, size * sizeof(q31_t));
+    return size;
+}
+
+static uint32_t setup_rfft_window_q15(const dsp_bench_case* c, uint32_t size)
+{
+    if (setup_rfft_q15(c, size) == 0U || size % c->param != 0U) {
+        return 0;
+    }
+    hop_len = size / c->param;
+    dsp_bench_fill_q15(dsp_bench_state.q15, size, 1.0f);
+    memset(&dsp_bench_state.q15[DSP_BENCH_MAX_BLOCK], 0, size * sizeof(q15_t));
+    return size;
+}
+
+static uint32_t setup_rfft_stream_q31(const dsp_bench_case* c, uint32_t size)
+{
+    if (setup_rfft_window_q31(c, size) == 0U) {
+        return 0;
+    }
+    if (arm_rfft_stream_init_q31(&rfft_stream_q31, &rfft_q31, (uint16_t)hop_len, dsp_bench_state.q31,
+                                 &dsp_bench_state.q31[DSP_BENCH_MAX_BLOCK]) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    return size;
+}
+
+static uint32_t setup_rfft_stream_q15(const dsp_bench_case* c, uint32_t size)
+{
+    if (setup_rfft_window_q15(c, size) == 0U) {
+        return 0;
+    }
+    if (arm_rfft_stream_init_q15(&rfft_stream_q15, &rfft_q15, (uint16_t)hop_len, dsp_bench_state.q15,
+                                 &dsp_bench_state.q15[DSP_BENCH_MAX_BLOCK]) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    return size;
+}
+
+static uint32_t setup_cfft_mixed_f32(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    if (arm_cfft_mixed_init_f32(&cfft_mixed_f32, (uint16_t)size, dsp_bench_state.f32) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    dsp_bench_fill_f32(dsp_bench_src.f32, 2U * size, 1.0f);
+    inverse = 0;
+    return size;
+}
+
+static uint32_t setup_cfft_padded_f32(const dsp_bench_case* c, uint32_t size)
+{
+    for (padded_len = 16U; padded_len < size; padded_len <<= 1U) {
+    }
+    if (padded_len > DSP_BENCH_MAX_BLOCK || setup_cfft_f32(c, padded_len) == 0U) {
+        return 0;
+    }
+    frame_len = size;
+    return size;
+}
+
+static uint32_t setup_rfft_mixed_f32(const dsp_bench_case* c, uint32_t size)
+{
+    (void)c;
+    if (arm_rfft_mixed_init_f32(&rfft_mixed_f32, (uint16_t)size, dsp_bench_state.f32) != ARM_MATH_SUCCESS) {
+        return 0;
+    }
+    dsp_bench_fill_f32(dsp_bench_src.f32, size, 1.0f);
+    inverse = 0;
+    return size;
+}
+
+static uint32_t setup_rfft_padded_f32(const dsp_bench_case* c, uint32_t size)
+{
+    for (padded_len = 32U; padded_len < size; padded_len <<= 1U) {
+    }
+    if (padded_len > DSP_BENCH_MAX_BLOCK || setup_rfft_fast_f32(c, padded_len) == 0U) {
+        return 0;
+    }
+    frame_len = size;
+    return size;
+}
+
+// 在 [0, N/2) 内均匀取 K 个频点
+static uint32_t tone_geometry(const dsp_bench_case* c, uint32_t size)
+{
+    uint32_t k;
+
+    if (c->param > TONE_BINS_MAX) {
+        return 0;
+    }
+    for (k = 0; k < c->param; k++) {
+        tone_bins[k] = (uint16_t)((2U * k + 1U) * size / (4U * c->param));
+    }
+    tone_len = size;
+    return size;
+}
+
+static uint32_t setup_goertzel_f32(const dsp_bench_case* c, uint32_t size)
+{
+    float32_t freqs[TONE_BINS_MAX];
+    uint32_t k;
+
+    if (tone_geometry(c, size) == 0U) {
+        return 0;
+    }
+    for (k = 0; k < c->param; k++) {
+        freqs[k] = (float32_t)tone_bins[k] / (float32_t)size;
+    }
+    arm_goertzel_init_f32(&goertzel_f32, (uint16_t)size, (uint16_t)c->param, freqs,
+                          dsp_bench_coeffs.f32, dsp_bench_state.f32);
+    dsp_bench_fill_f32(dsp_bench_src.f32, size, 1.0f);
+    return size;
+}
+
+static uint32_t setup_goertzel_q31(const dsp_bench_case* c, uint32_t size)
+{
+    q31_t freqs[TONE_BINS_MAX];
+    uint32_t k;
+
+    if (tone_geometry(c, size) == 0U) {
+        return 0;
+    }
+    for (k = 0; k < c->param; k++) {
+        freqs[k] = (q31_t)(((q63_t)tone_bins[k] << 31) / size);
+    }
+    arm_goertzel_init_q31(&goertzel_q31, (uint16_t)size, (uint16_t)c->param, freqs,
+                          dsp_bench_coeffs.q31, (q63_t*)dsp_bench_state.q31);
+    dsp_bench_fill_q31(dsp_bench_src.q31, size, 0.5f);
+    return size;
+}
+
+static uint32_t setup_goertzel_q15(const dsp_bench_case* c, uint32_t size)
+{
+    q15_t freqs[TONE_BINS_MAX];
+    uint32_t k;
+
+    if (tone_geometry(c, size) == 0U) {
+        return 0;
+    }
+    for (k = 0; k < c->param; k++) {
+        freqs[k] = (q15_t)(((q31_t)tone_bins[k] << 15) / (q31_t)size);
+    }
+    arm_goertzel_init_q15(&goertzel_q15, (uint16_t)size, (uint16_t)c->param, freqs,
+                          dsp_bench_coeffs.q31, (q63_t*)dsp_bench_state.q31);
+    dsp_bench_fill_q15(dsp_bench_src.q15, size, 0.5f);
+    return size;
+}
+
+static uint32_t setup_sdft_f32(const dsp_bench_case* c, uint32_t size)
+{
+    if (tone_geometry(c, size) == 0U) {
+        return 0;
+    }
+    arm_sdft_init_f32(&sdft_f32, (uint16_t)size, (uint16_t)c->param, tone_bins,
+                      dsp_bench_state.f32, dsp_bench_dst.f32, dsp_bench_coeffs.f32);
+    dsp_bench_fill_f32(dsp_bench_src.f32, size, 1.0f);
+    return size;
+}
+
+static uint32_t setup_sdft_q31(const dsp_bench_case* c, uint32_t size)
+{
+    if (tone_geometry(c, size) == 0U) {
+        return 0;
+    }
+    arm_sdft_init_q31(&sdft_q31, (uint16_t)size, (uint16_t)c->param, tone_bins,
+                      dsp_bench_state.q31, dsp_bench_dst.q31, (q63_t*)dsp_bench_coeffs.q31);
+    dsp_bench_fill_q31(dsp_bench_src.q31, size, 0.5f);
+    return size;
+}
+
+static uint32_t setup_sdft_q15(const dsp_bench_case* c, uint32_t size)
+{
+    if (tone_geometry(c, size) == 0U) {
+        return 0;
+    }
+    arm_sdft_init_q15(&sdft_q15, (uint16_t)size, (uint16_t)c->param, tone_bins,
+                      dsp_bench_state.q15, dsp_bench_dst.q15, (q63_t*)dsp_bench_coeffs.q31);
+    dsp_bench_fill_q15(dsp_bench_src.q15, size, 0.5f);
+    return size;
+}
+
+static void run_cfft_f32(void)
+{
+    arm_cfft_f32(cfft_f32, dsp_bench_src.f32, inverse, 1);
+    inverse ^= 1U;
+}
+
+static void run_cfft_q31(void)
+{
+    arm_cfft_q31(cfft_q31, dsp_bench_src.q31, 0, 1);
+}
+
+static void run_cfft_q15(void)
+{
+    arm_cfft_q15(cfft_q15, dsp_bench_src.q15, 0, 1);
+}
+
+static void run_cfft_bfp_q31(void)
+{
+    arm_cfft_bfp_q31(cfft_q31, dsp_bench_src.q31, 0, 1);
+}
+
+static void run_cfft_bfp_q15(void)
+{
+    arm_cfft_bfp_q15(cfft_q15, dsp_bench_src.q15, 0, 1);
+}
+
+static void run_rfft_fast_f32(void)
+{
+    // 正变换 src -> dst，反变换 dst -> src（两者都会改写输入）
+    if (inverse == 0U) {
+        arm_rfft_fast_f32(&rfft_fast_f32, dsp_bench_src.f32, dsp_bench_dst.f32, 0);
+    } else {
+        arm_rfft_fast_f32(&rfft_fast_f32, dsp_bench_dst.f32, dsp_bench_src.f32, 1);
+    }
+    inverse ^= 1U;
+}
+
+static void run_rfft_q31(void)
+{
+    arm_rfft_q31(&rfft_q31, dsp_bench_src.q31, dsp_bench_dst.q31);
+}
+
+static void run_rfft_q15(void)
+{
+    arm_rfft_q15(&rfft_q15, dsp_bench_src.q15, dsp_bench_dst.q15);
+}
+
+static void run_rfft_packed_q31(void)
+{
+    arm_rfft_packed_q31(&rfft_q31, dsp_bench_src.q31);
+}
+
+static void run_rfft_packed_q15(void)
+{
+    arm_rfft_packed_q15(&rfft_q15, dsp_bench_src.q15);
+}
+
+static void run_rfft_stream_q31(void)
+{
+    uint32_t n;
+
+    for (n = 0; n < rfft_q31.fftLenReal; n += hop_len) {
+        arm_rfft_stream_q31(&rfft_stream_q31, &dsp_bench_src.q31[n], dsp_bench_dst.q31, hop_len);
+    }
+}
+
+static void run_rfft_stream_q15(void)
+{
+    uint32_t n;
+
+    for (n = 0; n < rfft_q15.fftLenReal; n += hop_len) {
+        arm_rfft_stream_q15(&rfft_stream_q15, &dsp_bench_src.q15[n], dsp_bench_dst.q15, hop_len);
+    }
+}
+
+static void run_rfft_window_q31(void)
+{
+    q31_t* history = &dsp_bench_state.q31[DSP_BENCH_MAX_BLOCK];
+    q31_t* frame = &dsp_bench_src.q31[DSP_BENCH_MAX_BLOCK];
+    uint32_t len = rfft_q31.fftLenReal;
+    uint32_t n;
+
+    for (n = 0; n < len; n += hop_len) {
+        memmove(history, &history[hop_len], (len - hop_len) * sizeof(q31_t));
+        memcpy(&history[len - hop_len], &dsp_bench_src.q31[n], hop_len * sizeof(q31_t));
+        arm_mult_q31(history, dsp_bench_state.q31, frame, len);
+        arm_rfft_q31(&rfft_q31, frame, dsp_bench_dst.q31);
+    }
+}
+
+static void run_rfft_window_q15(void)
+{
+    q15_t* history = &dsp_bench_state.q15[DSP_BENCH_MAX_BLOCK];
+    q15_t* frame = &dsp_bench_src.q15[DSP_BENCH_MAX_BLOCK];
+    uint32_t len = rfft_q15.fftLenReal;
+    uint32_t n;
+
+    for (n = 0; n < len; n += hop_len) {
+        memmove(history, &history[hop_len], (len - hop_len) * sizeof(q15_t));
+        memcpy(&history[len - hop_len], &dsp_bench_src.q15[n], hop_len * sizeof(q15_t));
+        arm_mult_q15(history, dsp_bench_state.q15, frame, len);
+        arm_rfft_q15(&rfft_q15, frame, dsp_bench_dst.q15);
+    }
+}
+
+static void run_cfft_mixed_f32(void)
+{
+    arm_cfft_mixed_f32(&cfft_mixed_f32, dsp_bench_src.f32, dsp_bench_dst.f32, inverse);
+    inverse ^= 1U;
+}
+
+static void run_cfft_padded_f32(void)
+{
+    memset(&dsp_bench_src.f32[2U * frame_len], 0, 2U * (padded_len - frame_len) * sizeof(float32_t));
+    run_cfft_f32();
+}
+
+static void run_rfft_mixed_f32(void)
+{
+    arm_rfft_mixed_f32(&rfft_mixed_f32, dsp_bench_src.f32, dsp_bench_dst.f32, inverse);
+    inverse ^= 1U;
+}
+
+static void run_rfft_padded_f32(void)
+{
+    if (inverse == 0U) {
+        memset(&dsp_bench_src.f32[frame_len], 0, (padded_len - frame_len) * sizeof(float32_t));
+    }
+    run_rfft_fast_f32();
+}
+
+static void run_goertzel_f32(void)
+{
+    arm_goertzel_f32(&goertzel_f32, dsp_bench_src.f32, dsp_bench_dst.f32, tone_len);
+}
+
+static void run_goertzel_q31(void)
+{
+    arm_goertzel_q31(&goertzel_q31, dsp_bench_src.q31, dsp_bench_dst.q31, tone_len);
+}
+
+static void run_goertzel_q15(void)
+{
+    arm_goertzel_q15(&goertzel_q15, dsp_bench_src.q15, dsp_bench_dst.q15, tone_len);
+}
+
+static void run_sdft_f32(void)
+{
+    arm_sdft_f32(&sdft_f32, dsp_bench_src.f32, &dsp_bench_dst.f32[DSP_BENCH_MAX_BLOCK], tone_len);
+}
+
+static void run_sdft_q31(void)
+{
+    arm_sdft_q31(&sdft_q31, dsp_bench_src.q31, &dsp_bench_dst.q31[DSP_BENCH_MAX_BLOCK], tone_len);
+}
+
+static void run_sdft_q15(void)
+{
+    arm_sdft_q15(&sdft_q15, dsp_bench_src.q15, &dsp_bench_dst.q15[DSP_BENCH_MAX_BLOCK], tone_len);
+}
+
+static const dsp_bench_case cases[] = {
+    { "cfft_f32",        0,  dsp_bench_fft_sizes,   setup_cfft_f32,        run_cfft_f32 },
+    { "cfft_q31",        0,  dsp_bench_fft_sizes,   setup_cfft_q31,        run_cfft_q31 },
+    { "cfft_q15",        0,  dsp_bench_fft_sizes,   setup_cfft_q15,        run_cfft_q15 },
+    { "cfft_bfp_q31",    0,  dsp_bench_fft_sizes,   setup_cfft_q31,        run_cfft_bfp_q31 },
+    { "cfft_bfp_q15",    0,  dsp_bench_fft_sizes,   setup_cfft_q15,        run_cfft_bfp_q15 },
+    { "rfft_fast_f32",   0,  dsp_bench_rfft_sizes,  setup_rfft_fast_f32,   run_rfft_fast_f32 },
+    { "rfft_q31",        0,  dsp_bench_rfft_sizes,  setup_rfft_q31,        run_rfft_q31 },
+    { "rfft_q15",        0,  dsp_bench_rfft_sizes,  setup_rfft_q15,        run_rfft_q15 },
+    { "rfft_packed_q31", 0,  dsp_bench_rfft_sizes,  setup_rfft_q31,        run_rfft_packed_q31 },
+    { "rfft_packed_q15", 0,  dsp_bench_rfft_sizes,  setup_rfft_q15,        run_rfft_packed_q15 },
+    { "rfft_stream_q31", 1,  dsp_bench_rfft_sizes,  setup_rfft_stream_q31, run_rfft_stream_q31 },
+    { "rfft_stream_q31", 4,  dsp_bench_rfft_sizes,  setup_rfft_stream_q31, run_rfft_stream_q31 },
+    { "rfft_window_q31", 1,  dsp_bench_rfft_sizes,  setup_rfft_window_q31, run_rfft_window_q31 },
+    { "rfft_window_q31", 4,  dsp_bench_rfft_sizes,  setup_rfft_window_q31, run_rfft_window_q31 },
+    { "rfft_stream_q15", 1,  dsp_bench_rfft_sizes,  setup_rfft_stream_q15, run_rfft_stream_q15 },
+    { "rfft_stream_q15", 4,  dsp_bench_rfft_sizes,  setup_rfft_stream_q15, run_rfft_stream_q15 },
+    { "rfft_window_q15", 1,  dsp_bench_rfft_sizes,  setup_rfft_window_q15, run_rfft_window_q15 },
+    { "rfft_window_q15", 4,  dsp_bench_rfft_sizes,  setup_rfft_window_q15, run_rfft_window_q15 },
+    { "cfft_mixed_f32",  0,  dsp_bench_mixed_sizes, setup_cfft_mixed_f32,  run_cfft_mixed_f32 },
+    { "cfft_padded_f32", 0,  dsp_bench_mixed_sizes, setup_cfft_padded_f32, run_cfft_padded_f32 },
+    { "rfft_mixed_f32",  0,  dsp_bench_mixed_sizes, setup_rfft_mixed_f32,  run_rfft_mixed_f32 },
+    { "rfft_padded_f32", 0,  dsp_bench_mixed_sizes, setup_rfft_padded_f32, run_rfft_padded_f32 },
+    { "goertzel_f32",    1,  dsp_bench_fft_sizes,   setup_goertzel_f32,    run_goertzel_f32 },
+    { "goertzel_f32",    4,  dsp_bench_fft_sizes,   setup_goertzel_f32,    run_goertzel_f32 },
+    { "goertzel_f32",    16, dsp_bench_fft_sizes,   setup_goertzel_f32,    run_goertzel_f32 },
+    { "goertzel_q31",    4,  dsp_bench_fft_sizes,   setup_goertzel_q31,    run_goertzel_q31 },
+    { "goertzel_q15",    4,  dsp_bench_fft_sizes,   setup_goertzel_q15,    run_goertzel_q15 },
+    { "sdft_f32",        1,  dsp_bench_fft_sizes,   setup_sdft_f32,        run_sdft_f32 },
+    { "sdft_f32",        4,  dsp_bench_fft_sizes,   setup_sdft_f32,        run_sdft_f32 },
+    { "sdft_f32",        16, dsp_bench_fft_sizes,   setup_sdft_f32,        run_sdft_f32 },
+    { "sdft_q31",        4,  dsp_bench_fft_sizes,   setup_sdft_q31,        run_sdft_q31 },
+    { "sdft_q15",        4,  dsp_bench_fft_sizes,   setup_sdft_q15,        run_sdft_q15 },
+};
+
+const dsp_bench_module dsp_bench_transform = { "transform", cases, DSP_BENCH_COUNT(cases) };
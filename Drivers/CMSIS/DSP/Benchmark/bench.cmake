@@ -0,0 +1,36 @@
+# CMSIS-DSP 基准测试源文件列表，主机 (Benchmark/CMakeLists.txt) 与固件 (顶层 DSP_BENCH 选项) 共用
+#
+#   DSP_BENCH_SOURCES      基准运行器与各模块用例（不含入口和计时）
+#   DSP_BENCH_LIB_SOURCES  CMSIS-DSP 各模块的合并源文件（整库编译，固件由 --gc-sections 去掉未用部分）
+#   DSP_BENCH_INCLUDES     头文件目录
+
+set(DSP_BENCH_DIR ${CMAKE_CURRENT_LIST_DIR})
+set(DSP_BENCH_DSP_DIR ${DSP_BENCH_DIR}/..)
+
+set(DSP_BENCH_SOURCES
+    ${DSP_BENCH_DIR}/Source/dsp_bench.c
+    ${DSP_BENCH_DIR}/Source/dsp_bench_basic.c
+    ${DSP_BENCH_DIR}/Source/dsp_bench_filtering.c
+    ${DSP_BENCH_DIR}/Source/dsp_bench_transform.c
+    ${DSP_BENCH_DIR}/Source/dsp_bench_matrix.c
+    ${DSP_BENCH_DIR}/Source/dsp_bench_statistics.c
+)
+
+set(DSP_BENCH_LIB_SOURCES
+    ${DSP_BENCH_DSP_DIR}/Source/BasicMathFunctions/BasicMathFunctions.c
+    ${DSP_BENCH_DSP_DIR}/Source/CommonTables/CommonTables.c
+    ${DSP_BENCH_DSP_DIR}/Source/ComplexMathFunctions/ComplexMathFunctions.c
+    ${DSP_BENCH_DSP_DIR}/Source/ControllerFunctions/ControllerFunctions.c
+    ${DSP_BENCH_DSP_DIR}/Source/FastMathFunctions/FastMathFunctions.c
+    ${DSP_BENCH_DSP_DIR}/Source/FilteringFunctions/FilteringFunctions.c
+    ${DSP_BENCH_DSP_DIR}/Source/MatrixFunctions/MatrixFunctions.c
+    ${DSP_BENCH_DSP_DIR}/Source/StatisticsFunctions/StatisticsFunctions.c
+    ${DSP_BENCH_DSP_DIR}/Source/SupportFunctions/SupportFunctions.c
+    ${DSP_BENCH_DSP_DIR}/Source/TransformFunctions/TransformFunctions.c
+)
+
+set(DSP_BENCH_INCLUDES
+    ${DSP_BENCH_DIR}/Include
+    ${DSP_BENCH_DIR}/Source
+    ${DSP_BENCH_DSP_DIR}/Include
+)
@@ -128,6 +128,15 @@
    * of some DSP functions. Experimental Neon versions currently do not have better
    * performances than the scalar versions.
    *
+   * - ARM_MATH_AVX2:
+   *
+   * Define macro ARM_MATH_AVX2 to enable x86-64 AVX2/FMA versions of the hot
+   * floating-point functions (FIR, biquad DF2T, CFFT and RFFT fast, dot product,
+   * matrix multiplication and basic math) when the library is built for a PC host
+   * (compile with -mavx2 -mfma). Results match the scalar versions within float
+   * rounding since the summation order differs. The AVX2 CFFT is radix-2, so with
+   * bitReverseFlag = 0 its output is in plain binary bit reversed order.
+   *
    * <hr>
    * CMSIS-DSP in ARM::CMSIS Pack
    * -----------------------------
@@ -331,6 +340,10 @@
 #include <arm_neon.h>
 #endif
 
+#if defined(ARM_MATH_AVX2)
+#include <immintrin.h>
+#endif
+
 
 #ifdef   __cplusplus
 extern "C"
@@ -856,6 +869,20 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
 
 #endif
 
+#if defined(ARM_MATH_AVX2)
+
+/* Horizontal sum of the 8 lanes */
+static inline float32_t __arm_hsum_f32_avx2(__m256 x)
+{
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_movehdup_ps(s));
+    return _mm_cvtss_f32(s);
+}
+
+#endif
+
 /*
  * @brief C custom defined intrinsic functions
  */
@@ -1372,6 +1399,117 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
         float32_t * pState,
         uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 FIR filter with circular state.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+          uint16_t stateIndex;      /**< ring position of the next input sample. */
+          q15_t *pState;            /**< points to the state variable array. The array is of length 2*(numTaps+3). */
+    const q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR filter with circular state.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+          uint16_t stateIndex;      /**< ring position of the next input sample. */
+          q31_t *pState;            /**< points to the state variable array. The array is of length 2*(numTaps+3). */
+    const q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR filter with circular state.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+          uint16_t stateIndex;      /**< ring position of the next input sample. */
+          float32_t *pState;        /**< points to the state variable array. The array is of length 2*(numTaps+3). */
+    const float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q15 circular state FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_q15(
+        arm_fir_circ_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q15 circular state FIR structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of length 2*(numTaps+3).
+   */
+  void arm_fir_circ_init_q15(
+        arm_fir_circ_instance_q15 * S,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pState);
+
+  /**
+   * @brief Processing function for the Q31 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q31 circular state FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_q31(
+        arm_fir_circ_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q31 circular state FIR structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of length 2*(numTaps+3).
+   */
+  void arm_fir_circ_init_q31(
+        arm_fir_circ_instance_q31 * S,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        q31_t * pState);
+
+  /**
+   * @brief Processing function for the floating-point FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the floating-point circular state FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_f32(
+        arm_fir_circ_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the floating-point circular state FIR structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of length 2*(numTaps+3).
+   */
+  void arm_fir_circ_init_f32(
+        arm_fir_circ_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
    */
@@ -2243,6 +2381,12 @@ void arm_cfft_q15(
           uint8_t ifftFlag,
           uint8_t bitReverseFlag);
 
+int32_t arm_cfft_bfp_q15(
+    const arm_cfft_instance_q15 * S,
+          q15_t * p1,
+          uint8_t ifftFlag,
+          uint8_t bitReverseFlag);
+
   /**
    * @brief Instance structure for the fixed-point CFFT/CIFFT function.
    */
@@ -2260,6 +2404,12 @@ void arm_cfft_q31(
           uint8_t ifftFlag,
           uint8_t bitReverseFlag);
 
+int32_t arm_cfft_bfp_q31(
+    const arm_cfft_instance_q31 * S,
+          q31_t * p1,
+          uint8_t ifftFlag,
+          uint8_t bitReverseFlag);
+
   /**
    * @brief Instance structure for the floating-point CFFT/CIFFT function.
    */
@@ -2327,6 +2477,66 @@ void arm_cfft_q31(
         q31_t * pSrc,
         q31_t * pDst);
 
+  void arm_rfft_packed_q15(
+  const arm_rfft_instance_q15 * S,
+        q15_t * p);
+
+  void arm_rfft_packed_q31(
+  const arm_rfft_instance_q31 * S,
+        q31_t * p);
+
+  /**
+   * @brief Instance structure for the Q15 streaming real FFT.
+   */
+  typedef struct
+  {
+          uint16_t hopSize;                    /**< number of new samples between frames. */
+          uint16_t index;                      /**< write position in the sample ring. */
+          uint16_t count;                      /**< number of samples received since the last frame. */
+    const arm_rfft_instance_q15 *pRfft;        /**< points to the forward real FFT instance. */
+    const q15_t *pWindow;                      /**< points to the window of length fftLenReal, or NULL. */
+          q15_t *pHistory;                     /**< points to the sample ring of length fftLenReal. */
+  } arm_rfft_stream_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 streaming real FFT.
+   */
+  typedef struct
+  {
+          uint16_t hopSize;                    /**< number of new samples between frames. */
+          uint16_t index;                      /**< write position in the sample ring. */
+          uint16_t count;                      /**< number of samples received since the last frame. */
+    const arm_rfft_instance_q31 *pRfft;        /**< points to the forward real FFT instance. */
+    const q31_t *pWindow;                      /**< points to the window of length fftLenReal, or NULL. */
+          q31_t *pHistory;                     /**< points to the sample ring of length fftLenReal. */
+  } arm_rfft_stream_instance_q31;
+
+  arm_status arm_rfft_stream_init_q15(
+        arm_rfft_stream_instance_q15 * S,
+  const arm_rfft_instance_q15 * pRfft,
+        uint16_t hopSize,
+  const q15_t * pWindow,
+        q15_t * pHistory);
+
+  uint32_t arm_rfft_stream_q15(
+        arm_rfft_stream_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  arm_status arm_rfft_stream_init_q31(
+        arm_rfft_stream_instance_q31 * S,
+  const arm_rfft_instance_q31 * pRfft,
+        uint16_t hopSize,
+  const q31_t * pWindow,
+        q31_t * pHistory);
+
+  uint32_t arm_rfft_stream_q31(
+        arm_rfft_stream_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
   /**
    * @brief Instance structure for the floating-point RFFT/RIFFT function.
    */
@@ -2390,6 +2600,82 @@ arm_status arm_rfft_4096_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
         float32_t * p, float32_t * pOut,
         uint8_t ifftFlag);
 
+  /**
+   * @brief Maximum number of radix stages of the mixed-radix FFT.
+   */
+#define ARM_CFFT_MIXED_MAX_STAGES   (16U)
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                                  /**< length of the FFT. */
+          uint16_t numStages;                               /**< number of radix stages. */
+          uint8_t radix[ARM_CFFT_MIXED_MAX_STAGES];         /**< radix (2, 3, 4 or 5) of each stage, in order of execution. */
+    const float32_t *pTwiddle;                              /**< points to the twiddle plan. */
+  } arm_cfft_mixed_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point mixed-radix CFFT/CIFFT.
+   * @param[out] S         points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in]  fftLen    length of the FFT, with prime factors 2, 3 and 5 only.
+   * @param[out] pTwiddle  points to the twiddle plan buffer of size 2*fftLen.
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+   */
+  arm_status arm_cfft_mixed_init_f32(
+        arm_cfft_mixed_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle);
+
+  /**
+   * @brief  Processing function for the floating-point mixed-radix CFFT/CIFFT.
+   * @param[in]     S         points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in,out] p1        points to the complex data buffer of size 2*fftLen. Processing occurs in-place.
+   * @param[in]     pScratch  points to a scratch buffer of size 2*fftLen.
+   * @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   */
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+        float32_t * p1,
+        float32_t * pScratch,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+          arm_cfft_mixed_instance_f32 Sint;  /**< Internal CFFT structure of length fftLenRFFT/2. */
+          uint16_t fftLenRFFT;               /**< length of the real sequence. */
+    const float32_t *pTwiddleRFFT;           /**< Twiddle factors real stage. */
+  } arm_rfft_mixed_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point mixed-radix RFFT/RIFFT.
+   * @param[out] S         points to an instance of the floating-point mixed-radix RFFT structure.
+   * @param[in]  fftLen    length of the real sequence, even with fftLen/2 having prime factors 2, 3 and 5 only.
+   * @param[out] pTwiddle  points to the twiddle plan buffer of size 2*fftLen.
+   * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+   */
+  arm_status arm_rfft_mixed_init_f32(
+        arm_rfft_mixed_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle);
+
+  /**
+   * @brief  Processing function for the floating-point mixed-radix RFFT/RIFFT.
+   * @param[in]     S         points to an instance of the floating-point mixed-radix RFFT structure.
+   * @param[in,out] p         points to the data buffer of size fftLen. Processing occurs in-place.
+   * @param[in]     pScratch  points to a scratch buffer of size fftLen.
+   * @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   */
+  void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+        float32_t * p,
+        float32_t * pScratch,
+        uint8_t ifftFlag);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -2528,6 +2814,274 @@ arm_status arm_rfft_4096_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
         q15_t * pInlineBuffer);
 
 
+  /**
+   * @brief Instance structure for the floating-point Goertzel detector.
+   */
+  typedef struct
+  {
+          uint16_t blockLength;     /**< number of samples per detection frame. */
+          uint16_t numBins;         /**< number of frequencies evaluated per frame. */
+          uint16_t count;           /**< number of samples accumulated in the current frame. */
+          float32_t *pCoeffs;       /**< points to the {cos, sin} pairs of the bin frequencies. The array is of length 2*numBins. */
+          float32_t *pState;        /**< points to the {s1, s2} state pairs. The array is of length 2*numBins. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel detector.
+   */
+  typedef struct
+  {
+          uint16_t blockLength;     /**< number of samples per detection frame. */
+          uint16_t numBins;         /**< number of frequencies evaluated per frame. */
+          uint16_t count;           /**< number of samples accumulated in the current frame. */
+          q31_t *pCoeffs;           /**< points to the {cos, sin} pairs of the bin frequencies. The array is of length 2*numBins. */
+          q63_t *pState;            /**< points to the {s1, s2} state pairs. The array is of length 2*numBins. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 Goertzel detector.
+   */
+  typedef struct
+  {
+          uint16_t blockLength;     /**< number of samples per detection frame. */
+          uint16_t numBins;         /**< number of frequencies evaluated per frame. */
+          uint16_t count;           /**< number of samples accumulated in the current frame. */
+          q31_t *pCoeffs;           /**< points to the {cos, sin} pairs of the bin frequencies. The array is of length 2*numBins. */
+          q63_t *pState;            /**< points to the {s1, s2} state pairs. The array is of length 2*numBins. */
+  } arm_goertzel_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel detector.
+   * @param[in,out] S            points to an instance of the floating-point Goertzel structure.
+   * @param[in]     blockLength  number of samples per detection frame.
+   * @param[in]     numBins      number of frequencies to evaluate.
+   * @param[in]     pFreqs       points to the bin frequencies, as fractions of the sample rate in [0, 0.5].
+   * @param[in]     pCoeffs      points to the coefficient buffer of length 2*numBins.
+   * @param[in]     pState       points to the state buffer of length 2*numBins.
+   */
+  void arm_goertzel_init_f32(
+        arm_goertzel_instance_f32 * S,
+        uint16_t blockLength,
+        uint16_t numBins,
+  const float32_t * pFreqs,
+        float32_t * pCoeffs,
+        float32_t * pState);
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel detector.
+   * @param[in,out] S            points to an instance of the Q31 Goertzel structure.
+   * @param[in]     blockLength  number of samples per detection frame.
+   * @param[in]     numBins      number of frequencies to evaluate.
+   * @param[in]     pFreqs       points to the bin frequencies, as 1.31 fractions of the sample rate in [0, 0.5].
+   * @param[in]     pCoeffs      points to the coefficient buffer of length 2*numBins.
+   * @param[in]     pState       points to the state buffer of length 2*numBins.
+   */
+  void arm_goertzel_init_q31(
+        arm_goertzel_instance_q31 * S,
+        uint16_t blockLength,
+        uint16_t numBins,
+  const q31_t * pFreqs,
+        q31_t * pCoeffs,
+        q63_t * pState);
+
+  /**
+   * @brief  Initialization function for the Q15 Goertzel detector.
+   * @param[in,out] S            points to an instance of the Q15 Goertzel structure.
+   * @param[in]     blockLength  number of samples per detection frame.
+   * @param[in]     numBins      number of frequencies to evaluate.
+   * @param[in]     pFreqs       points to the bin frequencies, as 1.15 fractions of the sample rate in [0, 0.5].
+   * @param[in]     pCoeffs      points to the coefficient buffer of length 2*numBins.
+   * @param[in]     pState       points to the state buffer of length 2*numBins.
+   */
+  void arm_goertzel_init_q15(
+        arm_goertzel_instance_q15 * S,
+        uint16_t blockLength,
+        uint16_t numBins,
+  const q15_t * pFreqs,
+        q31_t * pCoeffs,
+        q63_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point Goertzel detector.
+   * @param[in,out] S          points to an instance of the floating-point Goertzel structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the bin powers, numBins values per completed frame.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        number of frames completed in this call.
+   */
+  uint32_t arm_goertzel_f32(
+        arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q31 Goertzel detector.
+   * @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the bin powers, numBins values per completed frame.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        number of frames completed in this call.
+   */
+  uint32_t arm_goertzel_q31(
+        arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q15 Goertzel detector.
+   * @param[in,out] S          points to an instance of the Q15 Goertzel structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the bin powers, numBins values per completed frame.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        number of frames completed in this call.
+   */
+  uint32_t arm_goertzel_q15(
+        arm_goertzel_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;          /**< length of the sliding window. */
+          uint16_t numBins;         /**< number of tracked bins. */
+          uint16_t index;           /**< ring position of the next input sample. */
+    const uint16_t *pBins;          /**< points to the tracked bin indices, each less than fftLen. */
+          float32_t *pTwiddle;      /**< points to the {cos, sin} twiddle table. The array is of length 2*fftLen. */
+          float32_t *pHistory;      /**< points to the sample ring. The array is of length fftLen. */
+          float32_t *pState;        /**< points to the per-bin accumulators. The array is of length 4*numBins. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;          /**< length of the sliding window. */
+          uint16_t numBins;         /**< number of tracked bins. */
+          uint16_t index;           /**< ring position of the next input sample. */
+    const uint16_t *pBins;          /**< points to the tracked bin indices, each less than fftLen. */
+          q31_t *pTwiddle;          /**< points to the {cos, sin} twiddle table. The array is of length 2*fftLen. */
+          q31_t *pHistory;          /**< points to the sample ring. The array is of length fftLen. */
+          q63_t *pState;            /**< points to the per-bin accumulators. The array is of length 2*numBins. */
+  } arm_sdft_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;          /**< length of the sliding window. */
+          uint16_t numBins;         /**< number of tracked bins. */
+          uint16_t index;           /**< ring position of the next input sample. */
+    const uint16_t *pBins;          /**< points to the tracked bin indices, each less than fftLen. */
+          q15_t *pTwiddle;          /**< points to the {cos, sin} twiddle table. The array is of length 2*fftLen. */
+          q15_t *pHistory;          /**< points to the sample ring. The array is of length fftLen. */
+          q63_t *pState;            /**< points to the per-bin accumulators. The array is of length 2*numBins. */
+  } arm_sdft_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[in,out] S         points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     fftLen    length of the sliding window.
+   * @param[in]     numBins   number of tracked bins.
+   * @param[in]     pBins     points to the tracked bin indices.
+   * @param[in]     pTwiddle  points to the twiddle buffer of length 2*fftLen.
+   * @param[in]     pHistory  points to the sample ring of length fftLen.
+   * @param[in]     pState    points to the state buffer of length 4*numBins.
+   */
+  void arm_sdft_init_f32(
+        arm_sdft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t numBins,
+  const uint16_t * pBins,
+        float32_t * pTwiddle,
+        float32_t * pHistory,
+        float32_t * pState);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding DFT.
+   * @param[in,out] S         points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     fftLen    length of the sliding window.
+   * @param[in]     numBins   number of tracked bins.
+   * @param[in]     pBins     points to the tracked bin indices.
+   * @param[in]     pTwiddle  points to the twiddle buffer of length 2*fftLen.
+   * @param[in]     pHistory  points to the sample ring of length fftLen.
+   * @param[in]     pState    points to the state buffer of length 2*numBins.
+   */
+  void arm_sdft_init_q31(
+        arm_sdft_instance_q31 * S,
+        uint16_t fftLen,
+        uint16_t numBins,
+  const uint16_t * pBins,
+        q31_t * pTwiddle,
+        q31_t * pHistory,
+        q63_t * pState);
+
+  /**
+   * @brief  Initialization function for the Q15 sliding DFT.
+   * @param[in,out] S         points to an instance of the Q15 sliding DFT structure.
+   * @param[in]     fftLen    length of the sliding window.
+   * @param[in]     numBins   number of tracked bins.
+   * @param[in]     pBins     points to the tracked bin indices.
+   * @param[in]     pTwiddle  points to the twiddle buffer of length 2*fftLen.
+   * @param[in]     pHistory  points to the sample ring of length fftLen.
+   * @param[in]     pState    points to the state buffer of length 2*numBins.
+   */
+  void arm_sdft_init_q15(
+        arm_sdft_instance_q15 * S,
+        uint16_t fftLen,
+        uint16_t numBins,
+  const uint16_t * pBins,
+        q15_t * pTwiddle,
+        q15_t * pHistory,
+        q63_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point sliding DFT.
+   * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the complex bins of the window ending at the last input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sdft_f32(
+        arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q31 sliding DFT.
+   * @param[in,out] S          points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the complex bins of the window ending at the last input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sdft_q31(
+        arm_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q15 sliding DFT.
+   * @param[in,out] S          points to an instance of the Q15 sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the complex bins of the window ending at the last input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sdft_q15(
+        arm_sdft_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+
   /**
    * @brief Floating-point vector addition.
    * @param[in]  pSrcA      points to the first input vector
@@ -3705,6 +4259,162 @@ arm_status arm_fir_decimate_init_f32(
         uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the Q15 L/M resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                    /**< upsample factor. */
+        uint16_t M;                    /**< downsample factor. */
+        uint16_t phaseLength;          /**< length of each polyphase filter component, i.e. multiply-accumulates per output. */
+        uint16_t phase;                /**< polyphase component of the next output. */
+        uint32_t inputOffset;          /**< input sample of the next output, relative to the start of the next block. */
+  const q15_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+        q15_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_q15;
+
+
+  /**
+   * @brief Instance structure for the Q31 L/M resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                    /**< upsample factor. */
+        uint16_t M;                    /**< downsample factor. */
+        uint16_t phaseLength;          /**< length of each polyphase filter component, i.e. multiply-accumulates per output. */
+        uint16_t phase;                /**< polyphase component of the next output. */
+        uint32_t inputOffset;          /**< input sample of the next output, relative to the start of the next block. */
+  const q31_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+        q31_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_q31;
+
+
+  /**
+   * @brief Instance structure for the floating-point L/M resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                    /**< upsample factor. */
+        uint16_t M;                    /**< downsample factor. */
+        uint16_t phaseLength;          /**< length of each polyphase filter component, i.e. multiply-accumulates per output. */
+        uint16_t phase;                /**< polyphase component of the next output. */
+        uint32_t inputOffset;          /**< input sample of the next output, relative to the start of the next block. */
+  const float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+        float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 L/M resampler.
+   * @param[in,out] S          points to an instance of the Q15 resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, at least (blockSize*L+M-1)/M values.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_q15(
+        arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 L/M resampler.
+   * @param[in,out] S          points to an instance of the Q15 resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  largest number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>L</code> or <code>M</code> is zero or the filter length <code>numTaps</code> is not a multiple of <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q15(
+        arm_fir_resample_instance_q15 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 L/M resampler.
+   * @param[in,out] S          points to an instance of the Q31 resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, at least (blockSize*L+M-1)/M values.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_q31(
+        arm_fir_resample_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 L/M resampler.
+   * @param[in,out] S          points to an instance of the Q31 resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  largest number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>L</code> or <code>M</code> is zero or the filter length <code>numTaps</code> is not a multiple of <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q31(
+        arm_fir_resample_instance_q31 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point L/M resampler.
+   * @param[in,out] S          points to an instance of the floating-point resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, at least (blockSize*L+M-1)/M values.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_f32(
+        arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point L/M resampler.
+   * @param[in,out] S          points to an instance of the floating-point resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  largest number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>L</code> or <code>M</code> is zero or the filter length <code>numTaps</code> is not a multiple of <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_f32(
+        arm_fir_resample_instance_f32 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -6677,6 +7387,507 @@ arm_status arm_sqrt_q15(
         float32_t * pResult,
         uint32_t * pIndex);
 
+  /**
+   * @brief Instance structure for the floating-point sliding window statistics.
+   */
+  typedef struct
+  {
+          uint16_t windowSize;      /**< number of samples in the window. */
+          uint16_t numSamples;      /**< number of samples currently in the window (up to windowSize). */
+          uint16_t head;            /**< ring position of the next input sample. */
+          uint16_t maxFront;        /**< position of the oldest entry of the maximum queue. */
+          uint16_t maxCount;        /**< number of entries in the maximum queue. */
+          uint16_t minFront;        /**< position of the oldest entry of the minimum queue. */
+          uint16_t minCount;        /**< number of entries in the minimum queue. */
+          float32_t mean;           /**< running mean of the window. */
+          float32_t m2;             /**< running sum of squared deviations from the mean. */
+          float32_t syncMean;       /**< mean of the samples since the ring last wrapped. */
+          float32_t syncM2;         /**< sum of squared deviations of the samples since the ring last wrapped. */
+          float32_t *pHistory;      /**< points to the sample ring. The array is of length windowSize. */
+          uint16_t *pMaxQueue;      /**< points to the maximum queue. The array is of length windowSize. */
+          uint16_t *pMinQueue;      /**< points to the minimum queue. The array is of length windowSize. */
+  } arm_sliding_stats_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding window statistics.
+   */
+  typedef struct
+  {
+          uint16_t windowSize;      /**< number of samples in the window. */
+          uint16_t numSamples;      /**< number of samples currently in the window (up to windowSize). */
+          uint16_t head;            /**< ring position of the next input sample. */
+          uint16_t maxFront;        /**< position of the oldest entry of the maximum queue. */
+          uint16_t maxCount;        /**< number of entries in the maximum queue. */
+          uint16_t minFront;        /**< position of the oldest entry of the minimum queue. */
+          uint16_t minCount;        /**< number of entries in the minimum queue. */
+          q63_t sum;                /**< sum of the samples. */
+          q63_t sumScaled;          /**< sum of the samples shifted right by 8 bits. */
+          q63_t sumOfSquaresScaled; /**< sum of the squares of the samples shifted right by 8 bits. */
+          uint64_t sumOfSquares;    /**< sum of the squares of the samples (modulo 2^64). */
+          q31_t *pHistory;          /**< points to the sample ring. The array is of length windowSize. */
+          uint16_t *pMaxQueue;      /**< points to the maximum queue. The array is of length windowSize. */
+          uint16_t *pMinQueue;      /**< points to the minimum queue. The array is of length windowSize. */
+  } arm_sliding_stats_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sliding window statistics.
+   */
+  typedef struct
+  {
+          uint16_t windowSize;      /**< number of samples in the window. */
+          uint16_t numSamples;      /**< number of samples currently in the window (up to windowSize). */
+          uint16_t head;            /**< ring position of the next input sample. */
+          uint16_t maxFront;        /**< position of the oldest entry of the maximum queue. */
+          uint16_t maxCount;        /**< number of entries in the maximum queue. */
+          uint16_t minFront;        /**< position of the oldest entry of the minimum queue. */
+          uint16_t minCount;        /**< number of entries in the minimum queue. */
+          q31_t sum;                /**< sum of the samples. */
+          q63_t sumOfSquares;       /**< sum of the squares of the samples. */
+          q15_t *pHistory;          /**< points to the sample ring. The array is of length windowSize. */
+          uint16_t *pMaxQueue;      /**< points to the maximum queue. The array is of length windowSize. */
+          uint16_t *pMinQueue;      /**< points to the minimum queue. The array is of length windowSize. */
+  } arm_sliding_stats_instance_q15;
+
+
+  /**
+   * @brief  Initialization function for the floating-point sliding window statistics.
+   * @param[in,out] S           points to an instance of the floating-point sliding window statistics structure.
+   * @param[in]     windowSize  number of samples in the window (at least 1).
+   * @param[in]     pHistory    points to the sample ring of length windowSize.
+   * @param[in]     pMaxQueue   points to the maximum queue of length windowSize.
+   * @param[in]     pMinQueue   points to the minimum queue of length windowSize.
+   */
+  void arm_sliding_stats_init_f32(
+        arm_sliding_stats_instance_f32 * S,
+        uint16_t windowSize,
+        float32_t * pHistory,
+        uint16_t * pMaxQueue,
+        uint16_t * pMinQueue);
+
+  /**
+   * @brief  Adds a block of samples to the floating-point sliding window statistics.
+   * @param[in,out] S          points to an instance of the floating-point sliding window statistics structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_stats_f32(
+        arm_sliding_stats_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Mean of the samples in the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] pResult  mean returned here.
+   */
+  void arm_sliding_stats_mean_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult);
+
+  /**
+   * @brief  Variance of the samples in the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] pResult  variance returned here.
+   */
+  void arm_sliding_stats_var_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult);
+
+  /**
+   * @brief  Standard deviation of the samples in the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] pResult  standard deviation returned here.
+   */
+  void arm_sliding_stats_std_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult);
+
+  /**
+   * @brief  Root mean square of the samples in the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] pResult  root mean square returned here.
+   */
+  void arm_sliding_stats_rms_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult);
+
+  /**
+   * @brief  Minimum value of the samples in the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] pResult  minimum value returned here.
+   */
+  void arm_sliding_stats_min_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult);
+
+  /**
+   * @brief  Maximum value of the samples in the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] pResult  maximum value returned here.
+   */
+  void arm_sliding_stats_max_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult);
+
+
+  /**
+   * @brief  Initialization function for the Q31 sliding window statistics.
+   * @param[in,out] S           points to an instance of the Q31 sliding window statistics structure.
+   * @param[in]     windowSize  number of samples in the window (at least 1).
+   * @param[in]     pHistory    points to the sample ring of length windowSize.
+   * @param[in]     pMaxQueue   points to the maximum queue of length windowSize.
+   * @param[in]     pMinQueue   points to the minimum queue of length windowSize.
+   */
+  void arm_sliding_stats_init_q31(
+        arm_sliding_stats_instance_q31 * S,
+        uint16_t windowSize,
+        q31_t * pHistory,
+        uint16_t * pMaxQueue,
+        uint16_t * pMinQueue);
+
+  /**
+   * @brief  Adds a block of samples to the Q31 sliding window statistics.
+   * @param[in,out] S          points to an instance of the Q31 sliding window statistics structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_stats_q31(
+        arm_sliding_stats_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Mean of the samples in the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] pResult  mean returned here.
+   */
+  void arm_sliding_stats_mean_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult);
+
+  /**
+   * @brief  Variance of the samples in the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] pResult  variance returned here.
+   */
+  void arm_sliding_stats_var_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult);
+
+  /**
+   * @brief  Standard deviation of the samples in the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] pResult  standard deviation returned here.
+   */
+  void arm_sliding_stats_std_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult);
+
+  /**
+   * @brief  Root mean square of the samples in the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] pResult  root mean square returned here.
+   */
+  void arm_sliding_stats_rms_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult);
+
+  /**
+   * @brief  Minimum value of the samples in the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] pResult  minimum value returned here.
+   */
+  void arm_sliding_stats_min_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult);
+
+  /**
+   * @brief  Maximum value of the samples in the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] pResult  maximum value returned here.
+   */
+  void arm_sliding_stats_max_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult);
+
+
+  /**
+   * @brief  Initialization function for the Q15 sliding window statistics.
+   * @param[in,out] S           points to an instance of the Q15 sliding window statistics structure.
+   * @param[in]     windowSize  number of samples in the window (at least 1).
+   * @param[in]     pHistory    points to the sample ring of length windowSize.
+   * @param[in]     pMaxQueue   points to the maximum queue of length windowSize.
+   * @param[in]     pMinQueue   points to the minimum queue of length windowSize.
+   */
+  void arm_sliding_stats_init_q15(
+        arm_sliding_stats_instance_q15 * S,
+        uint16_t windowSize,
+        q15_t * pHistory,
+        uint16_t * pMaxQueue,
+        uint16_t * pMinQueue);
+
+  /**
+   * @brief  Adds a block of samples to the Q15 sliding window statistics.
+   * @param[in,out] S          points to an instance of the Q15 sliding window statistics structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_stats_q15(
+        arm_sliding_stats_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Mean of the samples in the Q15 sliding window.
+   * @param[in]  S        points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] pResult  mean returned here.
+   */
+  void arm_sliding_stats_mean_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        q15_t * pResult);
+
+  /**
+   * @brief  Variance of the samples in the Q15 sliding window.
+   * @param[in]  S        points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] pResult  variance returned here.
+   */
+  void arm_sliding_stats_var_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        q15_t * pResult);
+
+  /**
+   * @brief  Standard deviation of the samples in the Q15 sliding window.
+   * @param[in]  S        points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] pResult  standard deviation returned here.
+   */
+  void arm_sliding_stats_std_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        q15_t * pResult);
+
+  /**
+   * @brief  Root mean square of the samples in the Q15 sliding window.
+   * @param[in]  S        points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] pResult  root mean square returned here.
+   */
+  void arm_sliding_stats_rms_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        q15_t * pResult);
+
+  /**
+   * @brief  Minimum value of the samples in the Q15 sliding window.
+   * @param[in]  S        points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] pResult  minimum value returned here.
+   */
+  void arm_sliding_stats_min_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        q15_t * pResult);
+
+  /**
+   * @brief  Maximum value of the samples in the Q15 sliding window.
+   * @param[in]  S        points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] pResult  maximum value returned here.
+   */
+  void arm_sliding_stats_max_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        q15_t * pResult);
+
+  /**
+   * @brief Instance structure for the Q15 running median filter.
+   */
+  typedef struct
+  {
+          uint16_t windowSize;      /**< number of samples in the window. */
+          uint16_t numSamples;      /**< number of samples currently in the window (up to windowSize). */
+          uint16_t head;            /**< ring position of the next input sample. */
+          q15_t *pHistory;          /**< points to the sample ring. The array is of length windowSize. */
+          uint16_t *pHeap;          /**< points to the heap array of ring positions, centered on the median. */
+          int16_t *pPos;            /**< points to the heap index of each ring position. */
+  } arm_median_filter_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 running median filter.
+   */
+  typedef struct
+  {
+          uint16_t windowSize;      /**< number of samples in the window. */
+          uint16_t numSamples;      /**< number of samples currently in the window (up to windowSize). */
+          uint16_t head;            /**< ring position of the next input sample. */
+          q31_t *pHistory;          /**< points to the sample ring. The array is of length windowSize. */
+          uint16_t *pHeap;          /**< points to the heap array of ring positions, centered on the median. */
+          int16_t *pPos;            /**< points to the heap index of each ring position. */
+  } arm_median_filter_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point running median filter.
+   */
+  typedef struct
+  {
+          uint16_t windowSize;      /**< number of samples in the window. */
+          uint16_t numSamples;      /**< number of samples currently in the window (up to windowSize). */
+          uint16_t head;            /**< ring position of the next input sample. */
+          float32_t *pHistory;      /**< points to the sample ring. The array is of length windowSize. */
+          uint16_t *pHeap;          /**< points to the heap array of ring positions, centered on the median. */
+          int16_t *pPos;            /**< points to the heap index of each ring position. */
+  } arm_median_filter_instance_f32;
+
+  /**
+   * @brief  Sorts the elements of a floating-point vector in ascending order.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector, may be equal to pSrc
+   * @param[in]  pScratch   points to a scratch buffer of blockSize samples
+   * @param[in]  blockSize  number of samples in the vector
+   */
+  void arm_sort_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point running median filter.
+   * @param[in,out] S           points to an instance of the floating-point running median filter structure.
+   * @param[in]     windowSize  number of samples in the window (at least 1).
+   * @param[in]     pHistory    points to the sample ring of length windowSize.
+   * @param[in]     pIndex      points to the index buffer of length 2*windowSize.
+   */
+  void arm_median_filter_init_f32(
+        arm_median_filter_instance_f32 * S,
+        uint16_t windowSize,
+        float32_t * pHistory,
+        uint16_t * pIndex);
+
+  /**
+   * @brief  Processing function for the floating-point running median filter.
+   * @param[in,out] S          points to an instance of the floating-point running median filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_filter_f32(
+        arm_median_filter_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Sorts the elements of a Q31 vector in ascending order.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector, may be equal to pSrc
+   * @param[in]  pScratch   points to a scratch buffer of blockSize samples
+   * @param[in]  blockSize  number of samples in the vector
+   */
+  void arm_sort_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pScratch,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 running median filter.
+   * @param[in,out] S           points to an instance of the Q31 running median filter structure.
+   * @param[in]     windowSize  number of samples in the window (at least 1).
+   * @param[in]     pHistory    points to the sample ring of length windowSize.
+   * @param[in]     pIndex      points to the index buffer of length 2*windowSize.
+   */
+  void arm_median_filter_init_q31(
+        arm_median_filter_instance_q31 * S,
+        uint16_t windowSize,
+        q31_t * pHistory,
+        uint16_t * pIndex);
+
+  /**
+   * @brief  Processing function for the Q31 running median filter.
+   * @param[in,out] S          points to an instance of the Q31 running median filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_filter_q31(
+        arm_median_filter_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Sorts the elements of a Q15 vector in ascending order.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector, may be equal to pSrc
+   * @param[in]  pScratch   points to a scratch buffer of blockSize samples
+   * @param[in]  blockSize  number of samples in the vector
+   */
+  void arm_sort_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        q15_t * pScratch,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 running median filter.
+   * @param[in,out] S           points to an instance of the Q15 running median filter structure.
+   * @param[in]     windowSize  number of samples in the window (at least 1).
+   * @param[in]     pHistory    points to the sample ring of length windowSize.
+   * @param[in]     pIndex      points to the index buffer of length 2*windowSize.
+   */
+  void arm_median_filter_init_q15(
+        arm_median_filter_instance_q15 * S,
+        uint16_t windowSize,
+        q15_t * pHistory,
+        uint16_t * pIndex);
+
+  /**
+   * @brief  Processing function for the Q15 running median filter.
+   * @param[in,out] S          points to an instance of the Q15 running median filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_filter_q15(
+        arm_median_filter_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Percentile of the elements of a floating-point vector.
+   * @param[in,out] pSrc        points to the input vector, reordered on return
+   * @param[in]     blockSize   number of samples in the vector
+   * @param[in]     percentile  percentile in the range [0, 100]
+   * @param[out]    pResult     percentile value returned here
+   */
+  void arm_percentile_f32(
+        float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t percentile,
+        float32_t * pResult);
+
+  /**
+   * @brief  Percentile of the elements of a Q31 vector.
+   * @param[in,out] pSrc       points to the input vector, reordered on return
+   * @param[in]     blockSize  number of samples in the vector
+   * @param[in]     fraction   percentile divided by 100, in 1.31 format
+   * @param[out]    pResult    percentile value returned here
+   */
+  void arm_percentile_q31(
+        q31_t * pSrc,
+        uint32_t blockSize,
+        q31_t fraction,
+        q31_t * pResult);
+
+  /**
+   * @brief  Percentile of the elements of a Q15 vector.
+   * @param[in,out] pSrc       points to the input vector, reordered on return
+   * @param[in]     blockSize  number of samples in the vector
+   * @param[in]     fraction   percentile divided by 100, in 1.15 format
+   * @param[out]    pResult    percentile value returned here
+   */
+  void arm_percentile_q15(
+        q15_t * pSrc,
+        uint32_t blockSize,
+        q15_t fraction,
+        q15_t * pResult);
+
 
   /**
    * @brief  Q15 complex-by-complex multiplication
@@ -107,6 +107,32 @@ void arm_dot_prod_f32(
     /* Tail */
     blkCnt = blockSize & 0x3;
 
+#elif defined(ARM_MATH_AVX2)
+    __m256 accum0 = _mm256_setzero_ps();
+    __m256 accum1 = _mm256_setzero_ps();
+
+    /* Compute 16 products at a time, two accumulators hide the FMA latency */
+    blkCnt = blockSize >> 4U;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A[0]*B[0] + A[1]*B[1] + A[2]*B[2] + ... + A[blockSize-1]*B[blockSize-1] */
+        accum0 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrcA), _mm256_loadu_ps(pSrcB), accum0);
+        accum1 = _mm256_fmadd_ps(_mm256_loadu_ps(pSrcA + 8), _mm256_loadu_ps(pSrcB + 8), accum1);
+
+        /* Increment pointers */
+        pSrcA += 16;
+        pSrcB += 16;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    sum = __arm_hsum_f32_avx2(_mm256_add_ps(accum0, accum1));
+
+    /* Tail */
+    blkCnt = blockSize & 0xF;
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
@@ -95,6 +95,31 @@ void arm_offset_f32(
     /* Tail */
     blkCnt = blockSize & 0x3;
 
+#elif defined(ARM_MATH_AVX2)
+    __m256 vec1;
+    __m256 offsetV = _mm256_set1_ps(offset);
+
+    /* Compute 8 outputs at a time */
+    blkCnt = blockSize >> 3U;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A + offset */
+
+        vec1 = _mm256_loadu_ps(pSrc);
+        _mm256_storeu_ps(pDst, _mm256_add_ps(vec1, offsetV));
+
+        /* Increment pointers */
+        pSrc += 8;
+        pDst += 8;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = blockSize & 0x7;
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
@@ -107,6 +107,31 @@ void arm_scale_f32(
     /* Tail */
     blkCnt = blockSize & 0x3;
 
+#elif defined(ARM_MATH_AVX2)
+    __m256 vec1;
+    __m256 scaleV = _mm256_set1_ps(scale);
+
+    /* Compute 8 outputs at a time */
+    blkCnt = blockSize >> 3U;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A * scale */
+
+        vec1 = _mm256_loadu_ps(pSrc);
+        _mm256_storeu_ps(pDst, _mm256_mul_ps(vec1, scaleV));
+
+        /* Increment pointers */
+        pSrc += 8;
+        pDst += 8;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = blockSize & 0x7;
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
@@ -96,6 +96,33 @@ void arm_sub_f32(
     /* Tail */
     blkCnt = blockSize & 0x3;
 
+#elif defined(ARM_MATH_AVX2)
+    __m256 vec1;
+    __m256 vec2;
+
+    /* Compute 8 outputs at a time */
+    blkCnt = blockSize >> 3U;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A - B */
+
+        vec1 = _mm256_loadu_ps(pSrcA);
+        vec2 = _mm256_loadu_ps(pSrcB);
+        _mm256_storeu_ps(pDst, _mm256_sub_ps(vec1, vec2));
+
+        /* Increment pointers */
+        pSrcA += 8;
+        pSrcB += 8;
+        pDst += 8;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = blockSize & 0x7;
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
@@ -69,6 +69,12 @@
 #include "arm_correlate_q15.c"
 #include "arm_correlate_q31.c"
 #include "arm_correlate_q7.c"
+#include "arm_fir_circ_f32.c"
+#include "arm_fir_circ_init_f32.c"
+#include "arm_fir_circ_init_q15.c"
+#include "arm_fir_circ_init_q31.c"
+#include "arm_fir_circ_q15.c"
+#include "arm_fir_circ_q31.c"
 #include "arm_fir_decimate_f32.c"
 #include "arm_fir_decimate_fast_q15.c"
 #include "arm_fir_decimate_fast_q31.c"
@@ -99,6 +105,12 @@
 #include "arm_fir_q15.c"
 #include "arm_fir_q31.c"
 #include "arm_fir_q7.c"
+#include "arm_fir_resample_f32.c"
+#include "arm_fir_resample_init_f32.c"
+#include "arm_fir_resample_init_q15.c"
+#include "arm_fir_resample_init_q31.c"
+#include "arm_fir_resample_q15.c"
+#include "arm_fir_resample_q31.c"
 #include "arm_fir_sparse_f32.c"
 #include "arm_fir_sparse_init_f32.c"
 #include "arm_fir_sparse_init_q15.c"
@@ -214,6 +214,108 @@ void arm_biquad_cascade_df2T_f32(
       stageCnt--;
    }
 }
+#elif defined(ARM_MATH_AVX2)
+
+void arm_biquad_cascade_df2T_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        float32_t b0[4], b1[4], b2[4], a1[4], a2[4];   /* Filter coefficients, one stage per lane */
+        float32_t d1[4], d2[4];                        /* State variables, one stage per lane */
+        uint32_t lanes, l, t, stage = S->numStages;    /* Loop counters */
+        __m128 b0V, b1V, b2V, a1V, a2V;
+        __m128 d1V, d2V, xV, yV, validV;
+  const __m128 laneV = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+  const __m128 blockV = _mm_set1_ps((float32_t)blockSize);
+
+  /* A stage depends on the previous stage's output of the same sample, so the stages are
+   * vectorized as a wavefront: 4 stages are processed together, lane l filtering sample (t - l)
+   * at step t. Each step shifts the previous outputs one lane up and feeds the next input to lane 0,
+   * the output of sample (t - 3) leaves lane 3. Unused lanes of the last group pass the input through.
+   * During the first and the last 3 steps only the lanes holding a valid sample update their state. */
+  while (stage > 0U)
+  {
+    lanes = (stage < 4U) ? stage : 4U;
+
+    for (l = 0; l < 4U; l++)
+    {
+      if (l < lanes)
+      {
+        b0[l] = pCoeffs[0];
+        b1[l] = pCoeffs[1];
+        b2[l] = pCoeffs[2];
+        a1[l] = pCoeffs[3];
+        a2[l] = pCoeffs[4];
+        d1[l] = pState[2U * l];
+        d2[l] = pState[2U * l + 1U];
+        pCoeffs += 5U;
+      }
+      else
+      {
+        b0[l] = 1.0f;
+        b1[l] = b2[l] = a1[l] = a2[l] = 0.0f;
+        d1[l] = d2[l] = 0.0f;
+      }
+    }
+
+    b0V = _mm_loadu_ps(b0);
+    b1V = _mm_loadu_ps(b1);
+    b2V = _mm_loadu_ps(b2);
+    a1V = _mm_loadu_ps(a1);
+    a2V = _mm_loadu_ps(a2);
+    d1V = _mm_loadu_ps(d1);
+    d2V = _mm_loadu_ps(d2);
+    yV = _mm_setzero_ps();
+
+    for (t = 0; t < blockSize + 3U; t++)
+    {
+      /* Lane 0 takes the next input, lane l takes the output of lane (l - 1) */
+      xV = _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(yV), 4));
+      xV = _mm_move_ss(xV, _mm_set_ss((t < blockSize) ? pIn[t] : 0.0f));
+
+      yV = _mm_fmadd_ps(b0V, xV, d1V);
+
+      if ((t >= 3U) && (t < blockSize))
+      {
+        d1V = _mm_fmadd_ps(b1V, xV, _mm_fmadd_ps(a1V, yV, d2V));
+        d2V = _mm_fmadd_ps(b2V, xV, _mm_mul_ps(a2V, yV));
+      }
+      else
+      {
+        /* Lanes outside 0 <= t - l < blockSize keep their state */
+        validV = _mm_sub_ps(_mm_set1_ps((float32_t)t), laneV);
+        validV = _mm_and_ps(_mm_cmpge_ps(validV, _mm_setzero_ps()), _mm_cmplt_ps(validV, blockV));
+        d1V = _mm_blendv_ps(d1V, _mm_fmadd_ps(b1V, xV, _mm_fmadd_ps(a1V, yV, d2V)), validV);
+        d2V = _mm_blendv_ps(d2V, _mm_fmadd_ps(b2V, xV, _mm_mul_ps(a2V, yV)), validV);
+      }
+
+      if (t >= 3U)
+      {
+        pDst[t - 3U] = _mm_cvtss_f32(_mm_shuffle_ps(yV, yV, _MM_SHUFFLE(3, 3, 3, 3)));
+      }
+    }
+
+    /* Store the updated state variables back into the state array */
+    _mm_storeu_ps(d1, d1V);
+    _mm_storeu_ps(d2, d2V);
+    for (l = 0; l < lanes; l++)
+    {
+      pState[2U * l] = d1[l];
+      pState[2U * l + 1U] = d2[l];
+    }
+    pState += 2U * lanes;
+
+    /* The output of this group is the input of the next one */
+    pIn = pDst;
+
+    stage -= lanes;
+  }
+}
 #else
 LOW_OPTIMIZATION_ENTER
 void arm_biquad_cascade_df2T_f32(
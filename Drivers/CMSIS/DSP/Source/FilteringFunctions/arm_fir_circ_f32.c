@@ -0,0 +1,240 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_f32.c
+ * Description:  Floating-point FIR filter processing function with circular state
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_Circ Finite Impulse Response (FIR) Filters with Circular State
+
+  This group of functions implements the same direct form FIR filter as the
+  \ref FIR functions, but keeps the filter history in a circular state buffer.
+  The standard functions append each input block behind the last <code>numTaps-1</code>
+  samples and copy that history back to the start of the state buffer at the end of
+  every call. For long filters fed with short blocks this copy dominates the cost
+  of the call. The circular variants never move the history: each input sample is
+  written once into each half of a double mapped buffer, so that the most recent
+  samples are always available as one contiguous window.
+
+  @par           Algorithm
+                   The state buffer holds <code>R = numTaps + 3</code> samples twice.
+                   Sample <code>x[n]</code> is written at ring position <code>p</code> and
+                   at <code>p + R</code>, the <code>R</code> samples starting at any ring position are
+                   therefore contiguous in memory. Outputs are computed 4 at a time over such a window:
+  <pre>
+      y[n] = b[0] * x[n] + b[1] * x[n-1] + b[2] * x[n-2] + ...+ b[numTaps-1] * x[n-numTaps+1]
+  </pre>
+  @par
+                   Results are identical to the standard FIR functions of the same data type.
+                   Each call costs 2 state writes per input sample instead of the
+                   <code>blockSize + numTaps - 1</code> copies of the standard functions;
+                   the standard functions stay faster for large blocks and short filters.
+  @par
+                   <code>pCoeffs</code> points to the coefficient array of size <code>numTaps</code>,
+                   stored in time reversed order as for the standard FIR:
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   <code>pState</code> points to a state array of size <code>2 * (numTaps + 3)</code>,
+                   independent of <code>blockSize</code>, and any block size can be used on each call.
+
+  @par           Instance Structure
+                   The coefficients and state variables for a filter are stored together in an instance data structure.
+                   A separate instance structure must be defined for each filter.
+                   Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+
+  @par           Initialization Functions
+                   There is also an associated initialization function for each data type.
+                   The initialization function sets the values of the internal structure fields
+                   and zeros out the values in the state buffer.
+                   To do this manually without calling the init function, assign the follow subfields of the instance structure:
+                   numTaps, stateIndex (0), pState, pCoeffs. Also set all of the values in pState to zero.
+  <pre>
+      arm_fir_circ_instance_f32 S = {numTaps, 0, pState, pCoeffs};
+      arm_fir_circ_instance_q31 S = {numTaps, 0, pState, pCoeffs};
+      arm_fir_circ_instance_q15 S = {numTaps, 0, pState, pCoeffs};
+  </pre>
+
+  @par           Fixed-Point Behavior
+                   The fixed-point versions use the same 64-bit accumulators and the same scaling
+                   as arm_fir_q31() and arm_fir_q15(). Refer to the function specific documentation below.
+ */
+
+/**
+  @addtogroup FIR_Circ
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point FIR filter with circular state.
+  @param[in,out] S          points to an instance of the floating-point circular state FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+
+void arm_fir_circ_f32(
+        arm_fir_circ_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;            /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;          /* Coefficient pointer */
+  const float32_t *px;                            /* Temporary pointer for state buffer */
+  const float32_t *pb;                            /* Temporary pointer for coefficient buffer */
+        float32_t acc0, acc1, acc2, acc3;         /* Accumulators */
+        float32_t x0, x1, x2, x3, c0;             /* Temporary variables to hold state and coefficient values */
+        uint32_t numTaps = S->numTaps;            /* Number of filter coefficients in the filter */
+        uint32_t ringLen = numTaps + 3U;          /* Length of one half of the state buffer */
+        uint32_t stateIndex = S->stateIndex;      /* Ring position of the next input sample */
+        uint32_t i, tapCnt, blkCnt;               /* Loop counters */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* Write 4 new input samples into both halves of the state buffer */
+    for (i = 0U; i < 4U; i++)
+    {
+      x0 = *pSrc++;
+      pState[stateIndex] = x0;
+      pState[stateIndex + ringLen] = x0;
+
+      stateIndex++;
+      if (stateIndex == ringLen)
+      {
+        stateIndex = 0U;
+      }
+    }
+
+    /* The next write position is also the oldest sample of the window: the last numTaps + 3 samples */
+    px = &pState[stateIndex];
+    pb = pCoeffs;
+
+    /* Set the accumulators to zero */
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+    acc2 = 0.0f;
+    acc3 = 0.0f;
+
+    /* Read the first 3 samples of the window */
+    x0 = *px++;
+    x1 = *px++;
+    x2 = *px++;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      /* Read the coefficient and the next sample */
+      c0 = *pb++;
+      x3 = *px++;
+
+      /* Perform the multiply-accumulates */
+      acc0 += x0 * c0;
+      acc1 += x1 * c0;
+      acc2 += x2 * c0;
+      acc3 += x3 * c0;
+
+      /* Shift the window by one sample */
+      x0 = x1;
+      x1 = x2;
+      x2 = x3;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Store the results in the destination buffer */
+    *pDst++ = acc0;
+    *pDst++ = acc1;
+    *pDst++ = acc2;
+    *pDst++ = acc3;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Process the remaining samples one at a time */
+  blkCnt = blockSize & 0x3U;
+
+  while (blkCnt > 0U)
+  {
+    x0 = *pSrc++;
+    pState[stateIndex] = x0;
+    pState[stateIndex + ringLen] = x0;
+
+    stateIndex++;
+    if (stateIndex == ringLen)
+    {
+      stateIndex = 0U;
+    }
+
+    /* The window of this output starts numTaps samples before the next write position */
+    i = stateIndex + 3U;
+    if (i >= ringLen)
+    {
+      i -= ringLen;
+    }
+
+    px = &pState[i];
+    pb = pCoeffs;
+    acc0 = 0.0f;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      c0 = *pb++;
+      x0 = *px++;
+      acc0 += x0 * c0;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    *pDst++ = acc0;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Save the ring position for the next call, the history itself is never moved */
+  S->stateIndex = (uint16_t) stateIndex;
+}
+
+/**
+  @} end of FIR_Circ group
+ */
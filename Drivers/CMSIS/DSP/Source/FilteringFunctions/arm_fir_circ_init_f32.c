@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_init_f32.c
+ * Description:  Floating-point FIR filter with circular state initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Circ
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point FIR filter with circular state.
+  @param[in,out] S          points to an instance of the floating-point circular state FIR structure
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     pCoeffs    points to the filter coefficients buffer
+  @param[in]     pState     points to the state buffer
+  @return        none
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+                   <code>pState</code> points to the array of state variables.
+                   <code>pState</code> is of length <code>2 * (numTaps + 3)</code> samples and does not depend on the block size.
+ */
+
+void arm_fir_circ_init_f32(
+        arm_fir_circ_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState)
+{
+  /* Assign filter taps */
+  S->numTaps = numTaps;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer. The size is always 2 * (numTaps + 3) */
+  memset(pState, 0, 2U * (numTaps + 3U) * sizeof(float32_t));
+
+  /* Assign state pointer and start writing at the beginning of the ring */
+  S->pState = pState;
+  S->stateIndex = 0U;
+}
+
+/**
+  @} end of FIR_Circ group
+ */
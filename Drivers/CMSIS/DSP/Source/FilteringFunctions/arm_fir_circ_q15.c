@@ -0,0 +1,263 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_q15.c
+ * Description:  Q15 FIR filter processing function with circular state
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Circ
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 FIR filter with circular state.
+  @param[in,out] S          points to an instance of the Q15 circular state FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   There is no risk of overflow with this approach and the full precision of intermediate multiplications is preserved.
+                   After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+                   Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+
+void arm_fir_circ_q15(
+        arm_fir_circ_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;              /* Coefficient pointer */
+  const q15_t *px;                                /* Temporary pointer for state buffer */
+  const q15_t *pb;                                /* Temporary pointer for coefficient buffer */
+        q63_t acc0, acc1, acc2, acc3;             /* Accumulators */
+        q15_t c1;                                 /* Single coefficient */
+  const q15_t *px1;                               /* Single tap state pointer */
+        uint32_t numTaps = S->numTaps;            /* Number of filter coefficients in the filter */
+        uint32_t ringLen = numTaps + 3U;          /* Length of one half of the state buffer */
+        uint32_t stateIndex = S->stateIndex;      /* Ring position of the next input sample */
+        uint32_t i, tapCnt, blkCnt;               /* Loop counters */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        q31_t x0, x1, x2, c0;                     /* Packed state and coefficient pairs */
+#endif
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* Write 4 new input samples into both halves of the state buffer */
+    for (i = 0U; i < 4U; i++)
+    {
+      pState[stateIndex] = *pSrc;
+      pState[stateIndex + ringLen] = *pSrc++;
+
+      stateIndex++;
+      if (stateIndex == ringLen)
+      {
+        stateIndex = 0U;
+      }
+    }
+
+    /* The next write position is also the oldest sample of the window: the last numTaps + 3 samples */
+    px = &pState[stateIndex];
+    pb = pCoeffs;
+
+    /* Set the accumulators to zero */
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Read the first 4 samples of the window as two pairs */
+    x0 = read_q15x2_ia ((q15_t **) &px);
+    x2 = read_q15x2_ia ((q15_t **) &px);
+
+    /* Loop over the taps 4 at a time with dual 16-bit multiply-accumulates.
+       The window is not word aligned in general, pairs are read unaligned. */
+    tapCnt = numTaps >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      /* Read the first two coefficients using SIMD:  b[N] and b[N-1] coefficients */
+      c0 = read_q15x2_ia ((q15_t **) &pb);
+
+      /* acc0 +=  b[N] * x[n-N] + b[N-1] * x[n-N-1] */
+      acc0 = __SMLALD(x0, c0, acc0);
+
+      /* acc2 +=  b[N] * x[n-N-2] + b[N-1] * x[n-N-3] */
+      acc2 = __SMLALD(x2, c0, acc2);
+
+      /* pack  x[n-N-1] and x[n-N-2] */
+#ifndef ARM_MATH_BIG_ENDIAN
+      x1 = __PKHBT(x2, x0, 0);
+#else
+      x1 = __PKHBT(x0, x2, 0);
+#endif
+
+      /* Read state x[n-N-4], x[n-N-5] */
+      x0 = read_q15x2_ia ((q15_t **) &px);
+
+      /* acc1 +=  b[N] * x[n-N-1] + b[N-1] * x[n-N-2] */
+      acc1 = __SMLALDX(x1, c0, acc1);
+
+      /* pack  x[n-N-3] and x[n-N-4] */
+#ifndef ARM_MATH_BIG_ENDIAN
+      x1 = __PKHBT(x0, x2, 0);
+#else
+      x1 = __PKHBT(x2, x0, 0);
+#endif
+
+      /* acc3 +=  b[N] * x[n-N-3] + b[N-1] * x[n-N-4] */
+      acc3 = __SMLALDX(x1, c0, acc3);
+
+      /* Read coefficients b[N-2], b[N-3] */
+      c0 = read_q15x2_ia ((q15_t **) &pb);
+
+      /* acc0 +=  b[N-2] * x[n-N-2] + b[N-3] * x[n-N-3] */
+      acc0 = __SMLALD(x2, c0, acc0);
+
+      /* Read state x[n-N-6], x[n-N-7] */
+      x2 = read_q15x2_ia ((q15_t **) &px);
+
+      /* acc2 +=  b[N-2] * x[n-N-4] + b[N-3] * x[n-N-5] */
+      acc2 = __SMLALD(x0, c0, acc2);
+
+      /* acc1 +=  b[N-2] * x[n-N-3] + b[N-3] * x[n-N-4] */
+      acc1 = __SMLALDX(x1, c0, acc1);
+
+      /* pack  x[n-N-5] and x[n-N-6] */
+#ifndef ARM_MATH_BIG_ENDIAN
+      x1 = __PKHBT(x2, x0, 0);
+#else
+      x1 = __PKHBT(x0, x2, 0);
+#endif
+
+      /* acc3 +=  b[N-2] * x[n-N-5] + b[N-3] * x[n-N-6] */
+      acc3 = __SMLALDX(x1, c0, acc3);
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    tapCnt = numTaps & ~0x3U;
+
+#else
+
+    /* Loop over all taps, 4 outputs per coefficient */
+    tapCnt = 0U;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    /* Remaining taps (all of them without loop unrolling), one coefficient at a time.
+       The unrolled loop may read one sample past the window, which is still inside
+       the state buffer since stateIndex < ringLen. */
+    while (tapCnt < numTaps)
+    {
+      c1 = pCoeffs[tapCnt];
+      px1 = &pState[stateIndex + tapCnt];
+
+      acc0 += (q31_t) px1[0] * c1;
+      acc1 += (q31_t) px1[1] * c1;
+      acc2 += (q31_t) px1[2] * c1;
+      acc3 += (q31_t) px1[3] * c1;
+
+      tapCnt++;
+    }
+
+    /* Store the results in the destination buffer */
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((acc1 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((acc2 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((acc3 >> 15), 16));
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Process the remaining samples one at a time */
+  blkCnt = blockSize & 0x3U;
+
+  while (blkCnt > 0U)
+  {
+    pState[stateIndex] = *pSrc;
+    pState[stateIndex + ringLen] = *pSrc++;
+
+    stateIndex++;
+    if (stateIndex == ringLen)
+    {
+      stateIndex = 0U;
+    }
+
+    /* The window of this output starts numTaps samples before the next write position */
+    i = stateIndex + 3U;
+    if (i >= ringLen)
+    {
+      i -= ringLen;
+    }
+
+    px = &pState[i];
+    pb = pCoeffs;
+    acc0 = 0;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      c1 = *pb++;
+      acc0 += (q31_t) *px++ * c1;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Save the ring position for the next call, the history itself is never moved */
+  S->stateIndex = (uint16_t) stateIndex;
+}
+
+/**
+  @} end of FIR_Circ group
+ */
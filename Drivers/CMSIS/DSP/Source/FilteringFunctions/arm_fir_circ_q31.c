@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_q31.c
+ * Description:  Q31 FIR filter processing function with circular state
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Circ
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 FIR filter with circular state.
+  @param[in,out] S          points to an instance of the Q31 circular state FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator.
+                   The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+                   Thus, if the accumulator result overflows it wraps around rather than clip.
+                   In order to avoid overflows completely the input signal must be scaled down by log2(numTaps) bits.
+                   After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.31 format by discarding the low 32 bits to yield the final result.
+ */
+
+void arm_fir_circ_q31(
+        arm_fir_circ_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        q31_t *pState = S->pState;                /* State pointer */
+  const q31_t *pCoeffs = S->pCoeffs;              /* Coefficient pointer */
+  const q31_t *px;                                /* Temporary pointer for state buffer */
+  const q31_t *pb;                                /* Temporary pointer for coefficient buffer */
+        q63_t acc0, acc1, acc2, acc3;             /* Accumulators */
+        q31_t x0, x1, x2, x3, c0;                 /* Temporary variables to hold state and coefficient values */
+        uint32_t numTaps = S->numTaps;            /* Number of filter coefficients in the filter */
+        uint32_t ringLen = numTaps + 3U;          /* Length of one half of the state buffer */
+        uint32_t stateIndex = S->stateIndex;      /* Ring position of the next input sample */
+        uint32_t i, tapCnt, blkCnt;               /* Loop counters */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* Write 4 new input samples into both halves of the state buffer */
+    for (i = 0U; i < 4U; i++)
+    {
+      x0 = *pSrc++;
+      pState[stateIndex] = x0;
+      pState[stateIndex + ringLen] = x0;
+
+      stateIndex++;
+      if (stateIndex == ringLen)
+      {
+        stateIndex = 0U;
+      }
+    }
+
+    /* The next write position is also the oldest sample of the window: the last numTaps + 3 samples */
+    px = &pState[stateIndex];
+    pb = pCoeffs;
+
+    /* Set the accumulators to zero */
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+    /* Read the first 3 samples of the window */
+    x0 = *px++;
+    x1 = *px++;
+    x2 = *px++;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      /* Read the coefficient and the next sample */
+      c0 = *pb++;
+      x3 = *px++;
+
+      /* Perform the multiply-accumulates */
+      acc0 += (q63_t) x0 * c0;
+      acc1 += (q63_t) x1 * c0;
+      acc2 += (q63_t) x2 * c0;
+      acc3 += (q63_t) x3 * c0;
+
+      /* Shift the window by one sample */
+      x0 = x1;
+      x1 = x2;
+      x2 = x3;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Store the results in the destination buffer */
+    *pDst++ = (q31_t) (acc0 >> 31U);
+    *pDst++ = (q31_t) (acc1 >> 31U);
+    *pDst++ = (q31_t) (acc2 >> 31U);
+    *pDst++ = (q31_t) (acc3 >> 31U);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Process the remaining samples one at a time */
+  blkCnt = blockSize & 0x3U;
+
+  while (blkCnt > 0U)
+  {
+    x0 = *pSrc++;
+    pState[stateIndex] = x0;
+    pState[stateIndex + ringLen] = x0;
+
+    stateIndex++;
+    if (stateIndex == ringLen)
+    {
+      stateIndex = 0U;
+    }
+
+    /* The window of this output starts numTaps samples before the next write position */
+    i = stateIndex + 3U;
+    if (i >= ringLen)
+    {
+      i -= ringLen;
+    }
+
+    px = &pState[i];
+    pb = pCoeffs;
+    acc0 = 0;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      c0 = *pb++;
+      x0 = *px++;
+      acc0 += (q63_t) x0 * c0;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    *pDst++ = (q31_t) (acc0 >> 31U);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Save the ring position for the next call, the history itself is never moved */
+  S->stateIndex = (uint16_t) stateIndex;
+}
+
+/**
+  @} end of FIR_Circ group
+ */
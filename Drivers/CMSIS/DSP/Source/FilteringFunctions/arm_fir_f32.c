@@ -337,6 +337,132 @@ uint32_t blockSize)
    }
 
 }
+#elif defined(ARM_MATH_AVX2)
+
+void arm_fir_f32(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        float32_t acc0;                                /* Accumulator */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t i, blkCnt;                            /* Loop counters */
+        __m256 c0V;                                    /* Broadcast coefficient */
+        __m256 acc0V, acc1V, acc2V, acc3V;             /* Accumulators, 8 outputs each */
+
+  /* The vector loops read up to 32 samples ahead of the current output,
+     so the whole block is copied behind the previous (numTaps - 1) samples first */
+  memcpy(&(S->pState[(numTaps - 1U)]), pSrc, blockSize * sizeof(float32_t));
+
+  /* Compute 32 outputs at a time.
+   * Each coefficient is broadcast and multiplied with 32 consecutive state samples:
+   *
+   *    acc[k] += b[numTaps-1-i] * x[n+k+i],   0 <= k < 32
+   *
+   * Four independent accumulators hide the FMA latency. */
+  blkCnt = blockSize >> 5U;
+
+  while (blkCnt > 0U)
+  {
+    acc0V = _mm256_setzero_ps();
+    acc1V = _mm256_setzero_ps();
+    acc2V = _mm256_setzero_ps();
+    acc3V = _mm256_setzero_ps();
+
+    px = pState;
+    pb = pCoeffs;
+    i = numTaps;
+
+    do
+    {
+      c0V = _mm256_broadcast_ss(pb++);
+      acc0V = _mm256_fmadd_ps(c0V, _mm256_loadu_ps(px), acc0V);
+      acc1V = _mm256_fmadd_ps(c0V, _mm256_loadu_ps(px + 8), acc1V);
+      acc2V = _mm256_fmadd_ps(c0V, _mm256_loadu_ps(px + 16), acc2V);
+      acc3V = _mm256_fmadd_ps(c0V, _mm256_loadu_ps(px + 24), acc3V);
+      px++;
+
+      i--;
+    } while (i > 0U);
+
+    _mm256_storeu_ps(pDst, acc0V);
+    _mm256_storeu_ps(pDst + 8, acc1V);
+    _mm256_storeu_ps(pDst + 16, acc2V);
+    _mm256_storeu_ps(pDst + 24, acc3V);
+    pDst += 32;
+
+    /* Advance state pointer by 32 for the next outputs */
+    pState = pState + 32U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Compute 8 outputs at a time */
+  blkCnt = (blockSize & 0x1FU) >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    acc0V = _mm256_setzero_ps();
+
+    px = pState;
+    pb = pCoeffs;
+    i = numTaps;
+
+    do
+    {
+      acc0V = _mm256_fmadd_ps(_mm256_broadcast_ss(pb++), _mm256_loadu_ps(px++), acc0V);
+
+      i--;
+    } while (i > 0U);
+
+    _mm256_storeu_ps(pDst, acc0V);
+    pDst += 8;
+
+    /* Advance state pointer by 8 for the next outputs */
+    pState = pState + 8U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Compute remaining outputs */
+  blkCnt = blockSize & 0x7U;
+
+  while (blkCnt > 0U)
+  {
+    acc0 = 0.0f;
+
+    px = pState;
+    pb = pCoeffs;
+    i = numTaps;
+
+    do
+    {
+      acc0 += *px++ * *pb++;
+
+      i--;
+    } while (i > 0U);
+
+    *pDst++ = acc0;
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, (numTaps - 1U) * sizeof(float32_t));
+}
 #else
 void arm_fir_f32(
   const arm_fir_instance_f32 * S,
@@ -0,0 +1,209 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point rational L/M polyphase resampler
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler
+
+  These functions change the sample rate by a rational factor <code>L/M</code>, for example
+  <code>160/441</code> from 44.1 kHz to 16 kHz or <code>32/25</code> from 100 Hz to 128 Hz.
+  Conceptually they are an upsampler by <code>L</code>, a lowpass FIR filter running at
+  <code>L</code> times the input rate and a downsampler by <code>M</code>.
+  Chaining \ref FIR_Interpolate and \ref FIR_decimate computes every sample of the
+  intermediate rate and then drops <code>M-1</code> out of <code>M</code>; these functions
+  only compute the output samples that are kept.
+
+  @par           Algorithm
+                   Output <code>k</code> sits at position <code>t = k*M</code> of the upsampled grid,
+                   that is after input sample <code>n = t / L</code> with phase <code>p = t % L</code>.
+                   Only one polyphase component of the filter is applied to it:
+  <pre>
+      y[k] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+L*(phaseLength-1)] * x[n-phaseLength+1]
+  </pre>
+  @par
+                   Each output costs <code>phaseLength = numTaps/L</code> multiply-accumulates,
+                   independent of <code>L</code> and <code>M</code>; the cascade costs
+                   <code>M * phaseLength</code> per output.
+                   The filter is designed for the upsampled rate, with a cutoff of
+                   <code>min(1/L, 1/M)</code> of its Nyquist frequency and a passband gain of <code>L</code>.
+  @par
+                   <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>
+                   stored in time reversed order, the same layout as for the FIR interpolator.
+                   <code>numTaps</code> must be a multiple of <code>L</code>.
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>,
+                   where <code>blockSize</code> is the largest number of input samples passed to one call.
+  @par
+                   The functions accept blocks of any length up to <code>blockSize</code> and keep the
+                   position of the next output between calls, so a stream can be fed in blocks of
+                   varying size. The number of outputs of a call varies accordingly and is returned;
+                   <code>pDst</code> must hold <code>(blockSize * L + M - 1) / M</code> values.
+                   The first output is aligned with the first input sample after initialization.
+
+  @par           Instance Structure
+                   The coefficients and state variables for a filter are stored together in an instance data structure.
+                   A separate instance structure must be defined for each filter.
+                   Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+
+  @par           Initialization Functions
+                   There is also an associated initialization function for each data type.
+                   The initialization function performs the following operations:
+                   - Sets the values of the internal structure fields.
+                   - Zeros out the values in the state buffer.
+                   - Checks to make sure that the length of the filter is a multiple of the interpolation factor.
+
+  @par           Fixed-Point Behavior
+                   The fixed-point versions use the same 64-bit accumulators and output scaling as
+                   arm_fir_interpolate_q31() and arm_fir_interpolate_q15().
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point L/M resampler.
+  @param[in,out] S          points to an instance of the floating-point resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process, at most the block size given at initialization
+  @return        number of output samples written to <code>pDst</code>
+ */
+
+uint32_t arm_fir_resample_f32(
+        arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;            /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;          /* Coefficient pointer */
+        float32_t *pStateCur;                     /* Points to the current sample of the state */
+  const float32_t *px;                            /* Temporary pointer for state buffer */
+  const float32_t *pb;                            /* Temporary pointer for coefficient buffer */
+        float32_t acc0;                           /* Accumulator */
+        uint32_t L = S->L;                        /* Interpolation factor */
+        uint32_t phaseLen = S->phaseLength;       /* Length of each polyphase filter component */
+        uint32_t stepN = S->M / L;                /* Whole input samples advanced per output */
+        uint32_t stepP = S->M % L;                /* Phase advance per output */
+        uint32_t n = S->inputOffset;              /* Input sample of the next output */
+        uint32_t p = S->phase;                    /* Phase of the next output */
+        uint32_t outCnt = 0U;                     /* Number of outputs written */
+        uint32_t tapCnt;                          /* Loop counter */
+
+  /* S->pState holds the previous phaseLength - 1 input samples, the new block is appended behind them */
+  pStateCur = pState + (phaseLen - 1U);
+  memcpy(pStateCur, pSrc, blockSize * sizeof(float32_t));
+
+  /* Compute the outputs that fall on an input sample of this block */
+  while (n < blockSize)
+  {
+    /* Window of phaseLength samples ending at x[n], oldest first */
+    px = pState + n;
+
+    /* Polyphase component p, read in time reversed order with a stride of L */
+    pb = pCoeffs + (L - 1U - p);
+
+    /* Set accumulator to zero */
+    acc0 = 0.0f;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 4 taps at a time */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      acc0 += *px++ * *pb;
+      pb += L;
+      acc0 += *px++ * *pb;
+      pb += L;
+      acc0 += *px++ * *pb;
+      pb += L;
+      acc0 += *px++ * *pb;
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining taps */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    /* Initialize tapCnt with number of taps */
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (tapCnt > 0U)
+    {
+      acc0 += *px++ * *pb;
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Store result in destination buffer */
+    *pDst++ = acc0;
+    outCnt++;
+
+    /* Advance by M positions of the upsampled grid */
+    n += stepN;
+    p += stepP;
+    if (p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Position of the next output relative to the start of the next block */
+  S->inputOffset = n - blockSize;
+  S->phase = (uint16_t) p;
+
+  /* Keep the last phaseLength - 1 samples for the next call */
+  memmove(pState, pState + blockSize, (phaseLen - 1U) * sizeof(float32_t));
+
+  return (outCnt);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
@@ -0,0 +1,159 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q15.c
+ * Description:  Q15 rational L/M polyphase resampler
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 L/M resampler.
+  @param[in,out] S          points to an instance of the Q15 resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process, at most the block size given at initialization
+  @return        number of output samples written to <code>pDst</code>
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   There is no risk of overflow with this approach and the full precision of intermediate multiplications is preserved.
+                   After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+                   Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+
+uint32_t arm_fir_resample_q15(
+        arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;              /* Coefficient pointer */
+        q15_t *pStateCur;                         /* Points to the current sample of the state */
+  const q15_t *px;                                /* Temporary pointer for state buffer */
+  const q15_t *pb;                                /* Temporary pointer for coefficient buffer */
+        q63_t acc0;                               /* Accumulator */
+        uint32_t L = S->L;                        /* Interpolation factor */
+        uint32_t phaseLen = S->phaseLength;       /* Length of each polyphase filter component */
+        uint32_t stepN = S->M / L;                /* Whole input samples advanced per output */
+        uint32_t stepP = S->M % L;                /* Phase advance per output */
+        uint32_t n = S->inputOffset;              /* Input sample of the next output */
+        uint32_t p = S->phase;                    /* Phase of the next output */
+        uint32_t outCnt = 0U;                     /* Number of outputs written */
+        uint32_t tapCnt;                          /* Loop counter */
+
+  /* S->pState holds the previous phaseLength - 1 input samples, the new block is appended behind them */
+  pStateCur = pState + (phaseLen - 1U);
+  memcpy(pStateCur, pSrc, blockSize * sizeof(q15_t));
+
+  /* Compute the outputs that fall on an input sample of this block */
+  while (n < blockSize)
+  {
+    /* Window of phaseLength samples ending at x[n], oldest first */
+    px = pState + n;
+
+    /* Polyphase component p, read in time reversed order with a stride of L */
+    pb = pCoeffs + (L - 1U - p);
+
+    /* Set accumulator to zero */
+    acc0 = 0;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 4 taps at a time */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      acc0 += (q31_t) *px++ * *pb;
+      pb += L;
+      acc0 += (q31_t) *px++ * *pb;
+      pb += L;
+      acc0 += (q31_t) *px++ * *pb;
+      pb += L;
+      acc0 += (q31_t) *px++ * *pb;
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining taps */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    /* Initialize tapCnt with number of taps */
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (tapCnt > 0U)
+    {
+      acc0 += (q31_t) *px++ * *pb;
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Store result in destination buffer */
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+    outCnt++;
+
+    /* Advance by M positions of the upsampled grid */
+    n += stepN;
+    p += stepP;
+    if (p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Position of the next output relative to the start of the next block */
+  S->inputOffset = n - blockSize;
+  S->phase = (uint16_t) p;
+
+  /* Keep the last phaseLength - 1 samples for the next call */
+  memmove(pState, pState + blockSize, (phaseLen - 1U) * sizeof(q15_t));
+
+  return (outCnt);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
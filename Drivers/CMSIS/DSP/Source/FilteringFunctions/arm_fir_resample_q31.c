@@ -0,0 +1,159 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q31.c
+ * Description:  Q31 rational L/M polyphase resampler
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 L/M resampler.
+  @param[in,out] S          points to an instance of the Q31 resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process, at most the block size given at initialization
+  @return        number of output samples written to <code>pDst</code>
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator.
+                   The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+                   Thus, if the accumulator result overflows it wraps around rather than clip.
+                   In order to avoid overflows completely the input signal must be scaled down by <code>1/(numTaps/L)</code>
+                   since <code>numTaps/L</code> additions occur per output sample.
+                   After all multiply-accumulates are performed, the 2.62 accumulator is right shifted by 31 bits and truncated to 1.31 format.
+ */
+
+uint32_t arm_fir_resample_q31(
+        arm_fir_resample_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        q31_t *pState = S->pState;                /* State pointer */
+  const q31_t *pCoeffs = S->pCoeffs;              /* Coefficient pointer */
+        q31_t *pStateCur;                         /* Points to the current sample of the state */
+  const q31_t *px;                                /* Temporary pointer for state buffer */
+  const q31_t *pb;                                /* Temporary pointer for coefficient buffer */
+        q63_t acc0;                               /* Accumulator */
+        uint32_t L = S->L;                        /* Interpolation factor */
+        uint32_t phaseLen = S->phaseLength;       /* Length of each polyphase filter component */
+        uint32_t stepN = S->M / L;                /* Whole input samples advanced per output */
+        uint32_t stepP = S->M % L;                /* Phase advance per output */
+        uint32_t n = S->inputOffset;              /* Input sample of the next output */
+        uint32_t p = S->phase;                    /* Phase of the next output */
+        uint32_t outCnt = 0U;                     /* Number of outputs written */
+        uint32_t tapCnt;                          /* Loop counter */
+
+  /* S->pState holds the previous phaseLength - 1 input samples, the new block is appended behind them */
+  pStateCur = pState + (phaseLen - 1U);
+  memcpy(pStateCur, pSrc, blockSize * sizeof(q31_t));
+
+  /* Compute the outputs that fall on an input sample of this block */
+  while (n < blockSize)
+  {
+    /* Window of phaseLength samples ending at x[n], oldest first */
+    px = pState + n;
+
+    /* Polyphase component p, read in time reversed order with a stride of L */
+    pb = pCoeffs + (L - 1U - p);
+
+    /* Set accumulator to zero */
+    acc0 = 0;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 4 taps at a time */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      acc0 += (q63_t) *px++ * *pb;
+      pb += L;
+      acc0 += (q63_t) *px++ * *pb;
+      pb += L;
+      acc0 += (q63_t) *px++ * *pb;
+      pb += L;
+      acc0 += (q63_t) *px++ * *pb;
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining taps */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    /* Initialize tapCnt with number of taps */
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (tapCnt > 0U)
+    {
+      acc0 += (q63_t) *px++ * *pb;
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Store result in destination buffer */
+    *pDst++ = (q31_t) (acc0 >> 31);
+    outCnt++;
+
+    /* Advance by M positions of the upsampled grid */
+    n += stepN;
+    p += stepP;
+    if (p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Position of the next output relative to the start of the next block */
+  S->inputOffset = n - blockSize;
+  S->phase = (uint16_t) p;
+
+  /* Keep the last phaseLength - 1 samples for the next call */
+  memmove(pState, pState + blockSize, (phaseLen - 1U) * sizeof(q31_t));
+
+  return (outCnt);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
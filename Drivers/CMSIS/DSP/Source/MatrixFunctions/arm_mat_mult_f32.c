@@ -394,6 +394,112 @@ arm_status arm_mat_mult_f32(
   /* Return to application */
   return (status);
 }
+#elif defined(ARM_MATH_AVX2)
+arm_status arm_mat_mult_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInA = pSrcA->pData;                /* Input data matrix pointer A */
+  float32_t *pInB = pSrcB->pData;                /* Input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* Output data matrix pointer */
+  float32_t *pIn1, *pIn2;                        /* Temporary input data matrix pointers */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t numRowsA = pSrcA->numRows;            /* Number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* Number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* Number of columns of input matrix A */
+  uint32_t row, col, k;                          /* Loop counters */
+  arm_status status;                             /* Status of matrix multiplication */
+  __m256 aV, acc0, acc1, acc2, acc3;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* Each output row is accumulated as a(i,k) * row k of pSrcB, so pSrcB is read row wise */
+    for (row = 0; row < numRowsA; row++)
+    {
+      col = 0;
+
+      /* Compute 32 outputs of the row at a time */
+      for (; col + 32U <= numColsB; col += 32U)
+      {
+        acc0 = _mm256_setzero_ps();
+        acc1 = _mm256_setzero_ps();
+        acc2 = _mm256_setzero_ps();
+        acc3 = _mm256_setzero_ps();
+        pIn2 = pInB + col;
+
+        for (k = 0; k < numColsA; k++)
+        {
+          aV = _mm256_broadcast_ss(&pInA[k]);
+          acc0 = _mm256_fmadd_ps(aV, _mm256_loadu_ps(pIn2), acc0);
+          acc1 = _mm256_fmadd_ps(aV, _mm256_loadu_ps(pIn2 + 8), acc1);
+          acc2 = _mm256_fmadd_ps(aV, _mm256_loadu_ps(pIn2 + 16), acc2);
+          acc3 = _mm256_fmadd_ps(aV, _mm256_loadu_ps(pIn2 + 24), acc3);
+          pIn2 += numColsB;
+        }
+
+        _mm256_storeu_ps(pOut + col, acc0);
+        _mm256_storeu_ps(pOut + col + 8, acc1);
+        _mm256_storeu_ps(pOut + col + 16, acc2);
+        _mm256_storeu_ps(pOut + col + 24, acc3);
+      }
+
+      /* Compute 8 outputs of the row at a time */
+      for (; col + 8U <= numColsB; col += 8U)
+      {
+        acc0 = _mm256_setzero_ps();
+        pIn2 = pInB + col;
+
+        for (k = 0; k < numColsA; k++)
+        {
+          acc0 = _mm256_fmadd_ps(_mm256_broadcast_ss(&pInA[k]), _mm256_loadu_ps(pIn2), acc0);
+          pIn2 += numColsB;
+        }
+
+        _mm256_storeu_ps(pOut + col, acc0);
+      }
+
+      /* Remaining columns: c(m,n) = a(m,1) * b(1,n) + a(m,2) * b(2,n) + .... + a(m,p) * b(p,n) */
+      for (; col < numColsB; col++)
+      {
+        sum = 0.0f;
+        pIn1 = pInA;
+        pIn2 = pInB + col;
+
+        for (k = 0; k < numColsA; k++)
+        {
+          sum += *pIn1++ * *pIn2;
+          pIn2 += numColsB;
+        }
+
+        pOut[col] = sum;
+      }
+
+      /* Update pointers to the next row of pSrcA and of the destination */
+      pInA += numColsA;
+      pOut += numColsB;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
 #else
 arm_status arm_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcA,
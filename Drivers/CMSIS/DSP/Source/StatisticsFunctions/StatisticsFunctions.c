@@ -34,10 +34,19 @@
 #include "arm_mean_q15.c"
 #include "arm_mean_q31.c"
 #include "arm_mean_q7.c"
+#include "arm_median_filter_f32.c"
+#include "arm_median_filter_q15.c"
+#include "arm_median_filter_q31.c"
+#include "arm_median_filter_init_f32.c"
+#include "arm_median_filter_init_q15.c"
+#include "arm_median_filter_init_q31.c"
 #include "arm_min_f32.c"
 #include "arm_min_q15.c"
 #include "arm_min_q31.c"
 #include "arm_min_q7.c"
+#include "arm_percentile_f32.c"
+#include "arm_percentile_q15.c"
+#include "arm_percentile_q31.c"
 #include "arm_power_f32.c"
 #include "arm_power_q15.c"
 #include "arm_power_q31.c"
@@ -45,6 +54,18 @@
 #include "arm_rms_f32.c"
 #include "arm_rms_q15.c"
 #include "arm_rms_q31.c"
+#include "arm_sliding_stats_f32.c"
+#include "arm_sliding_stats_q15.c"
+#include "arm_sliding_stats_q31.c"
+#include "arm_sliding_stats_get_f32.c"
+#include "arm_sliding_stats_get_q15.c"
+#include "arm_sliding_stats_get_q31.c"
+#include "arm_sliding_stats_init_f32.c"
+#include "arm_sliding_stats_init_q15.c"
+#include "arm_sliding_stats_init_q31.c"
+#include "arm_sort_f32.c"
+#include "arm_sort_q15.c"
+#include "arm_sort_q31.c"
 #include "arm_std_f32.c"
 #include "arm_std_q15.c"
 #include "arm_std_q31.c"
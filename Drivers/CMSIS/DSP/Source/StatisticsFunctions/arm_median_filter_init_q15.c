@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_filter_init_q15.c
+ * Description:  Q15 running median filter initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup MedianFilter
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 running median filter.
+  @param[in,out] S           points to an instance of the Q15 running median filter structure
+  @param[in]     windowSize  number of samples in the window, at least 1
+  @param[in]     pHistory    points to the sample ring
+  @param[in]     pIndex      points to the index buffer
+  @return        none
+
+  @par           Details
+                   <code>pHistory</code> is of length <code>windowSize</code> and
+                   <code>pIndex</code> of length <code>2 * windowSize</code>.
+                   The first half of <code>pIndex</code> holds the heaps, the second half the
+                   heap index of each ring position.
+ */
+
+void arm_median_filter_init_q15(
+        arm_median_filter_instance_q15 * S,
+        uint16_t windowSize,
+        q15_t * pHistory,
+        uint16_t * pIndex)
+{
+  uint32_t k;                                      /* Ring position */
+
+  S->windowSize = windowSize;
+  S->numSamples = 0U;
+  S->head = 0U;
+  S->pHistory = pHistory;
+
+  /* The max-heap takes windowSize / 2 slots below the median */
+  S->pHeap = &pIndex[windowSize / 2U];
+  S->pPos = (int16_t *) &pIndex[windowSize];
+
+  /* Ring positions fill the heaps alternately around the median: 0, -1, 1, -2, 2, ... */
+  for (k = 0U; k < windowSize; k++)
+  {
+    S->pPos[k] = (int16_t) (((k + 1U) / 2U) * (((k & 1U) != 0U) ? -1 : 1));
+    S->pHeap[S->pPos[k]] = (uint16_t) k;
+  }
+}
+
+/**
+  @} end of MedianFilter group
+ */
@@ -0,0 +1,226 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_filter_q31.c
+ * Description:  Q31 running median filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup MedianFilter
+  @{
+ */
+
+/* Returns 1 if the sample at heap index i is smaller than the sample at heap index j */
+#define ARM_MEDIAN_LESS(i, j)  (pHist[pHeap[(i)]] < pHist[pHeap[(j)]])
+
+/* Exchanges heap indices i and j if the sample at i is smaller, returns 1 if exchanged */
+static uint32_t arm_median_exchange_q31(
+  const q31_t * pHist,
+        uint16_t * pHeap,
+        int16_t * pPos,
+        int32_t i,
+        int32_t j)
+{
+  uint16_t tmp;
+
+  if (!ARM_MEDIAN_LESS(i, j))
+  {
+    return 0U;
+  }
+
+  tmp = pHeap[i];
+  pHeap[i] = pHeap[j];
+  pHeap[j] = tmp;
+  pPos[pHeap[i]] = (int16_t) i;
+  pPos[pHeap[j]] = (int16_t) j;
+
+  return 1U;
+}
+
+/* Moves the parent of min-heap index i down while a child at i or its sibling is smaller */
+static void arm_median_min_down_q31(
+  const q31_t * pHist,
+        uint16_t * pHeap,
+        int16_t * pPos,
+        int32_t i,
+        int32_t minCount)
+{
+  for (; i <= minCount; i *= 2)
+  {
+    /* Pick the smaller child; index 1 is the only child of the median */
+    if ((i > 1) && (i < minCount) && ARM_MEDIAN_LESS(i + 1, i))
+    {
+      i++;
+    }
+    if (!arm_median_exchange_q31(pHist, pHeap, pPos, i, i / 2))
+    {
+      break;
+    }
+  }
+}
+
+/* Moves the parent of max-heap index i down while a child at i or its sibling is larger */
+static void arm_median_max_down_q31(
+  const q31_t * pHist,
+        uint16_t * pHeap,
+        int16_t * pPos,
+        int32_t i,
+        int32_t maxCount)
+{
+  for (; i >= -maxCount; i *= 2)
+  {
+    /* Pick the larger child; index -1 is the only child of the median */
+    if ((i < -1) && (i > -maxCount) && ARM_MEDIAN_LESS(i, i - 1))
+    {
+      i--;
+    }
+    if (!arm_median_exchange_q31(pHist, pHeap, pPos, i / 2, i))
+    {
+      break;
+    }
+  }
+}
+
+/**
+  @brief         Processing function for the Q31 running median filter.
+  @param[in,out] S          points to an instance of the Q31 running median filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   For an even number of samples the mean of the two middle samples is computed
+                   with a wider intermediate and rounded towards minus infinity; there is no overflow.
+ */
+void arm_median_filter_q31(
+        arm_median_filter_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        q31_t *pHist = S->pHistory;                    /* Sample ring */
+        uint16_t *pHeap = S->pHeap;                    /* Heap of ring positions, median at index 0 */
+        int16_t *pPos = S->pPos;                       /* Heap index of each ring position */
+        uint32_t windowSize = S->windowSize;           /* Window length */
+        uint32_t numSamples = S->numSamples;           /* Samples in the window */
+        uint32_t head = S->head;                       /* Ring position of the next sample */
+        int32_t minCount, maxCount;                    /* Heap sizes */
+        int32_t i;                                     /* Heap index */
+        q31_t in, out;                                 /* Incoming and outgoing samples */
+        uint32_t isFull;                               /* Window was full before the sample */
+        uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    isFull = (numSamples == windowSize);
+    out = pHist[head];
+    pHist[head] = in;
+    i = pPos[head];
+    head = (head + 1U == windowSize) ? 0U : head + 1U;
+    numSamples += (isFull ? 0U : 1U);
+
+    /* Number of samples in the min-heap (indices 1..minCount) and the max-heap (-maxCount..-1) */
+    minCount = ((int32_t) numSamples - 1) / 2;
+    maxCount = (int32_t) numSamples / 2;
+
+    if (i > 0)
+    {
+      /* Slot in the min-heap */
+      if (isFull && (out < in))
+      {
+        /* Larger than before: sift down */
+        arm_median_min_down_q31(pHist, pHeap, pPos, i * 2, minCount);
+      }
+      else
+      {
+        /* Smaller or new: sift up, and into the max-heap if it reaches the median */
+        while ((i > 0) && arm_median_exchange_q31(pHist, pHeap, pPos, i, i / 2))
+        {
+          i /= 2;
+        }
+        if (i == 0)
+        {
+          arm_median_max_down_q31(pHist, pHeap, pPos, -1, maxCount);
+        }
+      }
+    }
+    else if (i < 0)
+    {
+      /* Slot in the max-heap */
+      if (isFull && (in < out))
+      {
+        /* Smaller than before: sift down */
+        arm_median_max_down_q31(pHist, pHeap, pPos, i * 2, maxCount);
+      }
+      else
+      {
+        /* Larger or new: sift up, and into the min-heap if it reaches the median */
+        while ((i < 0) && arm_median_exchange_q31(pHist, pHeap, pPos, i / 2, i))
+        {
+          i /= 2;
+        }
+        if (i == 0)
+        {
+          arm_median_min_down_q31(pHist, pHeap, pPos, 1, minCount);
+        }
+      }
+    }
+    else
+    {
+      /* Slot at the median: move it into whichever heap it belongs to */
+      arm_median_max_down_q31(pHist, pHeap, pPos, -1, maxCount);
+      arm_median_min_down_q31(pHist, pHeap, pPos, 1, minCount);
+    }
+
+    /* Median, or mean of the two middle samples */
+    if ((numSamples & 1U) != 0U)
+    {
+      *pDst++ = pHist[pHeap[0]];
+    }
+    else
+    {
+      *pDst++ = (q31_t) (((q63_t) pHist[pHeap[0]] + pHist[pHeap[-1]]) >> 1);
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  S->numSamples = (uint16_t) numSamples;
+  S->head = (uint16_t) head;
+}
+
+/**
+  @} end of MedianFilter group
+ */
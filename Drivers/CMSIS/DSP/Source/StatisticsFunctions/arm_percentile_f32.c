@@ -0,0 +1,198 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_percentile_f32.c
+ * Description:  Floating-point percentile
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup Percentile Percentile
+
+  Computes a percentile of the elements of a vector, such as the median (50th percentile)
+  or the bounds used to reject outliers of noisy measurements.
+  The percentile <code>p</code> is interpolated linearly between the two samples closest
+  to rank <code>r = p / 100 * (blockSize - 1)</code> of the sorted vector:
+  <pre>
+      Result = s[k] + (r - k) * (s[k + 1] - s[k]),  k = floor(r)
+  </pre>
+  where <code>s</code> is the vector in ascending order. This matches the default
+  definition of most numerical libraries; the 0th and 100th percentiles are the minimum and the maximum.
+
+  @par           Algorithm
+                   The vector is not sorted. Quick-select partitions it around a median-of-three pivot
+                   and continues only in the part that holds rank <code>k</code>, for an expected cost of
+                   O(blockSize); <code>s[k + 1]</code> is then the smallest sample above position <code>k</code>.
+  @par
+                   The input vector is reordered in place. Copy it first with \ref arm_copy_f32 (or the
+                   matching data type) if it must be preserved.
+ */
+
+/**
+  @addtogroup Percentile
+  @{
+ */
+
+/* Reorders p so that p[k] is the k-th smallest sample, with no larger sample before and no smaller sample after it */
+static void arm_select_f32(
+  float32_t * p,
+  int32_t n,
+  int32_t k)
+{
+  int32_t lo = 0, hi = n - 1, mid, i, j;
+  float32_t pivot, tmp;
+
+#define ARM_SELECT_SWAP(a, b) do { tmp = p[(a)]; p[(a)] = p[(b)]; p[(b)] = tmp; } while (0)
+
+  while (hi > lo)
+  {
+    /* Median of three: p[lo] <= p[mid] <= p[hi] bound the partition scans */
+    mid = lo + ((hi - lo) >> 1);
+    if (p[mid] < p[lo])
+    {
+      ARM_SELECT_SWAP(mid, lo);
+    }
+    if (p[hi] < p[lo])
+    {
+      ARM_SELECT_SWAP(hi, lo);
+    }
+    if (p[hi] < p[mid])
+    {
+      ARM_SELECT_SWAP(hi, mid);
+    }
+    pivot = p[mid];
+
+    /* Partition: p[lo..j] <= pivot <= p[i..hi], samples between j and i equal the pivot */
+    i = lo;
+    j = hi;
+    while (i <= j)
+    {
+      while (p[i] < pivot)
+      {
+        i++;
+      }
+      while (pivot < p[j])
+      {
+        j--;
+      }
+      if (i <= j)
+      {
+        ARM_SELECT_SWAP(i, j);
+        i++;
+        j--;
+      }
+    }
+
+    /* Continue in the part that holds rank k */
+    if (k <= j)
+    {
+      hi = j;
+    }
+    else if (k >= i)
+    {
+      lo = i;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+#undef ARM_SELECT_SWAP
+}
+
+/* Smallest sample of p[0..n-1] */
+static float32_t arm_select_min_f32(
+  const float32_t * p,
+  uint32_t n)
+{
+  float32_t out = p[0];
+  uint32_t i;
+
+  for (i = 1U; i < n; i++)
+  {
+    out = (p[i] < out) ? p[i] : out;
+  }
+
+  return out;
+}
+
+/**
+  @brief         Percentile of the elements of a floating-point vector.
+  @param[in,out] pSrc        points to the input vector, reordered on return
+  @param[in]     blockSize   number of samples in the vector
+  @param[in]     percentile  percentile in the range [0, 100], clamped to that range
+  @param[out]    pResult     percentile value returned here
+  @return        none
+
+  @par           Details
+                   NaN values are not supported. The result is 0 for an empty vector.
+ */
+void arm_percentile_f32(
+        float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t percentile,
+        float32_t * pResult)
+{
+        float32_t rank, frac;                          /* Rank and its fractional part */
+        float32_t lo;                                  /* Sample at the integer rank */
+        uint32_t k;                                    /* Integer rank */
+
+  if (blockSize == 0U)
+  {
+    *pResult = 0.0f;
+    return;
+  }
+
+  percentile = (percentile < 0.0f) ? 0.0f : ((percentile > 100.0f) ? 100.0f : percentile);
+  /* Multiply before dividing: for integral percentiles and blockSize up to 2^24 / 100 the
+     product is exact, so a rank that should be an integer (p = 60, blockSize = 36 gives 21)
+     comes out exact instead of 20.999998 through the rounded constant 0.01f */
+  rank = percentile * (float32_t) (blockSize - 1U) / 100.0f;
+  k = (uint32_t) rank;
+  k = (k > blockSize - 1U) ? blockSize - 1U : k;
+  frac = rank - (float32_t) k;
+
+  arm_select_f32(pSrc, (int32_t) blockSize, (int32_t) k);
+  lo = pSrc[k];
+
+  if ((frac > 0.0f) && (k + 1U < blockSize))
+  {
+    *pResult = lo + frac * (arm_select_min_f32(&pSrc[k + 1U], blockSize - k - 1U) - lo);
+  }
+  else
+  {
+    *pResult = lo;
+  }
+}
+
+/**
+  @} end of Percentile group
+ */
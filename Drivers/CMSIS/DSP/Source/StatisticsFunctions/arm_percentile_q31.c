@@ -0,0 +1,178 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_percentile_q31.c
+ * Description:  Q31 percentile
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup Percentile
+  @{
+ */
+
+/* Reorders p so that p[k] is the k-th smallest sample, with no larger sample before and no smaller sample after it */
+static void arm_select_q31(
+  q31_t * p,
+  int32_t n,
+  int32_t k)
+{
+  int32_t lo = 0, hi = n - 1, mid, i, j;
+  q31_t pivot, tmp;
+
+#define ARM_SELECT_SWAP(a, b) do { tmp = p[(a)]; p[(a)] = p[(b)]; p[(b)] = tmp; } while (0)
+
+  while (hi > lo)
+  {
+    /* Median of three: p[lo] <= p[mid] <= p[hi] bound the partition scans */
+    mid = lo + ((hi - lo) >> 1);
+    if (p[mid] < p[lo])
+    {
+      ARM_SELECT_SWAP(mid, lo);
+    }
+    if (p[hi] < p[lo])
+    {
+      ARM_SELECT_SWAP(hi, lo);
+    }
+    if (p[hi] < p[mid])
+    {
+      ARM_SELECT_SWAP(hi, mid);
+    }
+    pivot = p[mid];
+
+    /* Partition: p[lo..j] <= pivot <= p[i..hi], samples between j and i equal the pivot */
+    i = lo;
+    j = hi;
+    while (i <= j)
+    {
+      while (p[i] < pivot)
+      {
+        i++;
+      }
+      while (pivot < p[j])
+      {
+        j--;
+      }
+      if (i <= j)
+      {
+        ARM_SELECT_SWAP(i, j);
+        i++;
+        j--;
+      }
+    }
+
+    /* Continue in the part that holds rank k */
+    if (k <= j)
+    {
+      hi = j;
+    }
+    else if (k >= i)
+    {
+      lo = i;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+#undef ARM_SELECT_SWAP
+}
+
+/* Smallest sample of p[0..n-1] */
+static q31_t arm_select_min_q31(
+  const q31_t * p,
+  uint32_t n)
+{
+  q31_t out = p[0];
+  uint32_t i;
+
+  for (i = 1U; i < n; i++)
+  {
+    out = (p[i] < out) ? p[i] : out;
+  }
+
+  return out;
+}
+
+/**
+  @brief         Percentile of the elements of a Q31 vector.
+  @param[in,out] pSrc       points to the input vector, reordered on return
+  @param[in]     blockSize  number of samples in the vector
+  @param[in]     fraction   percentile divided by 100, in 1.31 format; negative values select the minimum
+  @param[out]    pResult    percentile value returned here
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The rank is computed exactly in 33.31 format. The interpolation, including the addition
+                   of the lower sample, is done in 64 bits and the result lies between the two samples, so
+                   narrowing it back to 1.31 cannot overflow even for samples of opposite full-scale sign.
+                   As 1.0 cannot be represented, the largest fraction
+                   <code>0x7FFFFFFF</code> returns a value just below the maximum when the two largest samples differ.
+                   The result is 0 for an empty vector.
+ */
+void arm_percentile_q31(
+        q31_t * pSrc,
+        uint32_t blockSize,
+        q31_t fraction,
+        q31_t * pResult)
+{
+        q63_t rank;                                    /* Rank in 33.31 format */
+        q31_t lo, hi;                                  /* Samples around the rank */
+        q31_t frac;                                    /* Fractional part of the rank */
+        uint32_t k;                                    /* Integer rank */
+
+  if (blockSize == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  rank = (q63_t) ((fraction < 0) ? 0 : fraction) * (blockSize - 1U);
+  k = (uint32_t) (rank >> 31);
+  frac = (q31_t) (rank & 0x7FFFFFFF);
+
+  arm_select_q31(pSrc, (int32_t) blockSize, (int32_t) k);
+  lo = pSrc[k];
+
+  if ((frac != 0) && (k + 1U < blockSize))
+  {
+    hi = arm_select_min_q31(&pSrc[k + 1U], blockSize - k - 1U);
+    *pResult = (q31_t) ((q63_t) lo + ((((q63_t) hi - lo) * frac) >> 31));
+  }
+  else
+  {
+    *pResult = lo;
+  }
+}
+
+/**
+  @} end of Percentile group
+ */
@@ -0,0 +1,247 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_f32.c
+ * Description:  Floating-point sliding window statistics update function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup SlidingStats Sliding Window Statistics
+
+  Maintains the mean, variance, standard deviation, root mean square, minimum and
+  maximum of the last <code>windowSize</code> input samples.
+  The block functions (\ref mean, \ref variance, \ref RMS, \ref Min, \ref Max) recompute
+  a window from scratch, which costs O(windowSize) for every new sample when a
+  statistic is tracked continuously. The sliding window functions update their
+  state in O(1) per sample, independent of the window length.
+
+  @par           Algorithm
+                   Each input sample is stored in a ring of <code>windowSize</code> samples.
+                   Once the ring is full, the new sample replaces the oldest one and the
+                   running sums are corrected by both of them.
+  @par
+                   The floating-point version uses Welford's method, which avoids the
+                   cancellation of the sum of squares approach. While the window fills:
+  <pre>
+      n    = n + 1
+      d    = x - mean
+      mean = mean + d / n
+      m2   = m2 + d * (x - mean)
+  </pre>
+                   and once the window is full, for the incoming sample <code>x</code> and the outgoing sample <code>y</code>:
+  <pre>
+      mean' = mean + (x - y) / N
+      m2    = m2 + (x - y) * (x - mean' + y - mean)
+  </pre>
+                   The variance is <code>m2 / (n - 1)</code> and the root mean square is
+                   <code>sqrt(mean * mean + m2 / n)</code>.
+                   The sliding update alone would accumulate rounding errors without bound.
+                   A second Welford accumulator therefore collects the samples written since the ring
+                   last wrapped around; each time the ring wraps it holds exactly the window, and
+                   replaces the running mean and <code>m2</code>. Rounding errors thus never
+                   accumulate over more than <code>windowSize</code> samples, at the cost of one
+                   more division per sample.
+  @par
+                   The fixed-point versions keep exact integer sums of the samples and of their squares,
+                   which do not drift. The results are computed from these sums with the same
+                   arithmetic as the block functions and are bit exact to \ref arm_mean_q31,
+                   \ref arm_var_q31, \ref arm_std_q31, \ref arm_rms_q31 (and their Q15 counterparts)
+                   applied to the samples in the window.
+  @par
+                   Minimum and maximum use monotonic queues of ring positions: a new sample removes
+                   all queued samples it dominates from the back of the queue and the oldest sample
+                   leaves the front when it drops out of the window. The front of a queue is always
+                   the extreme value of the window, and each sample enters and leaves a queue once,
+                   so the cost is O(1) per sample amortized.
+  @par
+                   Before the window is full the results cover the samples received so far.
+                   Mean, root mean square, minimum and maximum of an empty window are 0;
+                   as for the block functions, variance and standard deviation are 0 for fewer than 2 samples.
+
+  @par           Instance Structure
+                   The ring, queues and running sums of a window are stored together in an instance data structure.
+                   A separate instance structure must be defined for each window.
+                   The ring and queue arrays cannot be shared among instances.
+
+  @par           Initialization Functions
+                   There is an associated initialization function for each data type.
+                   The initialization function sets the window length and buffers and empties the window;
+                   it can also be called at any time to restart the statistics.
+
+  @par           Fixed-Point Behavior
+                   The window length is limited to 65535 samples, so that the running sums cannot overflow.
+                   The Q31 root mean square shares the limitation of \ref arm_rms_q31: the sum of the squares
+                   of full scale samples wraps around for windows of 4 or more samples.
+ */
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Adds a block of samples to the floating-point sliding window statistics.
+  @param[in,out] S          points to an instance of the floating-point sliding window statistics structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Details
+                   Each sample is processed as if the function were called once per sample;
+                   the results after the call cover the last <code>windowSize</code> samples.
+                   The running mean and <code>m2</code> are resynchronized every <code>windowSize</code> samples,
+                   the accuracy therefore does not degrade with the number of processed samples.
+ */
+
+void arm_sliding_stats_f32(
+        arm_sliding_stats_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+        float32_t *pHist = S->pHistory;                /* Sample ring */
+        uint16_t *pMaxQ = S->pMaxQueue;                /* Maximum queue */
+        uint16_t *pMinQ = S->pMinQueue;                /* Minimum queue */
+        uint32_t windowSize = S->windowSize;           /* Window length */
+        uint32_t numSamples = S->numSamples;           /* Samples in the window */
+        uint32_t head = S->head;                       /* Ring position of the next sample */
+        uint32_t maxFront = S->maxFront, maxCount = S->maxCount;
+        uint32_t minFront = S->minFront, minCount = S->minCount;
+        float32_t mean = S->mean;                      /* Running mean */
+        float32_t m2 = S->m2;                          /* Running sum of squared deviations */
+        float32_t syncMean = S->syncMean;              /* Mean since the ring last wrapped */
+        float32_t syncM2 = S->syncM2;                  /* Squared deviations since the ring last wrapped */
+        float32_t invWindow = 1.0f / (float32_t) windowSize;
+        float32_t in, out, delta, newMean;             /* Temporary variables */
+        uint32_t pos;                                  /* Queue position */
+        uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* Welford update over the samples since the ring last wrapped */
+    delta = in - syncMean;
+    syncMean += delta / (float32_t) (head + 1U);
+    syncM2 += delta * (in - syncMean);
+
+    if (numSamples == windowSize)
+    {
+      /* The oldest sample leaves the window */
+      out = pHist[head];
+
+      /* Remove it from the queues where it is still the front entry */
+      if (pMaxQ[maxFront] == head)
+      {
+        maxFront = (maxFront + 1U == windowSize) ? 0U : maxFront + 1U;
+        maxCount--;
+      }
+      if (pMinQ[minFront] == head)
+      {
+        minFront = (minFront + 1U == windowSize) ? 0U : minFront + 1U;
+        minCount--;
+      }
+
+      /* Replace the outgoing sample by the incoming one */
+      delta = in - out;
+      newMean = mean + delta * invWindow;
+      m2 += delta * ((in - newMean) + (out - mean));
+      mean = newMean;
+    }
+    else
+    {
+      /* While the window fills it holds exactly the samples since the start */
+      numSamples++;
+      mean = syncMean;
+      m2 = syncM2;
+    }
+
+    pHist[head] = in;
+
+    /* Drop queued samples that can no longer be the maximum */
+    while (maxCount > 0U)
+    {
+      pos = maxFront + maxCount - 1U;
+      pos = (pos >= windowSize) ? pos - windowSize : pos;
+      if (pHist[pMaxQ[pos]] > in)
+      {
+        break;
+      }
+      maxCount--;
+    }
+    pos = maxFront + maxCount;
+    pMaxQ[(pos >= windowSize) ? pos - windowSize : pos] = (uint16_t) head;
+    maxCount++;
+
+    /* Drop queued samples that can no longer be the minimum */
+    while (minCount > 0U)
+    {
+      pos = minFront + minCount - 1U;
+      pos = (pos >= windowSize) ? pos - windowSize : pos;
+      if (pHist[pMinQ[pos]] < in)
+      {
+        break;
+      }
+      minCount--;
+    }
+    pos = minFront + minCount;
+    pMinQ[(pos >= windowSize) ? pos - windowSize : pos] = (uint16_t) head;
+    minCount++;
+
+    head++;
+    if (head == windowSize)
+    {
+      /* The ring wrapped: the second accumulator covers the window, restart it */
+      head = 0U;
+      mean = syncMean;
+      m2 = syncM2;
+      syncMean = 0.0f;
+      syncM2 = 0.0f;
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  S->numSamples = (uint16_t) numSamples;
+  S->head = (uint16_t) head;
+  S->maxFront = (uint16_t) maxFront;
+  S->maxCount = (uint16_t) maxCount;
+  S->minFront = (uint16_t) minFront;
+  S->minCount = (uint16_t) minCount;
+  S->mean = mean;
+  S->m2 = m2;
+  S->syncMean = syncMean;
+  S->syncM2 = syncM2;
+}
+
+/**
+  @} end of SlidingStats group
+ */
@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_get_f32.c
+ * Description:  Results of the floating-point sliding window statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Mean of the samples in the floating-point sliding window.
+  @param[in]     S        points to an instance of the floating-point sliding window statistics structure
+  @param[out]    pResult  mean value returned here
+  @return        none
+ */
+void arm_sliding_stats_mean_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  *pResult = S->mean;
+}
+
+/**
+  @brief         Variance of the samples in the floating-point sliding window.
+  @param[in]     S        points to an instance of the floating-point sliding window statistics structure
+  @param[out]    pResult  variance value returned here
+  @return        none
+ */
+void arm_sliding_stats_var_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  if (S->numSamples <= 1U)
+  {
+    *pResult = 0.0f;
+    return;
+  }
+
+  /* Rounding can leave m2 slightly negative for a constant window */
+  *pResult = (S->m2 > 0.0f) ? S->m2 / (float32_t) (S->numSamples - 1U) : 0.0f;
+}
+
+/**
+  @brief         Standard deviation of the samples in the floating-point sliding window.
+  @param[in]     S        points to an instance of the floating-point sliding window statistics structure
+  @param[out]    pResult  standard deviation value returned here
+  @return        none
+ */
+void arm_sliding_stats_std_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  float32_t var;
+
+  arm_sliding_stats_var_f32(S, &var);
+  arm_sqrt_f32(var, pResult);
+}
+
+/**
+  @brief         Root mean square of the samples in the floating-point sliding window.
+  @param[in]     S        points to an instance of the floating-point sliding window statistics structure
+  @param[out]    pResult  root mean square value returned here
+  @return        none
+ */
+void arm_sliding_stats_rms_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  float32_t meanOfSquares;
+
+  if (S->numSamples == 0U)
+  {
+    *pResult = 0.0f;
+    return;
+  }
+
+  /* mean(x^2) = mean^2 + m2 / n */
+  meanOfSquares = S->mean * S->mean;
+  if (S->m2 > 0.0f)
+  {
+    meanOfSquares += S->m2 / (float32_t) S->numSamples;
+  }
+  arm_sqrt_f32(meanOfSquares, pResult);
+}
+
+/**
+  @brief         Minimum value of the samples in the floating-point sliding window.
+  @param[in]     S        points to an instance of the floating-point sliding window statistics structure
+  @param[out]    pResult  minimum value returned here
+  @return        none
+ */
+void arm_sliding_stats_min_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  *pResult = (S->minCount > 0U) ? S->pHistory[S->pMinQueue[S->minFront]] : 0.0f;
+}
+
+/**
+  @brief         Maximum value of the samples in the floating-point sliding window.
+  @param[in]     S        points to an instance of the floating-point sliding window statistics structure
+  @param[out]    pResult  maximum value returned here
+  @return        none
+ */
+void arm_sliding_stats_max_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  *pResult = (S->maxCount > 0U) ? S->pHistory[S->pMaxQueue[S->maxFront]] : 0.0f;
+}
+
+/**
+  @} end of SlidingStats group
+ */
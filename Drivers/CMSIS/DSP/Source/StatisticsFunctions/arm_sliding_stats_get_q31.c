@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_get_q31.c
+ * Description:  Results of the Q31 sliding window statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Mean of the samples in the Q31 sliding window.
+  @param[in]     S        points to an instance of the Q31 sliding window statistics structure
+  @param[out]    pResult  mean value returned here
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The result is identical to \ref arm_mean_q31 applied to the samples in the window.
+ */
+void arm_sliding_stats_mean_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  if (S->numSamples == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  *pResult = (q31_t) (S->sum / S->numSamples);
+}
+
+/**
+  @brief         Variance of the samples in the Q31 sliding window.
+  @param[in]     S        points to an instance of the Q31 sliding window statistics structure
+  @param[out]    pResult  variance value returned here
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The result is identical to \ref arm_var_q31 applied to the samples in the window.
+ */
+void arm_sliding_stats_var_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+        q63_t meanOfSquares, squareOfMean;             /* Square of mean and mean of square */
+        uint32_t numSamples = S->numSamples;           /* Samples in the window */
+
+  if (numSamples <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  /* Compute Mean of squares and then store the result in a temporary variable, meanOfSquares. */
+  meanOfSquares = (S->sumOfSquaresScaled / (q63_t)(numSamples - 1U));
+
+  /* Compute square of mean */
+  squareOfMean = ( S->sumScaled * S->sumScaled / (q63_t)(numSamples * (numSamples - 1U)));
+
+  /* Compute variance and store result in destination */
+  *pResult = (meanOfSquares - squareOfMean) >> 15U;
+}
+
+/**
+  @brief         Standard deviation of the samples in the Q31 sliding window.
+  @param[in]     S        points to an instance of the Q31 sliding window statistics structure
+  @param[out]    pResult  standard deviation value returned here
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The result is identical to \ref arm_std_q31 applied to the samples in the window.
+ */
+void arm_sliding_stats_std_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  q31_t var;
+
+  arm_sliding_stats_var_q31(S, &var);
+  arm_sqrt_q31(var, pResult);
+}
+
+/**
+  @brief         Root mean square of the samples in the Q31 sliding window.
+  @param[in]     S        points to an instance of the Q31 sliding window statistics structure
+  @param[out]    pResult  root mean square value returned here
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The result is identical to \ref arm_rms_q31 applied to the samples in the window,
+                   including its wrap around for long windows of large samples.
+ */
+void arm_sliding_stats_rms_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  if (S->numSamples == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  /* Convert data in 2.62 to 1.31 by 31 right shifts and saturate */
+  arm_sqrt_q31(clip_q63_to_q31((S->sumOfSquares / (q63_t) S->numSamples) >> 31), pResult);
+}
+
+/**
+  @brief         Minimum value of the samples in the Q31 sliding window.
+  @param[in]     S        points to an instance of the Q31 sliding window statistics structure
+  @param[out]    pResult  minimum value returned here
+  @return        none
+ */
+void arm_sliding_stats_min_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  *pResult = (S->minCount > 0U) ? S->pHistory[S->pMinQueue[S->minFront]] : 0;
+}
+
+/**
+  @brief         Maximum value of the samples in the Q31 sliding window.
+  @param[in]     S        points to an instance of the Q31 sliding window statistics structure
+  @param[out]    pResult  maximum value returned here
+  @return        none
+ */
+void arm_sliding_stats_max_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  *pResult = (S->maxCount > 0U) ? S->pHistory[S->pMaxQueue[S->maxFront]] : 0;
+}
+
+/**
+  @} end of SlidingStats group
+ */
@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_init_f32.c
+ * Description:  Floating-point sliding window statistics initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point sliding window statistics.
+  @param[in,out] S           points to an instance of the floating-point sliding window statistics structure
+  @param[in]     windowSize  number of samples in the window, at least 1
+  @param[in]     pHistory    points to the sample ring
+  @param[in]     pMaxQueue   points to the maximum queue
+  @param[in]     pMinQueue   points to the minimum queue
+  @return        none
+
+  @par           Details
+                   <code>pHistory</code>, <code>pMaxQueue</code> and <code>pMinQueue</code> are each of length <code>windowSize</code>.
+                   The window is emptied; the buffers do not need to be cleared.
+ */
+
+void arm_sliding_stats_init_f32(
+        arm_sliding_stats_instance_f32 * S,
+        uint16_t windowSize,
+        float32_t * pHistory,
+        uint16_t * pMaxQueue,
+        uint16_t * pMinQueue)
+{
+  /* Assign window length and buffers */
+  S->windowSize = windowSize;
+  S->pHistory = pHistory;
+  S->pMaxQueue = pMaxQueue;
+  S->pMinQueue = pMinQueue;
+
+  /* Empty the window */
+  S->numSamples = 0U;
+  S->head = 0U;
+  S->maxFront = 0U;
+  S->maxCount = 0U;
+  S->minFront = 0U;
+  S->minCount = 0U;
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+  S->syncMean = 0.0f;
+  S->syncM2 = 0.0f;
+}
+
+/**
+  @} end of SlidingStats group
+ */
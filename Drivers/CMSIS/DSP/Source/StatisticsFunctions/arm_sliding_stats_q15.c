@@ -0,0 +1,158 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_q15.c
+ * Description:  Q15 sliding window statistics update function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Adds a block of samples to the Q15 sliding window statistics.
+  @param[in,out] S          points to an instance of the Q15 sliding window statistics structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Details
+                   Each sample is processed as if the function were called once per sample;
+                   the results after the call cover the last <code>windowSize</code> samples.
+                   The running sums are updated exactly, results do not drift with the number
+                   of processed samples.
+ */
+
+void arm_sliding_stats_q15(
+        arm_sliding_stats_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize)
+{
+        q15_t *pHist = S->pHistory;                    /* Sample ring */
+        uint16_t *pMaxQ = S->pMaxQueue;                /* Maximum queue */
+        uint16_t *pMinQ = S->pMinQueue;                /* Minimum queue */
+        uint32_t windowSize = S->windowSize;           /* Window length */
+        uint32_t numSamples = S->numSamples;           /* Samples in the window */
+        uint32_t head = S->head;                       /* Ring position of the next sample */
+        uint32_t maxFront = S->maxFront, maxCount = S->maxCount;
+        uint32_t minFront = S->minFront, minCount = S->minCount;
+        q31_t sum = S->sum;                            /* Sum of the samples */
+        q63_t sumOfSquares = S->sumOfSquares;          /* Sum of the squares of the samples */
+        q15_t in, out;                                 /* Temporary variables */
+        uint32_t pos;                                  /* Queue position */
+        uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (numSamples == windowSize)
+    {
+      /* The oldest sample leaves the window */
+      out = pHist[head];
+
+      /* Remove it from the queues where it is still the front entry */
+      if (pMaxQ[maxFront] == head)
+      {
+        maxFront = (maxFront + 1U == windowSize) ? 0U : maxFront + 1U;
+        maxCount--;
+      }
+      if (pMinQ[minFront] == head)
+      {
+        minFront = (minFront + 1U == windowSize) ? 0U : minFront + 1U;
+        minCount--;
+      }
+
+      /* Remove the outgoing sample from the sums */
+      sum -= out;
+      sumOfSquares -= ((q31_t) out * out);
+    }
+    else
+    {
+      numSamples++;
+    }
+
+    /* Add the incoming sample to the sums */
+    sum += in;
+    sumOfSquares += ((q31_t) in * in);
+
+    pHist[head] = in;
+
+    /* Drop queued samples that can no longer be the maximum */
+    while (maxCount > 0U)
+    {
+      pos = maxFront + maxCount - 1U;
+      pos = (pos >= windowSize) ? pos - windowSize : pos;
+      if (pHist[pMaxQ[pos]] > in)
+      {
+        break;
+      }
+      maxCount--;
+    }
+    pos = maxFront + maxCount;
+    pMaxQ[(pos >= windowSize) ? pos - windowSize : pos] = (uint16_t) head;
+    maxCount++;
+
+    /* Drop queued samples that can no longer be the minimum */
+    while (minCount > 0U)
+    {
+      pos = minFront + minCount - 1U;
+      pos = (pos >= windowSize) ? pos - windowSize : pos;
+      if (pHist[pMinQ[pos]] < in)
+      {
+        break;
+      }
+      minCount--;
+    }
+    pos = minFront + minCount;
+    pMinQ[(pos >= windowSize) ? pos - windowSize : pos] = (uint16_t) head;
+    minCount++;
+
+    head = (head + 1U == windowSize) ? 0U : head + 1U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  S->numSamples = (uint16_t) numSamples;
+  S->head = (uint16_t) head;
+  S->maxFront = (uint16_t) maxFront;
+  S->maxCount = (uint16_t) maxCount;
+  S->minFront = (uint16_t) minFront;
+  S->minCount = (uint16_t) minCount;
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+}
+
+/**
+  @} end of SlidingStats group
+ */
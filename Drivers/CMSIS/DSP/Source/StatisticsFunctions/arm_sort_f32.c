@@ -0,0 +1,188 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_f32.c
+ * Description:  Floating-point vector sort
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup Sort Sort
+
+  Sorts the elements of a vector in ascending order.
+
+  @par           Algorithm
+                   The floating-point version sorts runs of 8 samples with a bitonic sorting network,
+                   whose 24 compare-exchange steps do not depend on the data and keep the run in registers.
+                   Vectors of less than 8 samples, and the last partial run, use insertion sort.
+                   The sorted runs are then merged pairwise, alternating between the output and the
+                   scratch buffer, for a total cost of O(blockSize * log(blockSize)).
+  @par
+                   The fixed-point versions use a least significant digit radix sort with 8-bit digits:
+                   4 passes for Q31 and 2 passes for Q15, each counting the digits and scattering the samples
+                   between the output and the scratch buffer. The cost is O(blockSize) and independent
+                   of the data; passes where all samples share the same digit are skipped.
+                   Vectors of up to 32 samples use insertion sort, which is faster than the fixed
+                   overhead of the digit histograms.
+  @par
+                   All versions read <code>pSrc</code> before writing <code>pDst</code>,
+                   so that a vector can be sorted in place. <code>pScratch</code> is a buffer of
+                   <code>blockSize</code> samples; it is not accessed when insertion sort is used.
+                   The radix sort keeps a histogram of 256 counters on the stack.
+ */
+
+/**
+  @addtogroup Sort
+  @{
+ */
+
+/* Compare-exchange: a receives the smaller and b the larger value */
+#define ARM_SORT_CE(a, b)                   \
+  do {                                      \
+    float32_t lo = ((a) < (b)) ? (a) : (b); \
+    (b) = ((a) < (b)) ? (b) : (a);          \
+    (a) = lo;                               \
+  } while (0)
+
+/* Sorts 8 samples with a bitonic network */
+static void arm_sort_bitonic8_f32(
+  float32_t * p)
+{
+  float32_t x0 = p[0], x1 = p[1], x2 = p[2], x3 = p[3];
+  float32_t x4 = p[4], x5 = p[5], x6 = p[6], x7 = p[7];
+
+  /* Bitonic sequences of 2 */
+  ARM_SORT_CE(x0, x1); ARM_SORT_CE(x3, x2); ARM_SORT_CE(x4, x5); ARM_SORT_CE(x7, x6);
+
+  /* Merge into bitonic sequences of 4 */
+  ARM_SORT_CE(x0, x2); ARM_SORT_CE(x1, x3); ARM_SORT_CE(x6, x4); ARM_SORT_CE(x7, x5);
+  ARM_SORT_CE(x0, x1); ARM_SORT_CE(x2, x3); ARM_SORT_CE(x5, x4); ARM_SORT_CE(x7, x6);
+
+  /* Merge into a sorted sequence of 8 */
+  ARM_SORT_CE(x0, x4); ARM_SORT_CE(x1, x5); ARM_SORT_CE(x2, x6); ARM_SORT_CE(x3, x7);
+  ARM_SORT_CE(x0, x2); ARM_SORT_CE(x1, x3); ARM_SORT_CE(x4, x6); ARM_SORT_CE(x5, x7);
+  ARM_SORT_CE(x0, x1); ARM_SORT_CE(x2, x3); ARM_SORT_CE(x4, x5); ARM_SORT_CE(x6, x7);
+
+  p[0] = x0; p[1] = x1; p[2] = x2; p[3] = x3;
+  p[4] = x4; p[5] = x5; p[6] = x6; p[7] = x7;
+}
+
+/* Sorts a short vector in place by insertion */
+static void arm_sort_insertion_f32(
+  float32_t * p,
+  uint32_t n)
+{
+  float32_t in;
+  uint32_t i, j;
+
+  for (i = 1U; i < n; i++)
+  {
+    in = p[i];
+    for (j = i; (j > 0U) && (p[j - 1U] > in); j--)
+    {
+      p[j] = p[j - 1U];
+    }
+    p[j] = in;
+  }
+}
+
+/**
+  @brief         Sorts the elements of a floating-point vector in ascending order.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector, may be equal to pSrc
+  @param[in]     pScratch   points to a scratch buffer of blockSize samples
+  @param[in]     blockSize  number of samples in the vector
+  @return        none
+
+  @par           Details
+                   NaN values are not supported.
+ */
+void arm_sort_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch,
+        uint32_t blockSize)
+{
+        float32_t *pIn, *pOut, *pTmp;                  /* Merge source and destination */
+        uint32_t width, lo, mid, hi, i, j, k;          /* Run bounds and indices */
+
+  if (pDst != pSrc)
+  {
+    arm_copy_f32(pSrc, pDst, blockSize);
+  }
+
+  /* Sort runs of 8 samples, the last partial run by insertion */
+  for (lo = 0U; lo + 8U <= blockSize; lo += 8U)
+  {
+    arm_sort_bitonic8_f32(&pDst[lo]);
+  }
+  arm_sort_insertion_f32(&pDst[lo], blockSize - lo);
+
+  /* Merge pairs of runs of doubling width */
+  pIn = pDst;
+  pOut = pScratch;
+  for (width = 8U; width < blockSize; width *= 2U)
+  {
+    for (lo = 0U; lo < blockSize; lo += 2U * width)
+    {
+      mid = (lo + width < blockSize) ? lo + width : blockSize;
+      hi = (mid + width < blockSize) ? mid + width : blockSize;
+      i = lo;
+      j = mid;
+      k = lo;
+
+      while ((i < mid) && (j < hi))
+      {
+        pOut[k++] = (pIn[j] < pIn[i]) ? pIn[j++] : pIn[i++];
+      }
+      while (i < mid)
+      {
+        pOut[k++] = pIn[i++];
+      }
+      while (j < hi)
+      {
+        pOut[k++] = pIn[j++];
+      }
+    }
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  if (pIn != pDst)
+  {
+    arm_copy_f32(pIn, pDst, blockSize);
+  }
+}
+
+/**
+  @} end of Sort group
+ */
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_q31.c
+ * Description:  Q31 vector sort
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup Sort
+  @{
+ */
+
+/* Sorts a short vector in place by insertion */
+static void arm_sort_insertion_q31(
+  q31_t * p,
+  uint32_t n)
+{
+  q31_t in;
+  uint32_t i, j;
+
+  for (i = 1U; i < n; i++)
+  {
+    in = p[i];
+    for (j = i; (j > 0U) && (p[j - 1U] > in); j--)
+    {
+      p[j] = p[j - 1U];
+    }
+    p[j] = in;
+  }
+}
+
+/**
+  @brief         Sorts the elements of a Q31 vector in ascending order.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector, may be equal to pSrc
+  @param[in]     pScratch   points to a scratch buffer of blockSize samples
+  @param[in]     blockSize  number of samples in the vector
+  @return        none
+ */
+void arm_sort_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pScratch,
+        uint32_t blockSize)
+{
+  const q31_t *pIn = pSrc;                             /* Source of the next pass */
+        q31_t *pOut = pScratch;                        /* Destination of the next pass */
+        uint32_t count[256];                           /* Digit histogram */
+        uint32_t shift, digit, sum, tmp, i;            /* Temporary variables */
+
+  if (blockSize <= 32U)
+  {
+    if (pDst != pSrc)
+    {
+      arm_copy_q31(pSrc, pDst, blockSize);
+    }
+    arm_sort_insertion_q31(pDst, blockSize);
+    return;
+  }
+
+  for (shift = 0U; shift < 32U; shift += 8U)
+  {
+    /* Count the digits; the sign bit is inverted so that negative values sort first */
+    memset(count, 0, sizeof(count));
+    for (i = 0U; i < blockSize; i++)
+    {
+      count[((((uint32_t) pIn[i]) ^ 0x80000000U) >> shift) & 0xFFU]++;
+    }
+
+    /* Skip the pass if all samples share the digit */
+    if (count[(((((uint32_t) pIn[0]) ^ 0x80000000U) >> shift) & 0xFFU)] == blockSize)
+    {
+      continue;
+    }
+
+    /* Turn the counts into start positions */
+    sum = 0U;
+    for (digit = 0U; digit < 256U; digit++)
+    {
+      tmp = count[digit];
+      count[digit] = sum;
+      sum += tmp;
+    }
+
+    /* Scatter in order of the digit, keeping the order of equal digits */
+    for (i = 0U; i < blockSize; i++)
+    {
+      pOut[count[((((uint32_t) pIn[i]) ^ 0x80000000U) >> shift) & 0xFFU]++] = pIn[i];
+    }
+
+    /* The first pass leaves pSrc unchanged, later passes alternate between pDst and pScratch */
+    pIn = pOut;
+    pOut = (pOut == pScratch) ? pDst : pScratch;
+  }
+
+  if (pIn != pDst)
+  {
+    arm_copy_q31(pIn, pDst, blockSize);
+  }
+}
+
+/**
+  @} end of Sort group
+ */
@@ -0,0 +1,264 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_bfp_q31.c
+ * Description:  Block-floating-point Q31 complex FFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+extern void arm_bitreversal_32(
+        uint32_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable);
+
+/* Store (xr + j * xi) / 2^shift and add its magnitude to the bound of the stage */
+#define ARM_BFP_STORE_Q31(p, xr, xi) \
+  outR = ((xr) + rnd) >> shift; \
+  outI = ((xi) + rnd) >> shift; \
+  (p)[0] = (q31_t) outR; \
+  (p)[1] = (q31_t) outI; \
+  bits |= (uint32_t) (outR ^ (outR >> 63)) | (uint32_t) (outI ^ (outI >> 63))
+
+/* Store (xr + j * xi) * (c - j * s) / 2^shift, pre-shifting the operands by pre bits */
+#define ARM_BFP_STORE_TW_Q31(p, xr, xi, c, s) \
+  outR = ((((xr) >> pre) * (c)) + (((xi) >> pre) * (s)) + rndTw) >> (31U + shift - pre); \
+  outI = ((((xi) >> pre) * (c)) - (((xr) >> pre) * (s)) + rndTw) >> (31U + shift - pre); \
+  (p)[0] = (q31_t) outR; \
+  (p)[1] = (q31_t) outI; \
+  bits |= (uint32_t) (outR ^ (outR >> 63)) | (uint32_t) (outI ^ (outI >> 63))
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup BlockFloatingFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the block-floating-point Q31 complex FFT.
+  @param[in]     S               points to an instance of the Q31 CFFT structure
+  @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag        flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @param[in]     bitReverseFlag  flag that enables / disables bit reversal of output
+                   - value = 0: disables bit reversal of output
+                   - value = 1: enables bit reversal of output
+  @return        exponent of the output block
+
+  @par           Scaling and Overflow Behavior
+                   The output values <code>y</code> and the returned exponent <code>e</code> give the
+                   transform as <code>y * 2^e</code> in the units of the input samples:
+                   <code>X[k] = sum(x[n] * exp(-2j*pi*n*k/N))</code> for the forward transform and
+                   <code>x[n] = sum(X[k] * exp(2j*pi*n*k/N)) / N</code> for the inverse transform.
+                   To compare with the 1.31 output of \ref arm_cfft_q31, which is <code>X / N</code>,
+                   shift the output by <code>e - log2(N)</code>.
+  @par
+                   A radix-4 stage whose inputs are at most 2^28 in magnitude is not scaled; otherwise
+                   its outputs are scaled down with rounding by the bits missing for the worst-case
+                   growth of <code>4*sqrt(2)</code> per component (<code>2*sqrt(2)</code> and 2^29
+                   for the radix-2 stage). The output cannot overflow.
+                   An all-zero input returns an exponent of 0.
+ */
+
+int32_t arm_cfft_bfp_q31(
+  const arm_cfft_instance_q31 * S,
+        q31_t * p1,
+        uint8_t ifftFlag,
+        uint8_t bitReverseFlag)
+{
+  const q31_t *pTw = S->pTwiddle;                  /* Twiddles cos, sin of 2*pi*k/fftLen */
+        q31_t *pA, *pB, *pC, *pD;                  /* Butterfly legs */
+        q63_t ar, ai, br, bi, cr, ci, dr, di;      /* Butterfly inputs */
+        q63_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+        q63_t c1, s1, c2, s2, c3, s3;              /* Twiddles W^j, W^2j, W^3j */
+        q63_t outR, outI;                          /* Scaled outputs */
+        uint32_t fftLen = S->fftLen;
+        uint32_t quarter = fftLen >> 2U;           /* Leg distance of a radix-4 stage */
+        uint32_t twStep = 1U;                      /* Twiddle index step of the stage */
+        uint32_t legB, legD;                       /* Offsets of the legs read as the second and fourth inputs */
+        uint32_t i, j;
+        uint32_t bits;                             /* Magnitude bound, OR of x ^ (x >> 31) */
+        uint32_t shift;                            /* Scaling of the current stage */
+        uint32_t pre;                              /* Pre-shift of the twiddle multiply operands */
+        q63_t rnd, rndTw;                          /* Rounding offsets */
+        int32_t exponent = 0;
+
+  /* Magnitude bound of the input */
+  bits = 0U;
+  for (i = 0U; i < 2U * fftLen; i++)
+  {
+    bits |= (uint32_t) (p1[i] ^ (p1[i] >> 31));
+  }
+  if (bits == 0U)
+  {
+    return (0);
+  }
+
+  /* Shift small inputs up to 28 magnitude bits */
+  shift = 32U - __CLZ(bits);
+  if (shift < 28U)
+  {
+    shift = 28U - shift;
+    for (i = 0U; i < 2U * fftLen; i++)
+    {
+      p1[i] = (q31_t) (p1[i] << shift);
+    }
+    bits <<= shift;
+    exponent -= (int32_t) shift;
+  }
+
+  /* Radix-2 stage when log2(fftLen) is odd */
+  if ((__CLZ(fftLen) & 1U) == 0U)
+  {
+    /* Inputs of at most 2^29 grow to at most 2^29 * 2 * sqrt(2) < 2^31 */
+    shift = 32U - __CLZ(bits);
+    shift = (shift > 29U) ? (shift - 29U) : 0U;
+    pre = (shift > 0U) ? (shift - 1U) : 0U;
+    rnd = (q63_t) ((1U << shift) >> 1U);
+    rndTw = (q63_t) 1 << (30U + shift - pre);
+    exponent += (int32_t) shift;
+    bits = 0U;
+
+    pA = p1;
+    pB = &p1[fftLen];
+    ar = pA[0];
+    ai = pA[1];
+    br = pB[0];
+    bi = pB[1];
+    ARM_BFP_STORE_Q31(pA, ar + br, ai + bi);
+    ARM_BFP_STORE_Q31(pB, ar - br, ai - bi);
+
+    for (i = 1U; i < (fftLen >> 1U); i++)
+    {
+      c1 = pTw[2U * i];
+      s1 = (ifftFlag != 0U) ? -pTw[2U * i + 1U] : pTw[2U * i + 1U];
+
+      pA = &p1[2U * i];
+      pB = &p1[fftLen + 2U * i];
+      ar = pA[0];
+      ai = pA[1];
+      br = pB[0];
+      bi = pB[1];
+      ARM_BFP_STORE_Q31(pA, ar + br, ai + bi);
+      ARM_BFP_STORE_TW_Q31(pB, ar - br, ai - bi, c1, s1);
+    }
+
+    quarter >>= 1U;
+    twStep = 2U;
+  }
+
+  /* The inverse transform reads the second and fourth legs swapped, which turns -j into j */
+  legB = (ifftFlag != 0U) ? 3U : 1U;
+  legD = (ifftFlag != 0U) ? 1U : 3U;
+
+  for (; quarter > 0U; quarter >>= 2U, twStep <<= 2U)
+  {
+    /* Inputs of at most 2^28 grow to at most 2^28 * 4 * sqrt(2) < 2^31 */
+    shift = 32U - __CLZ(bits);
+    shift = (shift > 28U) ? (shift - 28U) : 0U;
+    pre = (shift > 0U) ? (shift - 1U) : 0U;
+    rnd = (q63_t) ((1U << shift) >> 1U);
+    rndTw = (q63_t) 1 << (30U + shift - pre);
+    exponent += (int32_t) shift;
+    bits = 0U;
+
+    for (j = 0U; j < quarter; j++)
+    {
+      c1 = pTw[2U * j * twStep];
+      s1 = pTw[2U * j * twStep + 1U];
+      c2 = pTw[4U * j * twStep];
+      s2 = pTw[4U * j * twStep + 1U];
+      c3 = pTw[6U * j * twStep];
+      s3 = pTw[6U * j * twStep + 1U];
+      if (ifftFlag != 0U)
+      {
+        s1 = -s1;
+        s2 = -s2;
+        s3 = -s3;
+      }
+
+      for (i = j; i < fftLen; i += 4U * quarter)
+      {
+        pA = &p1[2U * i];
+        pB = &p1[2U * (i + quarter)];
+        pC = &p1[2U * (i + 2U * quarter)];
+        pD = &p1[2U * (i + 3U * quarter)];
+
+        ar = pA[0];
+        ai = pA[1];
+        br = pA[2U * legB * quarter];
+        bi = pA[2U * legB * quarter + 1U];
+        cr = pC[0];
+        ci = pC[1];
+        dr = pA[2U * legD * quarter];
+        di = pA[2U * legD * quarter + 1U];
+
+        t0r = ar + cr;
+        t0i = ai + ci;
+        t1r = ar - cr;
+        t1i = ai - ci;
+        t2r = br + dr;
+        t2i = bi + di;
+        t3r = br - dr;
+        t3i = bi - di;
+
+        /* y0 = t0 + t2, y2 = t0 - t2, y1 = t1 - j * t3, y3 = t1 + j * t3; y2 and y1 are stored swapped */
+        ARM_BFP_STORE_Q31(pA, t0r + t2r, t0i + t2i);
+        if (j == 0U)
+        {
+          ARM_BFP_STORE_Q31(pB, t0r - t2r, t0i - t2i);
+          ARM_BFP_STORE_Q31(pC, t1r + t3i, t1i - t3r);
+          ARM_BFP_STORE_Q31(pD, t1r - t3i, t1i + t3r);
+        }
+        else
+        {
+          ARM_BFP_STORE_TW_Q31(pB, t0r - t2r, t0i - t2i, c2, s2);
+          ARM_BFP_STORE_TW_Q31(pC, t1r + t3i, t1i - t3r, c1, s1);
+          ARM_BFP_STORE_TW_Q31(pD, t1r - t3i, t1i + t3r, c3, s3);
+        }
+      }
+    }
+  }
+
+  if (bitReverseFlag != 0U)
+  {
+    arm_bitreversal_32((uint32_t *) p1, S->bitRevLength, S->pBitRevTable);
+  }
+
+  if (ifftFlag != 0U)
+  {
+    exponent -= (int32_t) (31U - __CLZ(fftLen));
+  }
+
+  return (exponent);
+}
+
+/**
+  @} end of BlockFloatingFFT group
+ */
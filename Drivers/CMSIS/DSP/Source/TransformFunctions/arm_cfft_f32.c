@@ -549,6 +549,121 @@ void arm_cfft_radix8by4_f32 (arm_cfft_instance_f32 * S, float32_t * p1)
     arm_radix8_butterfly_f32 (pCol4, L, (float32_t *) S->pTwiddle, 4U);
 }
 
+#if defined(ARM_MATH_AVX2)
+/**
+  @brief         Radix-2 decimation in frequency CFFT for x86 AVX2 / FMA.
+  @param[in]     S              points to an instance of the floating-point CFFT structure
+  @param[in,out] p1             points to the complex data buffer of size <code>2*fftLen</code>
+  @param[in]     bitReverseFlag flag that enables / disables bit reversal of output
+  @return        none
+
+  @par           The butterflies of each stage are computed 4 at a time in a 256-bit vector,
+                 using the twiddle table of the instance. The last two stages are merged into a
+                 radix-4 stage working on 4 consecutive complex values. Without bit reversal the
+                 output is left in binary bit reversed order.
+ */
+static void arm_cfft_radix2_avx2_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p1,
+        uint8_t bitReverseFlag)
+{
+  const uint32_t L = S->fftLen;
+  const float32_t *pCoef = S->pTwiddle;
+  const __m128 negV = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+  uint32_t half, stride, j, k, r, bit;
+  float32_t *pA, *pB;
+  __m256 aV, bV, sumV, diffV, twV, cosV, sinV;
+  __m256i idxV;
+  __m128 loV, hiV, sV, dV;
+  uint64_t tmp;
+
+  /* Stages with a butterfly span of 4 or more complex values */
+  for (half = L >> 1U; half >= 4U; half >>= 1U)
+  {
+    /* Twiddle of butterfly j is W_N^(j * stride), stored as {cos, sin} pairs */
+    stride = L / (2U * half);
+
+    for (j = 0; j < half; j += 4U)
+    {
+      if (stride == 1U)
+      {
+        twV = _mm256_loadu_ps(&pCoef[2U * j]);
+      }
+      else
+      {
+        idxV = _mm256_setr_epi64x((int64_t)(j * stride), (int64_t)((j + 1U) * stride),
+                                  (int64_t)((j + 2U) * stride), (int64_t)((j + 3U) * stride));
+        twV = _mm256_castpd_ps(_mm256_i64gather_pd((const double *)pCoef, idxV, 8));
+      }
+      cosV = _mm256_moveldup_ps(twV);
+      sinV = _mm256_movehdup_ps(twV);
+
+      for (k = j; k < L; k += 2U * half)
+      {
+        pA = &p1[2U * k];
+        pB = &p1[2U * (k + half)];
+
+        aV = _mm256_loadu_ps(pA);
+        bV = _mm256_loadu_ps(pB);
+        sumV = _mm256_add_ps(aV, bV);
+        diffV = _mm256_sub_ps(aV, bV);
+
+        /* (xr + j*xi) * (cos - j*sin) = (xr*cos + xi*sin) + j*(xi*cos - xr*sin) */
+        diffV = _mm256_fmsubadd_ps(diffV, cosV,
+                                   _mm256_mul_ps(_mm256_permute_ps(diffV, _MM_SHUFFLE(2, 3, 0, 1)), sinV));
+
+        _mm256_storeu_ps(pA, sumV);
+        _mm256_storeu_ps(pB, diffV);
+      }
+    }
+  }
+
+  /* Last two stages as radix-4: s = x0..1 + x2..3, d = x0..1 - x2..3, outputs {s0+s1, s0-s1, d0-j*d1, d0+j*d1} */
+  for (k = 0; k < L; k += 4U)
+  {
+    pA = &p1[2U * k];
+
+    loV = _mm_loadu_ps(pA);
+    hiV = _mm_loadu_ps(pA + 4);
+    sV = _mm_add_ps(loV, hiV);
+    dV = _mm_sub_ps(loV, hiV);
+
+    /* Multiply the second difference by -j: (xr + j*xi) * -j = xi - j*xr */
+    dV = _mm_xor_ps(_mm_shuffle_ps(dV, dV, _MM_SHUFFLE(2, 3, 1, 0)), negV);
+
+    loV = _mm_movelh_ps(sV, dV);
+    hiV = _mm_movehl_ps(dV, sV);
+
+    aV = _mm256_set_m128(_mm_sub_ps(loV, hiV), _mm_add_ps(loV, hiV));
+    /* {s0+s1, d0-j*d1, s0-s1, d0+j*d1} reordered to {s0+s1, s0-s1, d0-j*d1, d0+j*d1} */
+    _mm256_storeu_ps(pA, _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(aV), _MM_SHUFFLE(3, 1, 2, 0))));
+  }
+
+  if (bitReverseFlag)
+  {
+    /* Binary bit reversal of the complex values, r runs through the reversed indices of k */
+    r = 0;
+    for (k = 0; k < L; k++)
+    {
+      if (k < r)
+      {
+        memcpy(&tmp, &p1[2U * k], sizeof(tmp));
+        memcpy(&p1[2U * k], &p1[2U * r], sizeof(tmp));
+        memcpy(&p1[2U * r], &tmp, sizeof(tmp));
+      }
+
+      bit = L >> 1U;
+      while ((bit != 0U) && ((r & bit) != 0U))
+      {
+        r ^= bit;
+        bit >>= 1U;
+      }
+      r |= bit;
+    }
+  }
+}
+#endif /* #if defined(ARM_MATH_AVX2) */
+
 /**
   @addtogroup ComplexFFT
   @{
@@ -587,6 +702,9 @@ void arm_cfft_f32(
     }
   }
 
+#if defined(ARM_MATH_AVX2)
+  arm_cfft_radix2_avx2_f32(S, p1, bitReverseFlag);
+#else
   switch (L)
   {
   case 16:
@@ -608,6 +726,7 @@ void arm_cfft_f32(
 
   if ( bitReverseFlag )
     arm_bitreversal_32 ((uint32_t*) p1, S->bitRevLength, S->pBitRevTable);
+#endif /* #if defined(ARM_MATH_AVX2) */
 
   if (ifftFlag == 1U)
   {
@@ -0,0 +1,456 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_f32.c
+ * Description:  Floating-point mixed-radix complex FFT processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/* Butterfly constants */
+#define ARM_MIXED_SIN60     (0.86602540378443865f)   /* sin(2*pi/3) */
+#define ARM_MIXED_COS72     (0.30901699437494742f)   /* cos(2*pi/5) */
+#define ARM_MIXED_COS144    (-0.80901699437494742f)  /* cos(4*pi/5) */
+#define ARM_MIXED_SIN72     (0.95105651629515357f)   /* sin(2*pi/5) */
+#define ARM_MIXED_SIN144    (0.58778525229247313f)   /* sin(4*pi/5) */
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup MixedRadixFFT Mixed-Radix FFT Functions
+
+  @par
+                   \ref arm_cfft_f32 and \ref arm_rfft_fast_f32 support power-of-two lengths only,
+                   so frames of other lengths (100, 240, 1000 samples, ...) have to be zero-padded,
+                   which costs cycles and memory and changes the bin spacing.
+                   The mixed-radix functions support every length whose prime factors are
+                   2, 3 and 5, up to 65535 complex points (for example 60, 100, 120, 240, 1000).
+  @par           Algorithm
+                   The length is factored into radix-4, radix-2, radix-3 and radix-5 stages, in
+                   that order. Each stage is a decimation-in-frequency pass of the Stockham
+                   autosort algorithm: it reads one buffer and writes the other in natural order,
+                   so no digit-reversal permutation is needed. The passes alternate between the
+                   data array and a scratch array of the same size; when the number of stages is
+                   odd, the result is copied back to the data array.
+                   The last stage needs no twiddle multiplications.
+  @par
+                   The inverse transform conjugates the input, runs the forward transform and
+                   conjugates the output with a scale of <code>1/fftLen</code>, as \ref arm_cfft_f32 does.
+  @par           Twiddle Plans
+                   The initialization functions factor the length and precompute the twiddles of
+                   every stage into a buffer provided by the caller. The twiddles are evaluated
+                   with exact integer range reduction, so their error is within one rounding.
+                   A plan is read-only and may be shared by any number of transforms of the same
+                   length, in both directions.
+  @par           Real FFT
+                   \ref arm_rfft_mixed_f32 computes the FFT of <code>fftLen</code> real samples
+                   (<code>fftLen</code> even, <code>fftLen/2</code> with prime factors 2, 3 and 5)
+                   through a complex FFT of length <code>fftLen/2</code> and a split stage.
+                   It works in place and uses the packed output format of \ref arm_rfft_fast_f32.
+ */
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/*
+ * Each stage transforms sequences of length n = m * p with stride s (n * s = fftLen):
+ *   y[q + s*(p*j + t)] = w^(j*t) * sum_r x[q + s*(j + r*m)] * exp(-2i*pi*r*t/p)
+ * for j = 0..m-1, q = 0..s-1, w = exp(-2i*pi/n). The twiddles are stored
+ * per j = 1..m-1 as p-1 pairs {cos, sin} of 2*pi*j*t/n, t = 1..p-1.
+ * The butterflies for j = 0 have unit twiddles and skip the multiplications;
+ * in the last stage (m = 1) these are all of them.
+ */
+
+/* Output t of a butterfly, multiplied by the conjugate of twiddle {c, s} */
+#define ARM_MIXED_STORE_TW(t, xr, xi, c, s) \
+  pY[(t) * outStride]      = (xr) * (c) + (xi) * (s); \
+  pY[(t) * outStride + 1U] = (xi) * (c) - (xr) * (s)
+
+#define ARM_MIXED_STORE(t, xr, xi) \
+  pY[(t) * outStride]      = (xr); \
+  pY[(t) * outStride + 1U] = (xi)
+
+/* Radix-2 butterfly: b0 = a0 + a1, b1 = a0 - a1 */
+#define ARM_MIXED_BFLY2 \
+  a0r = pA[0]; \
+  a0i = pA[1]; \
+  a1r = pA[inStride]; \
+  a1i = pA[inStride + 1U]; \
+  pY[0] = a0r + a1r; \
+  pY[1] = a0i + a1i; \
+  b1r = a0r - a1r; \
+  b1i = a0i - a1i
+
+static void arm_radix2_mixed_f32(
+  const float32_t * pIn,
+        float32_t * pOut,
+  const float32_t * pTw,
+        uint32_t m,
+        uint32_t s)
+{
+  const float32_t *pA = pIn;
+        float32_t *pY = pOut;
+        float32_t a0r, a0i, a1r, a1i, b1r, b1i;
+        float32_t c1, s1;
+        uint32_t j, q;
+        uint32_t inStride = 2U * m * s;            /* Distance between the inputs of a butterfly */
+        uint32_t outStride = 2U * s;               /* Distance between the outputs of a butterfly */
+
+  for (q = 0U; q < s; q++)
+  {
+    ARM_MIXED_BFLY2;
+    ARM_MIXED_STORE(1U, b1r, b1i);
+    pA += 2U;
+    pY += 2U;
+  }
+
+  for (j = 1U; j < m; j++)
+  {
+    c1 = pTw[0];
+    s1 = pTw[1];
+    pTw += 2U;
+
+    pA = &pIn[2U * s * j];
+    pY = &pOut[2U * s * 2U * j];
+
+    for (q = 0U; q < s; q++)
+    {
+      ARM_MIXED_BFLY2;
+      ARM_MIXED_STORE_TW(1U, b1r, b1i, c1, s1);
+      pA += 2U;
+      pY += 2U;
+    }
+  }
+}
+
+/* Radix-3 butterfly: b1,2 = a0 - (a1 + a2) / 2 -/+ j * sin(2*pi/3) * (a1 - a2) */
+#define ARM_MIXED_BFLY3 \
+  tr = pA[inStride]      + pA[2U * inStride]; \
+  ti = pA[inStride + 1U] + pA[2U * inStride + 1U]; \
+  dr = pA[inStride]      - pA[2U * inStride]; \
+  di = pA[inStride + 1U] - pA[2U * inStride + 1U]; \
+  pY[0] = pA[0] + tr; \
+  pY[1] = pA[1] + ti; \
+  mr = pA[0] - 0.5f * tr; \
+  mi = pA[1] - 0.5f * ti; \
+  b1r = mr + ARM_MIXED_SIN60 * di; \
+  b1i = mi - ARM_MIXED_SIN60 * dr; \
+  b2r = mr - ARM_MIXED_SIN60 * di; \
+  b2i = mi + ARM_MIXED_SIN60 * dr
+
+static void arm_radix3_mixed_f32(
+  const float32_t * pIn,
+        float32_t * pOut,
+  const float32_t * pTw,
+        uint32_t m,
+        uint32_t s)
+{
+  const float32_t *pA = pIn;
+        float32_t *pY = pOut;
+        float32_t tr, ti, dr, di, mr, mi;
+        float32_t b1r, b1i, b2r, b2i;
+        float32_t c1, s1, c2, s2;
+        uint32_t j, q;
+        uint32_t inStride = 2U * m * s;
+        uint32_t outStride = 2U * s;
+
+  for (q = 0U; q < s; q++)
+  {
+    ARM_MIXED_BFLY3;
+    ARM_MIXED_STORE(1U, b1r, b1i);
+    ARM_MIXED_STORE(2U, b2r, b2i);
+    pA += 2U;
+    pY += 2U;
+  }
+
+  for (j = 1U; j < m; j++)
+  {
+    c1 = pTw[0];
+    s1 = pTw[1];
+    c2 = pTw[2];
+    s2 = pTw[3];
+    pTw += 4U;
+
+    pA = &pIn[2U * s * j];
+    pY = &pOut[2U * s * 3U * j];
+
+    for (q = 0U; q < s; q++)
+    {
+      ARM_MIXED_BFLY3;
+      ARM_MIXED_STORE_TW(1U, b1r, b1i, c1, s1);
+      ARM_MIXED_STORE_TW(2U, b2r, b2i, c2, s2);
+      pA += 2U;
+      pY += 2U;
+    }
+  }
+}
+
+/* Radix-4 butterfly: b1 = t1 - j * t3, b2 = t0 - t2, b3 = t1 + j * t3 */
+#define ARM_MIXED_BFLY4 \
+  t0r = pA[0]             + pA[2U * inStride]; \
+  t0i = pA[1]             + pA[2U * inStride + 1U]; \
+  t1r = pA[0]             - pA[2U * inStride]; \
+  t1i = pA[1]             - pA[2U * inStride + 1U]; \
+  t2r = pA[inStride]      + pA[3U * inStride]; \
+  t2i = pA[inStride + 1U] + pA[3U * inStride + 1U]; \
+  t3r = pA[inStride]      - pA[3U * inStride]; \
+  t3i = pA[inStride + 1U] - pA[3U * inStride + 1U]; \
+  pY[0] = t0r + t2r; \
+  pY[1] = t0i + t2i; \
+  b1r = t1r + t3i; \
+  b1i = t1i - t3r; \
+  b2r = t0r - t2r; \
+  b2i = t0i - t2i; \
+  b3r = t1r - t3i; \
+  b3i = t1i + t3r
+
+static void arm_radix4_mixed_f32(
+  const float32_t * pIn,
+        float32_t * pOut,
+  const float32_t * pTw,
+        uint32_t m,
+        uint32_t s)
+{
+  const float32_t *pA = pIn;
+        float32_t *pY = pOut;
+        float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+        float32_t b1r, b1i, b2r, b2i, b3r, b3i;
+        float32_t c1, s1, c2, s2, c3, s3;
+        uint32_t j, q;
+        uint32_t inStride = 2U * m * s;
+        uint32_t outStride = 2U * s;
+
+  for (q = 0U; q < s; q++)
+  {
+    ARM_MIXED_BFLY4;
+    ARM_MIXED_STORE(1U, b1r, b1i);
+    ARM_MIXED_STORE(2U, b2r, b2i);
+    ARM_MIXED_STORE(3U, b3r, b3i);
+    pA += 2U;
+    pY += 2U;
+  }
+
+  for (j = 1U; j < m; j++)
+  {
+    c1 = pTw[0];
+    s1 = pTw[1];
+    c2 = pTw[2];
+    s2 = pTw[3];
+    c3 = pTw[4];
+    s3 = pTw[5];
+    pTw += 6U;
+
+    pA = &pIn[2U * s * j];
+    pY = &pOut[2U * s * 4U * j];
+
+    for (q = 0U; q < s; q++)
+    {
+      ARM_MIXED_BFLY4;
+      ARM_MIXED_STORE_TW(1U, b1r, b1i, c1, s1);
+      ARM_MIXED_STORE_TW(2U, b2r, b2i, c2, s2);
+      ARM_MIXED_STORE_TW(3U, b3r, b3i, c3, s3);
+      pA += 2U;
+      pY += 2U;
+    }
+  }
+}
+
+/*
+ * Radix-5 butterfly with t1 = a1 + a4, t2 = a2 + a3, d1 = a1 - a4, d2 = a2 - a3:
+ *   b1,4 = a0 + cos72 * t1 + cos144 * t2 -/+ j * (sin72 * d1 + sin144 * d2)
+ *   b2,3 = a0 + cos144 * t1 + cos72 * t2 -/+ j * (sin144 * d1 - sin72 * d2)
+ */
+#define ARM_MIXED_BFLY5 \
+  t1r = pA[inStride]           + pA[4U * inStride]; \
+  t1i = pA[inStride + 1U]      + pA[4U * inStride + 1U]; \
+  d1r = pA[inStride]           - pA[4U * inStride]; \
+  d1i = pA[inStride + 1U]      - pA[4U * inStride + 1U]; \
+  t2r = pA[2U * inStride]      + pA[3U * inStride]; \
+  t2i = pA[2U * inStride + 1U] + pA[3U * inStride + 1U]; \
+  d2r = pA[2U * inStride]      - pA[3U * inStride]; \
+  d2i = pA[2U * inStride + 1U] - pA[3U * inStride + 1U]; \
+  pY[0] = pA[0] + t1r + t2r; \
+  pY[1] = pA[1] + t1i + t2i; \
+  m1r = pA[0] + ARM_MIXED_COS72 * t1r + ARM_MIXED_COS144 * t2r; \
+  m1i = pA[1] + ARM_MIXED_COS72 * t1i + ARM_MIXED_COS144 * t2i; \
+  m2r = pA[0] + ARM_MIXED_COS144 * t1r + ARM_MIXED_COS72 * t2r; \
+  m2i = pA[1] + ARM_MIXED_COS144 * t1i + ARM_MIXED_COS72 * t2i; \
+  n1r = ARM_MIXED_SIN72 * d1r + ARM_MIXED_SIN144 * d2r; \
+  n1i = ARM_MIXED_SIN72 * d1i + ARM_MIXED_SIN144 * d2i; \
+  n2r = ARM_MIXED_SIN144 * d1r - ARM_MIXED_SIN72 * d2r; \
+  n2i = ARM_MIXED_SIN144 * d1i - ARM_MIXED_SIN72 * d2i
+
+static void arm_radix5_mixed_f32(
+  const float32_t * pIn,
+        float32_t * pOut,
+  const float32_t * pTw,
+        uint32_t m,
+        uint32_t s)
+{
+  const float32_t *pA = pIn;
+        float32_t *pY = pOut;
+        float32_t t1r, t1i, t2r, t2i, d1r, d1i, d2r, d2i;
+        float32_t m1r, m1i, m2r, m2i, n1r, n1i, n2r, n2i;
+        float32_t c1, s1, c2, s2, c3, s3, c4, s4;
+        uint32_t j, q;
+        uint32_t inStride = 2U * m * s;
+        uint32_t outStride = 2U * s;
+
+  for (q = 0U; q < s; q++)
+  {
+    ARM_MIXED_BFLY5;
+    ARM_MIXED_STORE(1U, m1r + n1i, m1i - n1r);
+    ARM_MIXED_STORE(2U, m2r + n2i, m2i - n2r);
+    ARM_MIXED_STORE(3U, m2r - n2i, m2i + n2r);
+    ARM_MIXED_STORE(4U, m1r - n1i, m1i + n1r);
+    pA += 2U;
+    pY += 2U;
+  }
+
+  for (j = 1U; j < m; j++)
+  {
+    c1 = pTw[0];
+    s1 = pTw[1];
+    c2 = pTw[2];
+    s2 = pTw[3];
+    c3 = pTw[4];
+    s3 = pTw[5];
+    c4 = pTw[6];
+    s4 = pTw[7];
+    pTw += 8U;
+
+    pA = &pIn[2U * s * j];
+    pY = &pOut[2U * s * 5U * j];
+
+    for (q = 0U; q < s; q++)
+    {
+      ARM_MIXED_BFLY5;
+      ARM_MIXED_STORE_TW(1U, m1r + n1i, m1i - n1r, c1, s1);
+      ARM_MIXED_STORE_TW(2U, m2r + n2i, m2i - n2r, c2, s2);
+      ARM_MIXED_STORE_TW(3U, m2r - n2i, m2i + n2r, c3, s3);
+      ARM_MIXED_STORE_TW(4U, m1r - n1i, m1i + n1r, c4, s4);
+      pA += 2U;
+      pY += 2U;
+    }
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point mixed-radix complex FFT.
+  @param[in]     S              points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in,out] p1             points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     pScratch       points to a scratch buffer of size <code>2*fftLen</code>
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+
+  @par           Scaling
+                   The forward transform is not scaled and the inverse transform is scaled
+                   by <code>1/fftLen</code>, the same as \ref arm_cfft_f32.
+ */
+
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+        float32_t * p1,
+        float32_t * pScratch,
+        uint8_t ifftFlag)
+{
+  const float32_t *pTw = S->pTwiddle;              /* Twiddles of the current stage */
+        float32_t *pIn = p1;                       /* Input of the current stage */
+        float32_t *pOut = pScratch;                /* Output of the current stage */
+        float32_t *pTmp;
+        float32_t invL;
+        uint32_t fftLen = S->fftLen;
+        uint32_t n = fftLen;                       /* Length of the sequences of the current stage */
+        uint32_t s = 1U;                           /* Number of sequences of the current stage */
+        uint32_t m, i;
+        uint16_t stage;
+
+  if (ifftFlag == 1U)
+  {
+    /* Conjugate input data */
+    for (i = 0U; i < fftLen; i++)
+    {
+      p1[2U * i + 1U] = -p1[2U * i + 1U];
+    }
+  }
+
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    m = n / S->radix[stage];
+
+    switch (S->radix[stage])
+    {
+    case 4U:
+      arm_radix4_mixed_f32(pIn, pOut, pTw, m, s);
+      break;
+    case 2U:
+      arm_radix2_mixed_f32(pIn, pOut, pTw, m, s);
+      break;
+    case 3U:
+      arm_radix3_mixed_f32(pIn, pOut, pTw, m, s);
+      break;
+    default:
+      arm_radix5_mixed_f32(pIn, pOut, pTw, m, s);
+      break;
+    }
+
+    /* (radix - 1) twiddles for each j = 1..m-1 */
+    pTw += 2U * (S->radix[stage] - 1U) * (m - 1U);
+    s *= S->radix[stage];
+    n = m;
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  /* Odd number of stages: the result is in the scratch buffer */
+  if (pIn != p1)
+  {
+    memcpy(p1, pIn, 2U * fftLen * sizeof(float32_t));
+  }
+
+  if (ifftFlag == 1U)
+  {
+    invL = 1.0f / (float32_t) fftLen;
+
+    /* Conjugate and scale output data */
+    for (i = 0U; i < fftLen; i++)
+    {
+      p1[2U * i]      =  p1[2U * i] * invL;
+      p1[2U * i + 1U] = -p1[2U * i + 1U] * invL;
+    }
+  }
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_init_f32.c
+ * Description:  Initialization function for the floating-point mixed-radix complex FFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/*
+ * cos and sin of 2*pi*num/den. The angle is reduced exactly with integers to
+ * [0, pi/4] and evaluated with Taylor polynomials of degree 10 (cos) and
+ * 9 (sin), whose truncation error is below 1e-9 there.
+ */
+void arm_cfft_mixed_sin_cos_f32(
+  uint32_t num,
+  uint32_t den,
+  float32_t * pCos,
+  float32_t * pSin)
+{
+  float32_t x, x2, c, s;
+  uint32_t octant, r;
+
+  /* 8 * num / den = octant + r / den */
+  num %= den;
+  octant = (8U * num) / den;
+  r = 8U * num - octant * den;
+
+  /* Odd octants: measure the angle back from the next multiple of pi/4 */
+  if ((octant & 1U) != 0U)
+  {
+    r = den - r;
+  }
+
+  x = 0.78539816339744831f * (float32_t) r / (float32_t) den;
+  x2 = x * x;
+
+  c = 1.0f - x2 * 0.5f * (1.0f - x2 * (1.0f / 12.0f) * (1.0f - x2 * (1.0f / 30.0f) *
+      (1.0f - x2 * (1.0f / 56.0f) * (1.0f - x2 * (1.0f / 90.0f)))));
+  s = x * (1.0f - x2 * (1.0f / 6.0f) * (1.0f - x2 * (1.0f / 20.0f) *
+      (1.0f - x2 * (1.0f / 42.0f) * (1.0f - x2 * (1.0f / 72.0f)))));
+
+  if ((octant & 1U) != 0U)
+  {
+    s = -s;
+  }
+
+  /* Angle = quadrant * pi/2 + (+/-x) */
+  switch (((octant + 1U) >> 1U) & 3U)
+  {
+  case 0U:
+    *pCos = c;
+    *pSin = s;
+    break;
+  case 1U:
+    *pCos = -s;
+    *pSin = c;
+    break;
+  case 2U:
+    *pCos = -c;
+    *pSin = -s;
+    break;
+  default:
+    *pCos = s;
+    *pSin = -c;
+    break;
+  }
+}
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix complex FFT.
+  @param[out]    S         points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in]     fftLen    length of the FFT, with prime factors 2, 3 and 5 only
+  @param[out]    pTwiddle  points to the twiddle plan buffer of size <code>2*fftLen</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is 0 or has a prime factor other than 2, 3 and 5
+
+  @par           Details
+                   The length is factored into radix-4 stages first, then radix-2, radix-3 and
+                   radix-5 stages. For each stage with radix <code>p</code> and sequence length
+                   <code>n = m * p</code>, the plan holds <code>(p-1)*(m-1)</code> {cos, sin} pairs;
+                   in total fewer than <code>fftLen</code> pairs.
+ */
+
+arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle)
+{
+  static const uint8_t radixOrder[4] = { 4U, 2U, 3U, 5U };
+  uint32_t n, m, j, t, p;
+  uint16_t numStages = 0U;
+  uint16_t i;
+
+  if (fftLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Factor the length */
+  n = fftLen;
+  for (i = 0U; i < 4U; i++)
+  {
+    while ((n % radixOrder[i]) == 0U)
+    {
+      S->radix[numStages++] = radixOrder[i];
+      n /= radixOrder[i];
+    }
+  }
+
+  if (n != 1U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->fftLen = fftLen;
+  S->numStages = numStages;
+  S->pTwiddle = pTwiddle;
+
+  /* Twiddles 2*pi*j*t/n of each stage, for j = 1..m-1 and t = 1..p-1 */
+  n = fftLen;
+  for (i = 0U; i < numStages; i++)
+  {
+    p = S->radix[i];
+    m = n / p;
+
+    for (j = 1U; j < m; j++)
+    {
+      for (t = 1U; t < p; t++)
+      {
+        arm_cfft_mixed_sin_cos_f32(j * t, n, &pTwiddle[0], &pTwiddle[1]);
+        pTwiddle += 2U;
+      }
+    }
+
+    n = m;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
@@ -0,0 +1,225 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point Goertzel detector processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup Goertzel Goertzel Detector
+
+  Computes the power of a few selected frequencies over consecutive frames of
+  <code>blockLength</code> samples. A complex FFT of the frame costs O(N log2 N)
+  and evaluates every bin; the Goertzel algorithm evaluates a single frequency with
+  one second-order recursion, so K bins cost O(K) per sample. It is cheaper than the
+  FFT when only a handful of tones are monitored (roughly K < log2 N).
+
+  @par           Algorithm
+                   For a bin at normalized frequency <code>f</code> (<code>w = 2*pi*f</code>),
+                   each input sample updates two state variables:
+  <pre>
+      s0 = x[n] + 2*cos(w)*s1 - s2
+      s2 = s1
+      s1 = s0
+  </pre>
+                   After <code>blockLength</code> samples the bin value follows from the last two states:
+  <pre>
+      X  = s1 - (cos(w) - j*sin(w)) * s2
+      |X|^2 = (s1 - cos(w)*s2)^2 + (sin(w)*s2)^2
+  </pre>
+                   The states are then cleared for the next frame.
+                   For <code>f = k / blockLength</code>, <code>|X|</code> equals the magnitude of bin <code>k</code>
+                   of a <code>blockLength</code>-point DFT; other frequencies need not be on the bin grid.
+  @par
+                   Bins are processed in pairs that share one pass over the input segment,
+                   so every sample is loaded once per two bins.
+  @par           Frames
+                   Frames may span several calls. Each call consumes the whole input block
+                   and writes <code>numBins</code> powers to <code>pDst</code> for every frame
+                   completed during the call; the return value is the number of such frames.
+                   <code>pDst</code> must therefore hold
+                   <code>numBins * ((count + blockSize) / blockLength)</code> values.
+
+  @par           Instance Structure
+                   The coefficients and states are stored in an instance data structure.
+                   A separate instance structure must be defined for each detector.
+                   There are separate instance structure declarations for each of the 3 supported data types.
+
+  @par           Initialization Functions
+                   There is also an associated initialization function for each data type.
+                   The initialization function computes the {cos(w), sin(w)} coefficient of each bin
+                   with \ref arm_sin_cos_f32, clears the states and starts a new frame.
+  @par
+                   Use of the initialization function is mandatory.
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point Goertzel detector.
+  @param[in,out] S          points to an instance of the floating-point Goertzel structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the bin powers, numBins values per completed frame
+  @param[in]     blockSize  number of samples to process
+  @return        number of frames completed in this call
+
+  @par           Scaling
+                   The output is the unnormalized power <code>|X|^2</code>, the same value that
+                   \ref arm_cmplx_mag_squared_f32 gives for the output of \ref arm_cfft_f32.
+ */
+
+uint32_t arm_goertzel_f32(
+        arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pCoeffs;                        /* Temporary pointer to the coefficients */
+        float32_t *pState;                         /* Temporary pointer to the states */
+  const float32_t *px;                             /* Temporary pointer to the input segment */
+        float32_t coefA, coefB;                    /* 2 * cos(w) of the two bins of a pair */
+        float32_t a0, a1, a2, b0, b1, b2;          /* States of the two bins of a pair */
+        float32_t in, re, im;                      /* Temporary variables */
+        uint32_t segLen, i;                        /* Segment length and loop counter */
+        uint32_t numFrames = 0U;                   /* Number of completed frames */
+        uint16_t numBins = S->numBins;             /* Number of bins */
+        uint16_t k;                                /* Bin counter */
+
+  while (blockSize > 0U)
+  {
+    /* Process up to the end of the current frame */
+    segLen = (uint32_t) S->blockLength - S->count;
+    if (segLen > blockSize)
+    {
+      segLen = blockSize;
+    }
+
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+
+    /* Two bins per pass over the segment */
+    k = numBins >> 1U;
+    while (k > 0U)
+    {
+      coefA = 2.0f * pCoeffs[0];
+      coefB = 2.0f * pCoeffs[2];
+      a1 = pState[0];
+      a2 = pState[1];
+      b1 = pState[2];
+      b2 = pState[3];
+
+      px = pSrc;
+      i = segLen;
+      while (i > 0U)
+      {
+        in = *px++;
+
+        /* s0 = x[n] + 2 * cos(w) * s1 - s2 */
+        a0 = in + coefA * a1 - a2;
+        b0 = in + coefB * b1 - b2;
+
+        a2 = a1;
+        a1 = a0;
+        b2 = b1;
+        b1 = b0;
+
+        i--;
+      }
+
+      pState[0] = a1;
+      pState[1] = a2;
+      pState[2] = b1;
+      pState[3] = b2;
+
+      pCoeffs += 4U;
+      pState += 4U;
+      k--;
+    }
+
+    /* Remaining bin */
+    if ((numBins & 1U) != 0U)
+    {
+      coefA = 2.0f * pCoeffs[0];
+      a1 = pState[0];
+      a2 = pState[1];
+
+      px = pSrc;
+      i = segLen;
+      while (i > 0U)
+      {
+        a0 = *px++ + coefA * a1 - a2;
+        a2 = a1;
+        a1 = a0;
+        i--;
+      }
+
+      pState[0] = a1;
+      pState[1] = a2;
+    }
+
+    pSrc += segLen;
+    blockSize -= segLen;
+    S->count += (uint16_t) segLen;
+
+    if (S->count == S->blockLength)
+    {
+      /* Frame complete: |X|^2 = (s1 - cos(w) * s2)^2 + (sin(w) * s2)^2 */
+      pCoeffs = S->pCoeffs;
+      pState = S->pState;
+      k = numBins;
+      while (k > 0U)
+      {
+        re = pState[0] - pCoeffs[0] * pState[1];
+        im = pCoeffs[1] * pState[1];
+        *pDst++ = re * re + im * im;
+
+        pState[0] = 0.0f;
+        pState[1] = 0.0f;
+
+        pCoeffs += 2U;
+        pState += 2U;
+        k--;
+      }
+
+      S->count = 0U;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+  @} end of Goertzel group
+ */
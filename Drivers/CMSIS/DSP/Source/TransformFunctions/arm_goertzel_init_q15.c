@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q15.c
+ * Description:  Q15 Goertzel detector initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 Goertzel detector.
+  @param[in,out] S            points to an instance of the Q15 Goertzel structure
+  @param[in]     blockLength  number of samples per detection frame
+  @param[in]     numBins      number of frequencies to evaluate
+  @param[in]     pFreqs       points to the bin frequencies, as 1.15 fractions of the sample rate in [0, 0.5]
+  @param[in]     pCoeffs      points to the coefficient buffer
+  @param[in]     pState       points to the state buffer
+  @return        none
+
+  @par           Details
+                   <code>pFreqs</code> is of length <code>numBins</code>; bin <code>k</code> of a
+                   <code>blockLength</code>-point DFT is at <code>k / blockLength</code>.
+                   <code>pCoeffs</code> and <code>pState</code> are each of length <code>2*numBins</code>
+                   and are filled by this function. The coefficients are stored in 1.31 format
+                   for all fixed-point types.
+ */
+
+void arm_goertzel_init_q15(
+        arm_goertzel_instance_q15 * S,
+        uint16_t blockLength,
+        uint16_t numBins,
+  const q15_t * pFreqs,
+        q31_t * pCoeffs,
+        q63_t * pState)
+{
+  float32_t sinVal, cosVal;
+  uint16_t k;
+
+  S->blockLength = blockLength;
+  S->numBins = numBins;
+  S->count = 0U;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  for (k = 0U; k < numBins; k++)
+  {
+    /* {cos(w), sin(w)} with w = 2 * pi * f, arm_sin_cos_f32 takes degrees */
+    arm_sin_cos_f32(360.0f * ((float32_t) pFreqs[k] / 32768.0f), &sinVal, &cosVal);
+
+    pCoeffs[2U * k] = clip_q63_to_q31((q63_t) (cosVal * 2147483648.0f));
+    pCoeffs[2U * k + 1U] = clip_q63_to_q31((q63_t) (sinVal * 2147483648.0f));
+  }
+
+  memset(pState, 0, 2U * numBins * sizeof(q63_t));
+}
+
+/**
+  @} end of Goertzel group
+ */
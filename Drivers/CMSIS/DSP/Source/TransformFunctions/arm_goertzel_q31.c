@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel detector processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 Goertzel detector.
+  @param[in,out] S          points to an instance of the Q31 Goertzel structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the bin powers, numBins values per completed frame
+  @param[in]     blockSize  number of samples to process
+  @return        number of frames completed in this call
+
+  @par           Scaling and Overflow Behavior
+                   The states are kept in 64-bit accumulators with 31 fractional bits, and
+                   the product <code>2*cos(w)*s1</code> is computed with 32x64-bit multiplies.
+                   The states grow at most to <code>blockLength / |sin(w)|</code> and to
+                   <code>blockLength^2 / 2</code> near <code>w = 0</code>, so frames of up to 32768
+                   samples cannot overflow at any frequency.
+  @par
+                   The output is the normalized power <code>|X / blockLength|^2</code> in 1.31 format,
+                   which is at most 1.0 and is saturated to 0x7FFFFFFF.
+                   Unlike \ref arm_cmplx_mag_squared_q31, no guard bits are reserved.
+ */
+
+uint32_t arm_goertzel_q31(
+        arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  const q31_t *pCoeffs;                            /* Temporary pointer to the coefficients */
+        q63_t *pState;                             /* Temporary pointer to the states */
+  const q31_t *px;                                 /* Temporary pointer to the input segment */
+        q31_t coefA, coefB;                        /* cos(w) of the two bins of a pair */
+        q63_t a0, a1, a2, b0, b1, b2;              /* States of the two bins of a pair */
+        q63_t in, re, im;                          /* Temporary variables */
+        uint64_t power;                            /* Bin power in 2.62 format */
+        uint32_t segLen, i;                        /* Segment length and loop counter */
+        uint32_t numFrames = 0U;                   /* Number of completed frames */
+        uint16_t numBins = S->numBins;             /* Number of bins */
+        uint16_t k;                                /* Bin counter */
+
+  while (blockSize > 0U)
+  {
+    /* Process up to the end of the current frame */
+    segLen = (uint32_t) S->blockLength - S->count;
+    if (segLen > blockSize)
+    {
+      segLen = blockSize;
+    }
+
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+
+    /* Two bins per pass over the segment */
+    k = numBins >> 1U;
+    while (k > 0U)
+    {
+      coefA = pCoeffs[0];
+      coefB = pCoeffs[2];
+      a1 = pState[0];
+      a2 = pState[1];
+      b1 = pState[2];
+      b2 = pState[3];
+
+      px = pSrc;
+      i = segLen;
+      while (i > 0U)
+      {
+        in = (q63_t) *px++;
+
+        /* s0 = x[n] + 2 * cos(w) * s1 - s2 */
+        a0 = in + (mult32x64(a1, coefA) << 2) - a2;
+        b0 = in + (mult32x64(b1, coefB) << 2) - b2;
+
+        a2 = a1;
+        a1 = a0;
+        b2 = b1;
+        b1 = b0;
+
+        i--;
+      }
+
+      pState[0] = a1;
+      pState[1] = a2;
+      pState[2] = b1;
+      pState[3] = b2;
+
+      pCoeffs += 4U;
+      pState += 4U;
+      k--;
+    }
+
+    /* Remaining bin */
+    if ((numBins & 1U) != 0U)
+    {
+      coefA = pCoeffs[0];
+      a1 = pState[0];
+      a2 = pState[1];
+
+      px = pSrc;
+      i = segLen;
+      while (i > 0U)
+      {
+        a0 = (q63_t) *px++ + (mult32x64(a1, coefA) << 2) - a2;
+        a2 = a1;
+        a1 = a0;
+        i--;
+      }
+
+      pState[0] = a1;
+      pState[1] = a2;
+    }
+
+    pSrc += segLen;
+    blockSize -= segLen;
+    S->count += (uint16_t) segLen;
+
+    if (S->count == S->blockLength)
+    {
+      /* Frame complete: |X / N|^2 = ((s1 - cos(w) * s2) / N)^2 + ((sin(w) * s2) / N)^2 */
+      pCoeffs = S->pCoeffs;
+      pState = S->pState;
+      k = numBins;
+      while (k > 0U)
+      {
+        re = (pState[0] - (mult32x64(pState[1], pCoeffs[0]) << 1)) / S->blockLength;
+        im = (mult32x64(pState[1], pCoeffs[1]) << 1) / S->blockLength;
+
+        /* 1.31 x 1.31 products in 2.62 format */
+        power = (uint64_t) (re * re) + (uint64_t) (im * im);
+        power >>= 31U;
+        *pDst++ = (power > 0x7FFFFFFFU) ? 0x7FFFFFFF : (q31_t) power;
+
+        pState[0] = 0;
+        pState[1] = 0;
+
+        pCoeffs += 2U;
+        pState += 2U;
+        k--;
+      }
+
+      S->count = 0U;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_f32.c
+ * Description:  Floating-point mixed-radix real FFT processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point mixed-radix real FFT.
+  @param[in]     S              points to an instance of the floating-point mixed-radix RFFT structure
+  @param[in,out] p              points to the data buffer of size <code>fftLen</code>. Processing occurs in-place
+  @param[in]     pScratch       points to a scratch buffer of size <code>fftLen</code>
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: real FFT
+                   - value = 1: real inverse FFT
+  @return        none
+
+  @par           Details
+                   The forward transform packs the <code>fftLen/2 + 1</code> independent bins into
+                   <code>fftLen</code> values as \ref arm_rfft_fast_f32 does:
+                   <pre>{X[0].re, X[fftLen/2].re, X[1].re, X[1].im, ..., X[fftLen/2-1].re, X[fftLen/2-1].im}</pre>
+                   The inverse transform takes the same format and includes the scale of <code>1/fftLen</code>.
+  @par
+                   The samples are treated as <code>fftLen/2</code> complex values
+                   <code>z[n] = x[2n] + j*x[2n+1]</code>. After their complex FFT <code>Z</code>,
+                   each pair of bins <code>k</code> and <code>fftLen/2 - k</code> is split into
+                   the even and odd sample spectra <code>E[k] = (Z[k] + conj(Z[fftLen/2-k])) / 2</code>
+                   and <code>O[k] = -j * (Z[k] - conj(Z[fftLen/2-k])) / 2</code>, and
+                   <code>X[k] = E[k] + exp(-2j*pi*k/fftLen) * O[k]</code>.
+                   The inverse transform runs these steps backwards.
+ */
+
+void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+        float32_t * p,
+        float32_t * pScratch,
+        uint8_t ifftFlag)
+{
+  const float32_t *pTw = S->pTwiddleRFFT;          /* Split twiddles */
+        float32_t *pA, *pB;                        /* Bins k and fftLen/2 - k */
+        float32_t ar, ai, br, bi;
+        float32_t er, ei, dr, di, tr, ti;
+        float32_t c, s;
+        uint32_t halfLen = S->Sint.fftLen;         /* Length of the complex FFT */
+        uint32_t k;
+
+  if (ifftFlag == 0U)
+  {
+    arm_cfft_mixed_f32(&(S->Sint), p, pScratch, 0U);
+
+    /* X[0] and X[fftLen/2] are real */
+    ar = p[0];
+    ai = p[1];
+    p[0] = ar + ai;
+    p[1] = ar - ai;
+
+    for (k = 1U; 2U * k <= halfLen; k++)
+    {
+      pA = &p[2U * k];
+      pB = &p[2U * (halfLen - k)];
+      c = pTw[2U * k];
+      s = pTw[2U * k + 1U];
+
+      ar = pA[0];
+      ai = pA[1];
+      br = pB[0];
+      bi = pB[1];
+
+      /* E = (Z[k] + conj(Z[M-k])) / 2, D = (Z[k] - conj(Z[M-k])) / 2 */
+      er = 0.5f * (ar + br);
+      ei = 0.5f * (ai - bi);
+      dr = 0.5f * (ar - br);
+      di = 0.5f * (ai + bi);
+
+      /* O = -j * W^k * D with W^k = c - j * s, stored in t */
+      tr = c * di - s * dr;
+      ti = -(c * dr + s * di);
+
+      /* X[k] = E + O, X[M-k] = conj(E - O) */
+      pA[0] = er + tr;
+      pA[1] = ei + ti;
+      pB[0] = er - tr;
+      pB[1] = ti - ei;
+    }
+  }
+  else
+  {
+    /* Z[0] from the real X[0] and X[fftLen/2] */
+    ar = p[0];
+    ai = p[1];
+    p[0] = 0.5f * (ar + ai);
+    p[1] = 0.5f * (ar - ai);
+
+    for (k = 1U; 2U * k <= halfLen; k++)
+    {
+      pA = &p[2U * k];
+      pB = &p[2U * (halfLen - k)];
+      c = pTw[2U * k];
+      s = pTw[2U * k + 1U];
+
+      ar = pA[0];
+      ai = pA[1];
+      br = pB[0];
+      bi = pB[1];
+
+      /* E = (X[k] + conj(X[M-k])) / 2, D = (X[k] - conj(X[M-k])) / 2 */
+      er = 0.5f * (ar + br);
+      ei = 0.5f * (ai - bi);
+      dr = 0.5f * (ar - br);
+      di = 0.5f * (ai + bi);
+
+      /* O = D * W^-k with W^-k = c + j * s, stored in t */
+      tr = c * dr - s * di;
+      ti = c * di + s * dr;
+
+      /* Z[k] = E + j * O, Z[M-k] = conj(E) + j * conj(O) */
+      pA[0] = er - ti;
+      pA[1] = ei + tr;
+      pB[0] = er + ti;
+      pB[1] = tr - ei;
+    }
+
+    arm_cfft_mixed_f32(&(S->Sint), p, pScratch, 1U);
+  }
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_init_f32.c
+ * Description:  Initialization function for the floating-point mixed-radix real FFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+extern void arm_cfft_mixed_sin_cos_f32(
+  uint32_t num,
+  uint32_t den,
+  float32_t * pCos,
+  float32_t * pSin);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix real FFT.
+  @param[out]    S         points to an instance of the floating-point mixed-radix RFFT structure
+  @param[in]     fftLen    length of the real sequence, even with <code>fftLen/2</code> having prime factors 2, 3 and 5 only
+  @param[out]    pTwiddle  points to the twiddle plan buffer of size <code>2*fftLen</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+
+  @par           Details
+                   The first <code>fftLen</code> values of <code>pTwiddle</code> hold the plan of the
+                   internal complex FFT of length <code>fftLen/2</code>, the rest holds the
+                   <code>fftLen/4 + 1</code> {cos, sin} pairs of the split stage.
+ */
+
+arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle)
+{
+  arm_status status;
+  uint32_t k;
+
+  if ((fftLen < 2U) || ((fftLen & 1U) != 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_cfft_mixed_init_f32(&(S->Sint), fftLen >> 1U, pTwiddle);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = &pTwiddle[fftLen];
+
+  /* {cos, sin} of 2*pi*k/fftLen for k = 0..fftLen/4 */
+  for (k = 0U; k <= (uint32_t) fftLen / 4U; k++)
+  {
+    arm_cfft_mixed_sin_cos_f32(k, fftLen, &pTwiddle[fftLen + 2U * k], &pTwiddle[fftLen + 2U * k + 1U]);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
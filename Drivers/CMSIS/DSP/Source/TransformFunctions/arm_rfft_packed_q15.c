@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_packed_q15.c
+ * Description:  Q15 in-place real FFT with packed output
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @addtogroup RealFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 in-place RFFT/RIFFT with packed output.
+  @param[in]     S     points to an instance of the Q15 RFFT/RIFFT structure
+  @param[in,out] p     points to the data buffer of size <code>fftLenReal</code>. Processing occurs in-place
+  @return        none
+
+  @par           Details
+                   The instance is initialized by \ref arm_rfft_init_q15 and <code>ifftFlagR</code>
+                   selects the transform direction; the output is always in normal order and
+                   <code>bitReverseFlagR</code> is not used.
+  @par
+                   The forward transform packs the <code>fftLenReal/2 + 1</code> independent bins into
+                   <code>fftLenReal</code> values as \ref arm_rfft_fast_f32 does:
+                   <pre>{X[0].re, X[fftLenReal/2].re, X[1].re, X[1].im, ..., X[fftLenReal/2-1].re, X[fftLenReal/2-1].im}</pre>
+                   The inverse transform takes the same format. Compared to \ref arm_rfft_q15, which writes
+                   the full <code>2*fftLenReal</code> conjugate-symmetric spectrum to a separate buffer,
+                   no output buffer is needed and half of the stores are saved.
+  @par           Scaling and Overflow Behavior
+                   The bins have the same values and formats as the output of \ref arm_rfft_q15
+                   (see the tables of that function), and the inverse transform gives the same output.
+                   Each pair of bins <code>k</code> and <code>fftLenReal/2 - k</code> is computed from the
+                   same two values of the internal complex FFT, so the split runs in-place.
+ */
+
+void arm_rfft_packed_q15(
+  const arm_rfft_instance_q15 * S,
+        q15_t * p)
+{
+  const q15_t *pATable = S->pTwiddleAReal;         /* Split twiddle tables */
+  const q15_t *pBTable = S->pTwiddleBReal;
+  const q15_t *pCoefA, *pCoefB;                    /* Twiddles of the current bin */
+        q15_t *pA, *pB;                            /* Bins k and fftLenReal/2 - k */
+        q31_t ar, ai, br, bi;                      /* Input values of the two bins */
+        q31_t outR1, outI1, outR2, outI2;          /* Output values of the two bins */
+        uint32_t halfLen = S->fftLenReal >> 1U;    /* Length of the complex FFT */
+        uint32_t step = 2U * S->twidCoefRModifier; /* Twiddle table stride */
+        uint32_t k;
+
+  if (S->ifftFlagR == 0U)
+  {
+    arm_cfft_q15(S->pCfft, p, 0U, 1U);
+
+    /* X[0] and X[fftLenReal/2] are real */
+    ar = p[0];
+    ai = p[1];
+    p[0] = (q15_t) ((ar + ai) >> 1);
+    p[1] = (q15_t) ((ar - ai) >> 1);
+
+    for (k = 1U; 2U * k <= halfLen; k++)
+    {
+      pA = &p[2U * k];
+      pB = &p[2U * (halfLen - k)];
+
+      ar = pA[0];
+      ai = pA[1];
+      br = pB[0];
+      bi = pB[1];
+
+      /* X[k] = Z[k] * A[k] + conj(Z[M-k]) * B[k] */
+      pCoefA = &pATable[k * step];
+      pCoefB = &pBTable[k * step];
+      outR1 = ar * pCoefA[0] - ai * pCoefA[1] + br * pCoefB[0] + bi * pCoefB[1];
+      outI1 = ai * pCoefA[0] + ar * pCoefA[1] + br * pCoefB[1] - bi * pCoefB[0];
+
+      /* X[M-k] = Z[M-k] * A[M-k] + conj(Z[k]) * B[M-k] */
+      pCoefA = &pATable[(halfLen - k) * step];
+      pCoefB = &pBTable[(halfLen - k) * step];
+      outR2 = br * pCoefA[0] - bi * pCoefA[1] + ar * pCoefB[0] + ai * pCoefB[1];
+      outI2 = bi * pCoefA[0] + br * pCoefA[1] + ar * pCoefB[1] - ai * pCoefB[0];
+
+      pA[0] = (q15_t) (outR1 >> 16);
+      pA[1] = (q15_t) (outI1 >> 16);
+      pB[0] = (q15_t) (outR2 >> 16);
+      pB[1] = (q15_t) (outI2 >> 16);
+    }
+  }
+  else
+  {
+    /* Z[0] from the real X[0] and X[fftLenReal/2] */
+    ar = p[0];
+    br = p[1];
+    outR1 = ar * pATable[0] + br * pBTable[0];
+    outI1 = -ar * pATable[1] - br * pBTable[1];
+    p[0] = (q15_t) (outR1 >> 16);
+    p[1] = (q15_t) (outI1 >> 16);
+
+    for (k = 1U; 2U * k <= halfLen; k++)
+    {
+      pA = &p[2U * k];
+      pB = &p[2U * (halfLen - k)];
+
+      ar = pA[0];
+      ai = pA[1];
+      br = pB[0];
+      bi = pB[1];
+
+      /* Z[k] = X[k] * conj(A[k]) + conj(X[M-k] * B[k]) */
+      pCoefA = &pATable[k * step];
+      pCoefB = &pBTable[k * step];
+      outR1 = ar * pCoefA[0] + ai * pCoefA[1] + br * pCoefB[0] - bi * pCoefB[1];
+      outI1 = ai * pCoefA[0] - ar * pCoefA[1] - br * pCoefB[1] - bi * pCoefB[0];
+
+      /* Z[M-k] = X[M-k] * conj(A[M-k]) + conj(X[k] * B[M-k]) */
+      pCoefA = &pATable[(halfLen - k) * step];
+      pCoefB = &pBTable[(halfLen - k) * step];
+      outR2 = br * pCoefA[0] + bi * pCoefA[1] + ar * pCoefB[0] - ai * pCoefB[1];
+      outI2 = bi * pCoefA[0] - br * pCoefA[1] - ar * pCoefB[1] - ai * pCoefB[0];
+
+      pA[0] = (q15_t) (outR1 >> 16);
+      pA[1] = (q15_t) (outI1 >> 16);
+      pB[0] = (q15_t) (outR2 >> 16);
+      pB[1] = (q15_t) (outI2 >> 16);
+    }
+
+    arm_cfft_q15(S->pCfft, p, 1U, 1U);
+
+    for (k = 0U; k < S->fftLenReal; k++)
+    {
+      p[k] = p[k] << 1U;
+    }
+  }
+}
+
+/**
+  @} end of RealFFT group
+ */
@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_stream_init_q15.c
+ * Description:  Initialization function for the Q15 streaming real FFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup RealFFTStream
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 streaming real FFT.
+  @param[out]    S         points to an instance of the Q15 streaming real FFT structure
+  @param[in]     pRfft     points to a forward Q15 RFFT instance initialized by \ref arm_rfft_init_q15
+  @param[in]     hopSize   number of new samples between frames, from 1 to <code>fftLenReal</code>
+  @param[in]     pWindow   points to the window of length <code>fftLenReal</code>, or NULL for no window
+  @param[in]     pHistory  points to the sample ring of length <code>fftLenReal</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>pRfft</code> is an inverse transform or <code>hopSize</code> is out of range
+
+  @par           Details
+                   The sample ring is cleared by this function. The RFFT instance and the window
+                   are only read and may be shared between streams.
+ */
+
+arm_status arm_rfft_stream_init_q15(
+        arm_rfft_stream_instance_q15 * S,
+  const arm_rfft_instance_q15 * pRfft,
+        uint16_t hopSize,
+  const q15_t * pWindow,
+        q15_t * pHistory)
+{
+  if ((pRfft->ifftFlagR != 0U) || (hopSize == 0U) || (hopSize > pRfft->fftLenReal))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->hopSize = hopSize;
+  S->index = 0U;
+  S->count = 0U;
+  S->pRfft = pRfft;
+  S->pWindow = pWindow;
+  S->pHistory = pHistory;
+
+  memset(pHistory, 0, pRfft->fftLenReal * sizeof(q15_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of RealFFTStream group
+ */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_stream_q15.c
+ * Description:  Q15 windowed real FFT of a sample stream
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup RealFFTStream Streaming Real FFT
+
+  Computes the packed real FFT of overlapping, windowed frames of a sample stream.
+  The last <code>fftLenReal</code> samples are kept in a ring buffer, and every
+  <code>hopSize</code> new samples a frame is loaded from the ring into the output
+  buffer, multiplied by the window on the way, and transformed in-place by
+  \ref arm_rfft_packed_q15 or \ref arm_rfft_packed_q31.
+  Input blocks may have any length; frames may span several calls.
+
+  The frame buffer is the output buffer itself, so the only state besides the
+  instance is the ring of <code>fftLenReal</code> samples, and the samples are
+  neither shifted nor copied into a separate windowed frame.
+
+  @par           Algorithm
+  The ring starts zeroed, so the first frames contain leading zeros. Frame
+  <code>m</code> holds input samples <code>(m+1)*hopSize - fftLenReal</code> to
+  <code>(m+1)*hopSize - 1</code>, oldest first, multiplied by <code>pWindow[0]</code>
+  to <code>pWindow[fftLenReal-1]</code>.
+ */
+
+/**
+  @addtogroup RealFFTStream
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 streaming real FFT.
+  @param[in,out] S          points to an instance of the Q15 streaming real FFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the packed spectra, <code>fftLenReal</code> values per completed frame
+  @param[in]     blockSize  number of samples to process
+  @return        number of frames completed in this call
+
+  @par           Details
+                   <code>pDst</code> must hold <code>fftLenReal</code> values for each frame that can
+                   complete in the call, that is <code>ceil(blockSize / hopSize)</code> frames at most.
+                   Each spectrum has the packed format and scaling of \ref arm_rfft_packed_q15.
+  @par
+                   The window is applied with \ref arm_mult_q15, so the windowed samples are saturated.
+ */
+
+uint32_t arm_rfft_stream_q15(
+        arm_rfft_stream_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  const arm_rfft_instance_q15 *pRfft = S->pRfft;   /* Packed real FFT */
+        q15_t *pHistory = S->pHistory;              /* Sample ring */
+        uint32_t fftLen = pRfft->fftLenReal;         /* Frame length */
+        uint32_t segLen;                             /* Samples copied in one step */
+        uint32_t tail;                               /* Samples from the oldest one to the end of the ring */
+        uint32_t numFrames = 0U;                     /* Number of completed frames */
+
+  while (blockSize > 0U)
+  {
+    /* Copy up to the next frame and to the end of the ring */
+    segLen = (uint32_t) S->hopSize - S->count;
+    if (segLen > blockSize)
+    {
+      segLen = blockSize;
+    }
+    if (segLen > fftLen - S->index)
+    {
+      segLen = fftLen - S->index;
+    }
+
+    memcpy(&pHistory[S->index], pSrc, segLen * sizeof(q15_t));
+
+    pSrc += segLen;
+    blockSize -= segLen;
+    S->count += (uint16_t) segLen;
+    S->index += (uint16_t) segLen;
+    if (S->index == fftLen)
+    {
+      S->index = 0U;
+    }
+
+    if (S->count == S->hopSize)
+    {
+      /* Load the frame oldest sample first, the oldest sample is at the write index */
+      tail = fftLen - S->index;
+      if (S->pWindow != NULL)
+      {
+        arm_mult_q15(&pHistory[S->index], S->pWindow, pDst, tail);
+        arm_mult_q15(pHistory, &S->pWindow[tail], &pDst[tail], S->index);
+      }
+      else
+      {
+        memcpy(pDst, &pHistory[S->index], tail * sizeof(q15_t));
+        memcpy(&pDst[tail], pHistory, S->index * sizeof(q15_t));
+      }
+
+      arm_rfft_packed_q15(pRfft, pDst);
+
+      pDst += fftLen;
+      S->count = 0U;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+  @} end of RealFFTStream group
+ */
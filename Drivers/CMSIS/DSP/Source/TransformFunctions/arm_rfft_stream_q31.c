@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_stream_q31.c
+ * Description:  Q31 windowed real FFT of a sample stream
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup RealFFTStream
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 streaming real FFT.
+  @param[in,out] S          points to an instance of the Q31 streaming real FFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the packed spectra, <code>fftLenReal</code> values per completed frame
+  @param[in]     blockSize  number of samples to process
+  @return        number of frames completed in this call
+
+  @par           Details
+                   <code>pDst</code> must hold <code>fftLenReal</code> values for each frame that can
+                   complete in the call, that is <code>ceil(blockSize / hopSize)</code> frames at most.
+                   Each spectrum has the packed format and scaling of \ref arm_rfft_packed_q31.
+  @par
+                   The window is applied with \ref arm_mult_q31, so the windowed samples are saturated.
+ */
+
+uint32_t arm_rfft_stream_q31(
+        arm_rfft_stream_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  const arm_rfft_instance_q31 *pRfft = S->pRfft;   /* Packed real FFT */
+        q31_t *pHistory = S->pHistory;              /* Sample ring */
+        uint32_t fftLen = pRfft->fftLenReal;         /* Frame length */
+        uint32_t segLen;                             /* Samples copied in one step */
+        uint32_t tail;                               /* Samples from the oldest one to the end of the ring */
+        uint32_t numFrames = 0U;                     /* Number of completed frames */
+
+  while (blockSize > 0U)
+  {
+    /* Copy up to the next frame and to the end of the ring */
+    segLen = (uint32_t) S->hopSize - S->count;
+    if (segLen > blockSize)
+    {
+      segLen = blockSize;
+    }
+    if (segLen > fftLen - S->index)
+    {
+      segLen = fftLen - S->index;
+    }
+
+    memcpy(&pHistory[S->index], pSrc, segLen * sizeof(q31_t));
+
+    pSrc += segLen;
+    blockSize -= segLen;
+    S->count += (uint16_t) segLen;
+    S->index += (uint16_t) segLen;
+    if (S->index == fftLen)
+    {
+      S->index = 0U;
+    }
+
+    if (S->count == S->hopSize)
+    {
+      /* Load the frame oldest sample first, the oldest sample is at the write index */
+      tail = fftLen - S->index;
+      if (S->pWindow != NULL)
+      {
+        arm_mult_q31(&pHistory[S->index], S->pWindow, pDst, tail);
+        arm_mult_q31(pHistory, &S->pWindow[tail], &pDst[tail], S->index);
+      }
+      else
+      {
+        memcpy(pDst, &pHistory[S->index], tail * sizeof(q31_t));
+        memcpy(&pDst[tail], pHistory, S->index * sizeof(q31_t));
+      }
+
+      arm_rfft_packed_q31(pRfft, pDst);
+
+      pDst += fftLen;
+      S->count = 0U;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+  @} end of RealFFTStream group
+ */
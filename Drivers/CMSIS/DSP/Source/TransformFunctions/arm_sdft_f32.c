@@ -0,0 +1,224 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_f32.c
+ * Description:  Floating-point sliding DFT processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup SlidingDFT Sliding DFT
+
+  Tracks selected bins of an <code>fftLen</code>-point DFT over a window that slides
+  by one sample at a time. Recomputing the window with a complex FFT after every
+  sample costs O(N log2 N); the sliding DFT updates each tracked bin in O(1) per
+  sample, so K bins cost O(K) per sample independent of the window length.
+
+  @par           Algorithm
+                   The classic recursion <code>X = (X + x[n] - x[n-N]) * exp(j*2*pi*k/N)</code>
+                   multiplies the bin by a twiddle of inexact magnitude at every sample, so
+                   rounding errors build up without bound. These functions instead use the
+                   modulated form: each sample is multiplied by a twiddle indexed by its ring
+                   position <code>m = n mod N</code> and the window sum is accumulated as
+  <pre>
+      y = y + (x[n] - x[n-N]) * exp(-j*2*pi*k*m/N)
+  </pre>
+                   The incoming and outgoing samples of the same ring position use the same
+                   twiddle, so the contribution of a sample is removed exactly when it leaves
+                   the window in fixed-point arithmetic. The bin of the window starting at
+                   ring position <code>m</code> is recovered at output time by one rotation:
+  <pre>
+      X = y * exp(j*2*pi*k*m/N)
+  </pre>
+                   and equals bin <code>k</code> of an FFT of the last <code>fftLen</code> samples,
+                   oldest sample first.
+  @par
+                   In floating point the products of the incoming and outgoing samples round
+                   differently, so the floating-point version keeps two accumulators per bin: the
+                   sum over the samples received since the ring last wrapped, and the remainder of
+                   the previous revolution, from which outgoing samples are subtracted.
+                   At each wrap the first accumulator replaces the second and is cleared,
+                   which bounds the rounding error to one window length.
+  @par
+                   Samples are written to the ring only after all bins have been updated, and a
+                   block is split where the ring wraps. Each bin walks its twiddles with the
+                   stride <code>k</code> through one table of <code>fftLen</code> entries.
+  @par           Output
+                   Each call writes the <code>numBins</code> complex bins of the window ending at the last
+                   input sample to <code>pDst</code>, interleaved as {real, imag} in the order of
+                   <code>pBins</code>. Until <code>fftLen</code> samples have been received, the window
+                   is padded with zeros. Call the function with small blocks (down to one sample)
+                   to obtain a spectrum per sample.
+
+  @par           Instance Structure
+                   The twiddles, sample ring and accumulators are stored in an instance data structure.
+                   A separate instance structure must be defined for each sliding DFT.
+                   There are separate instance structure declarations for each of the 3 supported data types.
+
+  @par           Initialization Functions
+                   There is also an associated initialization function for each data type.
+                   The initialization function computes the twiddle table with \ref arm_sin_cos_f32
+                   and clears the sample ring and the accumulators.
+  @par
+                   Use of the initialization function is mandatory.
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point sliding DFT.
+  @param[in,out] S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the complex bins of the window ending at the last input sample
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling
+                   The output is not normalized, the same as the output of \ref arm_cfft_f32.
+ */
+
+void arm_sdft_f32(
+        arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pTwiddle = S->pTwiddle;         /* Twiddle table */
+        float32_t *pHistory = S->pHistory;         /* Sample ring */
+        float32_t *pState;                         /* Temporary pointer to the accumulators */
+  const float32_t *px, *pxOld;                     /* Temporary pointers to the incoming and outgoing samples */
+        float32_t curRe, curIm, remRe, remIm;      /* Accumulators of the current bin */
+        float32_t in, old, wr, wi;                 /* Temporary variables */
+        uint32_t fftLen = S->fftLen;               /* Window length */
+        uint32_t index = S->index;                 /* Ring position of the next sample */
+        uint32_t segLen, i, k;                     /* Segment length and loop counters */
+        uint32_t bin, idx;                         /* Bin index and twiddle index */
+
+  while (blockSize > 0U)
+  {
+    /* Process up to the end of the ring */
+    segLen = fftLen - index;
+    if (segLen > blockSize)
+    {
+      segLen = blockSize;
+    }
+
+    pState = S->pState;
+    for (k = 0U; k < S->numBins; k++)
+    {
+      bin = S->pBins[k];
+      idx = (bin * index) % fftLen;
+
+      curRe = pState[0];
+      curIm = pState[1];
+      remRe = pState[2];
+      remIm = pState[3];
+
+      px = pSrc;
+      pxOld = &pHistory[index];
+      i = segLen;
+      while (i > 0U)
+      {
+        in = *px++;
+        old = *pxOld++;
+        wr = pTwiddle[2U * idx];
+        wi = pTwiddle[2U * idx + 1U];
+
+        /* Add x[n] * exp(-j*w*m), remove x[n-N] * exp(-j*w*m) */
+        curRe += in * wr;
+        curIm -= in * wi;
+        remRe -= old * wr;
+        remIm += old * wi;
+
+        idx += bin;
+        if (idx >= fftLen)
+        {
+          idx -= fftLen;
+        }
+
+        i--;
+      }
+
+      pState[0] = curRe;
+      pState[1] = curIm;
+      pState[2] = remRe;
+      pState[3] = remIm;
+      pState += 4U;
+    }
+
+    /* Store the segment in the ring */
+    memcpy(&pHistory[index], pSrc, segLen * sizeof(float32_t));
+
+    pSrc += segLen;
+    blockSize -= segLen;
+    index += segLen;
+
+    if (index == fftLen)
+    {
+      /* Ring wrapped: the current revolution becomes the remainder */
+      index = 0U;
+      pState = S->pState;
+      for (k = 0U; k < S->numBins; k++)
+      {
+        pState[2] = pState[0];
+        pState[3] = pState[1];
+        pState[0] = 0.0f;
+        pState[1] = 0.0f;
+        pState += 4U;
+      }
+    }
+  }
+
+  S->index = (uint16_t) index;
+
+  /* X = y * exp(j*w*m), with m the ring position of the oldest sample */
+  pState = S->pState;
+  for (k = 0U; k < S->numBins; k++)
+  {
+    idx = ((uint32_t) S->pBins[k] * index) % fftLen;
+    wr = pTwiddle[2U * idx];
+    wi = pTwiddle[2U * idx + 1U];
+
+    curRe = pState[0] + pState[2];
+    curIm = pState[1] + pState[3];
+
+    *pDst++ = curRe * wr - curIm * wi;
+    *pDst++ = curRe * wi + curIm * wr;
+
+    pState += 4U;
+  }
+}
+
+/**
+  @} end of SlidingDFT group
+ */
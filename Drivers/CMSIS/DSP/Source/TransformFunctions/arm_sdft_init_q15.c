@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_q15.c
+ * Description:  Q15 sliding DFT initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 sliding DFT.
+  @param[in,out] S         points to an instance of the Q15 sliding DFT structure
+  @param[in]     fftLen    length of the sliding window
+  @param[in]     numBins   number of tracked bins
+  @param[in]     pBins     points to the tracked bin indices
+  @param[in]     pTwiddle  points to the twiddle buffer
+  @param[in]     pHistory  points to the sample ring
+  @param[in]     pState    points to the state buffer
+  @return        none
+
+  @par           Details
+                   <code>pBins</code> is of length <code>numBins</code> and holds bin indices less than
+                   <code>fftLen</code>; it is referenced, not copied. Any <code>fftLen</code> is supported.
+  @par
+                   <code>pTwiddle</code> is of length <code>2*fftLen</code> and is filled with
+                   {cos, sin} pairs in 1.15 format of <code>2*pi*m/fftLen</code>. It depends on <code>fftLen</code> only
+                   and may be shared by instances of the same length.
+  @par
+                   <code>pHistory</code> is of length <code>fftLen</code> and <code>pState</code> of length
+                   <code>2*numBins</code>; both are cleared.
+ */
+
+void arm_sdft_init_q15(
+        arm_sdft_instance_q15 * S,
+        uint16_t fftLen,
+        uint16_t numBins,
+  const uint16_t * pBins,
+        q15_t * pTwiddle,
+        q15_t * pHistory,
+        q63_t * pState)
+{
+  float32_t sinVal, cosVal;
+  int32_t m, a;
+
+  S->fftLen = fftLen;
+  S->numBins = numBins;
+  S->index = 0U;
+  S->pBins = pBins;
+  S->pTwiddle = pTwiddle;
+  S->pHistory = pHistory;
+  S->pState = pState;
+
+  for (m = 0; m < (int32_t) fftLen; m++)
+  {
+    /* Angle 2*pi*m/N in degrees, folded to (-180, 180] */
+    a = (2 * m > (int32_t) fftLen) ? (m - (int32_t) fftLen) : m;
+    arm_sin_cos_f32(360.0f * (float32_t) a / (float32_t) fftLen, &sinVal, &cosVal);
+
+    pTwiddle[2 * m] = (q15_t) __SSAT((q31_t) (cosVal * 32768.0f + ((cosVal > 0.0f) ? 0.5f : -0.5f)), 16);
+    pTwiddle[2 * m + 1] = (q15_t) __SSAT((q31_t) (sinVal * 32768.0f + ((sinVal > 0.0f) ? 0.5f : -0.5f)), 16);
+  }
+
+  memset(pHistory, 0, fftLen * sizeof(q15_t));
+  memset(pState, 0, 2U * numBins * sizeof(q63_t));
+}
+
+/**
+  @} end of SlidingDFT group
+ */
@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q15.c
+ * Description:  Q15 sliding DFT processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 sliding DFT.
+  @param[in,out] S          points to an instance of the Q15 sliding DFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the complex bins of the window ending at the last input sample
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The products of the sample differences and the 1.15 twiddles are exact
+                   and are accumulated in 2.30 format in 64-bit accumulators, which cannot overflow.
+  @par
+                   The output is <code>X / fftLen</code> in 1.15 format and is saturated.
+                   This matches the scaling of \ref arm_cfft_q15, whose output of
+                   an <code>fftLen</code>-point transform is also <code>X / fftLen</code>.
+ */
+
+void arm_sdft_q15(
+        arm_sdft_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  const q15_t *pTwiddle = S->pTwiddle;             /* Twiddle table */
+        q15_t *pHistory = S->pHistory;             /* Sample ring */
+        q63_t *pState;                             /* Temporary pointer to the accumulators */
+  const q15_t *px, *pxOld;                         /* Temporary pointers to the incoming and outgoing samples */
+        q63_t accRe, accIm;                        /* Accumulators of the current bin */
+        q31_t diff, re, im;                        /* Temporary variables */
+        q15_t wr, wi;                              /* Twiddle of the current sample */
+        uint32_t fftLen = S->fftLen;               /* Window length */
+        uint32_t index = S->index;                 /* Ring position of the next sample */
+        uint32_t segLen, i, k;                     /* Segment length and loop counters */
+        uint32_t bin, idx;                         /* Bin index and twiddle index */
+
+  while (blockSize > 0U)
+  {
+    /* Process up to the end of the ring */
+    segLen = fftLen - index;
+    if (segLen > blockSize)
+    {
+      segLen = blockSize;
+    }
+
+    pState = S->pState;
+    for (k = 0U; k < S->numBins; k++)
+    {
+      bin = S->pBins[k];
+      idx = (bin * index) % fftLen;
+
+      accRe = pState[0];
+      accIm = pState[1];
+
+      px = pSrc;
+      pxOld = &pHistory[index];
+      i = segLen;
+      while (i > 0U)
+      {
+        /* x[n] - x[n-N] fits in 17 bits, the product with a 1.15 twiddle in 32 bits */
+        diff = (q31_t) *px++ - *pxOld++;
+        wr = pTwiddle[2U * idx];
+        wi = pTwiddle[2U * idx + 1U];
+
+        accRe += (q31_t) (diff * wr);
+        accIm -= (q31_t) (diff * wi);
+
+        idx += bin;
+        if (idx >= fftLen)
+        {
+          idx -= fftLen;
+        }
+
+        i--;
+      }
+
+      pState[0] = accRe;
+      pState[1] = accIm;
+      pState += 2U;
+    }
+
+    /* Store the segment in the ring */
+    memcpy(&pHistory[index], pSrc, segLen * sizeof(q15_t));
+
+    pSrc += segLen;
+    blockSize -= segLen;
+    index += segLen;
+
+    if (index == fftLen)
+    {
+      index = 0U;
+    }
+  }
+
+  S->index = (uint16_t) index;
+
+  /* X = y * exp(j*w*m), with m the ring position of the oldest sample */
+  pState = S->pState;
+  for (k = 0U; k < S->numBins; k++)
+  {
+    idx = ((uint32_t) S->pBins[k] * index) % fftLen;
+    wr = pTwiddle[2U * idx];
+    wi = pTwiddle[2U * idx + 1U];
+
+    /* y / N in 2.30 format */
+    re = (q31_t) (pState[0] / (q63_t) fftLen);
+    im = (q31_t) (pState[1] / (q63_t) fftLen);
+
+    *pDst++ = (q15_t) __SSAT((q31_t) (((q63_t) re * wr - (q63_t) im * wi) >> 30), 16);
+    *pDst++ = (q15_t) __SSAT((q31_t) (((q63_t) re * wi + (q63_t) im * wr) >> 30), 16);
+
+    pState += 2U;
+  }
+}
+
+/**
+  @} end of SlidingDFT group
+ */
@@ -0,0 +1,158 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q31.c
+ * Description:  Q31 sliding DFT processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2026 createskyblue@outlook.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 sliding DFT.
+  @param[in,out] S          points to an instance of the Q31 sliding DFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the complex bins of the window ending at the last input sample
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The products of the samples and the 1.31 twiddles are truncated to 2.30 format
+                   and accumulated in 64-bit accumulators, which cannot overflow.
+                   The incoming and outgoing products of a sample are truncated identically, so they cancel exactly.
+  @par
+                   The output is <code>X / fftLen</code> in 1.31 format and is saturated.
+                   This matches the scaling of \ref arm_cfft_q31, whose output of
+                   an <code>fftLen</code>-point transform is also <code>X / fftLen</code>.
+ */
+
+void arm_sdft_q31(
+        arm_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  const q31_t *pTwiddle = S->pTwiddle;             /* Twiddle table */
+        q31_t *pHistory = S->pHistory;             /* Sample ring */
+        q63_t *pState;                             /* Temporary pointer to the accumulators */
+  const q31_t *px, *pxOld;                         /* Temporary pointers to the incoming and outgoing samples */
+        q63_t accRe, accIm;                        /* Accumulators of the current bin */
+        q31_t in, old, wr, wi;                     /* Temporary variables */
+        uint32_t fftLen = S->fftLen;               /* Window length */
+        uint32_t index = S->index;                 /* Ring position of the next sample */
+        uint32_t segLen, i, k;                     /* Segment length and loop counters */
+        uint32_t bin, idx;                         /* Bin index and twiddle index */
+
+  while (blockSize > 0U)
+  {
+    /* Process up to the end of the ring */
+    segLen = fftLen - index;
+    if (segLen > blockSize)
+    {
+      segLen = blockSize;
+    }
+
+    pState = S->pState;
+    for (k = 0U; k < S->numBins; k++)
+    {
+      bin = S->pBins[k];
+      idx = (bin * index) % fftLen;
+
+      accRe = pState[0];
+      accIm = pState[1];
+
+      px = pSrc;
+      pxOld = &pHistory[index];
+      i = segLen;
+      while (i > 0U)
+      {
+        in = *px++;
+        old = *pxOld++;
+        wr = pTwiddle[2U * idx];
+        wi = pTwiddle[2U * idx + 1U];
+
+        /* Add x[n] * exp(-j*w*m), remove x[n-N] * exp(-j*w*m) */
+        accRe += (((q63_t) in * wr) >> 32) - (((q63_t) old * wr) >> 32);
+        accIm -= (((q63_t) in * wi) >> 32) - (((q63_t) old * wi) >> 32);
+
+        idx += bin;
+        if (idx >= fftLen)
+        {
+          idx -= fftLen;
+        }
+
+        i--;
+      }
+
+      pState[0] = accRe;
+      pState[1] = accIm;
+      pState += 2U;
+    }
+
+    /* Store the segment in the ring */
+    memcpy(&pHistory[index], pSrc, segLen * sizeof(q31_t));
+
+    pSrc += segLen;
+    blockSize -= segLen;
+    index += segLen;
+
+    if (index == fftLen)
+    {
+      index = 0U;
+    }
+  }
+
+  S->index = (uint16_t) index;
+
+  /* X = y * exp(j*w*m), with m the ring position of the oldest sample */
+  pState = S->pState;
+  for (k = 0U; k < S->numBins; k++)
+  {
+    idx = ((uint32_t) S->pBins[k] * index) % fftLen;
+    wr = pTwiddle[2U * idx];
+    wi = pTwiddle[2U * idx + 1U];
+
+    /* y / N from 2.30 to 1.31 format */
+    accRe = (pState[0] * 2) / (q63_t) fftLen;
+    accIm = (pState[1] * 2) / (q63_t) fftLen;
+
+    *pDst++ = clip_q63_to_q31((accRe * wr - accIm * wi) >> 31);
+    *pDst++ = clip_q63_to_q31((accRe * wi + accIm * wr) >> 31);
+
+    pState += 2U;
+  }
+}
+
+/**
+  @} end of SlidingDFT group
+ */
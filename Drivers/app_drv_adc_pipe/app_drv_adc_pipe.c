@@ -0,0 +1,169 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    app_drv_adc_pipe.c
+ * @brief   ADC DMA 采样流水线
+ * @note    定时器触发 + 硬件过采样 + DMA 双块缓冲，按块做校准换算
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include "app_drv_adc_pipe.h"
+
+// 数据手册典型值：30 °C 时 0.76 V，斜率 2.5 mV/°C，用于校准值缺失时
+#define ADC_PIPE_TYPICAL_CAL1   (1038U)
+#define ADC_PIPE_TYPICAL_CAL2   (1379U)
+
+/**
+ * @brief 由校准值计算整块换算参数
+ * @param cal 输出参数
+ * @param cal1 TS_CAL1（30 °C，3.0 V 下 12 位读数）
+ * @param cal2 TS_CAL2（TEMPSENSOR_CAL2_TEMP，3.0 V 下 12 位读数）
+ * @param vdda_mv 实际 VDDA（毫伏）
+ */
+void ADC_Pipe_ComputeCalibration(ADC_Pipe_Calibration* cal, uint16_t cal1, uint16_t cal2, uint32_t vdda_mv)
+{
+    uint64_t num;
+    uint64_t den;
+    int8_t shift = 0;
+
+    if (cal2 <= cal1 || vdda_mv == 0U) {
+        cal1 = ADC_PIPE_TYPICAL_CAL1;
+        cal2 = ADC_PIPE_TYPICAL_CAL2;
+    }
+
+    // 30 °C 对应的过采样原始值：cal1 * 3000 / VDDA * 8
+    cal->input_offset = (q15_t)(-(int32_t)(((uint32_t)cal1 * TEMPSENSOR_CAL_VREFANALOG * ADC_PIPE_OVERSAMPLE_GAIN + vdda_mv / 2U) / vdda_mv));
+
+    // 斜率（输出 LSB / 原始 LSB）= 256 * VDDA * (T2 - T1) / (3000 * 8 * (cal2 - cal1))
+    num = (uint64_t)ADC_PIPE_TEMP_LSB_PER_C * vdda_mv * (uint32_t)(TEMPSENSOR_CAL2_TEMP - TEMPSENSOR_CAL1_TEMP);
+    den = (uint64_t)TEMPSENSOR_CAL_VREFANALOG * ADC_PIPE_OVERSAMPLE_GAIN * (uint32_t)(cal2 - cal1);
+
+    // 拆成 q15 小数 * 2^shift，小数部分落在 [0.5, 1)
+    while (num >= (den << shift)) {
+        shift++;
+    }
+    cal->scale_shift = shift;
+    cal->scale_fract = (q15_t)((num * 32768U + (den << shift) / 2U) / (den << shift));
+    if (cal->scale_fract < 0) {
+        // 四舍五入进位到 1.0，改用下一档移位
+        cal->scale_shift = (int8_t)(shift + 1);
+        cal->scale_fract = 0x4000;
+    }
+
+    cal->output_offset = (q15_t)(TEMPSENSOR_CAL1_TEMP * ADC_PIPE_TEMP_LSB_PER_C);
+}
+
+/**
+ * @brief 整块换算
+ * @param cal 换算参数
+ * @param src 原始过采样值（15 位，可视为非负 q15）
+ * @param dst 输出温度，可与 src 相同
+ * @param length 点数
+ */
+void ADC_Pipe_Convert(const ADC_Pipe_Calibration* cal, const uint16_t* src, q15_t* dst, uint16_t length)
+{
+    arm_offset_q15((q15_t*)src, cal->input_offset, dst, length);
+    arm_scale_q15(dst, cal->scale_fract, cal->scale_shift, dst, length);
+    arm_offset_q15(dst, cal->output_offset, dst, length);
+}
+
+/**
+ * @brief 处理 DMA 刚写满的一块
+ * @param ctx 指向 ADC_Pipe_Context 结构体的指针
+ * @param half 0：前半块，1：后半块
+ */
+static void ADC_Pipe_ProcessBlock(ADC_Pipe_Context* ctx, uint8_t half)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t pos;
+
+    ADC_Pipe_Convert(&ctx->cal, &ctx->dma_buffer[half * ADC_PIPE_BLOCK_SIZE], ctx->output, ADC_PIPE_BLOCK_SIZE);
+
+    ctx->convert_cycles_last = DWT->CYCCNT - start;
+    if (ctx->convert_cycles_last > ctx->convert_cycles_max) {
+        ctx->convert_cycles_max = ctx->convert_cycles_last;
+    }
+    ctx->block_count++;
+
+    // DMA 应在另一半写入，否则换算期间数据已被覆盖
+    pos = 2U * ADC_PIPE_BLOCK_SIZE - __HAL_DMA_GET_COUNTER(ctx->hadc->DMA_Handle);
+    if ((half == 0U) ? (pos < ADC_PIPE_BLOCK_SIZE) : (pos >= ADC_PIPE_BLOCK_SIZE)) {
+        ctx->overrun_count++;
+    }
+
+    if (ctx->block_callback != NULL) {
+        ctx->block_callback(ctx->block_user, ctx->output, ADC_PIPE_BLOCK_SIZE);
+    }
+}
+
+/**
+ * @brief 初始化 ADC 采样流水线
+ * @param ctx 指向 ADC_Pipe_Context 结构体的指针
+ * @param hadc 已初始化的 ADC（触发源为 htim 的 TRGO，DMA 循环模式）
+ * @param htim 触发定时器
+ */
+void ADC_Pipe_Init(ADC_Pipe_Context* ctx, ADC_HandleTypeDef* hadc, TIM_HandleTypeDef* htim)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->hadc = hadc;
+    ctx->htim = htim;
+
+    ADC_Pipe_ComputeCalibration(&ctx->cal, *TEMPSENSOR_CAL1_ADDR, *TEMPSENSOR_CAL2_ADDR, ADC_PIPE_VDDA_MV);
+
+    // 使能 DWT 周期计数器，用于换算耗时统计
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    HAL_ADCEx_Calibration_Start(ctx->hadc, ADC_SINGLE_ENDED);
+}
+
+/**
+ * @brief 注册块回调函数
+ */
+void ADC_Pipe_RegisterBlockCallback(ADC_Pipe_Context* ctx, ADC_Pipe_Block_Func func, void* user)
+{
+    ctx->block_callback = func;
+    ctx->block_user = user;
+}
+
+/**
+ * @brief 启动采样
+ */
+HAL_StatusTypeDef ADC_Pipe_Start(ADC_Pipe_Context* ctx)
+{
+    HAL_StatusTypeDef status;
+
+    status = HAL_ADC_Start_DMA(ctx->hadc, (uint32_t*)ctx->dma_buffer, 2U * ADC_PIPE_BLOCK_SIZE);
+    if (status != HAL_OK) {
+        return status;
+    }
+    return HAL_TIM_Base_Start(ctx->htim);
+}
+
+/**
+ * @brief 停止采样
+ */
+void ADC_Pipe_Stop(ADC_Pipe_Context* ctx)
+{
+    HAL_TIM_Base_Stop(ctx->htim);
+    HAL_ADC_Stop_DMA(ctx->hadc);
+}
+
+/**
+ * @brief DMA 半传输完成：处理前半块
+ */
+void ADC_Pipe_HalfComplete(ADC_Pipe_Context* ctx)
+{
+    ADC_Pipe_ProcessBlock(ctx, 0);
+}
+
+/**
+ * @brief DMA 传输完成：处理后半块
+ */
+void ADC_Pipe_Complete(ADC_Pipe_Context* ctx)
+{
+    ADC_Pipe_ProcessBlock(ctx, 1);
+}
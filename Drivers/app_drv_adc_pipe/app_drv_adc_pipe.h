@@ -0,0 +1,82 @@
+#ifndef APP_DRV_ADC_PIPE_H_
+#define APP_DRV_ADC_PIPE_H_
+
+#include <stdint.h>
+#include "main.h"
+#include "arm_math.h"
+
+/*
+ * 定时器触发 ADC 采样流水线
+ *
+ * TIM TRGO 触发 ADC，硬件过采样 16 次后右移 1 位（15 位结果，可直接视为非负 q15），
+ * DMA 循环写入双块缓冲区；半传输/传输完成中断中对刚写满的一块做整块校准换算：
+ *   y = ((x - x30) * scale) + 30 °C
+ * 依次调用 arm_offset_q15 / arm_scale_q15 / arm_offset_q15，不逐点计算。
+ *
+ * 输出格式：q15，1 LSB = 1/256 °C（满量程 ±128 °C）。
+ * 校准参数由出厂 TS_CAL1/TS_CAL2（3.0 V 下测得）和实际 VDDA 计算。
+ */
+
+// 每块采样点数（DMA 缓冲区为 2 块）
+#ifndef ADC_PIPE_BLOCK_SIZE
+  #define ADC_PIPE_BLOCK_SIZE   (64U)
+#endif
+
+// 实际 VDDA（毫伏）
+#ifndef ADC_PIPE_VDDA_MV
+  #define ADC_PIPE_VDDA_MV      (3300U)
+#endif
+
+#define ADC_PIPE_OVERSAMPLE_GAIN  (8)     // 16 倍过采样右移 1 位，相对 12 位结果的增益
+#define ADC_PIPE_TEMP_LSB_PER_C   (256)   // 输出每摄氏度的 LSB 数
+
+// 整块换算参数
+typedef struct {
+    q15_t input_offset;     // -x30：30 °C 对应的原始值取负
+    q15_t scale_fract;      // 斜率小数部分
+    int8_t scale_shift;     // 斜率移位
+    q15_t output_offset;    // 30 °C 对应的输出值
+} ADC_Pipe_Calibration;
+
+// 块回调函数类型定义（在 DMA 中断中调用）
+typedef void (*ADC_Pipe_Block_Func)(void* user, const q15_t* block, uint16_t length);
+
+// ADC 流水线上下文结构体
+typedef struct {
+    ADC_HandleTypeDef* hadc;
+    TIM_HandleTypeDef* htim;
+    uint16_t dma_buffer[2U * ADC_PIPE_BLOCK_SIZE];
+    q15_t output[ADC_PIPE_BLOCK_SIZE];
+    ADC_Pipe_Calibration cal;
+
+    ADC_Pipe_Block_Func block_callback;
+    void* block_user;
+
+    // 统计
+    uint32_t block_count;           // 已处理的块数
+    uint32_t overrun_count;         // 处理结束时 DMA 已回绕写入该块的次数
+    uint32_t convert_cycles_last;   // 最近一块换算耗时，DWT 周期
+    uint32_t convert_cycles_max;
+} ADC_Pipe_Context;
+
+// 初始化：计算校准参数并执行 ADC 自校准
+void ADC_Pipe_Init(ADC_Pipe_Context* ctx, ADC_HandleTypeDef* hadc, TIM_HandleTypeDef* htim);
+
+// 注册块回调函数
+void ADC_Pipe_RegisterBlockCallback(ADC_Pipe_Context* ctx, ADC_Pipe_Block_Func func, void* user);
+
+// 启动/停止采样
+HAL_StatusTypeDef ADC_Pipe_Start(ADC_Pipe_Context* ctx);
+void ADC_Pipe_Stop(ADC_Pipe_Context* ctx);
+
+// 在 HAL_ADC_ConvHalfCpltCallback / HAL_ADC_ConvCpltCallback 中调用
+void ADC_Pipe_HalfComplete(ADC_Pipe_Context* ctx);
+void ADC_Pipe_Complete(ADC_Pipe_Context* ctx);
+
+// 由校准值计算换算参数（cal1/cal2 为 3.0 V 下 12 位读数）
+void ADC_Pipe_ComputeCalibration(ADC_Pipe_Calibration* cal, uint16_t cal1, uint16_t cal2, uint32_t vdda_mv);
+
+// 整块换算：原始过采样值 -> 温度（q15，1/256 °C）
+void ADC_Pipe_Convert(const ADC_Pipe_Calibration* cal, const uint16_t* src, q15_t* dst, uint16_t length);
+
+#endif /* APP_DRV_ADC_PIPE_H_ */
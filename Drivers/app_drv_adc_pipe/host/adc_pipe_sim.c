@@ -0,0 +1,393 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    adc_pipe_sim.c
+ * @brief   ADC 采样流水线主机端模拟（Linux / macOS）
+ * @note    与固件共用 app_drv_adc_pipe.c，CMSIS-DSP 按通用 C 实现编译，同目录的 main.h 替代 HAL：
+ *            cc -O2 -I. -I.. -I../../CMSIS/DSP/Include -I../../CMSIS/Core/Include -o adc_pipe_sim adc_pipe_sim.c \
+ *               ../app_drv_adc_pipe.c ../../CMSIS/DSP/Source/BasicMathFunctions/arm_offset_q15.c \
+ *               ../../CMSIS/DSP/Source/BasicMathFunctions/arm_scale_q15.c -lm
+ *
+ *          模拟的 ADC 源：内部温度传感器按本片校准值 (TS_CAL1/TS_CAL2，3.0 V) 线性输出，
+ *          VDDA = ADC_PIPE_VDDA_MV，每次 12 位转换叠加高斯噪声并量化，16 次过采样求和右移 1 位；
+ *          TIM6 触发速率 10 kHz，DMA 循环写入双块缓冲区，半满/全满时调用 ADC_Pipe_HalfComplete/Complete，
+ *          可设置中断延迟 (期间 DMA 继续写入)。用例：
+ *            accuracy  -40 ~ 125 °C 扫描：定点整块换算与浮点公式的差、块均值与真实温度的差
+ *            overrun   不同中断延迟下的 overrun_count，超过一块时间才应计数
+ *            speed     不同块长的整块换算吞吐，与逐点浮点换算对比
+ *
+ *            adc_pipe_sim [-s seed] [-e noise_lsb] [accuracy|overrun|speed]
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "app_drv_adc_pipe.h"
+
+#define SIM_RATE_HZ             (10000U)    // TIM6：80 MHz / 80 / 100
+#define SIM_CAL1                (1046U)     // 本片 TS_CAL1（典型值 1038）
+#define SIM_CAL2                (1391U)     // 本片 TS_CAL2（典型值 1379）
+#define SIM_PENDING_MAX         (8U)
+
+// 模拟的 ADC + DMA
+typedef struct {
+    uint16_t* buffer;
+    uint32_t length;
+    uint32_t pos;               // DMA 写指针
+    uint8_t adc_running;
+    uint8_t tim_running;
+    double temperature;         // 芯片温度
+    double noise_lsb;           // 单次 12 位转换的噪声 (rms)
+    uint32_t latency;           // 中断延迟（采样数）
+    uint64_t samples;
+    struct {
+        uint64_t due;
+        uint8_t half;
+    } pending[SIM_PENDING_MAX];
+    uint8_t pending_count;
+    uint8_t half;               // 正在处理的半块
+} Sim_Adc;
+
+// 块回调中的统计
+typedef struct {
+    double max_convert_error;   // 定点换算与浮点公式之差（°C）
+    double max_mean_error;      // 块均值与真实温度之差（°C）
+    uint32_t blocks;
+} Sim_Stats;
+
+uint16_t host_ts_cal[2] = { SIM_CAL1, SIM_CAL2 };
+CoreDebug_Type host_core_debug;
+
+static DMA_HandleTypeDef sim_hdma;
+static ADC_HandleTypeDef sim_hadc = { &sim_hdma };
+static TIM_HandleTypeDef sim_htim;
+static ADC_Pipe_Context adc_pipe;
+static Sim_Adc adc;
+static Sim_Stats stats;
+static volatile float sim_sink;    // 防止浮点对照循环被优化掉
+
+static uint64_t Sim_NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+DWT_Type* Host_Dwt(void)
+{
+    static DWT_Type dwt;
+
+    dwt.CYCCNT = (uint32_t)Sim_NowNs();
+    return &dwt;
+}
+
+/* ----------------------------------------------------------------------------
+ * HAL 替身
+ * ------------------------------------------------------------------------- */
+
+HAL_StatusTypeDef HAL_ADCEx_Calibration_Start(ADC_HandleTypeDef* hadc, uint32_t single_diff)
+{
+    (void)hadc;
+    (void)single_diff;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef* hadc, uint32_t* data, uint32_t length)
+{
+    adc.buffer = (uint16_t*)data;
+    adc.length = length;
+    adc.pos = 0;
+    adc.pending_count = 0;
+    adc.adc_running = 1;
+    hadc->DMA_Handle->counter = length;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef* hadc)
+{
+    (void)hadc;
+    adc.adc_running = 0;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef* htim)
+{
+    htim->running = 1;
+    adc.tim_running = 1;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef* htim)
+{
+    htim->running = 0;
+    adc.tim_running = 0;
+    return HAL_OK;
+}
+
+/* ----------------------------------------------------------------------------
+ * 模拟 ADC 源
+ * ------------------------------------------------------------------------- */
+
+static double Sim_Gaussian(void)
+{
+    double u = drand48(), v = drand48();
+
+    return sqrt(-2.0 * log(1.0 - u)) * cos(2.0 * M_PI * v);
+}
+
+/**
+ * @brief 一次 12 位转换：传感器电压按校准点线性插值，折算到实际 VDDA
+ */
+static int32_t Sim_Convert12(double temperature)
+{
+    double code = SIM_CAL1 + (double)(SIM_CAL2 - SIM_CAL1) * (temperature - TEMPSENSOR_CAL1_TEMP)
+                  / (double)(TEMPSENSOR_CAL2_TEMP - TEMPSENSOR_CAL1_TEMP);
+    int32_t out;
+
+    code = code * TEMPSENSOR_CAL_VREFANALOG / ADC_PIPE_VDDA_MV + adc.noise_lsb * Sim_Gaussian();
+    out = (int32_t)lrint(code);
+    return (out < 0) ? 0 : (out > 4095) ? 4095 : out;
+}
+
+// 硬件过采样：16 次求和右移 1 位
+static uint16_t Sim_Oversample(double temperature)
+{
+    int32_t sum = 0;
+    int i;
+
+    for (i = 0; i < 16; i++) {
+        sum += Sim_Convert12(temperature);
+    }
+    return (uint16_t)(sum >> 1);
+}
+
+// 浮点参考换算
+static double Sim_Reference(uint16_t raw)
+{
+    double code12 = raw / (double)ADC_PIPE_OVERSAMPLE_GAIN * ADC_PIPE_VDDA_MV / TEMPSENSOR_CAL_VREFANALOG;
+
+    return TEMPSENSOR_CAL1_TEMP + (code12 - SIM_CAL1) * (TEMPSENSOR_CAL2_TEMP - TEMPSENSOR_CAL1_TEMP)
+           / (double)(SIM_CAL2 - SIM_CAL1);
+}
+
+/**
+ * @brief 一次定时器触发：DMA 写入一个采样，到达半满/全满时登记中断，延迟到期后调用回调
+ */
+static void Sim_Trigger(void)
+{
+    uint8_t i;
+
+    if (!adc.adc_running || !adc.tim_running) {
+        return;
+    }
+    adc.buffer[adc.pos++] = Sim_Oversample(adc.temperature);
+    adc.samples++;
+    if (adc.pos == adc.length / 2U || adc.pos == adc.length) {
+        if (adc.pending_count < SIM_PENDING_MAX) {
+            adc.pending[adc.pending_count].due = adc.samples + adc.latency;
+            adc.pending[adc.pending_count].half = (adc.pos == adc.length) ? 1U : 0U;
+            adc.pending_count++;
+        }
+        if (adc.pos == adc.length) {
+            adc.pos = 0;
+        }
+    }
+    sim_hdma.counter = adc.length - adc.pos;
+
+    while (adc.pending_count > 0 && adc.pending[0].due <= adc.samples) {
+        adc.half = adc.pending[0].half;
+        for (i = 1; i < adc.pending_count; i++) {
+            adc.pending[i - 1U] = adc.pending[i];
+        }
+        adc.pending_count--;
+        if (adc.half == 0U) {
+            ADC_Pipe_HalfComplete(&adc_pipe);
+        } else {
+            ADC_Pipe_Complete(&adc_pipe);
+        }
+    }
+}
+
+/**
+ * @brief 块回调：对照刚换算的原始数据检查误差
+ */
+static void Sim_Block(void* user, const q15_t* block, uint16_t length)
+{
+    const uint16_t* raw = &adc_pipe.dma_buffer[adc.half * ADC_PIPE_BLOCK_SIZE];
+    double sum = 0.0, err;
+    uint16_t i;
+
+    (void)user;
+    for (i = 0; i < length; i++) {
+        err = fabs(block[i] / (double)ADC_PIPE_TEMP_LSB_PER_C - Sim_Reference(raw[i]));
+        if (err > stats.max_convert_error) {
+            stats.max_convert_error = err;
+        }
+        sum += block[i];
+    }
+    err = fabs(sum / length / ADC_PIPE_TEMP_LSB_PER_C - adc.temperature);
+    if (err > stats.max_mean_error) {
+        stats.max_mean_error = err;
+    }
+    stats.blocks++;
+}
+
+static void Sim_Open(uint32_t latency)
+{
+    memset(&stats, 0, sizeof(stats));
+    adc.latency = latency;
+    adc.samples = 0;
+    ADC_Pipe_Init(&adc_pipe, &sim_hadc, &sim_htim);
+    ADC_Pipe_RegisterBlockCallback(&adc_pipe, Sim_Block, NULL);
+    ADC_Pipe_Start(&adc_pipe);
+}
+
+/* ----------------------------------------------------------------------------
+ * 用例
+ * ------------------------------------------------------------------------- */
+
+/**
+ * @brief -40 ~ 125 °C 扫描，每个温度点采满一块
+ */
+static int Sim_Accuracy(void)
+{
+    double t;
+    uint32_t i;
+    int ok;
+
+    Sim_Open(0);
+    for (t = -40.0; t <= 125.0; t += 0.25) {
+        adc.temperature = t;
+        for (i = 0; i < ADC_PIPE_BLOCK_SIZE; i++) {
+            Sim_Trigger();
+        }
+    }
+    ADC_Pipe_Stop(&adc_pipe);
+
+    // 误差上限：输入偏移取整 ±0.5 原始 LSB (约 0.02 °C) 加上输出截断 1/256 °C
+    ok = stats.blocks == 661U && stats.max_convert_error < 0.03 && adc_pipe.overrun_count == 0U;
+    printf("accuracy: cal %u/%u at %u mV, scale %d * 2^%d, %u blocks, max |fixed - float| %.4f C, "
+           "max |block mean - true| %.4f C (noise %.1f LSB) -> %s\n",
+           SIM_CAL1, SIM_CAL2, ADC_PIPE_VDDA_MV, adc_pipe.cal.scale_fract, adc_pipe.cal.scale_shift, stats.blocks,
+           stats.max_convert_error, stats.max_mean_error, adc.noise_lsb, ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief 中断延迟小于一块时间不应计 overrun，超过后每块都应计数
+ */
+static int Sim_Overrun(void)
+{
+    static const uint32_t latencies[] = { 0, ADC_PIPE_BLOCK_SIZE / 2U, ADC_PIPE_BLOCK_SIZE - 1U,
+                                          ADC_PIPE_BLOCK_SIZE + 1U, ADC_PIPE_BLOCK_SIZE + ADC_PIPE_BLOCK_SIZE / 2U };
+    uint32_t i, n;
+    int failed = 0;
+
+    adc.temperature = 25.0;
+    for (i = 0; i < sizeof(latencies) / sizeof(latencies[0]); i++) {
+        uint8_t expect = latencies[i] >= ADC_PIPE_BLOCK_SIZE;
+        int ok;
+
+        Sim_Open(latencies[i]);
+        for (n = 0; n < 200U * ADC_PIPE_BLOCK_SIZE; n++) {
+            Sim_Trigger();
+        }
+        ADC_Pipe_Stop(&adc_pipe);
+        ok = expect ? (adc_pipe.overrun_count == adc_pipe.block_count) : (adc_pipe.overrun_count == 0U);
+        printf("overrun: latency %4.1f ms (block %.1f ms), %u blocks, %u overruns -> %s\n",
+               latencies[i] * 1000.0 / SIM_RATE_HZ, ADC_PIPE_BLOCK_SIZE * 1000.0 / SIM_RATE_HZ,
+               adc_pipe.block_count, adc_pipe.overrun_count, ok ? "PASS" : "FAIL");
+        failed |= !ok;
+    }
+    return failed;
+}
+
+/**
+ * @brief 整块换算吞吐（主机），与逐点浮点换算对比
+ */
+static void Sim_Speed(void)
+{
+    static const uint16_t lengths[] = { 16, 64, 256, 1024, 4096 };
+    static uint16_t raw[4096];
+    static q15_t out[4096];
+    static float out_f32[4096];
+    ADC_Pipe_Calibration cal;
+    double a = (double)ADC_PIPE_VDDA_MV / TEMPSENSOR_CAL_VREFANALOG / ADC_PIPE_OVERSAMPLE_GAIN;
+    double b = (double)(TEMPSENSOR_CAL2_TEMP - TEMPSENSOR_CAL1_TEMP) / (SIM_CAL2 - SIM_CAL1);
+    uint32_t i, r, reps;
+    uint64_t start;
+    double block_ns, float_ns;
+
+    ADC_Pipe_ComputeCalibration(&cal, SIM_CAL1, SIM_CAL2, ADC_PIPE_VDDA_MV);
+    for (i = 0; i < 4096U; i++) {
+        raw[i] = Sim_Oversample(-40.0 + 165.0 * i / 4096.0);
+    }
+
+    printf("speed: block, ns/block, Msamples/s (block convert), Msamples/s (per-sample float), "
+           "share of a %u Hz block period\n", SIM_RATE_HZ);
+    for (i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        reps = 20000000U / lengths[i];
+
+        start = Sim_NowNs();
+        for (r = 0; r < reps; r++) {
+            ADC_Pipe_Convert(&cal, raw, out, lengths[i]);
+        }
+        block_ns = (double)(Sim_NowNs() - start) / reps;
+
+        start = Sim_NowNs();
+        for (r = 0; r < reps; r++) {
+            uint16_t k;
+
+            for (k = 0; k < lengths[i]; k++) {
+                out_f32[k] = (float)(TEMPSENSOR_CAL1_TEMP + (raw[k] * a - SIM_CAL1) * b);
+            }
+            sim_sink = out_f32[r % lengths[i]];
+        }
+        float_ns = (double)(Sim_NowNs() - start) / reps;
+
+        printf("  %5u  %8.1f  %7.1f  %7.1f  %.5f%%\n", lengths[i], block_ns, lengths[i] / block_ns * 1e3,
+               lengths[i] / float_ns * 1e3, 100.0 * block_ns * 1e-9 / (lengths[i] / (double)SIM_RATE_HZ));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const char* only = NULL;
+    int failed = 0;
+    int opt;
+
+    srand48(1);
+    adc.noise_lsb = 1.5;
+    while ((opt = getopt(argc, argv, "s:e:")) != -1) {
+        switch (opt) {
+        case 's': srand48(strtol(optarg, NULL, 0)); break;
+        case 'e': adc.noise_lsb = strtod(optarg, NULL); break;
+        default:
+            fprintf(stderr, "usage: adc_pipe_sim [-s seed] [-e noise_lsb] [accuracy|overrun|speed]\n");
+            return 2;
+        }
+    }
+    if (optind < argc) {
+        only = argv[optind];
+    }
+
+    if (only == NULL || strcmp(only, "accuracy") == 0) {
+        failed |= Sim_Accuracy();
+    }
+    if (only == NULL || strcmp(only, "overrun") == 0) {
+        failed |= Sim_Overrun();
+    }
+    if (only == NULL || strcmp(only, "speed") == 0) {
+        Sim_Speed();
+    }
+    return failed;
+}
@@ -0,0 +1,70 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    main.h
+ * @brief   主机端替身：app_drv_adc_pipe.c 用到的 HAL / CMSIS 声明
+ * @note    函数与校准值由 adc_pipe_sim.c 提供；主机上 DWT->CYCCNT 按纳秒计数
+ ******************************************************************************
+ */
+
+#ifndef HOST_MAIN_H_
+#define HOST_MAIN_H_
+
+#include <stdint.h>
+
+typedef enum {
+    HAL_OK = 0,
+    HAL_ERROR,
+    HAL_BUSY,
+    HAL_TIMEOUT,
+} HAL_StatusTypeDef;
+
+typedef struct {
+    volatile uint32_t counter;      // 剩余传输数，对应 CNDTR
+} DMA_HandleTypeDef;
+
+typedef struct {
+    DMA_HandleTypeDef* DMA_Handle;
+} ADC_HandleTypeDef;
+
+typedef struct {
+    uint8_t running;
+} TIM_HandleTypeDef;
+
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+DWT_Type* Host_Dwt(void);
+extern CoreDebug_Type host_core_debug;
+extern uint16_t host_ts_cal[2];
+
+#define DWT                             (Host_Dwt())
+#define CoreDebug                       (&host_core_debug)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL)
+
+#define __HAL_DMA_GET_COUNTER(hdma)     ((hdma)->counter)
+
+#define TEMPSENSOR_CAL1_ADDR            (&host_ts_cal[0])
+#define TEMPSENSOR_CAL2_ADDR            (&host_ts_cal[1])
+#define TEMPSENSOR_CAL1_TEMP            ((int32_t)30L)
+#define TEMPSENSOR_CAL2_TEMP            (130L)
+#define TEMPSENSOR_CAL_VREFANALOG       (3000UL)
+
+#define ADC_SINGLE_ENDED                (0x7FU)
+
+HAL_StatusTypeDef HAL_ADCEx_Calibration_Start(ADC_HandleTypeDef* hadc, uint32_t single_diff);
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef* hadc, uint32_t* data, uint32_t length);
+HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef* hadc);
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef* htim);
+HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef* htim);
+
+#endif /* HOST_MAIN_H_ */
@@ -0,0 +1,650 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    app_drv_arq.c
+ * @brief   滑动窗口 ARQ 批量传输
+ * @note    选择重传 + 每块 CRC32，发送环槽位直接作为 DMA 发送源；不依赖 HAL，可在主机上编译
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include "app_drv_arq.h"
+
+// 帧解析状态
+#define ARQ_RX_SOF          0
+#define ARQ_RX_HEADER       1
+#define ARQ_RX_BODY         2
+
+// 发送环槽位状态
+#define ARQ_SLOT_FREE       0
+#define ARQ_SLOT_FILLING    1   // 正在写入数据
+#define ARQ_SLOT_READY      2   // 等待（重新）发送
+#define ARQ_SLOT_SENT       3   // 已发送，等待确认
+#define ARQ_SLOT_SACKED     4   // 已被选择确认，等待累计确认释放
+
+// tx_current 中的控制帧标识
+#define ARQ_CURRENT_SACK    (0xFEU)
+#define ARQ_CURRENT_SYN     (0xFFU)
+
+#define ARQ_SLOT_MASK       (ARQ_WINDOW_MAX - 1U)
+
+// CRC-32 半字节查表（反射多项式 0xEDB88320），只占 64 字节
+static const uint32_t arq_crc_table[16] = {
+    0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+    0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU,
+};
+
+static inline uint32_t ARQ_GetU32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void ARQ_PutU32(uint8_t* p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+/**
+ * @brief CRC-32（zlib 兼容）
+ * @param crc 上一段的结果，首段为 0
+ */
+uint32_t ARQ_Crc32(uint32_t crc, const uint8_t* data, uint32_t length)
+{
+    crc = ~crc;
+    while (length-- > 0U) {
+        crc ^= *data++;
+        crc = (crc >> 4) ^ arq_crc_table[crc & 0x0FU];
+        crc = (crc >> 4) ^ arq_crc_table[crc & 0x0FU];
+    }
+    return ~crc;
+}
+
+/**
+ * @brief 填写帧头与 CRC（负载已在 frame[ARQ_HEADER_SIZE] 起）
+ * @return 帧总长度
+ */
+static uint16_t ARQ_Encode(uint8_t* frame, uint8_t type, uint8_t seq, uint16_t length)
+{
+    frame[0] = ARQ_SOF;
+    frame[1] = type;
+    frame[2] = seq;
+    frame[3] = (uint8_t)length;
+    frame[4] = (uint8_t)(length >> 8);
+    ARQ_PutU32(&frame[ARQ_HEADER_SIZE + length], ARQ_Crc32(0, &frame[1], ARQ_HEADER_SIZE - 1U + length));
+    return (uint16_t)(ARQ_HEADER_SIZE + length + ARQ_CRC_SIZE);
+}
+
+/**
+ * @brief 发送方实际窗口：本地窗口与对端通告窗口的较小值
+ */
+static inline uint32_t ARQ_TxWindow(ARQ_Context* ctx)
+{
+    return (ctx->peer_window < ctx->window) ? ctx->peer_window : ctx->window;
+}
+
+/**
+ * @brief 超时重传后加倍超时（Karn 退避）
+ */
+static void ARQ_Backoff(ARQ_Context* ctx)
+{
+    ctx->rto = (ctx->rto >= ARQ_RTO_MAX_MS / 2U) ? ARQ_RTO_MAX_MS : ctx->rto * 2U;
+}
+
+/**
+ * @brief 更新往返时间估计（只用未重传过的块采样）
+ */
+static void ARQ_RttSample(ARQ_Context* ctx, uint32_t sample)
+{
+    uint32_t rto;
+
+    if (ctx->srtt8 == 0U) {
+        ctx->srtt8 = (sample << 3) | 1U;
+        ctx->rttvar4 = sample << 1;
+    } else {
+        int32_t err = (int32_t)sample - (int32_t)(ctx->srtt8 >> 3);
+
+        ctx->srtt8 = (uint32_t)((int32_t)ctx->srtt8 + err);
+        if (err < 0) {
+            err = -err;
+        }
+        ctx->rttvar4 = (uint32_t)((int32_t)ctx->rttvar4 + err - (int32_t)(ctx->rttvar4 >> 2));
+    }
+    // 往返时间稳定时偏差趋于 0，偏差项保留下限以容纳毫秒计时粒度与主循环调度抖动
+    rto = (ctx->srtt8 >> 3) + ((ctx->rttvar4 > ARQ_RTO_MARGIN_MS) ? ctx->rttvar4 : ARQ_RTO_MARGIN_MS);
+    ctx->rto = (rto > ARQ_RTO_MAX_MS) ? ARQ_RTO_MAX_MS : rto;
+}
+
+/**
+ * @brief 链路空闲时按优先级发送：SACK > SYN > 最早的待发送数据块
+ */
+static void ARQ_Kick(ARQ_Context* ctx)
+{
+    while (!ctx->tx_busy) {
+        ARQ_TxSlot* slot = NULL;
+        const uint8_t* frame;
+        uint16_t length;
+        uint8_t current;
+
+        if (ctx->ack_pending) {
+            uint32_t bitmap = 0;
+            uint8_t* p = &ctx->ack_frame[ARQ_HEADER_SIZE];
+
+            // 链路空闲时才重建，正在发送的 SACK 帧不会被改写
+            for (uint8_t i = 0; i + 1U < ctx->window; i++) {
+                if (ctx->rx_slots[(ctx->rx_next + 1U + i) & ARQ_SLOT_MASK].valid) {
+                    bitmap |= 1UL << i;
+                }
+            }
+            ARQ_PutU32(p, bitmap);
+            p[4] = ctx->rx_session;
+            p[5] = ctx->window;
+            frame = ctx->ack_frame;
+            length = ARQ_Encode(ctx->ack_frame, ARQ_TYPE_SACK, (uint8_t)ctx->rx_next, 6);
+            current = ARQ_CURRENT_SACK;
+        } else if (ctx->syn_pending) {
+            frame = ctx->syn_frame;
+            length = ARQ_SYN_FRAME_SIZE;
+            current = ARQ_CURRENT_SYN;
+        } else {
+            uint32_t limit;
+
+            if (ctx->tx_state != ARQ_TX_OPEN) {
+                return;
+            }
+            // 从最早的序号开始找，重传块总是先于新块发送
+            limit = ctx->tx_base + ARQ_TxWindow(ctx);
+            if ((int32_t)(limit - ctx->tx_next) > 0) {
+                limit = ctx->tx_next;
+            }
+            for (uint32_t seq = ctx->tx_base; seq != limit; seq++) {
+                if (ctx->tx_slots[seq & ARQ_SLOT_MASK].state == ARQ_SLOT_READY) {
+                    slot = &ctx->tx_slots[seq & ARQ_SLOT_MASK];
+                    current = (uint8_t)(seq & ARQ_SLOT_MASK);
+                    break;
+                }
+            }
+            if (slot == NULL) {
+                return;
+            }
+            frame = slot->frame;
+            length = slot->length;
+        }
+
+        ctx->tx_busy = 1;
+        ctx->tx_current = current;
+        if (ctx->send(ctx->send_user, frame, length) != 0) {
+            ctx->tx_busy = 0;
+            return;
+        }
+
+        if (current == ARQ_CURRENT_SACK) {
+            ctx->ack_pending = 0;
+        } else if (current == ARQ_CURRENT_SYN) {
+            ctx->syn_pending = 0;
+            ctx->syn_ms = ctx->now_ms;
+        } else {
+            slot->state = ARQ_SLOT_SENT;
+            slot->stamp = ++ctx->tx_stamp;
+            slot->sent_ms = ctx->now_ms;
+            ctx->tx_frames++;
+        }
+    }
+}
+
+/**
+ * @brief 块被确认：采样往返时间并记录最大发送顺序号
+ * @return 1：首次确认
+ */
+static uint8_t ARQ_Acked(ARQ_Context* ctx, ARQ_TxSlot* slot)
+{
+    if (slot->state != ARQ_SLOT_SENT && slot->state != ARQ_SLOT_READY) {
+        return 0;
+    }
+    if (slot->retries == 0U) {
+        ARQ_RttSample(ctx, ctx->now_ms - slot->sent_ms);
+    }
+    if ((int32_t)(slot->stamp - ctx->ack_stamp) > 0) {
+        ctx->ack_stamp = slot->stamp;
+    }
+    ctx->tx_bytes += (uint32_t)(slot->length - ARQ_HEADER_SIZE - ARQ_CRC_SIZE);
+    return 1;
+}
+
+/**
+ * @brief 处理 SACK：释放累计确认的块，标记选择确认的块，重传空洞
+ */
+static void ARQ_HandleSack(ARQ_Context* ctx, uint8_t ack, const uint8_t* payload)
+{
+    uint32_t bitmap = ARQ_GetU32(payload);
+    uint8_t window = payload[5];
+    uint8_t offset;
+
+    if (ctx->tx_state == ARQ_TX_IDLE || payload[4] != ctx->tx_session) {
+        return;
+    }
+    ctx->peer_window = (window == 0U) ? 1U : (window > ARQ_WINDOW_MAX) ? ARQ_WINDOW_MAX : window;
+
+    // SYN 帧很短，不用于往返时间采样，否则低波特率下首批数据块会被过早重传
+    if (ctx->tx_state == ARQ_TX_SYN) {
+        ctx->tx_state = ARQ_TX_OPEN;
+        ctx->syn_pending = 0;
+    }
+
+    // 累计确认超出已分配的序号：过期或错误的 SACK
+    offset = (uint8_t)(ack - (uint8_t)ctx->tx_base);
+    if (offset > ctx->tx_next - ctx->tx_base) {
+        return;
+    }
+    while (offset-- > 0U) {
+        ARQ_TxSlot* slot = &ctx->tx_slots[ctx->tx_base & ARQ_SLOT_MASK];
+
+        ARQ_Acked(ctx, slot);
+        slot->state = ARQ_SLOT_FREE;
+        ctx->tx_base++;
+    }
+
+    for (uint8_t i = 0; i < 32U && ctx->tx_base + 1U + i < ctx->tx_next; i++) {
+        if ((bitmap & (1UL << i)) != 0U) {
+            ARQ_TxSlot* slot = &ctx->tx_slots[(ctx->tx_base + 1U + i) & ARQ_SLOT_MASK];
+
+            if (ARQ_Acked(ctx, slot)) {
+                slot->state = ARQ_SLOT_SACKED;
+            }
+        }
+    }
+
+    // 链路不乱序：比已确认块更早发送而仍未确认的块已丢失
+    for (uint32_t seq = ctx->tx_base; seq != ctx->tx_next; seq++) {
+        ARQ_TxSlot* slot = &ctx->tx_slots[seq & ARQ_SLOT_MASK];
+
+        if (slot->state == ARQ_SLOT_SENT && (int32_t)(slot->stamp - ctx->ack_stamp) < 0) {
+            slot->state = ARQ_SLOT_READY;
+            slot->retries++;
+            ctx->retransmit_count++;
+        }
+    }
+
+    if (ctx->tx_closed && ctx->tx_base == ctx->tx_next) {
+        ctx->tx_state = ARQ_TX_DONE;
+    }
+}
+
+/**
+ * @brief 按序交付一块
+ */
+static void ARQ_Deliver(ARQ_Context* ctx, const uint8_t* data, uint16_t length)
+{
+    ctx->rx_next++;
+    ctx->rx_bytes += length;
+    if (length == 0U) {
+        ctx->rx_eof = 1;
+    }
+    if (ctx->deliver != NULL) {
+        ctx->deliver(ctx->deliver_user, data, length);
+    }
+}
+
+/**
+ * @brief 处理数据帧：按序直接交付，乱序暂存
+ */
+static void ARQ_HandleData(ARQ_Context* ctx, uint8_t seq, const uint8_t* payload, uint16_t length)
+{
+    uint8_t offset;
+
+    if (!ctx->rx_open) {
+        return;
+    }
+    ctx->ack_pending = 1;
+
+    // 窗口外：重复帧（SACK 丢失后的重传），只需再回复 SACK
+    offset = (uint8_t)(seq - (uint8_t)ctx->rx_next);
+    if (offset >= ctx->window || ctx->rx_eof) {
+        ctx->duplicate_count++;
+        return;
+    }
+
+    if (offset == 0U) {
+        ARQ_Deliver(ctx, payload, length);
+        while (!ctx->rx_eof) {
+            ARQ_RxSlot* slot = &ctx->rx_slots[ctx->rx_next & ARQ_SLOT_MASK];
+
+            if (!slot->valid) {
+                break;
+            }
+            slot->valid = 0;
+            ARQ_Deliver(ctx, slot->data, slot->length);
+        }
+    } else {
+        ARQ_RxSlot* slot = &ctx->rx_slots[(ctx->rx_next + offset) & ARQ_SLOT_MASK];
+
+        if (slot->valid) {
+            ctx->duplicate_count++;
+            return;
+        }
+        memcpy(slot->data, payload, length);
+        slot->length = length;
+        slot->valid = 1;
+    }
+}
+
+/**
+ * @brief 处理 SYN：新会话清空接收状态，重复的 SYN 只回复 SACK
+ */
+static void ARQ_HandleSyn(ARQ_Context* ctx, uint8_t session)
+{
+    if (!ctx->rx_open || session != ctx->rx_session) {
+        ctx->rx_open = 1;
+        ctx->rx_session = session;
+        ctx->rx_next = 0;
+        ctx->rx_eof = 0;
+        for (uint8_t i = 0; i < ARQ_WINDOW_MAX; i++) {
+            ctx->rx_slots[i].valid = 0;
+        }
+    }
+    ctx->ack_pending = 1;
+}
+
+/**
+ * @brief 校验并分发一帧
+ */
+static void ARQ_Dispatch(ARQ_Context* ctx)
+{
+    const uint8_t* frame = ctx->rx_frame;
+    uint16_t length = ctx->rx_length;
+    uint8_t type = frame[0];
+
+    if (ARQ_Crc32(0, frame, ARQ_HEADER_SIZE - 1U + length) != ARQ_GetU32(&frame[ARQ_HEADER_SIZE - 1U + length])) {
+        ctx->crc_error_count++;
+        return;
+    }
+
+    if (type == ARQ_TYPE_DATA) {
+        ARQ_HandleData(ctx, frame[1], &frame[ARQ_HEADER_SIZE - 1U], length);
+    } else if (type == ARQ_TYPE_SACK && length == 6U) {
+        ARQ_HandleSack(ctx, frame[1], &frame[ARQ_HEADER_SIZE - 1U]);
+    } else if (type == ARQ_TYPE_SYN && length == 1U) {
+        ARQ_HandleSyn(ctx, frame[1]);
+    }
+}
+
+/**
+ * @brief 初始化 ARQ 上下文
+ * @param ctx 指向 ARQ_Context 结构体的指针
+ * @param window 本地窗口，1 ~ ARQ_WINDOW_MAX
+ * @param send 非阻塞发送函数
+ * @param send_user 传递给发送函数的用户参数
+ * @param deliver 按序交付函数，可为 NULL
+ * @param deliver_user 传递给交付函数的用户参数
+ */
+void ARQ_Init(ARQ_Context* ctx, uint8_t window, ARQ_Send_Func send, void* send_user,
+              ARQ_Deliver_Func deliver, void* deliver_user)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->send = send;
+    ctx->send_user = send_user;
+    ctx->deliver = deliver;
+    ctx->deliver_user = deliver_user;
+    ctx->rx_state = ARQ_RX_SOF;
+    ctx->rto = ARQ_RTO_INIT_MS;
+    ARQ_SetWindow(ctx, window);
+    ctx->peer_window = ctx->window;
+}
+
+/**
+ * @brief 修改本地窗口
+ * @note 缩小窗口时已在途的块不受影响；接收方缩小窗口时超出新窗口的暂存块会被重传覆盖
+ */
+void ARQ_SetWindow(ARQ_Context* ctx, uint8_t window)
+{
+    ctx->window = (window == 0U) ? 1U : (window > ARQ_WINDOW_MAX) ? ARQ_WINDOW_MAX : window;
+}
+
+/**
+ * @brief 开始发送会话
+ * @param session 会话号，接收方据此区分新会话与重复的 SYN
+ */
+void ARQ_Open(ARQ_Context* ctx, uint8_t session, uint32_t now_ms)
+{
+    ctx->now_ms = now_ms;
+    for (uint8_t i = 0; i < ARQ_WINDOW_MAX; i++) {
+        ctx->tx_slots[i].state = ARQ_SLOT_FREE;
+    }
+    ctx->tx_state = ARQ_TX_SYN;
+    ctx->tx_session = session;
+    ctx->tx_closed = 0;
+    ctx->tx_base = 0;
+    ctx->tx_next = 0;
+    ctx->tx_fill = 0;
+    ctx->tx_stamp = 0;
+    ctx->ack_stamp = 0;
+    ctx->srtt8 = 0;
+    ctx->rttvar4 = 0;
+    ctx->rto = ARQ_RTO_INIT_MS;
+    ctx->syn_retries = 0;
+    ctx->syn_pending = 1;
+    ctx->tx_frames = 0;
+    ctx->tx_bytes = 0;
+    ctx->retransmit_count = 0;
+    ctx->timeout_count = 0;
+
+    ctx->syn_frame[ARQ_HEADER_SIZE] = ctx->window;
+    ARQ_Encode(ctx->syn_frame, ARQ_TYPE_SYN, session, 1);
+    ARQ_Kick(ctx);
+}
+
+/**
+ * @brief 取可写入的块：正在写入的块，或窗口内新分配的块
+ * @return NULL 表示窗口满或会话已结束
+ */
+static ARQ_TxSlot* ARQ_FillSlot(ARQ_Context* ctx)
+{
+    uint8_t index = (uint8_t)(ctx->tx_next & ARQ_SLOT_MASK);
+    ARQ_TxSlot* slot = &ctx->tx_slots[index];
+
+    if (slot->state == ARQ_SLOT_FILLING) {
+        return slot;
+    }
+    if (ctx->tx_closed || (ctx->tx_state != ARQ_TX_SYN && ctx->tx_state != ARQ_TX_OPEN) ||
+        ctx->tx_next - ctx->tx_base >= ARQ_TxWindow(ctx)) {
+        return NULL;
+    }
+    // 已释放的槽位可能仍在发送最后一次重传
+    if (ctx->tx_busy && ctx->tx_current == index) {
+        return NULL;
+    }
+    slot->state = ARQ_SLOT_FILLING;
+    ctx->tx_fill = 0;
+    return slot;
+}
+
+/**
+ * @brief 封装正在写入的块并排队发送
+ */
+static void ARQ_Seal(ARQ_Context* ctx, ARQ_TxSlot* slot)
+{
+    slot->length = ARQ_Encode(slot->frame, ARQ_TYPE_DATA, (uint8_t)ctx->tx_next, ctx->tx_fill);
+    slot->retries = 0;
+    slot->stamp = 0;
+    slot->state = ARQ_SLOT_READY;
+    ctx->tx_next++;
+    ctx->tx_fill = 0;
+}
+
+/**
+ * @brief 写入数据
+ * @return 已接受的字节数，数据直接写入发送环槽位
+ */
+uint16_t ARQ_Write(ARQ_Context* ctx, const uint8_t* data, uint16_t length)
+{
+    uint16_t written = 0;
+
+    while (written < length) {
+        ARQ_TxSlot* slot = ARQ_FillSlot(ctx);
+        uint16_t count;
+
+        if (slot == NULL) {
+            break;
+        }
+        count = (uint16_t)(ARQ_BLOCK_SIZE - ctx->tx_fill);
+        if (count > length - written) {
+            count = (uint16_t)(length - written);
+        }
+        memcpy(&slot->frame[ARQ_HEADER_SIZE + ctx->tx_fill], &data[written], count);
+        ctx->tx_fill += count;
+        written += count;
+        if (ctx->tx_fill == ARQ_BLOCK_SIZE) {
+            ARQ_Seal(ctx, slot);
+        }
+    }
+    ARQ_Kick(ctx);
+    return written;
+}
+
+/**
+ * @brief 不满一块的数据立即排队发送
+ */
+void ARQ_Flush(ARQ_Context* ctx)
+{
+    ARQ_TxSlot* slot = &ctx->tx_slots[ctx->tx_next & ARQ_SLOT_MASK];
+
+    if (slot->state == ARQ_SLOT_FILLING && ctx->tx_fill > 0U) {
+        ARQ_Seal(ctx, slot);
+        ARQ_Kick(ctx);
+    }
+}
+
+/**
+ * @brief 排队 EOF 块
+ * @return 1：已排队（或此前已排队），0：窗口满，稍后重试
+ */
+uint8_t ARQ_Close(ARQ_Context* ctx)
+{
+    ARQ_TxSlot* slot;
+
+    if (ctx->tx_closed) {
+        return 1;
+    }
+    ARQ_Flush(ctx);
+    slot = ARQ_FillSlot(ctx);
+    if (slot == NULL) {
+        return 0;
+    }
+    ARQ_Seal(ctx, slot);
+    ctx->tx_closed = 1;
+    ARQ_Kick(ctx);
+    return 1;
+}
+
+/**
+ * @brief 处理接收到的字节流
+ * @param data 接收数据，可在任意位置切分
+ * @param length 数据长度
+ * @param now_ms 当前时间，ms
+ * @note 校验失败的帧直接丢弃，由发送方的选择重传恢复；处理完这一批后回复一个 SACK
+ */
+void ARQ_Input(ARQ_Context* ctx, const uint8_t* data, uint16_t length, uint32_t now_ms)
+{
+    ctx->now_ms = now_ms;
+
+    while (length > 0U) {
+        uint16_t want;
+        uint16_t count;
+
+        if (ctx->rx_state == ARQ_RX_SOF) {
+            if (*data == ARQ_SOF) {
+                ctx->rx_state = ARQ_RX_HEADER;
+                ctx->rx_pos = 0;
+            }
+            data++;
+            length--;
+            continue;
+        }
+
+        want = (ctx->rx_state == ARQ_RX_HEADER) ? (uint16_t)(ARQ_HEADER_SIZE - 1U) :
+               (uint16_t)(ARQ_HEADER_SIZE - 1U + ctx->rx_length + ARQ_CRC_SIZE);
+        count = (uint16_t)(want - ctx->rx_pos);
+        if (count > length) {
+            count = length;
+        }
+        memcpy(&ctx->rx_frame[ctx->rx_pos], data, count);
+        ctx->rx_pos += count;
+        data += count;
+        length -= count;
+        if (ctx->rx_pos < want) {
+            break;
+        }
+
+        if (ctx->rx_state == ARQ_RX_HEADER) {
+            ctx->rx_length = (uint16_t)(ctx->rx_frame[2] | (ctx->rx_frame[3] << 8));
+            if (ctx->rx_length > ARQ_BLOCK_SIZE) {
+                ctx->crc_error_count++;
+                ctx->rx_state = ARQ_RX_SOF;
+            } else {
+                ctx->rx_state = ARQ_RX_BODY;
+            }
+        } else {
+            ARQ_Dispatch(ctx);
+            ctx->rx_state = ARQ_RX_SOF;
+        }
+    }
+
+    ARQ_Kick(ctx);
+}
+
+/**
+ * @brief 主循环处理：超时重传并接续发送
+ * @param now_ms 当前时间，ms
+ */
+void ARQ_Poll(ARQ_Context* ctx, uint32_t now_ms)
+{
+    uint8_t timeout = 0;
+
+    ctx->now_ms = now_ms;
+
+    if (ctx->tx_state == ARQ_TX_SYN && !ctx->syn_pending &&
+        !(ctx->tx_busy && ctx->tx_current == ARQ_CURRENT_SYN) && now_ms - ctx->syn_ms >= ctx->rto) {
+        if (++ctx->syn_retries > ARQ_MAX_RETRIES) {
+            ctx->tx_state = ARQ_TX_FAILED;
+        } else {
+            ctx->syn_pending = 1;
+            ctx->timeout_count++;
+            timeout = 1;
+        }
+    }
+
+    if (ctx->tx_state == ARQ_TX_OPEN) {
+        for (uint32_t seq = ctx->tx_base; seq != ctx->tx_next; seq++) {
+            ARQ_TxSlot* slot = &ctx->tx_slots[seq & ARQ_SLOT_MASK];
+
+            if (slot->state != ARQ_SLOT_SENT || now_ms - slot->sent_ms < ctx->rto) {
+                continue;
+            }
+            if (++slot->retries > ARQ_MAX_RETRIES) {
+                ctx->tx_state = ARQ_TX_FAILED;
+                break;
+            }
+            slot->state = ARQ_SLOT_READY;
+            ctx->timeout_count++;
+            timeout = 1;
+        }
+    }
+
+    if (timeout) {
+        ARQ_Backoff(ctx);
+    }
+    ARQ_Kick(ctx);
+}
+
+/**
+ * @brief 发送完成处理
+ * @note 在中断上下文中调用，只清除忙标志，下一帧由主循环中的 ARQ_Poll/ARQ_Input 接续
+ */
+void ARQ_TxComplete(ARQ_Context* ctx)
+{
+    ctx->tx_busy = 0;
+}
@@ -0,0 +1,193 @@
+#ifndef APP_DRV_ARQ_H_
+#define APP_DRV_ARQ_H_
+
+#include <stdint.h>
+
+/*
+ * 滑动窗口 ARQ 批量传输（选择重传）
+ *
+ * 帧格式（小端）：
+ *   0xA6 | 类型(1) | 序号(1) | 长度(2) | 负载(长度) | CRC32(4，覆盖类型到负载，与 zlib crc32 一致)
+ *
+ * 帧类型：
+ *   ARQ_TYPE_SYN   开始会话，序号为会话号，负载为发送方窗口(1)；接收方清空状态并回复 SACK
+ *   ARQ_TYPE_DATA  数据块，负载 1 ~ ARQ_BLOCK_SIZE 字节；空负载表示数据结束 (EOF)，与数据块一样按序确认
+ *   ARQ_TYPE_SACK  序号为累计确认（期望的下一块），负载：位图(4) + 会话号(1) + 接收窗口(1)，
+ *                  位图第 i 位表示序号 (累计确认 + 1 + i) 的块已收到
+ *
+ * 发送环：窗口内每个槽位保存一个完整编码的帧，DMA 直接从槽位发送，重传时原样再发一次，
+ * 收到确认后才释放；窗口大小即发送环的槽位数（运行时可设，不超过 ARQ_WINDOW_MAX）。
+ *
+ * 选择重传：串口链路不会乱序，SACK 中已确认块之前发送、仍未确认的块必定已丢失，
+ * 收到 SACK 后立即重传（按发送顺序号判定，每次丢失只重传一次），链路不必等待超时；
+ * 窗口已满或尾部丢失时靠超时重传，超时按往返时间估计 (SRTT + 4 * RTTVAR)。
+ *
+ * 接收方：窗口内乱序到达的块暂存，按序交付；每处理完一批输入回复一个 SACK。
+ * 接收窗口在 SACK 中通告，发送方在途块数取本地窗口与通告窗口的较小值。
+ * 窗口要覆盖往返时间（一帧发送时间 + SACK 返回）才能连续发送，2 块即可接近线速，默认 8 块留出重传余量；
+ * 接收串口没有流控时，窗口内的帧须能全部放进 DMA 接收环与接收队列，用 ARQ_WINDOW_FOR 换算。
+ *
+ * 协议核心只依赖发送函数和调用方传入的毫秒时间，不依赖 HAL 与中断，
+ * 同一份代码在主机上编译即为对端实现（host/arq_peer.c，可经 pty 回环测试）。
+ *
+ * 效率：满块帧开销 9 字节 / 265 字节（约 96.6%），反向只有 15 字节的 SACK；
+ * 单块出错只重传该块，误码率 1e-5 时帧错误率约 2%，有效吞吐约为线速的 93%。
+ */
+
+#ifndef ARQ_BLOCK_SIZE
+  #define ARQ_BLOCK_SIZE        (256U)   // 数据块最大负载
+#endif
+
+#ifndef ARQ_WINDOW_MAX
+  #define ARQ_WINDOW_MAX        (8U)     // 发送环/接收重排槽位数，2 的幂，不超过 32（SACK 位图宽度）
+#endif
+
+#ifndef ARQ_RTO_INIT_MS
+  #define ARQ_RTO_INIT_MS       (1000U)  // 尚无往返时间样本时的超时
+#endif
+
+#ifndef ARQ_RTO_MARGIN_MS
+  #define ARQ_RTO_MARGIN_MS     (10U)    // 超时中偏差项的下限
+#endif
+
+#ifndef ARQ_RTO_MAX_MS
+  #define ARQ_RTO_MAX_MS        (4000U)
+#endif
+
+#ifndef ARQ_MAX_RETRIES
+  #define ARQ_MAX_RETRIES       (16U)    // 单块（或 SYN）重传次数上限，超过后会话失败
+#endif
+
+#define ARQ_SOF                 (0xA6U)
+#define ARQ_TYPE_SYN            (0x01U)
+#define ARQ_TYPE_DATA           (0x02U)
+#define ARQ_TYPE_SACK           (0x03U)
+
+#define ARQ_HEADER_SIZE         (5U)     // SOF + 类型 + 序号 + 长度
+#define ARQ_CRC_SIZE            (4U)
+#define ARQ_FRAME_MAX           (ARQ_HEADER_SIZE + ARQ_BLOCK_SIZE + ARQ_CRC_SIZE)
+#define ARQ_SYN_FRAME_SIZE      (ARQ_HEADER_SIZE + 1U + ARQ_CRC_SIZE)
+#define ARQ_SACK_FRAME_SIZE     (ARQ_HEADER_SIZE + 6U + ARQ_CRC_SIZE)
+
+// 接收缓冲 bytes 字节（DMA 接收环 + 接收队列）能容纳的满块帧数，作为无流控时的窗口（超出上限由 ARQ_SetWindow 截断）
+#define ARQ_WINDOW_FOR(bytes)   (((bytes) >= ARQ_FRAME_MAX) ? (uint8_t)((bytes) / ARQ_FRAME_MAX) : 1U)
+
+typedef enum {
+    ARQ_TX_IDLE = 0,                // 未开始发送会话
+    ARQ_TX_SYN,                     // 等待对端确认 SYN
+    ARQ_TX_OPEN,                    // 传输中
+    ARQ_TX_DONE,                    // EOF 已被确认
+    ARQ_TX_FAILED,                  // 重传次数超限
+} ARQ_TxState;
+
+// 发送函数类型定义（非阻塞，如 HAL_UART_Transmit_DMA），返回 0 表示已启动发送，
+// 发送完成后调用 ARQ_TxComplete；同步发送的实现可在返回前直接调用 ARQ_TxComplete
+typedef int (*ARQ_Send_Func)(void* user, const uint8_t* data, uint16_t length);
+
+// 按序交付函数类型定义，length 为 0 表示数据结束 (EOF)
+typedef void (*ARQ_Deliver_Func)(void* user, const uint8_t* data, uint16_t length);
+
+// 发送环槽位
+typedef struct {
+    uint8_t frame[ARQ_FRAME_MAX];   // 完整编码的帧，DMA 直接从此发送
+    uint16_t length;                // 帧长度
+    uint8_t state;
+    uint8_t retries;                // 重传次数
+    uint32_t stamp;                 // 最近一次发送的顺序号
+    uint32_t sent_ms;               // 最近一次发送的时间
+} ARQ_TxSlot;
+
+// 接收重排槽位
+typedef struct {
+    uint8_t data[ARQ_BLOCK_SIZE];
+    uint16_t length;
+    uint8_t valid;
+} ARQ_RxSlot;
+
+// ARQ 上下文结构体（收发双向，各自独立的会话）
+typedef struct {
+    ARQ_Send_Func send;
+    void* send_user;
+    ARQ_Deliver_Func deliver;
+    void* deliver_user;
+    uint8_t window;                 // 本地窗口：发送在途上限，同时作为接收窗口通告
+    volatile uint8_t tx_busy;       // 链路忙，发送完成中断中清除
+    uint8_t tx_current;             // 正在发送的槽位或控制帧
+    uint32_t now_ms;                // 最近一次调用传入的时间
+
+    // 发送方
+    ARQ_TxState tx_state;
+    uint8_t tx_session;
+    uint8_t peer_window;            // 对端通告的接收窗口
+    uint8_t tx_closed;              // EOF 已排队
+    uint8_t syn_pending;
+    uint8_t syn_retries;
+    uint32_t syn_ms;
+    uint32_t tx_base;               // 最早未确认的块序号（自由运行，线上取低 8 位）
+    uint32_t tx_next;               // 下一个分配的块序号
+    uint16_t tx_fill;               // 正在写入的块已有字节数
+    uint32_t tx_stamp;              // 发送顺序计数
+    uint32_t ack_stamp;             // 已确认块中最大的发送顺序号
+    uint32_t srtt8;                 // 平滑往返时间 * 8，ms
+    uint32_t rttvar4;               // 往返时间偏差 * 4，ms
+    uint32_t rto;                   // 当前超时，ms
+    ARQ_TxSlot tx_slots[ARQ_WINDOW_MAX];
+    uint8_t syn_frame[ARQ_SYN_FRAME_SIZE];
+
+    // 接收方
+    uint8_t rx_open;                // 已收到 SYN
+    uint8_t rx_session;
+    uint8_t rx_eof;                 // EOF 已交付
+    uint8_t ack_pending;
+    uint32_t rx_next;               // 期望的下一块序号
+    ARQ_RxSlot rx_slots[ARQ_WINDOW_MAX];
+    uint8_t ack_frame[ARQ_SACK_FRAME_SIZE];
+
+    // 帧解析
+    uint8_t rx_state;
+    uint16_t rx_pos;
+    uint16_t rx_length;
+    uint8_t rx_frame[ARQ_FRAME_MAX - 1U];   // 类型起的整帧（不含 SOF）
+
+    // 统计
+    uint32_t tx_frames;             // 已发送的数据帧数（含重传）
+    uint32_t tx_bytes;              // 已被确认的数据字节数
+    uint32_t retransmit_count;      // SACK 空洞触发的重传次数
+    uint32_t timeout_count;         // 超时重传次数
+    uint32_t rx_bytes;              // 已交付的数据字节数
+    uint32_t crc_error_count;       // 校验失败或长度非法的帧数
+    uint32_t duplicate_count;       // 重复或窗口外的数据帧数
+} ARQ_Context;
+
+// 初始化，window 为本地窗口（1 ~ ARQ_WINDOW_MAX），deliver 可为 NULL（只发送）
+void ARQ_Init(ARQ_Context* ctx, uint8_t window, ARQ_Send_Func send, void* send_user,
+              ARQ_Deliver_Func deliver, void* deliver_user);
+
+// 修改本地窗口，下一个 SACK 起对端生效
+void ARQ_SetWindow(ARQ_Context* ctx, uint8_t window);
+
+// 开始发送会话：清空发送环并发送 SYN，session 应与上一次不同
+void ARQ_Open(ARQ_Context* ctx, uint8_t session, uint32_t now_ms);
+
+// 写入数据，满块立即排队发送，返回已接受的字节数（窗口满时小于 length）
+uint16_t ARQ_Write(ARQ_Context* ctx, const uint8_t* data, uint16_t length);
+
+// 不满一块的数据立即排队发送
+void ARQ_Flush(ARQ_Context* ctx);
+
+// 排队 EOF 块，返回 1 表示已排队，0 表示窗口满需稍后重试
+uint8_t ARQ_Close(ARQ_Context* ctx);
+
+// 处理接收到的字节流（任意切分），处理完后回复 SACK
+void ARQ_Input(ARQ_Context* ctx, const uint8_t* data, uint16_t length, uint32_t now_ms);
+
+// 主循环中调用：超时重传并接续发送
+void ARQ_Poll(ARQ_Context* ctx, uint32_t now_ms);
+
+// 在 HAL_UART_TxCpltCallback 中调用
+void ARQ_TxComplete(ARQ_Context* ctx);
+
+// CRC-32（zlib 兼容，可分段累加，初值为 0）
+uint32_t ARQ_Crc32(uint32_t crc, const uint8_t* data, uint32_t length);
+
+#endif /* APP_DRV_ARQ_H_ */
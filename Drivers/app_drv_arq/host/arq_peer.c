@@ -0,0 +1,430 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    arq_peer.c
+ * @brief   ARQ 主机端对端实现（Linux / macOS）
+ * @note    与固件共用 app_drv_arq.c，编译：
+ *            cc -O2 -I.. -o arq_peer arq_peer.c ../app_drv_arq.c
+ *
+ *          与设备传输（设备先执行对应的控制台命令，-x 可代为发送）：
+ *            arq_peer -b 115200 -x "arq recv" /dev/ttyUSB0 send firmware.bin
+ *            arq_peer -b 115200 -x "arq send 1048576" /dev/ttyUSB0 recv dump.bin
+ *
+ *          pty 回环测试（同一进程内两个上下文分别挂在 pty 主从两端，按波特率节拍发送，
+ *          -e 按误码率在两个方向随机翻转比特）：
+ *            arq_peer -b 115200 -e 1e-5 loop test.bin
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "app_drv_arq.h"
+
+#define PEER_IDLE_TIMEOUT_MS    (5000U)    // 接收方无数据超时
+#define PEER_LINGER_MS          (300U)     // EOF 交付后继续应答重复帧的时间
+
+// 一端链路：文件描述符 + 按波特率模拟的发送完成时刻
+typedef struct {
+    int fd;
+    ARQ_Context* arq;
+    uint64_t busy_until_us;
+    uint32_t baud;
+    double ber;                 // 注入的误码率
+    uint32_t injected;          // 注入错误的帧数
+    uint8_t deferred;           // pty：帧在模拟的发送时间结束时才写出
+    uint16_t pending;           // 等待写出的字节数
+    uint8_t frame[ARQ_FRAME_MAX];
+} Peer_Link;
+
+// 接收端输出
+typedef struct {
+    FILE* file;                 // 写入文件，可为 NULL
+    uint8_t* data;              // 回环测试：写入内存用于比对
+    size_t length;
+    size_t capacity;
+    uint32_t crc;
+    uint8_t eof;
+    uint64_t eof_us;
+} Peer_Sink;
+
+static uint64_t Peer_NowUs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000U + (uint64_t)ts.tv_nsec / 1000U;
+}
+
+static uint32_t Peer_NowMs(void)
+{
+    return (uint32_t)(Peer_NowUs() / 1000U);
+}
+
+static void Peer_WriteAll(int fd, const uint8_t* data, uint16_t length)
+{
+    uint16_t done = 0;
+
+    while (done < length) {
+        ssize_t n = write(fd, data + done, length - done);
+
+        if (n < 0) {
+            if (errno != EAGAIN && errno != EINTR) {
+                perror("write");
+                exit(1);
+            }
+            usleep(100);
+            continue;
+        }
+        done += (uint16_t)n;
+    }
+}
+
+/**
+ * @brief 发送函数：按 10 位/字节计算线路占用时间，到时再通知发送完成
+ * @note pty 没有波特率，节拍由此模拟，帧在发送时间结束时才写出，对端看到的往返时间与真实线路一致；
+ *       真实串口立即写出，由硬件控制节拍，同时避免把整个窗口一次塞进内核缓冲区
+ */
+static int Peer_Send(void* user, const uint8_t* data, uint16_t length)
+{
+    Peer_Link* link = (Peer_Link*)user;
+    uint64_t now = Peer_NowUs();
+
+    memcpy(link->frame, data, length);
+    if (link->ber > 0.0) {
+        uint8_t hit = 0;
+
+        for (uint16_t i = 0; i < length; i++) {
+            if (drand48() < link->ber * 8.0) {
+                link->frame[i] ^= (uint8_t)(1U << (lrand48() & 7));
+                hit = 1;
+            }
+        }
+        link->injected += hit;
+    }
+    if (link->deferred) {
+        link->pending = length;
+    } else {
+        Peer_WriteAll(link->fd, link->frame, length);
+    }
+    link->busy_until_us = now + (uint64_t)length * 10U * 1000000U / link->baud;
+    return 0;
+}
+
+static void Peer_Deliver(void* user, const uint8_t* data, uint16_t length)
+{
+    Peer_Sink* sink = (Peer_Sink*)user;
+
+    if (length == 0U) {
+        sink->eof = 1;
+        sink->eof_us = Peer_NowUs();
+        return;
+    }
+    sink->crc = ARQ_Crc32(sink->crc, data, length);
+    if (sink->file != NULL) {
+        fwrite(data, 1, length, sink->file);
+    }
+    if (sink->data != NULL) {
+        if (sink->length + length > sink->capacity) {
+            sink->capacity = (sink->length + length) * 2U;
+            sink->data = realloc(sink->data, sink->capacity);
+        }
+        memcpy(sink->data + sink->length, data, length);
+    }
+    sink->length += length;
+}
+
+/**
+ * @brief 读取链路上的数据交给 ARQ，并在模拟的发送时间到达后通知发送完成
+ */
+static void Peer_Service(Peer_Link* link)
+{
+    uint8_t buf[512];
+    ssize_t n;
+
+    while ((n = read(link->fd, buf, sizeof(buf))) > 0) {
+        ARQ_Input(link->arq, buf, (uint16_t)n, Peer_NowMs());
+    }
+    if (link->arq->tx_busy && Peer_NowUs() >= link->busy_until_us) {
+        if (link->pending > 0U) {
+            Peer_WriteAll(link->fd, link->frame, link->pending);
+            link->pending = 0;
+        }
+        ARQ_TxComplete(link->arq);
+    }
+    ARQ_Poll(link->arq, Peer_NowMs());
+}
+
+/**
+ * @brief 等待接收数据或最近的发送完成时刻（最长 1 ms）
+ */
+static void Peer_Wait(Peer_Link* links, int count)
+{
+    struct pollfd fds[2];
+    struct timespec timeout = { 0, 1000000 };
+    uint64_t now = Peer_NowUs();
+
+    for (int i = 0; i < count; i++) {
+        fds[i].fd = links[i].fd;
+        fds[i].events = POLLIN;
+        if (links[i].arq->tx_busy) {
+            uint64_t wait = (links[i].busy_until_us > now) ? links[i].busy_until_us - now : 0U;
+
+            if (wait * 1000U < (uint64_t)timeout.tv_nsec) {
+                timeout.tv_nsec = (long)(wait * 1000U);
+            }
+        }
+    }
+    ppoll(fds, (nfds_t)count, &timeout, NULL);
+}
+
+static int Peer_Raw(int fd, uint32_t baud)
+{
+    struct termios tio;
+
+    if (tcgetattr(fd, &tio) != 0) {
+        return -1;
+    }
+    cfmakeraw(&tio);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    if (baud != 0U) {
+        cfsetspeed(&tio, (speed_t)baud);
+    }
+    if (tcsetattr(fd, TCSANOW, &tio) != 0) {
+        return -1;
+    }
+    return fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+static uint8_t* Peer_LoadFile(const char* path, size_t* length)
+{
+    FILE* f = fopen(path, "rb");
+    uint8_t* data;
+    long size;
+
+    if (f == NULL) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc((size_t)size + 1U);
+    if (data != NULL && fread(data, 1, (size_t)size, f) != (size_t)size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    *length = (size_t)size;
+    return data;
+}
+
+/**
+ * @brief 向发送端写入数据，全部写完后排队 EOF
+ * @return 1：EOF 已排队
+ */
+static uint8_t Peer_Feed(ARQ_Context* arq, const uint8_t* data, size_t length, size_t* offset)
+{
+    while (*offset < length) {
+        size_t chunk = length - *offset;
+        uint16_t written;
+
+        if (chunk > 0xFFFFU) {
+            chunk = 0xFFFFU;
+        }
+        written = ARQ_Write(arq, data + *offset, (uint16_t)chunk);
+        if (written == 0U) {
+            return 0;
+        }
+        *offset += written;
+    }
+    return ARQ_Close(arq);
+}
+
+static void Peer_Report(const char* role, ARQ_Context* arq, size_t bytes, uint64_t elapsed_us, uint32_t baud)
+{
+    double seconds = (double)elapsed_us / 1e6;
+    double rate = (seconds > 0.0) ? (double)bytes / seconds : 0.0;
+
+    printf("%s %zu bytes in %.2f s, %.0f B/s (%.1f%% of %u baud line rate)\n",
+           role, bytes, seconds, rate, rate * 1000.0 / (baud / 10.0) / 10.0, baud);
+    printf("  frames %u, sack retransmit %u, timeout %u, crc error %u, duplicate %u, rto %u ms\n",
+           arq->tx_frames, arq->retransmit_count, arq->timeout_count,
+           arq->crc_error_count, arq->duplicate_count, arq->rto);
+}
+
+/**
+ * @brief pty 回环：发送端在主设备端，接收端在从设备端
+ */
+static int Peer_Loop(const char* path, uint32_t baud, double ber, uint8_t window)
+{
+    static ARQ_Context tx_arq, rx_arq;
+    Peer_Link links[2];
+    Peer_Sink sink;
+    size_t length, offset = 0;
+    uint8_t* data = Peer_LoadFile(path, &length);
+    uint64_t start;
+    int master, slave;
+    int ok;
+
+    if (data == NULL) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 1;
+    }
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        perror("posix_openpt");
+        return 1;
+    }
+    slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if (slave < 0 || Peer_Raw(slave, 0) != 0 || Peer_Raw(master, 0) != 0) {
+        perror("pty");
+        return 1;
+    }
+
+    memset(&sink, 0, sizeof(sink));
+    links[0] = (Peer_Link){ .fd = master, .arq = &tx_arq, .baud = baud, .ber = ber, .deferred = 1 };
+    links[1] = (Peer_Link){ .fd = slave, .arq = &rx_arq, .baud = baud, .ber = ber, .deferred = 1 };
+    ARQ_Init(&tx_arq, window, Peer_Send, &links[0], NULL, NULL);
+    ARQ_Init(&rx_arq, window, Peer_Send, &links[1], Peer_Deliver, &sink);
+    sink.data = malloc(length + 1U);
+    sink.capacity = length + 1U;
+
+    start = Peer_NowUs();
+    ARQ_Open(&tx_arq, (uint8_t)Peer_NowMs(), Peer_NowMs());
+    while (tx_arq.tx_state != ARQ_TX_DONE && tx_arq.tx_state != ARQ_TX_FAILED) {
+        Peer_Feed(&tx_arq, data, length, &offset);
+        Peer_Service(&links[0]);
+        Peer_Service(&links[1]);
+        Peer_Wait(links, 2);
+    }
+
+    ok = (tx_arq.tx_state == ARQ_TX_DONE && sink.eof && sink.length == length &&
+          memcmp(sink.data, data, length) == 0);
+    Peer_Report("sent", &tx_arq, tx_arq.tx_bytes, sink.eof_us - start, baud);
+    Peer_Report("received", &rx_arq, sink.length, sink.eof_us - start, baud);
+    printf("  injected errors: %u frames forward, %u frames reverse\n", links[0].injected, links[1].injected);
+    printf("%s: crc %08x\n", ok ? "PASS" : "FAIL", sink.crc);
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief 通过串口与设备传输
+ */
+static int Peer_Device(const char* tty, const char* mode, const char* path, uint32_t baud,
+                       double ber, uint8_t window, const char* command)
+{
+    static ARQ_Context arq;
+    Peer_Link link;
+    Peer_Sink sink;
+    uint64_t start, last_rx;
+    int fd = open(tty, O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+    if (fd < 0 || Peer_Raw(fd, baud) != 0) {
+        perror(tty);
+        return 1;
+    }
+    memset(&sink, 0, sizeof(sink));
+    link = (Peer_Link){ .fd = fd, .arq = &arq, .baud = baud, .ber = ber };
+
+    if (command != NULL) {
+        // 控制台命令，丢弃回显后再开始
+        dprintf(fd, "%s\r\n", command);
+        tcdrain(fd);
+        usleep(100000);
+        tcflush(fd, TCIFLUSH);
+    }
+
+    if (strcmp(mode, "send") == 0) {
+        size_t length, offset = 0;
+        uint8_t* data = Peer_LoadFile(path, &length);
+
+        if (data == NULL) {
+            fprintf(stderr, "cannot read %s\n", path);
+            return 1;
+        }
+        ARQ_Init(&arq, window, Peer_Send, &link, NULL, NULL);
+        start = Peer_NowUs();
+        ARQ_Open(&arq, (uint8_t)Peer_NowMs(), Peer_NowMs());
+        while (arq.tx_state != ARQ_TX_DONE && arq.tx_state != ARQ_TX_FAILED) {
+            Peer_Feed(&arq, data, length, &offset);
+            Peer_Service(&link);
+            Peer_Wait(&link, 1);
+        }
+        Peer_Report("sent", &arq, arq.tx_bytes, Peer_NowUs() - start, baud);
+        printf("%s: crc %08x\n", (arq.tx_state == ARQ_TX_DONE) ? "DONE" : "FAILED",
+               ARQ_Crc32(0, data, (uint32_t)length));
+        return (arq.tx_state == ARQ_TX_DONE) ? 0 : 1;
+    }
+
+    sink.file = fopen(path, "wb");
+    if (sink.file == NULL) {
+        perror(path);
+        return 1;
+    }
+    ARQ_Init(&arq, window, Peer_Send, &link, Peer_Deliver, &sink);
+    start = last_rx = Peer_NowUs();
+    for (;;) {
+        uint32_t before = arq.rx_bytes + arq.crc_error_count + arq.duplicate_count + arq.rx_eof;
+
+        Peer_Service(&link);
+        if (arq.rx_bytes + arq.crc_error_count + arq.duplicate_count + arq.rx_eof != before) {
+            last_rx = Peer_NowUs();
+        }
+        // EOF 之后继续应答一段时间，最后一个 SACK 丢失时发送方的重传仍能得到确认
+        if ((sink.eof && Peer_NowUs() - last_rx > PEER_LINGER_MS * 1000U) ||
+            Peer_NowUs() - last_rx > PEER_IDLE_TIMEOUT_MS * 1000U) {
+            break;
+        }
+        Peer_Wait(&link, 1);
+    }
+    fclose(sink.file);
+    Peer_Report("received", &arq, sink.length, (sink.eof ? sink.eof_us : Peer_NowUs()) - start, baud);
+    printf("%s: crc %08x\n", sink.eof ? "DONE" : "TIMEOUT", sink.crc);
+    return sink.eof ? 0 : 1;
+}
+
+static void Peer_Usage(void)
+{
+    fprintf(stderr,
+            "usage: arq_peer [-b baud] [-w window] [-e bit_error_rate] [-x console_command] <tty> send|recv <file>\n"
+            "       arq_peer [-b baud] [-w window] [-e bit_error_rate] loop <file>\n");
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t baud = 115200;
+    uint8_t window = ARQ_WINDOW_MAX;
+    double ber = 0.0;
+    const char* command = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "b:w:e:x:s:")) != -1) {
+        switch (opt) {
+        case 'b': baud = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'w': window = (uint8_t)strtoul(optarg, NULL, 0); break;
+        case 'e': ber = strtod(optarg, NULL); break;
+        case 'x': command = optarg; break;
+        case 's': srand48(strtol(optarg, NULL, 0)); break;
+        default: Peer_Usage(); return 2;
+        }
+    }
+    if (argc - optind == 2 && strcmp(argv[optind], "loop") == 0) {
+        return Peer_Loop(argv[optind + 1], baud, ber, window);
+    }
+    if (argc - optind == 3 && (strcmp(argv[optind + 1], "send") == 0 || strcmp(argv[optind + 1], "recv") == 0)) {
+        return Peer_Device(argv[optind], argv[optind + 1], argv[optind + 2], baud, ber, window, command);
+    }
+    Peer_Usage();
+    return 2;
+}
@@ -0,0 +1,178 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    app_drv_bridge.c
+ * @brief   串口桥接
+ * @note    接收 DMA 缓冲区中的数据段直接作为另一串口 DMA 发送的源地址，零拷贝转发
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include "app_drv_bridge.h"
+
+/**
+ * @brief 按经过的时间补充令牌
+ */
+static void BRIDGE_Refill(BRIDGE_Context* ctx)
+{
+    uint32_t now = HAL_GetTick();
+    uint32_t elapsed = now - ctx->credit_tick;
+    uint32_t cap = ctx->burst * 1000U;
+
+    ctx->credit_tick = now;
+    // 先按容量截断时间，避免 rate * elapsed 溢出
+    if (elapsed >= cap / ctx->rate) {
+        ctx->credit = cap;
+    } else {
+        ctx->credit += ctx->rate * elapsed;
+        if (ctx->credit > cap) {
+            ctx->credit = cap;
+        }
+    }
+}
+
+/**
+ * @brief 按两端波特率限制数据段长度
+ * @note 发送端慢于接收端时，持续输入下接收 DMA 可能在发送 DMA 读完之前绕回覆盖数据段的后部；
+ *       发送 L 字节期间接收端最多写入 L * rx / tx 字节，不超过空闲空间加上已读出的部分即可，
+ *       取 L * (rx - tx) <= 空闲空间 * tx。首字节在启动发送时即被读取，至少发送 1 字节
+ */
+static uint16_t BRIDGE_SafeLength(BRIDGE_Context* ctx, uint16_t length)
+{
+    uint32_t rx_baud = ctx->rx->huart->Init.BaudRate;
+    uint32_t tx_baud = ctx->tx->Init.BaudRate;
+    uint32_t limit;
+
+    if (tx_baud >= rx_baud) {
+        return length;
+    }
+    limit = (uint32_t)(USART_DMA_BUFFER_SIZE - ctx->rx->span_pending) * tx_baud / (rx_baud - tx_baud);
+    if (limit == 0U) {
+        limit = 1U;
+    }
+    return (length > limit) ? (uint16_t)limit : length;
+}
+
+/**
+ * @brief 发送端空闲时取下一个数据段启动发送
+ * @note 在中断中调用，或在主循环中关中断调用
+ */
+static void BRIDGE_Kick(BRIDGE_Context* ctx)
+{
+    uint8_t* data;
+    uint16_t length;
+
+    if (ctx->tx_len != 0U) {
+        return;
+    }
+    length = USART_Rx_DMA_PeekSpan(ctx->rx, &data);
+    if (length == 0U) {
+        return;
+    }
+    if (ctx->rx->span_pending > ctx->backlog_max) {
+        ctx->backlog_max = ctx->rx->span_pending;
+    }
+    length = BRIDGE_SafeLength(ctx, length);
+
+    if (ctx->rate != 0U) {
+        uint32_t tokens;
+
+        BRIDGE_Refill(ctx);
+        tokens = ctx->credit / 1000U;
+        if (tokens == 0U) {
+            if (!ctx->throttled) {
+                ctx->throttled = 1;
+                ctx->throttled_count++;
+            }
+            return;
+        }
+        ctx->throttled = 0;
+        if (length > tokens) {
+            length = (uint16_t)tokens;
+        }
+        ctx->credit -= (uint32_t)length * 1000U;
+    }
+
+    // 发送期间数据段不释放，接收 DMA 不会覆盖正在发送的数据
+    if (HAL_UART_Transmit_DMA(ctx->tx, data, length) == HAL_OK) {
+        ctx->tx_len = length;
+    } else if (ctx->rate != 0U) {
+        ctx->credit += (uint32_t)length * 1000U;
+    }
+}
+
+/**
+ * @brief 接收端新数据到达回调
+ */
+static void BRIDGE_RxReady(void* user)
+{
+    BRIDGE_Kick((BRIDGE_Context*)user);
+}
+
+/**
+ * @brief 初始化串口桥接
+ * @param ctx 指向 BRIDGE_Context 结构体的指针
+ * @param rx 接收端，须已由 USART_Rx_DMA_Init 启动接收
+ * @param tx 发送端串口，须已配置 DMA 发送
+ */
+void BRIDGE_Init(BRIDGE_Context* ctx, USART_DMA_Context* rx, UART_HandleTypeDef* tx)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->rx = rx;
+    ctx->tx = tx;
+    USART_Rx_DMA_EnableSpan(rx, BRIDGE_RxReady, ctx);
+}
+
+/**
+ * @brief 设置限速
+ * @param ctx 指向 BRIDGE_Context 结构体的指针
+ * @param rate 字节/秒，0 表示不限速
+ * @param burst 令牌桶容量，字节（最小 1）
+ */
+void BRIDGE_SetRate(BRIDGE_Context* ctx, uint32_t rate, uint32_t burst)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    ctx->rate = rate;
+    ctx->burst = (burst > 0U) ? burst : 1U;
+    ctx->credit = 0;
+    ctx->credit_tick = HAL_GetTick();
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief 发送完成处理
+ * @note 在中断上下文中调用，释放已发送的数据段并接续发送
+ */
+void BRIDGE_TxComplete(BRIDGE_Context* ctx)
+{
+    if (ctx->tx_len == 0U) {
+        return;
+    }
+    USART_Rx_DMA_ConsumeSpan(ctx->rx, ctx->tx_len);
+    ctx->forwarded_bytes += ctx->tx_len;
+    ctx->span_count++;
+    ctx->tx_len = 0;
+    BRIDGE_Kick(ctx);
+}
+
+/**
+ * @brief 主循环处理
+ * @note 发送空闲时直接按 DMA 当前位置取数据，不必等到 IDLE/HT/TC 中断，
+ *       降低长数据包首字节的转发延迟；令牌不足时推迟的数据段也在此接续发送
+ */
+void BRIDGE_Poll(BRIDGE_Context* ctx)
+{
+    uint32_t primask;
+
+    if (ctx->tx_len != 0U) {
+        return;
+    }
+    primask = __get_PRIMASK();
+    __disable_irq();
+    BRIDGE_Kick(ctx);
+    __set_PRIMASK(primask);
+}
@@ -0,0 +1,58 @@
+#ifndef APP_DRV_BRIDGE_H_
+#define APP_DRV_BRIDGE_H_
+
+#include <stdint.h>
+#include "main.h"
+#include "app_drv_serial_rx.h"
+
+/*
+ * 串口桥接：一个串口接收的数据原样从另一个串口发出（单向，双向桥接用两个上下文）
+ *
+ * 接收端工作在零拷贝模式（USART_Rx_DMA_EnableSpan）：发送 DMA 的源地址直接指向接收
+ * DMA 缓冲区中的数据段，发送完成后才释放，全程没有中间缓冲区拷贝。
+ *
+ * 背压：发送忙或限速时数据留在接收 DMA 缓冲区中，接收缓冲区即为转发队列；
+ * 持续输入快于输出时积压会超过缓冲区大小，溢出计入接收端丢弃统计（需配合流控）；
+ * 发送端波特率低于接收端时按两端波特率限制每段长度，发送 DMA 总在数据被绕圈覆盖之前读完，
+ * 溢出只会丢弃数据，不会转发被覆盖的字节。
+ *
+ * 限速：令牌桶，rate 字节/秒、容量 burst 字节，每次发送的数据段不超过当前令牌数；
+ * 令牌按 HAL_GetTick() 毫秒补充，令牌不足时由 BRIDGE_Poll 在主循环中接续发送。
+ *
+ * 延迟：中断只在 IDLE/HT/TC 时通知新数据，长数据包的首段要等到半个缓冲区才转发；
+ * 主循环中调用 BRIDGE_Poll 可在发送空闲时按 DMA 当前位置直接取数据，延迟降到主循环周期量级。
+ */
+
+// 串口桥接上下文结构体
+typedef struct {
+    USART_DMA_Context* rx;          // 接收端（零拷贝模式）
+    UART_HandleTypeDef* tx;         // 发送端（DMA 发送）
+    volatile uint16_t tx_len;       // 正在发送的数据段长度，0 表示空闲
+
+    // 限速（令牌桶），rate 为 0 表示不限速
+    uint32_t rate;                  // 字节/秒
+    uint32_t burst;                 // 令牌桶容量，字节
+    uint32_t credit;                // 当前令牌，1/1000 字节
+    uint32_t credit_tick;           // 上次补充令牌的时间，ms
+    uint8_t throttled;              // 当前因令牌不足推迟发送
+
+    // 统计
+    uint32_t forwarded_bytes;       // 已转发字节数
+    uint32_t span_count;            // 发送的数据段数
+    uint32_t throttled_count;       // 因令牌不足开始推迟发送的次数
+    uint16_t backlog_max;           // 接收端最大积压字节数
+} BRIDGE_Context;
+
+// 初始化桥接，rx 须已由 USART_Rx_DMA_Init 启动接收（之后不再使用用户队列）
+void BRIDGE_Init(BRIDGE_Context* ctx, USART_DMA_Context* rx, UART_HandleTypeDef* tx);
+
+// 设置限速，rate 为 0 时不限速
+void BRIDGE_SetRate(BRIDGE_Context* ctx, uint32_t rate, uint32_t burst);
+
+// 在 HAL_UART_TxCpltCallback 中调用（发送端串口）
+void BRIDGE_TxComplete(BRIDGE_Context* ctx);
+
+// 主循环中调用：限速时补充令牌并接续发送
+void BRIDGE_Poll(BRIDGE_Context* ctx);
+
+#endif /* APP_DRV_BRIDGE_H_ */
@@ -0,0 +1,433 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    bridge_sim.c
+ * @brief   串口桥接主机端模拟（Linux / macOS）
+ * @note    与固件共用 app_drv_serial_rx.c 和 app_drv_bridge.c，同目录的 main.h / usart.h 替代 HAL，
+ *          USART_DMA_BUFFER_SIZE 与 CMakeLists.txt 中的板级配置一致：
+ *            cc -O2 -I. -I.. -I../../app_drv_serial_rx -DUSART_DMA_BUFFER_SIZE=256 -o bridge_sim bridge_sim.c \
+ *               ../app_drv_bridge.c ../../app_drv_serial_rx/app_drv_serial_rx.c
+ *
+ *          按位时间的事件模拟（8N1，每字符 10 位）：
+ *            接收  字节在停止位结束时由 DMA 写入循环缓冲区，半满/全满时产生 HT/TC 中断，
+ *                  停止位结束后 1 个字符时间内没有新起始位则产生 IDLE 中断
+ *            发送  DMA 在前一字节进入移位寄存器时从源地址（即接收 DMA 缓冲区）读取下一字节，
+ *                  最后一个停止位结束后经中断延迟调用 BRIDGE_TxComplete
+ *            主循环按固定周期调用 BRIDGE_Poll
+ *          每个输入字节记录到达时刻和它在接收缓冲区中的槽位，发送 DMA 读取时核对槽位中仍是同一字节，
+ *          输出必须是输入的有序子序列（只有接收端计入溢出时才允许缺失），并给出逐字节转发延迟。
+ *          场景：
+ *            bursty      115200 -> 115200，30% 负载的随机数据包
+ *            nopoll      同上，不调用 BRIDGE_Poll，只靠 IDLE/HT/TC 中断转发
+ *            continuous  115200 -> 115200 连续输入
+ *            faster      115200 -> 460800 连续输入
+ *            fast        921600 -> 921600，50% 负载
+ *            shaped      限速 4000 B/s（容量 64 B），输入约 2900 B/s 的 64 B 以内数据包
+ *            overload    限速 4000 B/s，输入约 5800 B/s：接收端溢出计数，输出保持限速，不转发损坏数据
+ *            slower      460800 -> 115200 连续输入：同上，输出为发送端线速
+ *
+ *            bridge_sim [-s seed] [-p poll_us] [-l isr_latency_us] [scenario]
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "app_drv_bridge.h"
+
+#define SIM_CHAR_BITS           (10U)           // 8N1
+#define SIM_INPUT_MAX           (1U << 20)
+#define SIM_DRAIN_S             (1.0)           // 输入结束后继续运行的时间
+#define SIM_HIST_BUCKET_NS      (10000.0)       // 延迟直方图 10 us 一格
+#define SIM_HIST_BUCKETS        (20000U)        // 200 ms
+
+// 场景
+typedef struct {
+    const char* name;
+    uint32_t in_baud;
+    uint32_t out_baud;
+    uint32_t rate;              // 限速，字节/秒，0 表示不限速
+    uint32_t burst;
+    double load;                // 输入负载（1 为连续）
+    uint32_t packet_max;        // 数据包最大字节数
+    double seconds;             // 输入时长
+    uint8_t poll;               // 主循环调用 BRIDGE_Poll
+    uint8_t lossy;              // 预期接收端溢出
+} Sim_Scenario;
+
+// 模拟的两个串口
+typedef struct {
+    double now;                 // ns
+
+    // 输入端
+    double rx_byte_ns;
+    double rx_next_end;         // 下一个字节停止位结束时刻，INFINITY 表示输入结束
+    double input_end;
+    uint32_t packet_left;
+    uint8_t idle_armed;
+    double idle_due;
+
+    // 输出端
+    double tx_byte_ns;
+    uint8_t tx_active;          // HAL 发送忙，直到发送完成中断
+    const uint8_t* tx_src;
+    uint16_t tx_len;
+    uint16_t tx_index;          // 下一个字节边界
+    double tx_next;
+    int32_t tx_seq[USART_DMA_BUFFER_SIZE];  // DMA 读取时槽位中的输入序号
+    uint8_t tx_val[USART_DMA_BUFFER_SIZE];
+    uint8_t tc_pending;
+    double tc_due;
+
+    double poll_ns;
+    double poll_next;
+    double isr_latency_ns;
+} Sim_Link;
+
+// 输出核对与统计
+typedef struct {
+    uint32_t in_count;
+    uint32_t out_count;
+    uint32_t corrupt;
+    int32_t last_seq;
+    double first_out;
+    double last_out;
+    double latency_sum;
+    double latency_max;
+    uint32_t hist[SIM_HIST_BUCKETS];
+} Sim_Stats;
+
+static double in_time[SIM_INPUT_MAX];
+static uint8_t in_val[SIM_INPUT_MAX];
+static int32_t slot_seq[USART_DMA_BUFFER_SIZE];    // 接收缓冲区槽位 -> 输入序号
+
+static USART_TypeDef rx_regs, tx_regs;
+static UART_HandleTypeDef rx_uart = { &rx_regs, { 0, 0 }, { 0, 0, 0 } };
+static UART_HandleTypeDef tx_uart = { &tx_regs, { 0, 0 }, { 0, 0, 0 } };
+static DMA_Channel_TypeDef rx_channel;
+static DMA_HandleTypeDef rx_dma = { &rx_channel, 0 };
+static uint8_t* rx_buffer;
+static USART_DMA_Context rx;
+static BRIDGE_Context bridge;
+static Sim_Link line;
+static Sim_Stats stats;
+static double poll_us = 100.0;
+static double isr_latency_us = 3.0;
+
+/* ----------------------------------------------------------------------------
+ * HAL 替身
+ * ------------------------------------------------------------------------- */
+
+DWT_Type* Host_Dwt(void)
+{
+    static DWT_Type dwt;
+
+    dwt.CYCCNT = (uint32_t)(line.now * 0.08);     // 80 MHz
+    return &dwt;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return (uint32_t)(line.now / 1e6);
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef* huart, uint8_t* pData, uint16_t Size)
+{
+    (void)huart;
+    rx_buffer = pData;
+    rx_channel.CNDTR = Size;
+    return HAL_OK;
+}
+
+// 发送 DMA 读取一个字节送入 TDR
+static void Sim_TxRead(uint16_t n)
+{
+    if (n < line.tx_len) {
+        line.tx_seq[n] = slot_seq[&line.tx_src[n] - rx_buffer];
+        line.tx_val[n] = line.tx_src[n];
+    }
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef* huart, const uint8_t* pData, uint16_t Size)
+{
+    (void)huart;
+    if (line.tx_active) {
+        return HAL_BUSY;
+    }
+    line.tx_active = 1;
+    line.tx_src = pData;
+    line.tx_len = Size;
+    line.tx_index = 0;
+    line.tx_next = line.now;
+    return HAL_OK;
+}
+
+/* ----------------------------------------------------------------------------
+ * 事件
+ * ------------------------------------------------------------------------- */
+
+// 输入端安排下一个字节：数据包内连续发送，包间按负载随机间隔
+static void Sim_ScheduleInput(const Sim_Scenario* s)
+{
+    double start = line.now;
+
+    if (line.packet_left == 0U) {
+        double packet_mean = (1.0 + s->packet_max) / 2.0;
+        double gap_mean = packet_mean * line.rx_byte_ns * (1.0 / s->load - 1.0);
+
+        start += gap_mean * 2.0 * drand48();
+        line.packet_left = 1U + (uint32_t)(lrand48() % s->packet_max);
+    }
+    line.packet_left--;
+    line.rx_next_end = start + line.rx_byte_ns;
+    if (line.rx_next_end > line.input_end || stats.in_count >= SIM_INPUT_MAX) {
+        line.rx_next_end = INFINITY;
+        return;
+    }
+    // 空闲不足一个字符时间就来了新的起始位，不产生 IDLE
+    if (line.idle_armed && start < line.idle_due) {
+        line.idle_armed = 0;
+    }
+}
+
+// 接收中断：HT/TC 由 DMA 标志区分，IDLE 由串口标志区分
+static void Sim_RxInterrupt(void)
+{
+    USART_Rx_DMA_IRQHandler_Process(&rx);
+    rx_dma.flags = 0;
+}
+
+static void Sim_RxByte(const Sim_Scenario* s)
+{
+    uint32_t pos = USART_DMA_BUFFER_SIZE - rx_channel.CNDTR;
+    uint8_t value = (uint8_t)lrand48();
+
+    rx_buffer[pos] = value;
+    slot_seq[pos] = (int32_t)stats.in_count;
+    in_val[stats.in_count] = value;
+    in_time[stats.in_count] = line.now;
+    stats.in_count++;
+
+    rx_channel.CNDTR = (rx_channel.CNDTR == 1U) ? USART_DMA_BUFFER_SIZE : rx_channel.CNDTR - 1U;
+    line.idle_armed = 1;
+    line.idle_due = line.now + line.rx_byte_ns;
+    if (pos + 1U == USART_DMA_BUFFER_SIZE / 2U) {
+        rx_dma.flags = 1U;
+        Sim_RxInterrupt();
+    } else if (pos + 1U == USART_DMA_BUFFER_SIZE) {
+        rx_dma.flags = 2U;
+        Sim_RxInterrupt();
+    }
+    Sim_ScheduleInput(s);
+}
+
+// 一个字节的停止位在输出端结束
+static void Sim_Output(uint16_t n)
+{
+    int32_t seq = line.tx_seq[n];
+    double latency;
+    uint32_t bucket;
+
+    if (seq <= stats.last_seq || in_val[seq] != line.tx_val[n]) {
+        stats.corrupt++;
+        return;
+    }
+    stats.last_seq = seq;
+    latency = line.now - in_time[seq];
+    stats.latency_sum += latency;
+    if (latency > stats.latency_max) {
+        stats.latency_max = latency;
+    }
+    bucket = (uint32_t)(latency / SIM_HIST_BUCKET_NS);
+    stats.hist[(bucket < SIM_HIST_BUCKETS) ? bucket : SIM_HIST_BUCKETS - 1U]++;
+    if (stats.out_count == 0U) {
+        stats.first_out = line.now;
+    }
+    stats.last_out = line.now;
+    stats.out_count++;
+}
+
+// 发送字节边界：前一字节发送完成，当前字节进入移位寄存器，DMA 读取下一字节
+static void Sim_TxBoundary(void)
+{
+    uint16_t k = line.tx_index++;
+
+    if (k == 0U) {
+        Sim_TxRead(0);
+    } else {
+        Sim_Output(k - 1U);
+    }
+    if (k < line.tx_len) {
+        Sim_TxRead(k + 1U);
+        line.tx_next = line.now + line.tx_byte_ns;
+    } else {
+        line.tx_next = INFINITY;
+        line.tc_pending = 1;
+        line.tc_due = line.now + line.isr_latency_ns;
+    }
+}
+
+static void Sim_TxComplete(void)
+{
+    line.tc_pending = 0;
+    line.tx_active = 0;
+    BRIDGE_TxComplete(&bridge);
+}
+
+/**
+ * @brief 运行一个场景
+ * @retval 0 通过
+ */
+static int Sim_Run(const Sim_Scenario* s)
+{
+    double end = s->seconds * 1e9 + SIM_DRAIN_S * 1e9;
+    double p99 = 0.0, out_rate, in_rate;
+    uint32_t i, acc = 0, lost;
+    int ok;
+
+    memset(&line, 0, sizeof(line));
+    memset(&stats, 0, sizeof(stats));
+    memset(&rx_regs, 0, sizeof(rx_regs));
+    stats.last_seq = -1;
+    line.rx_byte_ns = SIM_CHAR_BITS * 1e9 / s->in_baud;
+    line.tx_byte_ns = SIM_CHAR_BITS * 1e9 / s->out_baud;
+    line.input_end = s->seconds * 1e9;
+    line.poll_ns = poll_us * 1e3;
+    line.poll_next = s->poll ? line.poll_ns : INFINITY;
+    line.isr_latency_ns = isr_latency_us * 1e3;
+    line.tx_next = INFINITY;
+    rx_uart.Init.BaudRate = s->in_baud;
+    tx_uart.Init.BaudRate = s->out_baud;
+
+    USART_Rx_DMA_Init(&rx, &rx_uart, &rx_dma);
+    BRIDGE_Init(&bridge, &rx, &tx_uart);
+    if (s->rate != 0U) {
+        BRIDGE_SetRate(&bridge, s->rate, s->burst);
+    }
+    Sim_ScheduleInput(s);
+
+    // 依次处理最早的事件，同一时刻按接收、IDLE、发送、发送完成、主循环的顺序
+    while (line.now < end) {
+        double t = line.rx_next_end;
+        int event = 0;
+
+        if (line.idle_armed && line.idle_due < t) {
+            t = line.idle_due;
+            event = 1;
+        }
+        if (line.tx_active && line.tx_next < t) {
+            t = line.tx_next;
+            event = 2;
+        }
+        if (line.tc_pending && line.tc_due < t) {
+            t = line.tc_due;
+            event = 3;
+        }
+        if (line.poll_next < t) {
+            t = line.poll_next;
+            event = 4;
+        }
+        if (t >= end) {
+            break;
+        }
+        line.now = t;
+
+        switch (event) {
+        case 0:
+            Sim_RxByte(s);
+            break;
+        case 1:
+            line.idle_armed = 0;
+            rx_regs.ISR |= UART_FLAG_IDLE;
+            Sim_RxInterrupt();
+            break;
+        case 2:
+            Sim_TxBoundary();
+            break;
+        case 3:
+            Sim_TxComplete();
+            break;
+        default:
+            line.poll_next += line.poll_ns;
+            BRIDGE_Poll(&bridge);
+            break;
+        }
+    }
+
+    for (i = 0; i < SIM_HIST_BUCKETS; i++) {
+        acc += stats.hist[i];
+        if (acc >= 0.99 * stats.out_count) {
+            p99 = (i + 1U) * SIM_HIST_BUCKET_NS / 1e6;
+            break;
+        }
+    }
+    lost = stats.in_count - stats.out_count - stats.corrupt;
+    in_rate = stats.in_count / s->seconds;
+    out_rate = (stats.last_out > stats.first_out) ? stats.out_count / ((stats.last_out - stats.first_out) / 1e9) : 0.0;
+
+    ok = stats.corrupt == 0U;
+    if (s->lossy) {
+        ok = ok && lost > 0U && rx.queue_overflow_count > 0U;
+    } else {
+        ok = ok && lost == 0U && rx.queue_overflow_count == 0U && rx.total_dropped_bytes == 0U;
+    }
+    if (s->rate != 0U && in_rate > s->rate) {
+        ok = ok && fabs(out_rate - s->rate) < 0.03 * s->rate;
+    }
+
+    printf("%-10s %6u -> %6u%s: in %6u B (%6.0f B/s), out %6u B (%6.0f B/s), lost %u, corrupt %u, overruns %u\n",
+           s->name, s->in_baud, s->out_baud, s->poll ? "" : " (no poll)", stats.in_count, in_rate,
+           stats.out_count, out_rate, lost, stats.corrupt, rx.queue_overflow_count);
+    printf("           latency mean %.3f ms, p99 %.2f ms, max %.3f ms; %u spans (avg %.1f B), backlog max %u B, "
+           "throttled %u -> %s\n",
+           stats.out_count ? stats.latency_sum / stats.out_count / 1e6 : 0.0, p99, stats.latency_max / 1e6,
+           bridge.span_count, bridge.span_count ? (double)bridge.forwarded_bytes / bridge.span_count : 0.0,
+           bridge.backlog_max, bridge.throttled_count, ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char* argv[])
+{
+    static const Sim_Scenario scenarios[] = {
+        { "bursty", 115200, 115200, 0, 0, 0.30, 200, 3.0, 1, 0 },
+        { "nopoll", 115200, 115200, 0, 0, 0.30, 200, 3.0, 0, 0 },
+        { "continuous", 115200, 115200, 0, 0, 1.00, 1000, 2.0, 1, 0 },
+        { "faster", 115200, 460800, 0, 0, 1.00, 1000, 2.0, 1, 0 },
+        { "fast", 921600, 921600, 0, 0, 0.50, 200, 1.0, 1, 0 },
+        { "shaped", 115200, 115200, 4000, 64, 0.25, 64, 5.0, 1, 0 },
+        { "overload", 115200, 115200, 4000, 64, 0.50, 64, 3.0, 1, 1 },
+        { "slower", 460800, 115200, 0, 0, 1.00, 1000, 1.0, 1, 1 },
+    };
+    const char* only = NULL;
+    int failed = 0;
+    uint32_t i;
+    int opt;
+
+    srand48(1);
+    while ((opt = getopt(argc, argv, "s:p:l:")) != -1) {
+        switch (opt) {
+        case 's': srand48(strtol(optarg, NULL, 0)); break;
+        case 'p': poll_us = strtod(optarg, NULL); break;
+        case 'l': isr_latency_us = strtod(optarg, NULL); break;
+        default:
+            fprintf(stderr, "usage: bridge_sim [-s seed] [-p poll_us] [-l isr_latency_us] [scenario]\n");
+            return 2;
+        }
+    }
+    if (optind < argc) {
+        only = argv[optind];
+    }
+
+    for (i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        if (only == NULL || strcmp(only, scenarios[i].name) == 0) {
+            failed |= Sim_Run(&scenarios[i]);
+        }
+    }
+    return failed;
+}
@@ -0,0 +1,580 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    flow_sim.c
+ * @brief   串口接收流控主机端模拟（Linux / macOS）
+ * @note    与固件共用 app_drv_serial_rx.c，复用同目录 bridge_sim.c 的 main.h / usart.h 替身：
+ *            cc -O2 -I. -I.. -I../../app_drv_serial_rx -I../../app_drv_fifo -DUSART_DMA_BUFFER_SIZE=256 \
+ *               -o flow_sim flow_sim.c ../../app_drv_serial_rx/app_drv_serial_rx.c ../../app_drv_fifo/app_drv_fifo.c
+ *
+ *          按位时间的事件模拟（8N1，每字符 10 位），接收端与 main.c 的 USART1 相同：
+ *          256 B 接收 FIFO 作用户队列，可用空间低于 1/4 时停止、恢复到 1/2 以上时允许。
+ *            对端    持续发送，看到停止后还会再发 lag 个字节才停下（发送 FIFO / 反应延迟）
+ *            接收    DMA 在停止位结束时写入循环缓冲区，HT/TC/IDLE 中断与 bridge_sim 相同；
+ *                    硬件 RTS 模式下 DMAR 清除后字节留在 RDR，RDR 满时 RTS 撤销，
+ *                    RDR 未读时再到的字节覆盖 RDR（OVRDIS），被覆盖的字节丢失
+ *            XON/XOFF 经设备发送线到达对端需一个字符时间，发送线忙时 flow_send 返回失败由驱动重试
+ *            消费者  主循环按周期从 FIFO 取数据（默认 6000 B/s，低于线速），随机停顿最长
+ *                    5000 个字符时间，取完调用 USART_Rx_DMA_FlowPoll
+ *          流控用例逐字节核对输出与输入（去掉被 RDR 覆盖的字节）完全一致。用例（mode-lag）：
+ *            none         不使用流控，作为对照：消费者停顿时必然丢数据
+ *            gpio-N       GPIO RTS，lag = 0/4/16/60：不得丢字节
+ *            xon-N        XON/XOFF，lag = 0/4/16/60：不得丢字节
+ *            hw-0         硬件 RTS，对端在当前字符结束时停止：不得丢字节
+ *            hw-N         硬件 RTS，lag = 4/16/60：DMA 停止后只有 RDR 一个字节可缓存，
+ *                         多发的字节被覆盖，只核对丢失全部来自 RDR 覆盖（驱动无法察觉）
+ *          每个用例同时按 main.c 使能接收时间戳（8 MHz 计数器，10 s 时回绕；侧队列 16 条）：
+ *            锁存    每条记录的 time 等于中断入口的计数器值，end 等于此时 DMA 写入的字节数，event 与中断源一致
+ *            连续    主循环（停顿期间不取）取出的记录 end 严格递增、相邻记录之间无空隙也无重叠，
+ *                    侧队列满丢弃记录后下一条覆盖这一段；time 单调不减
+ *            覆盖    结束时记录覆盖 DMA 写入的全部字节；硬件 RTS 下 DMA 恢复时从 RDR 取走的
+ *                    最后一个字节之后没有中断，允许缺一个字节
+ *
+ *            flow_sim [-s seed] [-t seconds] [-r consume_bytes_per_s] [-p poll_us] [-q ts_queue] [case]
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "app_drv_serial_rx.h"
+#include "app_drv_fifo.h"
+
+#define SIM_BAUD                (115200U)
+#define SIM_CHAR_BITS           (10U)           // 8N1
+#define SIM_FIFO_SIZE           (256U)          // main.c RX_FIFO_SIZE
+#define SIM_STALL_MAX_CHARS     (5000.0)        // 消费者最长停顿，字符时间
+#define SIM_STALL_INTERVAL_S    (0.5)           // 平均每 0.5 s 停顿一次
+#define SIM_DRAIN_S             (2.0)           // 输入结束后继续运行的时间
+#define SIM_RTS_PIN             (1U << 12)      // PA12
+#define SIM_TS_HZ               (8000000U)      // main.c TIM2
+#define SIM_TS_START            (0xFFFFFFFFU - 10U * SIM_TS_HZ)
+#define SIM_TS_QUEUE_MAX        (256U)
+
+typedef struct {
+    const char* name;
+    uint8_t mode;               // USART_FLOW_xxx
+    uint32_t lag;               // 对端看到停止后继续发送的字节数
+    uint8_t lossy;              // 预期丢字节
+} Sim_Case;
+
+// 模拟的串口与对端
+typedef struct {
+    double now;                 // ns
+    double byte_ns;
+    double input_end;
+
+    // 对端发送
+    double rx_next_end;         // 下一个字节停止位结束时刻，INFINITY 表示未发送
+    uint8_t peer_halted;        // 因流控停止发送
+    uint8_t peer_stop_seen;
+    uint32_t peer_lag_left;
+    uint8_t peer_xoff;          // 对端已收到 XOFF
+    uint8_t input_done;
+
+    // 接收端
+    uint8_t idle_armed;
+    double idle_due;
+    uint8_t rdr_full;           // 硬件 RTS：DMA 请求关闭时 RDR 中的字节
+    uint32_t rdr_seq;
+    uint32_t rdr_overwritten;
+    uint32_t ring_count;        // DMA 写入循环缓冲区的字节数
+
+    // 设备发送线（XON/XOFF）
+    double flow_tx_free;        // 发送线空闲时刻
+    double flow_arrive;         // XON/XOFF 到达对端时刻，INFINITY 表示没有
+    uint8_t flow_char;
+    uint32_t flow_chars;
+
+    // 消费者
+    double poll_ns;
+    double poll_next;
+    double stall_until;
+    double budget;              // 可读取字节数
+} Sim_Link;
+
+typedef struct {
+    uint32_t in_count;
+    uint32_t out_count;
+    uint32_t corrupt;           // 与预期不符的输出字节
+    uint32_t match;             // 下一个待匹配的输入序号
+    uint32_t backlog_max;       // DMA 缓冲区中积压的最大字节数
+
+    // 时间戳
+    uint32_t ts_records;
+    uint32_t ts_pos;            // 已取出记录覆盖的字节数
+    uint16_t ts_end;
+    uint32_t ts_time;
+    uint32_t ts_bad_latch;      // time/end/event 与中断时刻不符
+    uint32_t ts_bad_end;        // end 不递增或超出已写入字节
+    uint32_t ts_bad_time;       // time 倒退
+} Sim_Stats;
+
+static uint8_t* in_val;
+static uint8_t* in_lost;        // 被 RDR 覆盖的输入字节
+static uint32_t in_max;
+
+static USART_TypeDef rx_regs;
+static GPIO_TypeDef rts_port;
+static UART_HandleTypeDef rx_uart = { &rx_regs, { SIM_BAUD, 0 }, { 0, 0, 0 } };
+static DMA_Channel_TypeDef rx_channel;
+static DMA_HandleTypeDef rx_dma = { &rx_channel, 0 };
+static uint8_t* rx_buffer;
+static USART_DMA_Context rx;
+static app_drv_fifo_t rx_fifo;
+static uint8_t rx_fifo_buffer[SIM_FIFO_SIZE];
+static Sim_Link line;
+static Sim_Stats stats;
+static const Sim_Case* sim_case;
+static volatile uint32_t ts_counter;
+static USART_Rx_Timestamp ts_queue[SIM_TS_QUEUE_MAX];
+static uint32_t ts_size = 16U;      // main.c RX_TS_QUEUE_SIZE
+
+static double sim_seconds = 60.0;
+static double consume_rate = 6000.0;
+static double poll_us = 100.0;
+
+/* ----------------------------------------------------------------------------
+ * HAL 替身
+ * ------------------------------------------------------------------------- */
+
+DWT_Type* Host_Dwt(void)
+{
+    static DWT_Type dwt;
+
+    dwt.CYCCNT = (uint32_t)(line.now * 0.08);     // 80 MHz
+    return &dwt;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return (uint32_t)(line.now / 1e6);
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef* huart, uint8_t* pData, uint16_t Size)
+{
+    (void)huart;
+    rx_buffer = pData;
+    rx_channel.CNDTR = Size;
+    rx_regs.CR3 |= USART_CR3_DMAR;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef* huart, const uint8_t* pData, uint16_t Size)
+{
+    (void)huart;
+    (void)pData;
+    (void)Size;
+    return HAL_ERROR;
+}
+
+static uint32_t Sim_QueueWrite(void* user_queue, uint8_t* data, uint16_t length)
+{
+    uint16_t written = length;
+
+    if (app_drv_fifo_write((app_drv_fifo_t*)user_queue, data, &written) != APP_DRV_FIFO_RESULT_SUCCESS) {
+        return 0;
+    }
+    return written;
+}
+
+static uint32_t Sim_QueueAvailable(void* user_queue)
+{
+    app_drv_fifo_t* fifo = (app_drv_fifo_t*)user_queue;
+
+    return fifo->size - app_drv_fifo_length(fifo);
+}
+
+// XON/XOFF 经设备发送线送出，前一个字符未发完时返回失败
+static int Sim_FlowSend(void* user, uint8_t ch)
+{
+    (void)user;
+    if (line.now < line.flow_tx_free) {
+        return -1;
+    }
+    line.flow_tx_free = line.now + line.byte_ns;
+    line.flow_arrive = line.flow_tx_free;
+    line.flow_char = ch;
+    line.flow_chars++;
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * 事件
+ * ------------------------------------------------------------------------- */
+
+// 对端看到的流控状态
+static uint8_t Sim_PeerStopped(void)
+{
+    switch (sim_case->mode) {
+    case USART_FLOW_RTS_GPIO:
+        return (rts_port.ODR & SIM_RTS_PIN) != 0U;
+    case USART_FLOW_RTS_HW:
+        return line.rdr_full;
+    case USART_FLOW_XONXOFF:
+        return line.peer_xoff;
+    default:
+        return 0;
+    }
+}
+
+// 对端在 start 时刻决定是否发送下一个字节
+static void Sim_PeerNext(double start)
+{
+    line.rx_next_end = INFINITY;
+    if (line.input_done) {
+        return;
+    }
+    if (Sim_PeerStopped()) {
+        if (!line.peer_stop_seen) {
+            line.peer_stop_seen = 1;
+            line.peer_lag_left = sim_case->lag;
+        }
+        if (line.peer_lag_left == 0U) {
+            line.peer_halted = 1;
+            return;
+        }
+        line.peer_lag_left--;
+    } else {
+        line.peer_stop_seen = 0;
+    }
+    line.peer_halted = 0;
+    if (start + line.byte_ns > line.input_end || stats.in_count >= in_max) {
+        line.input_done = 1;
+        return;
+    }
+    line.rx_next_end = start + line.byte_ns;
+    // 空闲不足一个字符时间就来了新的起始位，不产生 IDLE
+    if (line.idle_armed && start < line.idle_due) {
+        line.idle_armed = 0;
+    }
+}
+
+// 接收中断：入口更新计数器，有新记录时核对锁存值
+static void Sim_RxInterrupt(uint8_t event)
+{
+    uint16_t head = rx.ts_head;
+
+    ts_counter = SIM_TS_START + (uint32_t)(line.now / (1e9 / SIM_TS_HZ));
+    USART_Rx_DMA_IRQHandler_Process(&rx);
+    rx_dma.flags = 0;
+
+    // 不论记录是否因侧队列满被丢弃，位置都须跟上 DMA
+    if (rx.ts_stream_pos != (uint16_t)line.ring_count) {
+        stats.ts_bad_latch++;
+    }
+    if (rx.ts_head != head) {
+        const USART_Rx_Timestamp* ts = &ts_queue[head & rx.ts_mask];
+
+        if (ts->time != ts_counter || ts->end != (uint16_t)line.ring_count || ts->event != event) {
+            stats.ts_bad_latch++;
+        }
+    }
+}
+
+// 主循环取出时间戳记录，核对连续与单调
+static void Sim_TsDrain(void)
+{
+    USART_Rx_Timestamp ts;
+
+    while (USART_Rx_DMA_GetTimestamp(&rx, &ts)) {
+        uint16_t span = (uint16_t)(ts.end - stats.ts_end);
+
+        if (span == 0U || stats.ts_pos + span > line.ring_count) {
+            stats.ts_bad_end++;
+        } else {
+            stats.ts_pos += span;
+        }
+        if (stats.ts_records > 0U && (int32_t)(ts.time - stats.ts_time) < 0) {
+            stats.ts_bad_time++;
+        }
+        stats.ts_end = ts.end;
+        stats.ts_time = ts.time;
+        stats.ts_records++;
+    }
+}
+
+// DMA 把一个字节写入循环缓冲区，半满/全满时产生中断
+static void Sim_DmaWrite(uint8_t value)
+{
+    uint32_t pos = USART_DMA_BUFFER_SIZE - rx_channel.CNDTR;
+
+    rx_buffer[pos] = value;
+    rx_channel.CNDTR = (rx_channel.CNDTR == 1U) ? USART_DMA_BUFFER_SIZE : rx_channel.CNDTR - 1U;
+    line.ring_count++;
+    if (pos + 1U == USART_DMA_BUFFER_SIZE / 2U) {
+        rx_dma.flags = 1U;
+        Sim_RxInterrupt(USART_TS_HT);
+    } else if (pos + 1U == USART_DMA_BUFFER_SIZE) {
+        rx_dma.flags = 2U;
+        Sim_RxInterrupt(USART_TS_TC);
+    }
+}
+
+// 驱动调用之后：硬件 RTS 恢复 DMA 请求时取走 RDR，对端看到允许后恢复发送
+static void Sim_AfterDriver(void)
+{
+    if (rx.span_pending > stats.backlog_max) {
+        stats.backlog_max = rx.span_pending;
+    }
+    if (line.rdr_full && (rx_regs.CR3 & USART_CR3_DMAR) != 0U) {
+        line.rdr_full = 0;
+        Sim_DmaWrite(in_val[line.rdr_seq]);
+    }
+    if (line.peer_halted && !Sim_PeerStopped()) {
+        Sim_PeerNext(line.now);
+    }
+}
+
+static void Sim_RxByte(void)
+{
+    uint32_t seq = stats.in_count++;
+
+    in_val[seq] = (uint8_t)lrand48();
+    line.idle_armed = 1;
+    line.idle_due = line.now + line.byte_ns;
+
+    if ((rx_regs.CR3 & USART_CR3_DMAR) != 0U) {
+        Sim_DmaWrite(in_val[seq]);
+    } else {
+        // DMA 请求关闭：字节进入 RDR，未读的旧字节被覆盖
+        if (line.rdr_full) {
+            in_lost[line.rdr_seq] = 1;
+            line.rdr_overwritten++;
+        }
+        line.rdr_full = 1;
+        line.rdr_seq = seq;
+    }
+    Sim_AfterDriver();
+    Sim_PeerNext(line.now);
+}
+
+// 消费者取出的字节必须按顺序等于输入中未被 RDR 覆盖的字节
+static void Sim_Check(uint8_t value)
+{
+    uint32_t j = stats.match;
+
+    stats.out_count++;
+    if (sim_case->mode == USART_FLOW_NONE) {
+        return;
+    }
+    while (j < stats.in_count && in_lost[j]) {
+        j++;
+    }
+    if (j == stats.in_count || in_val[j] != value) {
+        stats.corrupt++;
+        return;
+    }
+    stats.match = j + 1U;
+}
+
+static void Sim_Poll(void)
+{
+    uint8_t buffer[64];
+
+    line.poll_next += line.poll_ns;
+    if (line.now < line.stall_until) {
+        return;
+    }
+    Sim_TsDrain();
+    if (drand48() < line.poll_ns / (SIM_STALL_INTERVAL_S * 1e9)) {
+        line.stall_until = line.now + drand48() * SIM_STALL_MAX_CHARS * line.byte_ns;
+        return;
+    }
+
+    line.budget += consume_rate * line.poll_ns / 1e9;
+    while (line.budget >= 1.0 && !app_drv_fifo_is_empty(&rx_fifo)) {
+        uint16_t length = (uint16_t)((line.budget < sizeof(buffer)) ? line.budget : sizeof(buffer));
+
+        app_drv_fifo_read(&rx_fifo, buffer, &length);
+        for (uint16_t i = 0; i < length; i++) {
+            Sim_Check(buffer[i]);
+        }
+        line.budget -= length;
+    }
+    if (line.budget > 64.0) {
+        line.budget = 64.0;
+    }
+    USART_Rx_DMA_FlowPoll(&rx);
+    Sim_AfterDriver();
+}
+
+/**
+ * @brief 运行一个用例
+ * @retval 0 通过
+ */
+static int Sim_Run(const Sim_Case* c)
+{
+    double end = (sim_seconds + SIM_DRAIN_S) * 1e9;
+    uint32_t lost;
+    uint32_t ts_tail;
+    int ts_ok;
+    int ok;
+
+    sim_case = c;
+    memset(&line, 0, sizeof(line));
+    memset(&stats, 0, sizeof(stats));
+    memset(&rx_regs, 0, sizeof(rx_regs));
+    memset(&rts_port, 0, sizeof(rts_port));
+    memset(in_lost, 0, in_max);
+    line.byte_ns = SIM_CHAR_BITS * 1e9 / SIM_BAUD;
+    line.input_end = sim_seconds * 1e9;
+    line.poll_ns = poll_us * 1e3;
+    line.poll_next = line.poll_ns;
+    line.flow_arrive = INFINITY;
+
+    app_drv_fifo_init(&rx_fifo, rx_fifo_buffer, SIM_FIFO_SIZE);
+    USART_Rx_DMA_Init(&rx, &rx_uart, &rx_dma);
+    USART_RegisterQueueOps(&rx, &rx_fifo, Sim_QueueWrite, Sim_QueueAvailable);
+    USART_Rx_DMA_EnableTimestamp(&rx, &ts_counter, ts_queue, (uint16_t)ts_size);
+    if (c->mode == USART_FLOW_RTS_GPIO) {
+        USART_Rx_DMA_SetRtsPin(&rx, &rts_port, SIM_RTS_PIN);
+    } else if (c->mode == USART_FLOW_XONXOFF) {
+        USART_Rx_DMA_SetFlowSender(&rx, Sim_FlowSend, NULL);
+    }
+    if (c->mode != USART_FLOW_NONE) {
+        USART_Rx_DMA_EnableFlowControl(&rx, c->mode, SIM_FIFO_SIZE / 4U, SIM_FIFO_SIZE / 2U);
+    }
+    Sim_PeerNext(0.0);
+
+    // 依次处理最早的事件，同一时刻按接收、IDLE、XON/XOFF 到达、主循环的顺序
+    while (line.now < end) {
+        double t = line.rx_next_end;
+        int event = 0;
+
+        if (line.idle_armed && line.idle_due < t) {
+            t = line.idle_due;
+            event = 1;
+        }
+        if (line.flow_arrive < t) {
+            t = line.flow_arrive;
+            event = 2;
+        }
+        if (line.poll_next < t) {
+            t = line.poll_next;
+            event = 3;
+        }
+        if (t >= end) {
+            break;
+        }
+        line.now = t;
+
+        switch (event) {
+        case 0:
+            Sim_RxByte();
+            break;
+        case 1:
+            line.idle_armed = 0;
+            rx_regs.ISR |= UART_FLAG_IDLE;
+            Sim_RxInterrupt(USART_TS_IDLE);
+            Sim_AfterDriver();
+            break;
+        case 2:
+            line.flow_arrive = INFINITY;
+            line.peer_xoff = (line.flow_char == USART_XOFF);
+            if (line.peer_halted && !Sim_PeerStopped()) {
+                Sim_PeerNext(line.now);
+            }
+            break;
+        default:
+            Sim_Poll();
+            break;
+        }
+    }
+
+    Sim_TsDrain();
+    ts_tail = line.ring_count - stats.ts_pos;
+    ts_ok = stats.ts_bad_latch == 0U && stats.ts_bad_end == 0U && stats.ts_bad_time == 0U &&
+            ts_tail <= ((c->mode == USART_FLOW_RTS_HW) ? 1U : 0U);
+
+    lost = stats.in_count - stats.out_count;
+    while (stats.match < stats.in_count && in_lost[stats.match]) {
+        stats.match++;
+    }
+    ok = stats.corrupt == 0U && stats.match == stats.in_count;
+    if (c->mode == USART_FLOW_NONE) {
+        // 不逐字节核对，只确认消费者停顿时确实会丢数据
+        ok = lost > 0U;
+    } else if (c->lossy) {
+        // DMA 停止后 RDR 只能缓存一个字节，多发的字节只能被覆盖，驱动无从察觉
+        ok = ok && lost == line.rdr_overwritten && rx.total_dropped_bytes == 0U && rx.flow_stop_count > 0U;
+    } else {
+        ok = ok && lost == 0U && rx.total_dropped_bytes == 0U && rx.flow_stop_count > 0U;
+    }
+    ok = ok && ts_ok;
+
+    printf("%-8s in %7u B, out %7u B (%5.1f%% of line rate), lost %u, corrupt %u, driver dropped %u\n",
+           c->name, stats.in_count, stats.out_count,
+           100.0 * stats.in_count / (sim_seconds * SIM_BAUD / SIM_CHAR_BITS), lost, stats.corrupt,
+           rx.total_dropped_bytes);
+    printf("         stops %u, backlog max %u B, rdr overwritten %u, xon/xoff sent %u\n",
+           rx.flow_stop_count, stats.backlog_max, line.rdr_overwritten, line.flow_chars);
+    printf("         timestamps %u (dropped %u), covered %u of %u B, bad latch %u, gap/overlap %u, "
+           "backwards %u -> %s\n",
+           stats.ts_records, rx.ts_dropped, stats.ts_pos, line.ring_count, stats.ts_bad_latch, stats.ts_bad_end,
+           stats.ts_bad_time, ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char* argv[])
+{
+    static const Sim_Case cases[] = {
+        { "none", USART_FLOW_NONE, 0, 1 },
+        { "gpio-0", USART_FLOW_RTS_GPIO, 0, 0 },
+        { "gpio-4", USART_FLOW_RTS_GPIO, 4, 0 },
+        { "gpio-16", USART_FLOW_RTS_GPIO, 16, 0 },
+        { "gpio-60", USART_FLOW_RTS_GPIO, 60, 0 },
+        { "xon-0", USART_FLOW_XONXOFF, 0, 0 },
+        { "xon-4", USART_FLOW_XONXOFF, 4, 0 },
+        { "xon-16", USART_FLOW_XONXOFF, 16, 0 },
+        { "xon-60", USART_FLOW_XONXOFF, 60, 0 },
+        { "hw-0", USART_FLOW_RTS_HW, 0, 0 },
+        { "hw-4", USART_FLOW_RTS_HW, 4, 1 },
+        { "hw-16", USART_FLOW_RTS_HW, 16, 1 },
+        { "hw-60", USART_FLOW_RTS_HW, 60, 1 },
+    };
+    const char* only = NULL;
+    int failed = 0;
+    uint32_t i;
+    int opt;
+
+    srand48(1);
+    while ((opt = getopt(argc, argv, "s:t:r:p:q:")) != -1) {
+        switch (opt) {
+        case 's': srand48(strtol(optarg, NULL, 0)); break;
+        case 't': sim_seconds = strtod(optarg, NULL); break;
+        case 'r': consume_rate = strtod(optarg, NULL); break;
+        case 'p': poll_us = strtod(optarg, NULL); break;
+        case 'q': ts_size = (uint32_t)strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: flow_sim [-s seed] [-t seconds] [-r consume_bytes_per_s] [-p poll_us] "
+                            "[-q ts_queue] [case]\n");
+            return 2;
+        }
+    }
+    if (optind < argc) {
+        only = argv[optind];
+    }
+    if (ts_size < 2U || ts_size > SIM_TS_QUEUE_MAX || (ts_size & (ts_size - 1U)) != 0U) {
+        fprintf(stderr, "ts_queue must be a power of 2, 2 .. %u\n", SIM_TS_QUEUE_MAX);
+        return 2;
+    }
+
+    in_max = (uint32_t)(sim_seconds * SIM_BAUD / SIM_CHAR_BITS) + 16U;
+    in_val = malloc(in_max);
+    in_lost = malloc(in_max);
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        if (only == NULL || strcmp(only, cases[i].name) == 0) {
+            failed |= Sim_Run(&cases[i]);
+        }
+    }
+    free(in_val);
+    free(in_lost);
+    return failed;
+}
@@ -0,0 +1,186 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    main.h
+ * @brief   主机端替身：app_drv_serial_rx.c / app_drv_bridge.c 用到的 HAL / CMSIS 声明
+ * @note    接收 DMA、发送 DMA 与 HAL_GetTick 由 bridge_sim.c / flow_sim.c 提供；
+ *          波特率切换、自动波特率只需能编译，寄存器与 GPIO 输出按普通变量读写
+ ******************************************************************************
+ */
+
+#ifndef HOST_MAIN_H_
+#define HOST_MAIN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum {
+    HAL_OK = 0,
+    HAL_ERROR,
+    HAL_BUSY,
+    HAL_TIMEOUT,
+} HAL_StatusTypeDef;
+
+#define RESET                   (0U)
+
+typedef enum {
+    GPIO_PIN_RESET = 0,
+    GPIO_PIN_SET,
+} GPIO_PinState;
+
+typedef struct {
+    volatile uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef struct {
+    volatile uint32_t CR1;
+    volatile uint32_t CR2;
+    volatile uint32_t CR3;
+    volatile uint32_t BRR;
+    volatile uint32_t ISR;
+    volatile uint32_t TDR;
+} USART_TypeDef;
+
+typedef struct {
+    uint32_t BaudRate;
+    uint32_t OverSampling;
+} UART_InitTypeDef;
+
+typedef struct {
+    uint32_t AdvFeatureInit;
+    uint32_t AutoBaudRateEnable;
+    uint32_t AutoBaudRateMode;
+} UART_AdvFeatureInitTypeDef;
+
+typedef struct {
+    USART_TypeDef* Instance;
+    UART_InitTypeDef Init;
+    UART_AdvFeatureInitTypeDef AdvancedInit;
+} UART_HandleTypeDef;
+
+typedef struct {
+    volatile uint32_t CNDTR;
+} DMA_Channel_TypeDef;
+
+typedef struct {
+    DMA_Channel_TypeDef* Instance;
+    volatile uint32_t flags;        // bit 0：半传输，bit 1：传输完成
+} DMA_HandleTypeDef;
+
+typedef enum {
+    UART_CLOCKSOURCE_PCLK1,
+    UART_CLOCKSOURCE_PCLK2,
+    UART_CLOCKSOURCE_HSI,
+    UART_CLOCKSOURCE_SYSCLK,
+    UART_CLOCKSOURCE_LSE,
+    UART_CLOCKSOURCE_UNDEFINED,
+} UART_ClockSourceTypeDef;
+
+// 寄存器位（与 STM32L4 一致）
+#define USART_CR1_OVER8                 (1UL << 15)
+#define USART_CR2_ABREN                 (1UL << 20)
+#define USART_CR2_ABRMODE               (3UL << 21)
+#define USART_CR3_DMAR                  (1UL << 6)
+#define USART_CR3_OVRDIS                (1UL << 12)
+
+#define UART_FLAG_IDLE                  (1UL << 4)
+#define UART_FLAG_TC                    (1UL << 6)
+#define UART_FLAG_TXE                   (1UL << 7)
+#define UART_FLAG_RTOF                  (1UL << 11)
+#define UART_FLAG_ABRE                  (1UL << 14)
+#define UART_FLAG_ABRF                  (1UL << 15)
+#define UART_FLAG_BUSY                  (1UL << 16)
+#define UART_FLAG_REACK                 (1UL << 22)
+#define UART_CLEAR_RTOF                 UART_FLAG_RTOF
+
+#define UART_IT_IDLE                    (0U)
+#define UART_IT_RTO                     (0U)
+#define DMA_IT_HT                       (0U)
+#define DMA_IT_TC                       (0U)
+
+#define UART_OVERSAMPLING_16            (0U)
+#define UART_OVERSAMPLING_8             USART_CR1_OVER8
+#define UART_AUTOBAUD_REQUEST           (1U)
+#define UART_ADVFEATURE_AUTOBAUDRATE_INIT       (1UL << 5)
+#define UART_ADVFEATURE_AUTOBAUDRATE_ENABLE     USART_CR2_ABREN
+
+#define HSI_VALUE                       (16000000UL)
+#define LSE_VALUE                       (32768UL)
+
+#define SET_BIT(REG, BIT)               ((REG) |= (BIT))
+#define READ_BIT(REG, BIT)              ((REG) & (BIT))
+#define ATOMIC_SET_BIT(REG, BIT)        ((REG) |= (BIT))
+#define ATOMIC_CLEAR_BIT(REG, BIT)      ((REG) &= ~(BIT))
+
+#define __HAL_UART_GET_FLAG(h, f)       ((((h)->Instance->ISR) & (f)) == (f))
+#define __HAL_UART_CLEAR_FLAG(h, f)     ((h)->Instance->ISR &= ~(f))
+#define __HAL_UART_CLEAR_IDLEFLAG(h)    __HAL_UART_CLEAR_FLAG((h), UART_FLAG_IDLE)
+#define __HAL_UART_ENABLE_IT(h, i)      ((void)(h))
+#define __HAL_UART_ENABLE(h)            ((void)(h))
+#define __HAL_UART_DISABLE(h)           ((void)(h))
+#define __HAL_UART_SEND_REQ(h, r)       ((void)(h))
+#define __HAL_DMA_ENABLE_IT(h, i)       ((void)(h))
+#define __HAL_DMA_GET_COUNTER(h)        ((h)->Instance->CNDTR)
+#define __HAL_DMA_GET_HT_FLAG_INDEX(h)  (1U)
+#define __HAL_DMA_GET_TC_FLAG_INDEX(h)  (2U)
+#define __HAL_DMA_GET_FLAG(h, f)        ((h)->flags & (f))
+#define UART_GETCLOCKSOURCE(h, s)       ((void)(h), (s) = UART_CLOCKSOURCE_PCLK1)
+#define UART_INSTANCE_LOWPOWER(h)       (0)
+#define IS_USART_AUTOBAUDRATE_DETECTION_INSTANCE(i)     (1)
+
+typedef struct {
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+DWT_Type* Host_Dwt(void);
+
+#define DWT                             (Host_Dwt())
+
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t primask) { (void)primask; }
+static inline void __disable_irq(void) {}
+static inline void __DMB(void) {}
+
+static inline uint32_t HAL_RCC_GetPCLK1Freq(void) { return 80000000UL; }
+static inline uint32_t HAL_RCC_GetPCLK2Freq(void) { return 80000000UL; }
+static inline uint32_t HAL_RCC_GetSysClockFreq(void) { return 80000000UL; }
+
+static inline void HAL_GPIO_WritePin(GPIO_TypeDef* port, uint16_t pin, GPIO_PinState state)
+{
+    if (state == GPIO_PIN_SET) {
+        port->ODR |= pin;
+    } else {
+        port->ODR &= ~(uint32_t)pin;
+    }
+}
+
+static inline void HAL_UART_ReceiverTimeout_Config(UART_HandleTypeDef* huart, uint32_t timeout)
+{
+    (void)huart;
+    (void)timeout;
+}
+
+static inline HAL_StatusTypeDef HAL_UART_EnableReceiverTimeout(UART_HandleTypeDef* huart)
+{
+    (void)huart;
+    return HAL_OK;
+}
+
+static inline HAL_StatusTypeDef UART_SetConfig(UART_HandleTypeDef* huart)
+{
+    huart->Instance->BRR = HAL_RCC_GetPCLK1Freq() / huart->Init.BaudRate;
+    return HAL_OK;
+}
+
+static inline void UART_AdvFeatureConfig(UART_HandleTypeDef* huart)
+{
+    (void)huart;
+}
+
+uint32_t HAL_GetTick(void);
+HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef* huart, uint8_t* pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef* huart, const uint8_t* pData, uint16_t Size);
+
+#endif /* HOST_MAIN_H_ */
@@ -0,0 +1,16 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    usart.h
+ * @brief   主机端替身：app_drv_serial_rx.c 包含的 CubeMX 串口头文件
+ ******************************************************************************
+ */
+
+#ifndef HOST_USART_H_
+#define HOST_USART_H_
+
+#include "main.h"
+
+#endif /* HOST_USART_H_ */
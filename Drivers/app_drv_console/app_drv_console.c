@@ -0,0 +1,254 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    app_drv_console.c
+ * @brief   命令行控制台
+ * @note    直接从接收 FIFO 增量分词，编译期完美哈希表分发命令，无动态内存
+ ******************************************************************************
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "app_drv_console.h"
+
+#define CONSOLE_PROMPT  "> "
+
+static void CONSOLE_ResetLine(CONSOLE_Context* ctx)
+{
+    ctx->pos = 0;
+    ctx->argc = 0;
+    ctx->in_token = 0;
+    ctx->in_quote = 0;
+    ctx->overflow = 0;
+}
+
+/**
+ * @brief 结束当前 token
+ */
+static void CONSOLE_EndToken(CONSOLE_Context* ctx)
+{
+    if (!ctx->in_token) {
+        return;
+    }
+    ctx->in_token = 0;
+    if (ctx->pos < CONSOLE_LINE_MAX) {
+        ctx->tokens[ctx->pos++] = '\0';
+    } else {
+        ctx->overflow = 1;
+    }
+}
+
+/**
+ * @brief 查找并执行命令
+ */
+static void CONSOLE_Dispatch(CONSOLE_Context* ctx)
+{
+    const CONSOLE_Command* cmd;
+    const char* name = ctx->argv[0];
+    uint16_t len = (uint16_t)strlen(name);
+    uint32_t start = DWT->CYCCNT;
+
+    cmd = &ctx->commands[CONSOLE_HASH(len, name[0], name[len - 1U])];
+    if (cmd->name == NULL || strcmp(cmd->name, name) != 0) {
+        cmd = NULL;
+    }
+
+    ctx->dispatch_cycles_last = DWT->CYCCNT - start;
+    if (ctx->dispatch_cycles_last > ctx->dispatch_cycles_max) {
+        ctx->dispatch_cycles_max = ctx->dispatch_cycles_last;
+    }
+
+    if (cmd == NULL) {
+        ctx->unknown_count++;
+        CONSOLE_Printf(ctx, "unknown command: %s\r\n", name);
+        return;
+    }
+    ctx->line_count++;
+    cmd->handler(ctx, ctx->argc, ctx->argv);
+}
+
+/**
+ * @brief 行结束处理
+ */
+static void CONSOLE_EndLine(CONSOLE_Context* ctx)
+{
+    CONSOLE_EndToken(ctx);
+    if (ctx->echo) {
+        CONSOLE_Puts(ctx, "\r\n");
+    }
+
+    if (ctx->overflow) {
+        ctx->overflow_count++;
+        CONSOLE_Puts(ctx, "line too long\r\n");
+    } else if (ctx->argc > 0U) {
+        CONSOLE_Dispatch(ctx);
+    }
+
+    CONSOLE_ResetLine(ctx);
+    CONSOLE_Puts(ctx, CONSOLE_PROMPT);
+}
+
+/**
+ * @brief 处理一个输入字符
+ */
+static void CONSOLE_Feed(CONSOLE_Context* ctx, char c)
+{
+    uint8_t last_cr = ctx->last_cr;
+
+    ctx->last_cr = (c == '\r') ? 1U : 0U;
+
+    if (c == '\r' || c == '\n') {
+        // "\r\n" 只处理一次
+        if (!(c == '\n' && last_cr)) {
+            CONSOLE_EndLine(ctx);
+        }
+        return;
+    }
+
+    // 退格：只在当前 token 内回退
+    if (c == '\b' || c == 0x7F) {
+        if (ctx->in_token && !ctx->overflow) {
+            ctx->pos--;
+            if (ctx->pos == (uint16_t)(ctx->argv[ctx->argc - 1U] - ctx->tokens)) {
+                ctx->argc--;
+                ctx->in_token = 0;
+            }
+            if (ctx->echo) {
+                CONSOLE_Puts(ctx, "\b \b");
+            }
+        }
+        return;
+    }
+
+    if (ctx->echo) {
+        ctx->write(ctx->user, &c, 1);
+    }
+
+    if (c == '"') {
+        ctx->in_quote = !ctx->in_quote;
+        return;
+    }
+    if ((c == ' ' || c == '\t') && !ctx->in_quote) {
+        CONSOLE_EndToken(ctx);
+        return;
+    }
+    if (ctx->overflow) {
+        return;
+    }
+
+    // 新 token 开始
+    if (!ctx->in_token) {
+        if (ctx->argc >= CONSOLE_MAX_ARGS) {
+            ctx->overflow = 1;
+            return;
+        }
+        ctx->argv[ctx->argc++] = &ctx->tokens[ctx->pos];
+        ctx->in_token = 1;
+    }
+
+    // 保留一个字节给结尾的 '\0'
+    if (ctx->pos >= CONSOLE_LINE_MAX - 1U) {
+        ctx->overflow = 1;
+        return;
+    }
+    ctx->tokens[ctx->pos++] = c;
+}
+
+/**
+ * @brief 初始化控制台
+ * @param ctx 指向 CONSOLE_Context 结构体的指针
+ * @param commands 命令表，长度为 CONSOLE_HASH_SIZE
+ * @param write 输出函数
+ * @param user 传递给输出函数的用户参数
+ * @return 槽位与名称哈希不一致的表项数
+ */
+uint8_t CONSOLE_Init(CONSOLE_Context* ctx, const CONSOLE_Command* commands,
+                     CONSOLE_Write_Func write, void* user)
+{
+    uint8_t mismatch = 0;
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->commands = commands;
+    ctx->write = write;
+    ctx->user = user;
+    ctx->echo = 1;
+
+    // 使能 DWT 周期计数器，用于分发耗时统计
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    // 校验命令表：手写的长度/首尾字符与名称不一致时该命令无法被找到
+    for (uint32_t slot = 0; slot < CONSOLE_HASH_SIZE; slot++) {
+        const char* name = commands[slot].name;
+        if (name != NULL) {
+            uint16_t len = (uint16_t)strlen(name);
+            if (len == 0U || CONSOLE_HASH(len, name[0], name[len - 1U]) != slot) {
+                mismatch++;
+            }
+        }
+    }
+
+    CONSOLE_Puts(ctx, CONSOLE_PROMPT);
+    return mismatch;
+}
+
+/**
+ * @brief 处理接收 FIFO 中的字符
+ * @param ctx 指向 CONSOLE_Context 结构体的指针
+ * @param fifo 串口接收 FIFO
+ */
+void CONSOLE_Process(CONSOLE_Context* ctx, app_drv_fifo_t* fifo)
+{
+    while (!app_drv_fifo_is_empty(fifo)) {
+        CONSOLE_Feed(ctx, (char)app_drv_fifo_pop(fifo));
+    }
+}
+
+/**
+ * @brief 格式化输出
+ */
+void CONSOLE_Printf(CONSOLE_Context* ctx, const char* format, ...)
+{
+    char buffer[CONSOLE_OUTPUT_MAX];
+    va_list args;
+    int len;
+
+    va_start(args, format);
+    len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    if (len <= 0) {
+        return;
+    }
+    if (len >= (int)sizeof(buffer)) {
+        len = sizeof(buffer) - 1;
+    }
+    ctx->write(ctx->user, buffer, (uint16_t)len);
+}
+
+/**
+ * @brief 输出字符串
+ */
+void CONSOLE_Puts(CONSOLE_Context* ctx, const char* str)
+{
+    ctx->write(ctx->user, str, (uint16_t)strlen(str));
+}
+
+/**
+ * @brief 打印命令列表
+ */
+void CONSOLE_CmdHelp(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    for (uint32_t slot = 0; slot < CONSOLE_HASH_SIZE; slot++) {
+        const CONSOLE_Command* cmd = &ctx->commands[slot];
+        if (cmd->name != NULL) {
+            CONSOLE_Printf(ctx, "  %-10s %s\r\n", cmd->name, (cmd->help != NULL) ? cmd->help : "");
+        }
+    }
+}
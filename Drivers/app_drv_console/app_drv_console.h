@@ -0,0 +1,92 @@
+#ifndef APP_DRV_CONSOLE_H_
+#define APP_DRV_CONSOLE_H_
+
+#include <stdint.h>
+#include "main.h"
+#include "app_drv_fifo.h"
+
+/*
+ * 命令行控制台（无动态内存）
+ *
+ * 逐字节从接收 FIFO 取数据并增量分词：字符直接写入 token 区，遇到空白写入 '\0'
+ * 并记录 argv，不做整行拷贝；支持双引号包含空格、退格、回显，"\r\n" 视为一次换行。
+ *
+ * 命令分发使用编译期完美哈希：槽位 = CONSOLE_HASH(长度, 首字符, 尾字符)，
+ * 命令表以指定初始化器按槽位放置，行结束时 O(1) 定位后再用 strcmp 确认。
+ * 推荐用 X 宏定义命令列表，同时生成命令表和 switch 检查函数，槽位冲突会产生
+ * "duplicate case value" 编译错误（见 main.c）。
+ */
+
+#ifndef CONSOLE_LINE_MAX
+  #define CONSOLE_LINE_MAX      (96U)    // 单行最大字符数（含各 token 的 '\0'）
+#endif
+
+#ifndef CONSOLE_MAX_ARGS
+  #define CONSOLE_MAX_ARGS      (8U)
+#endif
+
+#ifndef CONSOLE_OUTPUT_MAX
+  #define CONSOLE_OUTPUT_MAX    (128U)   // CONSOLE_Printf 单次输出最大长度
+#endif
+
+#define CONSOLE_HASH_SIZE       (32U)    // 命令表槽位数（2 的幂）
+#define CONSOLE_HASH(len, first, last) \
+    ((((uint32_t)(len) * 7U) + ((uint32_t)(first) * 3U) + (uint32_t)(last)) & (CONSOLE_HASH_SIZE - 1U))
+
+typedef struct CONSOLE_Context CONSOLE_Context;
+
+// 命令处理函数类型定义，argv[0] 为命令名
+typedef void (*CONSOLE_Handler)(CONSOLE_Context* ctx, uint8_t argc, char* argv[]);
+
+// 输出函数类型定义
+typedef void (*CONSOLE_Write_Func)(void* user, const char* data, uint16_t length);
+
+// 命令表项（name 为 NULL 表示空槽位）
+typedef struct {
+    const char* name;
+    CONSOLE_Handler handler;
+    const char* help;
+} CONSOLE_Command;
+
+// 控制台上下文结构体
+struct CONSOLE_Context {
+    const CONSOLE_Command* commands;    // CONSOLE_HASH_SIZE 个槽位
+    CONSOLE_Write_Func write;
+    void* user;
+    uint8_t echo;                       // 1：回显输入字符
+
+    // 增量分词状态
+    char tokens[CONSOLE_LINE_MAX];
+    uint16_t pos;
+    char* argv[CONSOLE_MAX_ARGS];
+    uint8_t argc;
+    uint8_t in_token;
+    uint8_t in_quote;
+    uint8_t overflow;                   // 行过长或参数过多，整行丢弃
+    uint8_t last_cr;
+
+    // 统计
+    uint32_t line_count;                // 执行的命令行数
+    uint32_t unknown_count;             // 未知命令数
+    uint32_t overflow_count;            // 过长被丢弃的行数
+    uint32_t dispatch_cycles_last;      // 最近一次分发（哈希定位 + 确认）耗时，DWT 周期
+    uint32_t dispatch_cycles_max;
+};
+
+// 初始化，返回命令表中槽位与名称不一致的表项数（应为 0）
+uint8_t CONSOLE_Init(CONSOLE_Context* ctx, const CONSOLE_Command* commands,
+                     CONSOLE_Write_Func write, void* user);
+
+// 主循环中调用：处理接收 FIFO 中的全部字符
+void CONSOLE_Process(CONSOLE_Context* ctx, app_drv_fifo_t* fifo);
+
+// 格式化输出（栈上 CONSOLE_OUTPUT_MAX 字节缓冲区，超长截断）
+void CONSOLE_Printf(CONSOLE_Context* ctx, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+// 输出字符串
+void CONSOLE_Puts(CONSOLE_Context* ctx, const char* str);
+
+// 打印命令列表（可作为 help 命令的处理函数）
+void CONSOLE_CmdHelp(CONSOLE_Context* ctx, uint8_t argc, char* argv[]);
+
+#endif /* APP_DRV_CONSOLE_H_ */
@@ -0,0 +1,379 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    console_bench.c
+ * @brief   命令行控制台主机端分发耗时测试（Linux / macOS）
+ * @note    与固件共用 app_drv_console.c，同目录的 main.h 替代 DWT：
+ *            cc -O2 -I. -I.. -I../../app_drv_fifo -o console_bench console_bench.c \
+ *               ../app_drv_console.c ../../app_drv_fifo/app_drv_fifo.c
+ *
+ *          命令表与 main.c 的 CONSOLE_COMMANDS 相同（处理函数换成计数），每行经接收 FIFO
+ *          交给 CONSOLE_Process，逐行读取 dispatch_cycles_last，并统计整行处理耗时。
+ *          x86 上 DWT->CYCCNT 读 TSC，其他平台按纳秒计数；结果已减去两次读取本身的开销。用例：
+ *            dispatch  每个命令与若干未知命令（含与已有命令同槽位的名称）各执行 N 行：
+ *                      分发耗时（哈希定位 + strcmp 确认）、整行处理耗时，
+ *                      并与对同一张表逐项 strcmp 的线性查找对比；处理函数调用次数、
+ *                      argc 与 unknown_count 不符时 FAIL
+ *            parse     引号、退格、"\r\n"、过长行与参数过多时的分词结果
+ *
+ *            console_bench [-n lines] [dispatch|parse]
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "app_drv_console.h"
+
+#define SIM_FIFO_SIZE           (256U)
+
+typedef struct {
+    uint32_t calls;
+    uint8_t argc;
+    char args[CONSOLE_LINE_MAX];    // 最近一次调用的参数，以 '|' 连接
+} Sim_Slot;
+
+CoreDebug_Type host_core_debug;
+
+static Sim_Slot sim_slots[CONSOLE_HASH_SIZE];
+static CONSOLE_Context console;
+static app_drv_fifo_t rx_fifo;
+static uint8_t rx_buffer[SIM_FIFO_SIZE];
+static uint32_t sim_output_bytes;
+
+static uint32_t Sim_Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec);
+#endif
+}
+
+DWT_Type* Host_Dwt(void)
+{
+    static DWT_Type dwt;
+
+    dwt.CYCCNT = Sim_Cycles();
+    return &dwt;
+}
+
+static void Sim_Handler(CONSOLE_Context* ctx, uint8_t argc, char* argv[])
+{
+    const char* name = argv[0];
+    size_t len = strlen(name);
+    Sim_Slot* slot = &sim_slots[CONSOLE_HASH(len, name[0], name[len - 1U])];
+    uint16_t pos = 0;
+
+    (void)ctx;
+    slot->calls++;
+    slot->argc = argc;
+    for (uint8_t i = 1; i < argc; i++) {
+        pos += (uint16_t)snprintf(&slot->args[pos], sizeof(slot->args) - pos, "%s%s", (i > 1U) ? "|" : "", argv[i]);
+    }
+    slot->args[pos] = '\0';
+}
+
+// 与 main.c 的命令列表相同：名称, 长度, 首字符, 尾字符, 说明
+#define SIM_COMMANDS(X) \
+    X("help",   4, 'h', 'p', "list commands") \
+    X("stats",  5, 's', 's', "receive statistics") \
+    X("clear",  5, 'c', 'r', "reset statistics") \
+    X("isr",    3, 'i', 'r', "interrupt timing") \
+    X("pools",  5, 'p', 's', "buffer and RAM usage") \
+    X("temp",   4, 't', 'p', "internal temperature") \
+    X("dfsdm",  5, 'd', 'm', "sigma-delta input level") \
+    X("stream", 6, 's', 'm', "telemetry stream") \
+    X("bridge", 6, 'b', 'e', "uart bridge") \
+    X("baudrate", 8, 'b', 'e', "usart1 baud rate") \
+    X("arq",    3, 'a', 'q', "bulk transfer") \
+    X("fw",     2, 'f', 'w', "firmware update over usart1") \
+    X("log",    3, 'l', 'g', "flash rx log") \
+    X("bench",  5, 'b', 'h', "CMSIS-DSP benchmark CSV") \
+    X("reboot", 6, 'r', 't', "system reset")
+
+#define SIM_TABLE_ENTRY(name, len, first, last, help) \
+    [CONSOLE_HASH(len, first, last)] = { name, Sim_Handler, help },
+#define SIM_NAME_ENTRY(name, len, first, last, help) name,
+
+static const CONSOLE_Command sim_commands[CONSOLE_HASH_SIZE] = {
+    SIM_COMMANDS(SIM_TABLE_ENTRY)
+};
+
+static const char* const sim_names[] = {
+    SIM_COMMANDS(SIM_NAME_ENTRY)
+};
+
+// 未知命令：hoop/lag/stas 与 help/log/temp 同槽位，需 strcmp 才能拒绝；其余落在空槽位
+static const char* const sim_unknown[] = { "hoop", "lag", "stas", "statistics", "x" };
+
+#define SIM_NAME_COUNT          (sizeof(sim_names) / sizeof(sim_names[0]))
+#define SIM_UNKNOWN_COUNT       (sizeof(sim_unknown) / sizeof(sim_unknown[0]))
+
+static void Sim_Write(void* user, const char* data, uint16_t length)
+{
+    (void)user;
+    (void)data;
+    sim_output_bytes += length;
+}
+
+static uint8_t Sim_Reset(void)
+{
+    uint8_t mismatch;
+
+    memset(sim_slots, 0, sizeof(sim_slots));
+    app_drv_fifo_init(&rx_fifo, rx_buffer, SIM_FIFO_SIZE);
+    mismatch = CONSOLE_Init(&console, sim_commands, Sim_Write, NULL);
+    console.echo = 0;
+    return mismatch;
+}
+
+static void Sim_Feed(const char* text)
+{
+    uint16_t len = (uint16_t)strlen(text);
+
+    app_drv_fifo_write(&rx_fifo, (uint8_t*)text, &len);
+    CONSOLE_Process(&console, &rx_fifo);
+}
+
+// 两次连续读取 DWT->CYCCNT 的最小差值，即测量本身的开销
+static uint32_t Sim_ReadOverhead(void)
+{
+    uint32_t best = UINT32_MAX;
+
+    for (uint32_t i = 0; i < 10000U; i++) {
+        uint32_t start = DWT->CYCCNT;
+        uint32_t delta = DWT->CYCCNT - start;
+        if (delta < best) {
+            best = delta;
+        }
+    }
+    return best;
+}
+
+// 对同一张表逐项 strcmp 的线性查找，作为对照
+static const CONSOLE_Command* Sim_LinearFind(const char* name)
+{
+    for (uint32_t slot = 0; slot < CONSOLE_HASH_SIZE; slot++) {
+        if (sim_commands[slot].name != NULL && strcmp(sim_commands[slot].name, name) == 0) {
+            return &sim_commands[slot];
+        }
+    }
+    return NULL;
+}
+
+static volatile const CONSOLE_Command* sim_sink;   // 防止线性查找被优化掉
+
+#define SIM_HIST_SIZE           (4096U)
+
+typedef struct {
+    double dispatch_mean;
+    uint32_t dispatch_min;
+    uint32_t dispatch_p99;      // 主机上最大值受调度与中断影响，改报 99 百分位
+    double line_mean;           // 整行 CONSOLE_Process 耗时
+    double linear_mean;
+} Sim_Timing;
+
+static uint32_t sim_hist[SIM_HIST_SIZE];
+
+// 减去读取开销，不小于 0
+static uint32_t Sim_Net(uint32_t delta, uint32_t overhead)
+{
+    return (delta > overhead) ? delta - overhead : 0U;
+}
+
+static void Sim_Measure(const char* name, uint32_t lines, uint32_t overhead, Sim_Timing* t)
+{
+    char line[CONSOLE_LINE_MAX];
+    uint64_t dispatch_sum = 0;
+    uint64_t line_sum = 0;
+    uint64_t linear_sum = 0;
+
+    uint32_t count = 0;
+
+    snprintf(line, sizeof(line), "%s on 115200\r\n", name);
+    memset(sim_hist, 0, sizeof(sim_hist));
+    t->dispatch_min = UINT32_MAX;
+    for (uint32_t i = 0; i < lines; i++) {
+        uint32_t start = DWT->CYCCNT;
+        uint32_t d;
+
+        Sim_Feed(line);
+        line_sum += Sim_Net(DWT->CYCCNT - start, overhead);
+
+        d = Sim_Net(console.dispatch_cycles_last, overhead);
+        dispatch_sum += d;
+        if (d < t->dispatch_min) {
+            t->dispatch_min = d;
+        }
+        sim_hist[(d < SIM_HIST_SIZE) ? d : SIM_HIST_SIZE - 1U]++;
+
+        start = DWT->CYCCNT;
+        sim_sink = Sim_LinearFind(name);
+        linear_sum += Sim_Net(DWT->CYCCNT - start, overhead);
+    }
+    for (t->dispatch_p99 = 0; t->dispatch_p99 < SIM_HIST_SIZE - 1U; t->dispatch_p99++) {
+        count += sim_hist[t->dispatch_p99];
+        if (count >= lines - lines / 100U) {
+            break;
+        }
+    }
+    t->dispatch_mean = (double)dispatch_sum / lines;
+    t->line_mean = (double)line_sum / lines;
+    t->linear_mean = (double)linear_sum / lines;
+}
+
+static int Sim_Dispatch(uint32_t lines)
+{
+    uint32_t overhead;
+    uint32_t bad = 0;
+    Sim_Timing t;
+
+    Sim_Reset();
+    overhead = Sim_ReadOverhead();
+    printf("dispatch: %u lines each, \"<name> on 115200\", %s, read overhead %u subtracted\n", lines,
+#if defined(__x86_64__) || defined(__i386__)
+           "TSC cycles",
+#else
+           "ns",
+#endif
+           overhead);
+    printf("  %-10s %4s  %9s %6s %8s  %10s  %11s\n", "command", "slot", "dispatch", "min", "p99",
+           "line", "linear scan");
+
+    for (uint32_t i = 0; i < SIM_NAME_COUNT; i++) {
+        const char* name = sim_names[i];
+        uint32_t slot = CONSOLE_HASH(strlen(name), name[0], name[strlen(name) - 1U]);
+
+        Sim_Measure(name, lines, overhead, &t);
+        printf("  %-10s %4u  %9.1f %6u %8u  %10.1f  %11.1f\n", name, slot, t.dispatch_mean,
+               t.dispatch_min, t.dispatch_p99, t.line_mean, t.linear_mean);
+        if (sim_slots[slot].calls != lines || sim_slots[slot].argc != 3U
+            || strcmp(sim_slots[slot].args, "on|115200") != 0) {
+            printf("    handler calls %u, argc %u, args \"%s\"\n", sim_slots[slot].calls,
+                   sim_slots[slot].argc, sim_slots[slot].args);
+            bad++;
+        }
+    }
+    for (uint32_t i = 0; i < SIM_UNKNOWN_COUNT; i++) {
+        const char* name = sim_unknown[i];
+        uint32_t slot = CONSOLE_HASH(strlen(name), name[0], name[strlen(name) - 1U]);
+
+        Sim_Measure(name, lines, overhead, &t);
+        printf("  %-10s %4u  %9.1f %6u %8u  %10.1f  %11.1f  (unknown%s)\n", name, slot, t.dispatch_mean,
+               t.dispatch_min, t.dispatch_p99, t.line_mean, t.linear_mean,
+               (sim_commands[slot].name != NULL) ? ", slot taken" : "");
+    }
+
+    if (console.line_count != lines * SIM_NAME_COUNT || console.unknown_count != lines * SIM_UNKNOWN_COUNT) {
+        printf("  line_count %u, unknown_count %u\n", console.line_count, console.unknown_count);
+        bad++;
+    }
+    printf("dispatch: -> %s\n", bad ? "FAIL" : "PASS");
+    return bad ? 1 : 0;
+}
+
+// 输入一行，检查命中的槽位、argc 与参数
+static uint32_t Sim_ParseCase(const char* input, const char* name, uint8_t argc, const char* args)
+{
+    char shown[48];
+    uint32_t n = 0;
+    uint32_t slot;
+    uint32_t lines = console.line_count;
+    uint32_t overflows = console.overflow_count;
+    uint32_t bad = 0;
+
+    Sim_Feed(input);
+    if (name == NULL) {
+        bad = (console.overflow_count != overflows + 1U || console.line_count != lines);
+    } else {
+        slot = CONSOLE_HASH(strlen(name), name[0], name[strlen(name) - 1U]);
+        bad = (console.line_count != lines + 1U || sim_slots[slot].argc != argc
+               || strcmp(sim_slots[slot].args, args) != 0);
+        if (bad) {
+            printf("    got argc %u, args \"%s\"\n", sim_slots[slot].argc, sim_slots[slot].args);
+        }
+    }
+    for (const char* c = input; *c != '\0' && n < sizeof(shown) - 3U; c++) {
+        const char* esc = (*c == '\r') ? "\\r" : (*c == '\n') ? "\\n" : (*c == '\t') ? "\\t" : (*c == '\b') ? "\\b" : NULL;
+        if (esc != NULL) {
+            shown[n++] = esc[0];
+            shown[n++] = esc[1];
+        } else {
+            shown[n++] = *c;
+        }
+    }
+    shown[n] = '\0';
+    printf("  %-46s -> %s\n", shown, bad ? "FAIL" : "ok");
+    return bad;
+}
+
+static int Sim_Parse(void)
+{
+    char long_line[CONSOLE_LINE_MAX + 16];
+    uint32_t bad = 0;
+
+    Sim_Reset();
+    printf("parse:\n");
+    bad += Sim_ParseCase("log dump 4\r\n", "log", 3, "dump|4");
+    bad += Sim_ParseCase("  bridge\trate   9600  \n", "bridge", 3, "rate|9600");
+    bad += Sim_ParseCase("stream \"a b\" c\r", "stream", 3, "a b|c");
+    bad += Sim_ParseCase("\nstats\r\n", "stats", 1, "");
+    bad += Sim_ParseCase("tempx\b\b\b\b\bisr load 1000 5\n", "isr", 4, "load|1000|5");
+    bad += Sim_ParseCase("arq send 12\b3\r\n", "arq", 3, "send|13");
+    bad += Sim_ParseCase("fw 1 2 3 4 5 6 7 8\r\n", NULL, 0, NULL);
+
+    memset(long_line, 'a', sizeof(long_line));
+    memcpy(long_line, "log ", 4);
+    memcpy(&long_line[sizeof(long_line) - 3U], "\r\n", 3);
+    bad += Sim_ParseCase(long_line, NULL, 0, NULL);
+    bad += Sim_ParseCase("log rewind\r\n", "log", 2, "rewind");
+
+    printf("parse: -> %s\n", bad ? "FAIL" : "PASS");
+    return bad ? 1 : 0;
+}
+
+int main(int argc, char* argv[])
+{
+    const char* only = NULL;
+    uint32_t lines = 100000U;
+    int failed = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:")) != -1) {
+        switch (opt) {
+        case 'n': lines = (uint32_t)strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: console_bench [-n lines] [dispatch|parse]\n");
+            return 2;
+        }
+    }
+    if (optind < argc) {
+        only = argv[optind];
+    }
+
+    if (Sim_Reset() != 0U) {
+        printf("table: command slots do not match CONSOLE_HASH\n");
+        failed = 1;
+    }
+
+    if (only == NULL || strcmp(only, "dispatch") == 0) {
+        failed |= Sim_Dispatch(lines);
+    }
+    if (only == NULL || strcmp(only, "parse") == 0) {
+        failed |= Sim_Parse();
+    }
+    return failed;
+}
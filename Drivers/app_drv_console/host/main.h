@@ -0,0 +1,34 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    main.h
+ * @brief   主机端替身：app_drv_console.c 用到的 DWT / CoreDebug 寄存器
+ * @note    DWT->CYCCNT 由 console_bench.c 提供，x86 上读 TSC，其他平台按纳秒计数
+ ******************************************************************************
+ */
+
+#ifndef HOST_MAIN_H_
+#define HOST_MAIN_H_
+
+#include <stdint.h>
+
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+DWT_Type* Host_Dwt(void);
+extern CoreDebug_Type host_core_debug;
+
+#define DWT                             (Host_Dwt())
+#define CoreDebug                       (&host_core_debug)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL)
+
+#endif /* HOST_MAIN_H_ */
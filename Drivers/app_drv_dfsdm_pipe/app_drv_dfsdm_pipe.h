@@ -0,0 +1,76 @@
+#ifndef APP_DRV_DFSDM_PIPE_H_
+#define APP_DRV_DFSDM_PIPE_H_
+
+#include <stdint.h>
+#include "main.h"
+#include "arm_math.h"
+
+/*
+ * DFSDM Σ-Δ 前端 + CMSIS-DSP 后级滤波流水线
+ *
+ * DFSDM 滤波器在硬件中完成位流的 Sinc 抽取，寄存器输出经 DMA 循环写入双块缓冲区
+ * (q31，24 位有效数据在高位)；半传输/传输完成中断中对刚写满的一块整体做：
+ *   arm_fir_decimate_q31        抗混叠低通 + 2 倍抽取
+ *   arm_biquad_cascade_df1_q31  二阶 Butterworth 高通，去除直流
+ * 逐点 CPU 开销仅为 DMA 搬运，软件滤波按块进行。
+ *
+ * DFSDM 数据寄存器低 8 位为通道号/状态位，作为 q31 处理时相当于 2^-23 量级的固定偏置，
+ * 由高通级去除，不单独屏蔽。
+ *
+ * 默认配置（见 Core/Src/dfsdm.c）：1 MHz 位流，Sinc4 64 倍 -> 15.625 kHz，
+ * 软件再 2 倍抽取 -> 7.8125 kHz，通带 0 ~ 2.5 kHz，阻带 (>4.8 kHz) 衰减约 68 dB。
+ */
+
+// DFSDM 输出每块点数（DMA 缓冲区为 2 块，须为抽取倍数的整数倍）
+#ifndef DFSDM_PIPE_BLOCK_SIZE
+  #define DFSDM_PIPE_BLOCK_SIZE     (128U)
+#endif
+
+#define DFSDM_PIPE_DECIMATION       (2U)    // 软件抽取倍数
+#define DFSDM_PIPE_FIR_TAPS         (32U)   // 抗混叠 FIR 阶数
+#define DFSDM_PIPE_BIQUAD_STAGES    (1U)    // 高通双二阶节数
+#define DFSDM_PIPE_OUTPUT_SIZE      (DFSDM_PIPE_BLOCK_SIZE / DFSDM_PIPE_DECIMATION)
+
+// 块回调函数类型定义（在 DMA 中断中调用）
+typedef void (*DFSDM_Pipe_Block_Func)(void* user, const q31_t* block, uint16_t length);
+
+// DFSDM 流水线上下文结构体
+typedef struct {
+    DFSDM_Filter_HandleTypeDef* hfilter;
+    int32_t dma_buffer[2U * DFSDM_PIPE_BLOCK_SIZE];
+    q31_t output[DFSDM_PIPE_OUTPUT_SIZE];
+
+    // CMSIS-DSP 滤波器实例与状态
+    arm_fir_decimate_instance_q31 fir;
+    q31_t fir_state[DFSDM_PIPE_FIR_TAPS + DFSDM_PIPE_BLOCK_SIZE - 1U];
+    arm_biquad_casd_df1_inst_q31 biquad;
+    q31_t biquad_state[4U * DFSDM_PIPE_BIQUAD_STAGES];
+
+    DFSDM_Pipe_Block_Func block_callback;
+    void* block_user;
+
+    // 统计
+    uint32_t block_count;           // 已处理的块数
+    uint32_t overrun_count;         // 处理结束时 DMA 已回绕写入该块的次数
+    uint32_t filter_cycles_last;    // 最近一块滤波耗时，DWT 周期
+    uint32_t filter_cycles_max;
+} DFSDM_Pipe_Context;
+
+// 初始化：初始化软件滤波器（hfilter 可为 NULL，仅使用 DFSDM_Pipe_Filter）
+void DFSDM_Pipe_Init(DFSDM_Pipe_Context* ctx, DFSDM_Filter_HandleTypeDef* hfilter);
+
+// 注册块回调函数
+void DFSDM_Pipe_RegisterBlockCallback(DFSDM_Pipe_Context* ctx, DFSDM_Pipe_Block_Func func, void* user);
+
+// 启动/停止采样
+HAL_StatusTypeDef DFSDM_Pipe_Start(DFSDM_Pipe_Context* ctx);
+void DFSDM_Pipe_Stop(DFSDM_Pipe_Context* ctx);
+
+// 在 HAL_DFSDM_FilterRegConvHalfCpltCallback / HAL_DFSDM_FilterRegConvCpltCallback 中调用
+void DFSDM_Pipe_HalfComplete(DFSDM_Pipe_Context* ctx);
+void DFSDM_Pipe_Complete(DFSDM_Pipe_Context* ctx);
+
+// 整块滤波：DFSDM_PIPE_BLOCK_SIZE 点输入 -> ctx->output（DFSDM_PIPE_OUTPUT_SIZE 点）
+void DFSDM_Pipe_Filter(DFSDM_Pipe_Context* ctx, const q31_t* src);
+
+#endif /* APP_DRV_DFSDM_PIPE_H_ */
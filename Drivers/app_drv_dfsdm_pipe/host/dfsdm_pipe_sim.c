@@ -0,0 +1,465 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    dfsdm_pipe_sim.c
+ * @brief   DFSDM 流水线主机端模拟（Linux / macOS）
+ * @note    与固件共用 app_drv_dfsdm_pipe.c，CMSIS-DSP 按通用 C 实现编译，同目录的 main.h 替代 HAL：
+ *            cc -O2 -I. -I.. -I../../CMSIS/DSP/Include -I../../CMSIS/Core/Include -o dfsdm_pipe_sim dfsdm_pipe_sim.c \
+ *               ../app_drv_dfsdm_pipe.c \
+ *               ../../CMSIS/DSP/Source/FilteringFunctions/arm_fir_decimate_q31.c \
+ *               ../../CMSIS/DSP/Source/FilteringFunctions/arm_fir_decimate_init_q31.c \
+ *               ../../CMSIS/DSP/Source/FilteringFunctions/arm_biquad_cascade_df1_q31.c \
+ *               ../../CMSIS/DSP/Source/FilteringFunctions/arm_biquad_cascade_df1_init_q31.c -lm
+ *
+ *          合成位流：二阶 Σ-Δ 调制器以 1 MHz 输出 ±1 位流，输入为正弦 + 直流（调制器满量程为 1）；
+ *          DFSDM 滤波器按 Core/Src/dfsdm.c 的配置建模：Sinc4 64 倍抽取（满量程 2^24），通道右移 2 位，
+ *          24 位饱和后左移 8 位写入数据寄存器，低 3 位为通道号 2；DMA 循环写入双块缓冲区，
+ *          半满/全满时调用 DFSDM_Pipe_HalfComplete/Complete，可设置中断延迟 (期间 DMA 继续写入)。
+ *          输出 q31 满量程对应调制器输入 ±2（6 dB 余量）。用例：
+ *            response  各频率正弦经 Sinc4 + FIR 抽取 + 高通后的增益，通带平坦、抽取后的混叠被抑制
+ *            dc        直流输入与通道号位被高通去除后的残余
+ *            snr       1 kHz 正弦（默认为调制器满量程的 -6 dB）的信噪失真比
+ *            overrun   不同中断延迟下的 overrun_count，超过一块时间才应计数
+ *            speed     DFSDM_Pipe_Filter 整块滤波耗时及占块周期的比例
+ *
+ *            dfsdm_pipe_sim [-a amplitude] [response|dc|snr|overrun|speed]
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "app_drv_dfsdm_pipe.h"
+
+#define SIM_BIT_RATE_HZ         (1000000.0)     // CKOUT：8 MHz / 8
+#define SIM_SINC_OSR            (64U)
+#define SIM_RIGHT_SHIFT         (2U)            // 通道 RightBitShift
+#define SIM_CHANNEL             (2U)            // 数据寄存器低 3 位
+#define SIM_DFSDM_RATE_HZ       (SIM_BIT_RATE_HZ / SIM_SINC_OSR)
+#define SIM_OUTPUT_RATE_HZ      (SIM_DFSDM_RATE_HZ / DFSDM_PIPE_DECIMATION)
+#define SIM_CAPTURE_MAX         (16384U)
+#define SIM_PENDING_MAX         (8U)
+
+// 模拟的调制器 + DFSDM 滤波器 + DMA
+typedef struct {
+    int32_t* buffer;
+    uint32_t length;
+    uint32_t pos;               // DMA 写指针
+    uint8_t running;
+
+    // 输入信号
+    double amplitude;
+    double frequency;
+    double dc;
+    uint64_t bits;
+
+    // 二阶 Σ-Δ 调制器
+    double integ1;
+    double integ2;
+    int8_t out;
+
+    // Sinc4：积分器 + 抽取 + 梳状
+    int64_t sinc_integ[4];
+    int64_t sinc_comb[4];
+    uint32_t sinc_phase;
+
+    uint32_t latency;           // 中断延迟（DFSDM 输出点数）
+    uint64_t samples;           // DFSDM 输出点数
+    struct {
+        uint64_t due;
+        uint8_t half;
+    } pending[SIM_PENDING_MAX];
+    uint8_t pending_count;
+} Sim_Dfsdm;
+
+CoreDebug_Type host_core_debug;
+
+static DMA_HandleTypeDef sim_hdma;
+static DFSDM_Filter_HandleTypeDef sim_hfilter = { &sim_hdma };
+static DFSDM_Pipe_Context dfsdm_pipe;
+static Sim_Dfsdm dfsdm;
+static q31_t capture[SIM_CAPTURE_MAX];
+static uint32_t captured;
+
+static uint64_t Sim_NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+DWT_Type* Host_Dwt(void)
+{
+    static DWT_Type dwt;
+
+    dwt.CYCCNT = (uint32_t)Sim_NowNs();
+    return &dwt;
+}
+
+/* ----------------------------------------------------------------------------
+ * HAL 替身
+ * ------------------------------------------------------------------------- */
+
+HAL_StatusTypeDef HAL_DFSDM_FilterRegularStart_DMA(DFSDM_Filter_HandleTypeDef* hdfsdm_filter, int32_t* pData,
+                                                   uint32_t Length)
+{
+    dfsdm.buffer = pData;
+    dfsdm.length = Length;
+    dfsdm.pos = 0;
+    dfsdm.pending_count = 0;
+    dfsdm.running = 1;
+    hdfsdm_filter->hdmaReg->counter = Length;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DFSDM_FilterRegularStop_DMA(DFSDM_Filter_HandleTypeDef* hdfsdm_filter)
+{
+    (void)hdfsdm_filter;
+    dfsdm.running = 0;
+    return HAL_OK;
+}
+
+/* ----------------------------------------------------------------------------
+ * 合成位流与 DFSDM 模型
+ * ------------------------------------------------------------------------- */
+
+/**
+ * @brief 二阶 Σ-Δ 调制器输出一位（CIFB 结构，噪声传递函数 (1 - z^-1)^2）
+ */
+static int8_t Sim_ModulatorBit(void)
+{
+    double x = dfsdm.dc + dfsdm.amplitude * sin(2.0 * M_PI * dfsdm.frequency * dfsdm.bits / SIM_BIT_RATE_HZ);
+
+    dfsdm.bits++;
+    dfsdm.out = (dfsdm.integ2 >= 0.0) ? 1 : -1;
+    dfsdm.integ1 += x - dfsdm.out;
+    dfsdm.integ2 += dfsdm.integ1 - 2.0 * dfsdm.out;
+    return dfsdm.out;
+}
+
+/**
+ * @brief Sinc4 滤波 64 个位，返回数据寄存器的值
+ */
+static int32_t Sim_SincSample(void)
+{
+    int64_t value;
+    int i;
+
+    for (dfsdm.sinc_phase = 0; dfsdm.sinc_phase < SIM_SINC_OSR; dfsdm.sinc_phase++) {
+        dfsdm.sinc_integ[0] += Sim_ModulatorBit();
+        for (i = 1; i < 4; i++) {
+            dfsdm.sinc_integ[i] += dfsdm.sinc_integ[i - 1];
+        }
+    }
+    value = dfsdm.sinc_integ[3];
+    for (i = 0; i < 4; i++) {
+        int64_t delayed = dfsdm.sinc_comb[i];
+
+        dfsdm.sinc_comb[i] = value;
+        value -= delayed;
+    }
+
+    // 通道右移后饱和到 24 位，数据在高 24 位
+    value >>= SIM_RIGHT_SHIFT;
+    if (value > 0x7FFFFF) {
+        value = 0x7FFFFF;
+    } else if (value < -0x800000) {
+        value = -0x800000;
+    }
+    return (int32_t)((uint32_t)value << 8) | (int32_t)SIM_CHANNEL;
+}
+
+/**
+ * @brief DFSDM 输出一个点：DMA 写入，到达半满/全满时登记中断，延迟到期后调用回调
+ */
+static void Sim_Sample(void)
+{
+    uint8_t i, half;
+
+    if (!dfsdm.running) {
+        return;
+    }
+    dfsdm.buffer[dfsdm.pos++] = Sim_SincSample();
+    dfsdm.samples++;
+    if (dfsdm.pos == dfsdm.length / 2U || dfsdm.pos == dfsdm.length) {
+        if (dfsdm.pending_count < SIM_PENDING_MAX) {
+            dfsdm.pending[dfsdm.pending_count].due = dfsdm.samples + dfsdm.latency;
+            dfsdm.pending[dfsdm.pending_count].half = (dfsdm.pos == dfsdm.length) ? 1U : 0U;
+            dfsdm.pending_count++;
+        }
+        if (dfsdm.pos == dfsdm.length) {
+            dfsdm.pos = 0;
+        }
+    }
+    sim_hdma.counter = dfsdm.length - dfsdm.pos;
+
+    while (dfsdm.pending_count > 0 && dfsdm.pending[0].due <= dfsdm.samples) {
+        half = dfsdm.pending[0].half;
+        for (i = 1; i < dfsdm.pending_count; i++) {
+            dfsdm.pending[i - 1U] = dfsdm.pending[i];
+        }
+        dfsdm.pending_count--;
+        if (half == 0U) {
+            DFSDM_Pipe_HalfComplete(&dfsdm_pipe);
+        } else {
+            DFSDM_Pipe_Complete(&dfsdm_pipe);
+        }
+    }
+}
+
+// 块回调：保存最近的输出
+static void Sim_Block(void* user, const q31_t* block, uint16_t length)
+{
+    (void)user;
+    if (captured + length > SIM_CAPTURE_MAX) {
+        memmove(capture, &capture[length], (SIM_CAPTURE_MAX - length) * sizeof(q31_t));
+        captured -= length;
+    }
+    memcpy(&capture[captured], block, length * sizeof(q31_t));
+    captured += length;
+}
+
+static void Sim_Open(double amplitude, double frequency, double dc, uint32_t latency)
+{
+    memset(&dfsdm, 0, sizeof(dfsdm));
+    captured = 0;
+    dfsdm.amplitude = amplitude;
+    dfsdm.frequency = frequency;
+    dfsdm.dc = dc;
+    dfsdm.latency = latency;
+    DFSDM_Pipe_Init(&dfsdm_pipe, &sim_hfilter);
+    DFSDM_Pipe_RegisterBlockCallback(&dfsdm_pipe, Sim_Block, NULL);
+    DFSDM_Pipe_Start(&dfsdm_pipe);
+}
+
+// 运行 seconds 秒
+static void Sim_Run(double seconds)
+{
+    uint64_t n = (uint64_t)(seconds * SIM_DFSDM_RATE_HZ);
+
+    while (n-- > 0U) {
+        Sim_Sample();
+    }
+}
+
+// 最近 count 个输出点的 RMS（q31 满量程为 1）
+static double Sim_Rms(uint32_t count)
+{
+    double sum = 0.0, v;
+    uint32_t i;
+
+    for (i = captured - count; i < captured; i++) {
+        v = capture[i] / 2147483648.0;
+        sum += v * v;
+    }
+    return sqrt(sum / count);
+}
+
+static double Sim_Db(double ratio)
+{
+    return 20.0 * log10(ratio + 1e-15);
+}
+
+/* ----------------------------------------------------------------------------
+ * 用例
+ * ------------------------------------------------------------------------- */
+
+/**
+ * @brief 频率响应：输出幅度 / (输入幅度 / 2)，稳定 0.25 s 后取 8192 点
+ * @note  包含硬件 Sinc4 的通带下垂，整条链路的增益
+ */
+static int Sim_Response(double amplitude)
+{
+    static const struct {
+        double frequency;
+        double min_db;
+        double max_db;
+    } points[] = {
+        { 50.0, -0.5, 0.5 },        // 高通截止 20 Hz 之上
+        { 200.0, -0.5, 0.5 },
+        { 1000.0, -0.5, 0.5 },
+        { 2000.0, -1.0, 0.5 },
+        { 2500.0, -3.0, 0.5 },      // 通带边沿：FIR -0.9 dB，Sinc4 下垂约 -1.5 dB
+        { 3500.0, -40.0, -10.0 },   // 过渡带
+        { 4800.0, -200.0, -60.0 },  // 阻带：抽取后混叠到 3.0125 kHz
+        { 6000.0, -200.0, -60.0 },  // 混叠到 1.8125 kHz
+        { 7500.0, -200.0, -60.0 },  // 混叠到 312.5 Hz
+    };
+    uint32_t i;
+    int failed = 0;
+
+    for (i = 0; i < sizeof(points) / sizeof(points[0]); i++) {
+        double gain;
+        int ok;
+
+        Sim_Open(amplitude, points[i].frequency, 0.0, 0);
+        Sim_Run(0.25 + 8192.0 / SIM_OUTPUT_RATE_HZ);
+        gain = Sim_Db(Sim_Rms(8192) * sqrt(2.0) / (amplitude / 2.0));
+        ok = gain >= points[i].min_db && gain <= points[i].max_db && dfsdm_pipe.overrun_count == 0U;
+        printf("response: %6.0f Hz  %8.2f dB  (limit %.1f .. %.1f) -> %s\n", points[i].frequency, gain,
+               points[i].min_db, points[i].max_db, ok ? "PASS" : "FAIL");
+        failed |= !ok;
+    }
+    return failed;
+}
+
+/**
+ * @brief 直流输入：高通稳定 1 s 后的残余
+ */
+static int Sim_Dc(void)
+{
+    static const double levels[] = { 0.0, 0.3, -0.5 };
+    uint32_t i;
+    int failed = 0;
+
+    for (i = 0; i < sizeof(levels) / sizeof(levels[0]); i++) {
+        double residual;
+        int ok;
+
+        Sim_Open(0.0, 0.0, levels[i], 0);
+        Sim_Run(1.0);
+        residual = Sim_Db(Sim_Rms(4096));
+        ok = residual < -90.0;
+        printf("dc: input %+.2f (output %+.3f FS before high-pass), residual %.1f dBFS -> %s\n", levels[i],
+               levels[i] / 2.0, residual, ok ? "PASS" : "FAIL");
+        failed |= !ok;
+    }
+    return failed;
+}
+
+/**
+ * @brief 1 kHz 正弦的信噪失真比：最小二乘拟合正弦后计算残差
+ */
+static int Sim_Snr(double amplitude)
+{
+    const uint32_t n = 8192;
+    double w = 2.0 * M_PI * 1000.0 / SIM_OUTPUT_RATE_HZ;
+    double sc = 0.0, ss = 0.0, cc = 0.0, yc = 0.0, ys = 0.0, det, a, b, signal, noise = 0.0, v;
+    uint32_t i, k;
+    int ok;
+
+    Sim_Open(amplitude, 1000.0, 0.0, 0);
+    Sim_Run(0.25 + n / SIM_OUTPUT_RATE_HZ);
+    for (i = 0; i < n; i++) {
+        k = captured - n + i;
+        v = capture[k] / 2147483648.0;
+        sc += sin(w * i) * cos(w * i);
+        ss += sin(w * i) * sin(w * i);
+        cc += cos(w * i) * cos(w * i);
+        ys += v * sin(w * i);
+        yc += v * cos(w * i);
+    }
+    det = ss * cc - sc * sc;
+    a = (ys * cc - yc * sc) / det;
+    b = (yc * ss - ys * sc) / det;
+    for (i = 0; i < n; i++) {
+        v = capture[captured - n + i] / 2147483648.0 - a * sin(w * i) - b * cos(w * i);
+        noise += v * v;
+    }
+    signal = (a * a + b * b) / 2.0;
+    noise /= n;
+
+    ok = 10.0 * log10(signal / noise) > 80.0;
+    printf("snr: 1 kHz at %.1f dB of modulator full scale, output %.2f dBFS, SINAD %.1f dB -> %s\n",
+           Sim_Db(amplitude), 10.0 * log10(signal * 2.0), 10.0 * log10(signal / noise), ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief 中断延迟小于一块时间不应计 overrun，超过后每块都应计数
+ */
+static int Sim_Overrun(void)
+{
+    static const uint32_t latencies[] = { 0, DFSDM_PIPE_BLOCK_SIZE / 2U, DFSDM_PIPE_BLOCK_SIZE - 1U,
+                                          DFSDM_PIPE_BLOCK_SIZE + 1U, DFSDM_PIPE_BLOCK_SIZE + DFSDM_PIPE_BLOCK_SIZE / 2U };
+    uint32_t i, n;
+    int failed = 0;
+
+    for (i = 0; i < sizeof(latencies) / sizeof(latencies[0]); i++) {
+        uint8_t expect = latencies[i] >= DFSDM_PIPE_BLOCK_SIZE;
+        int ok;
+
+        Sim_Open(0.25, 1000.0, 0.0, latencies[i]);
+        for (n = 0; n < 100U * DFSDM_PIPE_BLOCK_SIZE; n++) {
+            Sim_Sample();
+        }
+        DFSDM_Pipe_Stop(&dfsdm_pipe);
+        ok = expect ? (dfsdm_pipe.overrun_count == dfsdm_pipe.block_count) : (dfsdm_pipe.overrun_count == 0U);
+        printf("overrun: latency %5.2f ms (block %.2f ms), %u blocks, %u overruns -> %s\n",
+               latencies[i] * 1000.0 / SIM_DFSDM_RATE_HZ, DFSDM_PIPE_BLOCK_SIZE * 1000.0 / SIM_DFSDM_RATE_HZ,
+               dfsdm_pipe.block_count, dfsdm_pipe.overrun_count, ok ? "PASS" : "FAIL");
+        failed |= !ok;
+    }
+    return failed;
+}
+
+/**
+ * @brief 整块滤波吞吐（主机）
+ */
+static void Sim_Speed(void)
+{
+    static q31_t block[DFSDM_PIPE_BLOCK_SIZE];
+    const uint32_t reps = 200000;
+    uint32_t i;
+    uint64_t start;
+    double block_ns;
+
+    Sim_Open(0.5, 1000.0, 0.0, 0);
+    for (i = 0; i < DFSDM_PIPE_BLOCK_SIZE; i++) {
+        block[i] = Sim_SincSample();
+    }
+    start = Sim_NowNs();
+    for (i = 0; i < reps; i++) {
+        DFSDM_Pipe_Filter(&dfsdm_pipe, block);
+    }
+    block_ns = (double)(Sim_NowNs() - start) / reps;
+    printf("speed: %u-point block in %.0f ns (%.1f Msamples/s), %.4f%% of the %.2f ms block period\n",
+           DFSDM_PIPE_BLOCK_SIZE, block_ns, DFSDM_PIPE_BLOCK_SIZE / block_ns * 1e3,
+           100.0 * block_ns * 1e-9 / (DFSDM_PIPE_BLOCK_SIZE / SIM_DFSDM_RATE_HZ),
+           DFSDM_PIPE_BLOCK_SIZE * 1000.0 / SIM_DFSDM_RATE_HZ);
+}
+
+int main(int argc, char* argv[])
+{
+    double amplitude = 0.5;
+    const char* only = NULL;
+    int failed = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "a:")) != -1) {
+        switch (opt) {
+        case 'a': amplitude = strtod(optarg, NULL); break;
+        default:
+            fprintf(stderr, "usage: dfsdm_pipe_sim [-a amplitude] [response|dc|snr|overrun|speed]\n");
+            return 2;
+        }
+    }
+    if (optind < argc) {
+        only = argv[optind];
+    }
+
+    if (only == NULL || strcmp(only, "response") == 0) {
+        failed |= Sim_Response(amplitude);
+    }
+    if (only == NULL || strcmp(only, "dc") == 0) {
+        failed |= Sim_Dc();
+    }
+    if (only == NULL || strcmp(only, "snr") == 0) {
+        failed |= Sim_Snr(amplitude);
+    }
+    if (only == NULL || strcmp(only, "overrun") == 0) {
+        failed |= Sim_Overrun();
+    }
+    if (only == NULL || strcmp(only, "speed") == 0) {
+        Sim_Speed();
+    }
+    return failed;
+}
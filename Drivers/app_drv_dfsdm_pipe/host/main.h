@@ -0,0 +1,55 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    main.h
+ * @brief   主机端替身：app_drv_dfsdm_pipe.c 用到的 HAL / CMSIS 声明
+ * @note    函数由 dfsdm_pipe_sim.c 提供；主机上 DWT->CYCCNT 按纳秒计数
+ ******************************************************************************
+ */
+
+#ifndef HOST_MAIN_H_
+#define HOST_MAIN_H_
+
+#include <stdint.h>
+
+typedef enum {
+    HAL_OK = 0,
+    HAL_ERROR,
+    HAL_BUSY,
+    HAL_TIMEOUT,
+} HAL_StatusTypeDef;
+
+typedef struct {
+    volatile uint32_t counter;      // 剩余传输数，对应 CNDTR
+} DMA_HandleTypeDef;
+
+typedef struct {
+    DMA_HandleTypeDef* hdmaReg;
+} DFSDM_Filter_HandleTypeDef;
+
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+DWT_Type* Host_Dwt(void);
+extern CoreDebug_Type host_core_debug;
+
+#define DWT                             (Host_Dwt())
+#define CoreDebug                       (&host_core_debug)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL)
+
+#define __HAL_DMA_GET_COUNTER(hdma)     ((hdma)->counter)
+
+HAL_StatusTypeDef HAL_DFSDM_FilterRegularStart_DMA(DFSDM_Filter_HandleTypeDef* hdfsdm_filter, int32_t* pData,
+                                                   uint32_t Length);
+HAL_StatusTypeDef HAL_DFSDM_FilterRegularStop_DMA(DFSDM_Filter_HandleTypeDef* hdfsdm_filter);
+
+#endif /* HOST_MAIN_H_ */
@@ -0,0 +1,475 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    app_drv_flash_log.c
+ * @brief   Flash 环形日志驱动
+ * @note    双字编程 + 行暂存 + 提前擦除，启动时按页序号快速恢复头尾指针
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include "app_drv_flash_log.h"
+
+#define FLASH_LOG_PAGE_MAGIC    (0x474F4C46UL)   // "FLOG"
+#define FLASH_LOG_RECORD_MAGIC  (0xA55AU)
+#define FLASH_LOG_ERASED        (0xFFFFFFFFFFFFFFFFULL)
+#define FLASH_LOG_ALIGN8(x)     (((x) + 7U) & ~7U)
+
+static uint32_t FLASH_Log_HAL_GetBank(uintptr_t addr);
+static int FLASH_Log_HAL_Program(uintptr_t addr, const uint64_t* data, uint16_t dword_count);
+static int FLASH_Log_HAL_ErasePage(uintptr_t page_addr);
+
+const FLASH_Log_Ops FLASH_Log_HAL_Ops = {
+    FLASH_Log_HAL_Program,
+    FLASH_Log_HAL_ErasePage,
+};
+
+/* CRC32 (多项式 0xEDB88320)，16 项半字节表，兼顾速度和代码体积 */
+static const uint32_t crc32_nibble_table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+static uint32_t FLASH_Log_Crc32(const uint8_t* data, uint16_t length)
+{
+    uint32_t crc = 0xFFFFFFFFUL;
+    while (length--) {
+        crc ^= *data++;
+        crc = (crc >> 4) ^ crc32_nibble_table[crc & 0x0F];
+        crc = (crc >> 4) ^ crc32_nibble_table[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+static inline uintptr_t FLASH_Log_PageAddr(FLASH_Log_Context* ctx, uint16_t page)
+{
+    return ctx->base + (uintptr_t)page * FLASH_LOG_PAGE_SIZE;
+}
+
+static inline uint16_t FLASH_Log_NextPage(FLASH_Log_Context* ctx, uint16_t page)
+{
+    return (uint16_t)((page + 1U) % ctx->page_count);
+}
+
+static inline uint64_t FLASH_Log_ReadDword(uintptr_t addr)
+{
+    return *(const volatile uint64_t*)addr;
+}
+
+/**
+ * @brief 读取页头中的页序号
+ * @retval 页序号，页无效时返回 0
+ */
+static uint32_t FLASH_Log_PageSeq(FLASH_Log_Context* ctx, uint16_t page)
+{
+    uint64_t header = FLASH_Log_ReadDword(FLASH_Log_PageAddr(ctx, page));
+    uint32_t seq = (uint32_t)(header >> 32);
+
+    if ((uint32_t)header != FLASH_LOG_PAGE_MAGIC || seq == 0xFFFFFFFFUL) {
+        return 0;
+    }
+    return seq;
+}
+
+static int FLASH_Log_PageIsBlank(FLASH_Log_Context* ctx, uint16_t page)
+{
+    uintptr_t addr = FLASH_Log_PageAddr(ctx, page);
+    uint32_t i;
+
+    for (i = 0; i < FLASH_LOG_PAGE_SIZE; i += 8U) {
+        if (FLASH_Log_ReadDword(addr + i) != FLASH_LOG_ERASED) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief 解析记录头
+ * @retval 记录数据长度，记录头无效时返回 -1
+ */
+static int32_t FLASH_Log_RecordLength(uint64_t header)
+{
+    uint16_t magic = (uint16_t)header;
+    uint16_t length = (uint16_t)(header >> 16);
+
+    if (magic != FLASH_LOG_RECORD_MAGIC || length == 0 || length > FLASH_LOG_MAX_RECORD) {
+        return -1;
+    }
+    return length;
+}
+
+/**
+ * @brief 擦除写指针前方的一页，必要时丢弃最旧数据
+ */
+static FLASH_Log_Result FLASH_Log_EraseAhead(FLASH_Log_Context* ctx)
+{
+    uint16_t ahead = FLASH_Log_NextPage(ctx, ctx->head_page);
+
+    if (FLASH_Log_PageIsBlank(ctx, ahead)) {
+        return FLASH_LOG_OK;
+    }
+
+    if (ahead == ctx->tail_page) {
+        ctx->tail_page = FLASH_Log_NextPage(ctx, ahead);
+        ctx->dropped_pages++;
+    }
+
+    ctx->erase_count++;
+    if (ctx->ops->erase_page(FLASH_Log_PageAddr(ctx, ahead)) != 0) {
+        return FLASH_LOG_FLASH_ERROR;
+    }
+    return FLASH_LOG_OK;
+}
+
+/**
+ * @brief 打开新的写入页：写入页头并擦除前方一页
+ */
+static FLASH_Log_Result FLASH_Log_OpenPage(FLASH_Log_Context* ctx, uint16_t page, uint32_t seq)
+{
+    uintptr_t addr = FLASH_Log_PageAddr(ctx, page);
+    uint64_t header = FLASH_LOG_PAGE_MAGIC | ((uint64_t)seq << 32);
+
+    // 正常情况下该页已被提前擦除，这里只做兜底
+    if (!FLASH_Log_PageIsBlank(ctx, page)) {
+        ctx->erase_count++;
+        if (ctx->ops->erase_page(addr) != 0) {
+            return FLASH_LOG_FLASH_ERROR;
+        }
+    }
+
+    if (ctx->ops->program(addr, &header, 1) != 0) {
+        return FLASH_LOG_FLASH_ERROR;
+    }
+
+    if (ctx->head_seq == 0) {
+        ctx->tail_page = page;
+    }
+    ctx->head_page = page;
+    ctx->head_offset = FLASH_LOG_HEADER_SIZE;
+    ctx->head_seq = seq;
+
+    return FLASH_Log_EraseAhead(ctx);
+}
+
+static FLASH_Log_Result FLASH_Log_PushDword(FLASH_Log_Context* ctx, uint64_t value)
+{
+    ctx->row_buf[ctx->row_count++] = value;
+    ctx->head_offset += 8U;
+
+    if (ctx->row_count == FLASH_LOG_ROW_DWORDS) {
+        return FLASH_Log_Flush(ctx);
+    }
+    return FLASH_LOG_OK;
+}
+
+/**
+ * @brief 初始化 Flash 日志并恢复头尾指针
+ * @param ctx 指向 FLASH_Log_Context 结构体的指针
+ * @param base 日志区起始地址（页对齐）
+ * @param page_count 日志区页数（至少 2 页）
+ * @param ops Flash 底层操作，NULL 时使用 HAL 实现
+ * @note 只读取每页页头和当前写入页的记录头，恢复时间与页数成正比；
+ *       没有任何有效页头但区域非空时整体格式化
+ */
+FLASH_Log_Result FLASH_Log_Init(FLASH_Log_Context* ctx, uintptr_t base, uint16_t page_count, const FLASH_Log_Ops* ops)
+{
+    uint32_t min_seq = 0xFFFFFFFFUL;
+    uint16_t page;
+
+    if (page_count < 2) {
+        return FLASH_LOG_PARAM_ERROR;
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->ops = (ops != NULL) ? ops : &FLASH_Log_HAL_Ops;
+    ctx->base = base;
+    ctx->page_count = page_count;
+
+    // 通过页序号找到最新页（头）和最旧页（尾）
+    for (page = 0; page < page_count; page++) {
+        uint32_t seq = FLASH_Log_PageSeq(ctx, page);
+        if (seq == 0) {
+            continue;
+        }
+        if (seq > ctx->head_seq) {
+            ctx->head_seq = seq;
+            ctx->head_page = page;
+        }
+        if (seq < min_seq) {
+            min_seq = seq;
+            ctx->tail_page = page;
+        }
+    }
+
+    if (ctx->head_seq == 0) {
+        // 没有日志页：区域中若有其他数据（如双 Bank 切换后旧固件的末尾）先整体擦除，首次追加时再打开第 0 页
+        for (page = 0; page < page_count; page++) {
+            if (!FLASH_Log_PageIsBlank(ctx, page)) {
+                return FLASH_Log_Format(ctx);
+            }
+        }
+        return FLASH_LOG_OK;
+    }
+
+    // 沿记录头链表找到写入位置
+    uintptr_t addr = FLASH_Log_PageAddr(ctx, ctx->head_page);
+    uint32_t offset = FLASH_LOG_HEADER_SIZE;
+    while (offset + FLASH_LOG_HEADER_SIZE <= FLASH_LOG_PAGE_SIZE) {
+        uint64_t header = FLASH_Log_ReadDword(addr + offset);
+        if (header == FLASH_LOG_ERASED) {
+            break;
+        }
+        int32_t length = FLASH_Log_RecordLength(header);
+        if (length < 0) {
+            // 记录头损坏，封存该页
+            offset = FLASH_LOG_PAGE_SIZE;
+            break;
+        }
+        offset += FLASH_LOG_HEADER_SIZE + FLASH_LOG_ALIGN8((uint32_t)length);
+    }
+    ctx->head_offset = (uint16_t)((offset > FLASH_LOG_PAGE_SIZE) ? FLASH_LOG_PAGE_SIZE : offset);
+
+    FLASH_Log_Rewind(ctx);
+
+    // 掉电可能发生在打开新页和提前擦除之间，这里补做擦除
+    return FLASH_Log_EraseAhead(ctx);
+}
+
+/**
+ * @brief 追加一条记录
+ * @param ctx 指向 FLASH_Log_Context 结构体的指针
+ * @param data 记录数据
+ * @param length 记录长度（1 ~ FLASH_LOG_MAX_RECORD）
+ * @note 数据先进入行暂存缓冲区，需要立即落盘时调用 FLASH_Log_Flush
+ */
+FLASH_Log_Result FLASH_Log_Append(FLASH_Log_Context* ctx, const uint8_t* data, uint16_t length)
+{
+    FLASH_Log_Result result;
+    uint32_t need = FLASH_LOG_HEADER_SIZE + FLASH_LOG_ALIGN8((uint32_t)length);
+
+    if (length == 0 || length > FLASH_LOG_MAX_RECORD) {
+        return FLASH_LOG_PARAM_ERROR;
+    }
+
+    if (ctx->head_seq == 0) {
+        result = FLASH_Log_OpenPage(ctx, 0, 1);
+        if (result != FLASH_LOG_OK) {
+            return result;
+        }
+        FLASH_Log_Rewind(ctx);
+    } else if (ctx->head_offset + need > FLASH_LOG_PAGE_SIZE) {
+        // 记录不跨页，当前页剩余空间保持擦除状态
+        result = FLASH_Log_Flush(ctx);
+        if (result != FLASH_LOG_OK) {
+            return result;
+        }
+        result = FLASH_Log_OpenPage(ctx, FLASH_Log_NextPage(ctx, ctx->head_page), ctx->head_seq + 1U);
+        if (result != FLASH_LOG_OK) {
+            return result;
+        }
+    }
+
+    // 先写记录头，掉电时数据不完整可由 CRC 识别
+    uint64_t header = FLASH_LOG_RECORD_MAGIC
+                    | ((uint64_t)length << 16)
+                    | ((uint64_t)FLASH_Log_Crc32(data, length) << 32);
+    result = FLASH_Log_PushDword(ctx, header);
+
+    uint16_t pos = 0;
+    while (result == FLASH_LOG_OK && pos < length) {
+        uint64_t value = FLASH_LOG_ERASED;
+        uint16_t chunk = (uint16_t)(length - pos);
+        if (chunk > 8U) {
+            chunk = 8U;
+        }
+        memcpy(&value, &data[pos], chunk);
+        pos += chunk;
+        result = FLASH_Log_PushDword(ctx, value);
+    }
+
+    if (result == FLASH_LOG_OK) {
+        ctx->total_written_bytes += length;
+    }
+    return result;
+}
+
+/**
+ * @brief 将行暂存缓冲区写入 Flash
+ * @param ctx 指向 FLASH_Log_Context 结构体的指针
+ * @note 编程失败时封存当前页，下一次追加从新页开始
+ */
+FLASH_Log_Result FLASH_Log_Flush(FLASH_Log_Context* ctx)
+{
+    if (ctx->row_count == 0) {
+        return FLASH_LOG_OK;
+    }
+
+    uintptr_t addr = FLASH_Log_PageAddr(ctx, ctx->head_page)
+                   + ctx->head_offset - (uint32_t)ctx->row_count * 8U;
+    int status = ctx->ops->program(addr, ctx->row_buf, ctx->row_count);
+    ctx->row_count = 0;
+
+    if (status != 0) {
+        ctx->head_offset = FLASH_LOG_PAGE_SIZE;
+        return FLASH_LOG_FLASH_ERROR;
+    }
+    return FLASH_LOG_OK;
+}
+
+/**
+ * @brief 读取下一条记录
+ * @param ctx 指向 FLASH_Log_Context 结构体的指针
+ * @param buffer 输出缓冲区
+ * @param length 输入缓冲区大小，输出记录长度
+ * @retval FLASH_LOG_EMPTY 没有已落盘的新记录
+ * @retval FLASH_LOG_CRC_ERROR 记录损坏，已跳过，可继续读取
+ * @note 仍在行暂存缓冲区中的数据不可读：行满时在记录中途编程，记录头可能已落盘而尾部仍在暂存区，
+ *       此时返回 FLASH_LOG_EMPTY 且读指针不动，尾部落盘后再读
+ */
+FLASH_Log_Result FLASH_Log_Read(FLASH_Log_Context* ctx, uint8_t* buffer, uint16_t* length)
+{
+    if (ctx->head_seq == 0) {
+        return FLASH_LOG_EMPTY;
+    }
+
+    // 读指针所在页已被环形覆盖，跳到最旧数据
+    if (FLASH_Log_PageSeq(ctx, ctx->read_page) != ctx->read_seq) {
+        FLASH_Log_Rewind(ctx);
+    }
+
+    while (1) {
+        uintptr_t addr = FLASH_Log_PageAddr(ctx, ctx->read_page);
+        uint32_t end = FLASH_LOG_PAGE_SIZE;
+
+        // 写入页只读到已编程的位置，暂存区中的数据在 Flash 中仍为擦除状态
+        if (ctx->read_page == ctx->head_page) {
+            end = ctx->head_offset - (uint32_t)ctx->row_count * 8U;
+        }
+
+        if (ctx->read_offset + FLASH_LOG_HEADER_SIZE <= end) {
+            uint64_t header = FLASH_Log_ReadDword(addr + ctx->read_offset);
+            int32_t record_len = FLASH_Log_RecordLength(header);
+
+            if (record_len > 0) {
+                if (ctx->read_offset + FLASH_LOG_HEADER_SIZE + FLASH_LOG_ALIGN8((uint32_t)record_len) > end) {
+                    return FLASH_LOG_EMPTY;
+                }
+                if ((uint16_t)record_len > *length) {
+                    *length = (uint16_t)record_len;
+                    return FLASH_LOG_PARAM_ERROR;
+                }
+
+                memcpy(buffer, (const void*)(addr + ctx->read_offset + FLASH_LOG_HEADER_SIZE), (uint32_t)record_len);
+                ctx->read_offset += FLASH_LOG_HEADER_SIZE + FLASH_LOG_ALIGN8((uint32_t)record_len);
+                *length = (uint16_t)record_len;
+
+                if (FLASH_Log_Crc32(buffer, (uint16_t)record_len) != (uint32_t)(header >> 32)) {
+                    ctx->crc_error_count++;
+                    return FLASH_LOG_CRC_ERROR;
+                }
+                return FLASH_LOG_OK;
+            }
+
+            if (header == FLASH_LOG_ERASED && ctx->read_page == ctx->head_page) {
+                return FLASH_LOG_EMPTY;
+            }
+        }
+
+        // 当前页读完（或记录头损坏），转到下一页
+        if (ctx->read_page == ctx->head_page) {
+            return FLASH_LOG_EMPTY;
+        }
+        ctx->read_page = FLASH_Log_NextPage(ctx, ctx->read_page);
+        ctx->read_offset = FLASH_LOG_HEADER_SIZE;
+        ctx->read_seq = FLASH_Log_PageSeq(ctx, ctx->read_page);
+    }
+}
+
+/**
+ * @brief 将读指针复位到最旧记录
+ * @param ctx 指向 FLASH_Log_Context 结构体的指针
+ */
+void FLASH_Log_Rewind(FLASH_Log_Context* ctx)
+{
+    ctx->read_page = ctx->tail_page;
+    ctx->read_offset = FLASH_LOG_HEADER_SIZE;
+    ctx->read_seq = FLASH_Log_PageSeq(ctx, ctx->tail_page);
+}
+
+/**
+ * @brief 擦除整个日志区
+ * @param ctx 指向 FLASH_Log_Context 结构体的指针
+ */
+FLASH_Log_Result FLASH_Log_Format(FLASH_Log_Context* ctx)
+{
+    uint16_t page;
+
+    for (page = 0; page < ctx->page_count; page++) {
+        if (!FLASH_Log_PageIsBlank(ctx, page)) {
+            ctx->erase_count++;
+            if (ctx->ops->erase_page(FLASH_Log_PageAddr(ctx, page)) != 0) {
+                return FLASH_LOG_FLASH_ERROR;
+            }
+        }
+    }
+
+    ctx->head_page = 0;
+    ctx->head_offset = 0;
+    ctx->head_seq = 0;
+    ctx->tail_page = 0;
+    ctx->row_count = 0;
+    FLASH_Log_Rewind(ctx);
+    return FLASH_LOG_OK;
+}
+
+/**
+ * @brief 获取地址所在的物理 Bank（考虑 Bank 交换）
+ */
+static uint32_t FLASH_Log_HAL_GetBank(uintptr_t addr)
+{
+    uint32_t in_bank1 = (addr < (FLASH_BASE + FLASH_BANK_SIZE)) ? 1U : 0U;
+
+    if (READ_BIT(SYSCFG->MEMRMP, SYSCFG_MEMRMP_FB_MODE) != 0U) {
+        in_bank1 = !in_bank1;
+    }
+    return in_bank1 ? FLASH_BANK_1 : FLASH_BANK_2;
+}
+
+static int FLASH_Log_HAL_Program(uintptr_t addr, const uint64_t* data, uint16_t dword_count)
+{
+    HAL_StatusTypeDef status = HAL_OK;
+    uint16_t i;
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    for (i = 0; i < dword_count && status == HAL_OK; i++) {
+        status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, addr + i * 8U, data[i]);
+    }
+    HAL_FLASH_Lock();
+
+    return (status == HAL_OK) ? 0 : -1;
+}
+
+static int FLASH_Log_HAL_ErasePage(uintptr_t page_addr)
+{
+    FLASH_EraseInitTypeDef erase;
+    uint32_t page_error = 0;
+    HAL_StatusTypeDef status;
+
+    erase.TypeErase = FLASH_TYPEERASE_PAGES;
+    erase.Banks = FLASH_Log_HAL_GetBank(page_addr);
+    erase.Page = (uint32_t)((page_addr - FLASH_BASE) % FLASH_BANK_SIZE) / FLASH_PAGE_SIZE;
+    erase.NbPages = 1;
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    status = HAL_FLASHEx_Erase(&erase, &page_error);
+    HAL_FLASH_Lock();
+
+    return (status == HAL_OK) ? 0 : -1;
+}
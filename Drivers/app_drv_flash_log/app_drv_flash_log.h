@@ -0,0 +1,111 @@
+#ifndef APP_DRV_FLASH_LOG_H_
+#define APP_DRV_FLASH_LOG_H_
+
+#include <stdint.h>
+#include "main.h"
+
+/*
+ * Flash 环形日志
+ *
+ * 以页为单位在片上 Flash 中循环追加记录，掉电后可恢复：
+ *   页头 (8 字节)  : magic(4) + 页序号(4)，页序号单调递增，用于启动时定位头/尾页
+ *   记录头 (8 字节): magic(2) + 长度(2) + CRC32(4)
+ *   记录数据       : 按 8 字节对齐，尾部用 0xFF 填充
+ *
+ * 写入按 64 位双字编程，多条记录先在 RAM 中拼成一行 (32 个双字) 再连续编程；
+ * 写指针进入新页时立即擦除下一页，始终保证前方有一页已擦除 (覆盖最旧数据)。
+ * 各页按环形顺序轮流擦除，擦写次数天然均衡。
+ *
+ * 吞吐参考 (STM32L496 数据手册典型值)：
+ *   双字编程 81.69 us / 8 字节，页擦除 22.02 ms / 2 KB
+ *   => 约 2048 / (256 * 81.69 us + 22.02 ms) ≈ 47 KB/s 持续写入。
+ *   host/flash_log_sim.c 按上述时间模拟的有效数据速率 (计入记录头/页头与页尾空余)：
+ *      16 B 记录 32 KB/s，64 B 43 KB/s，256 B 45 KB/s，1 KB 记录每页只放一条，32 KB/s，
+ *      均高于 115200 波特率下的 11.5 KB/s 接收速率。
+ * 日志区默认放在 Bank2 末尾，代码运行在 Bank1，擦写期间中断与 DMA 接收不受影响 (RWW)。
+ * 注意：L4 的快速行编程要求整个 Bank 先做批量擦除，按页擦除的日志区无法使用，故采用双字编程。
+ */
+
+// 日志区起始地址和页数（需与链接脚本中的 FLASH_LOG 区域一致）
+#ifndef FLASH_LOG_START_ADDR
+  #define FLASH_LOG_START_ADDR  (0x080F0000UL)
+#endif
+
+#ifndef FLASH_LOG_PAGE_COUNT
+  #define FLASH_LOG_PAGE_COUNT  (32)
+#endif
+
+#define FLASH_LOG_PAGE_SIZE     (2048U)                          // Flash 页大小
+#define FLASH_LOG_ROW_DWORDS    (32U)                            // 一行包含的双字数
+#define FLASH_LOG_HEADER_SIZE   (8U)                             // 页头/记录头大小
+#define FLASH_LOG_MAX_RECORD    (FLASH_LOG_PAGE_SIZE - 2U * FLASH_LOG_HEADER_SIZE) // 单条记录最大长度
+
+typedef enum {
+    FLASH_LOG_OK = 0,
+    FLASH_LOG_EMPTY,          // 没有可读记录
+    FLASH_LOG_PARAM_ERROR,    // 参数错误（长度为 0 或超过单页容量）
+    FLASH_LOG_CRC_ERROR,      // 记录校验失败（掉电时写了一半），已跳过
+    FLASH_LOG_FLASH_ERROR,    // Flash 编程/擦除失败
+} FLASH_Log_Result;
+
+// Flash 底层操作函数类型定义（可替换为主机端模拟实现）
+typedef int (*FLASH_Log_Program_Func)(uintptr_t addr, const uint64_t* data, uint16_t dword_count); // 连续编程多个双字，成功返回 0
+typedef int (*FLASH_Log_Erase_Func)(uintptr_t page_addr);                                           // 擦除一页，成功返回 0
+
+typedef struct {
+    FLASH_Log_Program_Func program;
+    FLASH_Log_Erase_Func erase_page;
+} FLASH_Log_Ops;
+
+// Flash 日志上下文结构体
+typedef struct {
+    const FLASH_Log_Ops* ops;
+    uintptr_t base;               // 日志区起始地址
+    uint16_t page_count;          // 日志区页数
+
+    // 写指针
+    uint16_t head_page;           // 当前写入页
+    uint16_t head_offset;         // 当前页内写入偏移（包含尚未编程的暂存数据）
+    uint32_t head_seq;            // 当前写入页序号（0 表示日志为空）
+
+    // 尾指针（最旧数据）
+    uint16_t tail_page;
+
+    // 读指针
+    uint16_t read_page;
+    uint16_t read_offset;
+    uint32_t read_seq;
+
+    // 行暂存缓冲区
+    uint64_t row_buf[FLASH_LOG_ROW_DWORDS];
+    uint16_t row_count;           // 暂存的双字数
+
+    // 统计
+    uint32_t total_written_bytes; // 已追加的数据字节数
+    uint32_t erase_count;         // 本次上电以来的页擦除次数
+    uint32_t dropped_pages;       // 因环形覆盖丢弃的页数
+    uint32_t crc_error_count;     // 读取时遇到的校验错误记录数
+} FLASH_Log_Context;
+
+// 基于 HAL 的默认 Flash 操作
+extern const FLASH_Log_Ops FLASH_Log_HAL_Ops;
+
+// 初始化并恢复日志头尾（ops 为 NULL 时使用 FLASH_Log_HAL_Ops）
+FLASH_Log_Result FLASH_Log_Init(FLASH_Log_Context* ctx, uintptr_t base, uint16_t page_count, const FLASH_Log_Ops* ops);
+
+// 追加一条记录（先进入行暂存缓冲区，满一行后编程）
+FLASH_Log_Result FLASH_Log_Append(FLASH_Log_Context* ctx, const uint8_t* data, uint16_t length);
+
+// 将暂存缓冲区中的数据立即写入 Flash
+FLASH_Log_Result FLASH_Log_Flush(FLASH_Log_Context* ctx);
+
+// 按写入顺序读取下一条记录，length 输入缓冲区大小，输出记录长度
+FLASH_Log_Result FLASH_Log_Read(FLASH_Log_Context* ctx, uint8_t* buffer, uint16_t* length);
+
+// 将读指针复位到最旧记录
+void FLASH_Log_Rewind(FLASH_Log_Context* ctx);
+
+// 擦除整个日志区
+FLASH_Log_Result FLASH_Log_Format(FLASH_Log_Context* ctx);
+
+#endif /* APP_DRV_FLASH_LOG_H_ */
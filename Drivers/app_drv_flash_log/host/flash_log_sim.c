@@ -0,0 +1,491 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    flash_log_sim.c
+ * @brief   Flash 环形日志主机端模拟（Linux / macOS）
+ * @note    与固件共用 app_drv_flash_log.c，同目录的 main.h 替代 HAL，编译：
+ *            cc -O2 -I. -I.. -o flash_log_sim flash_log_sim.c ../app_drv_flash_log.c
+ *
+ *          RAM 中的 Flash 镜像按 STM32L4 的规则工作：擦除置全 1，双字只能在擦除状态下编程
+ *          （否则计为违规，对应硬件的 PROGERR），耗时按数据手册典型值累计。用例：
+ *            staged    每次追加后立即读取，覆盖记录头已落盘、尾部仍在行暂存区的窗口
+ *            wrap      写满多圈后读取 / 重新初始化，读指针所在页被覆盖时跳到最旧记录
+ *            foreign   日志区中是其他数据（双 Bank 切换后旧固件的末尾）时初始化即整体格式化
+ *            power     在随机的第 n 次双字编程处掉电（该双字只编程了部分位）后重新初始化，
+ *                      已 Flush 的记录必须完整读回，恢复后可继续追加
+ *            speed     不同记录长度下的持续写入吞吐（模拟 Flash 时间）与驱动本身的主机耗时
+ *          擦除中途掉电后页内容不确定，这里按擦除未开始 / 已完成两种情况处理。
+ *
+ *            flash_log_sim [-s seed] [-n power_trials] [staged|wrap|foreign|power|speed]
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "app_drv_flash_log.h"
+
+#define SIM_PAGES               (16U)       // 模拟日志区页数 (32 KB)
+#define SIM_DWORDS              (SIM_PAGES * FLASH_LOG_PAGE_SIZE / 8U)
+#define SIM_PROGRAM_US          (81.69)     // 双字编程时间
+#define SIM_ERASE_US            (22020.0)   // 页擦除时间
+#define SIM_RECORD_MAX          (256U)      // 功能用例的最大记录长度
+
+// 模拟的 Flash 及其统计
+typedef struct {
+    uint64_t cells[SIM_DWORDS];
+    double busy_us;             // 累计编程 / 擦除时间
+    uint32_t programmed;        // 已编程的双字数
+    uint32_t erased;            // 已擦除的页数
+    uint32_t violations;        // 对未擦除双字编程的次数
+    int64_t cut_after;          // 剩余多少次双字编程后掉电，< 0 不掉电
+    uint8_t power_lost;
+} Sim_Flash;
+
+static Sim_Flash sim;
+
+static uint64_t Sim_NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t Sim_Index(uintptr_t addr)
+{
+    return (uint32_t)((addr - (uintptr_t)sim.cells) / 8U);
+}
+
+/**
+ * @brief 连续编程多个双字；掉电点所在的双字只清除部分位，此后所有操作失败
+ */
+static int Sim_Program(uintptr_t addr, const uint64_t* data, uint16_t dword_count)
+{
+    uint32_t index = Sim_Index(addr);
+    uint16_t i;
+
+    for (i = 0; i < dword_count; i++) {
+        if (sim.power_lost) {
+            return -1;
+        }
+        if (sim.cells[index + i] != 0xFFFFFFFFFFFFFFFFULL) {
+            sim.violations++;
+            return -1;
+        }
+        if (sim.cut_after >= 0 && sim.cut_after-- == 0) {
+            uint64_t partial = ((uint64_t)mrand48() << 32) ^ (uint64_t)mrand48();
+
+            sim.cells[index + i] = data[i] | (~data[i] & partial);
+            sim.power_lost = 1;
+            return -1;
+        }
+        sim.cells[index + i] = data[i];
+        sim.programmed++;
+        sim.busy_us += SIM_PROGRAM_US;
+    }
+    return 0;
+}
+
+static int Sim_ErasePage(uintptr_t page_addr)
+{
+    uint32_t index = Sim_Index(page_addr);
+
+    if (sim.power_lost) {
+        return -1;
+    }
+    // 掉电点落在擦除上时随机取擦除前或擦除后的状态
+    if (sim.cut_after >= 0 && sim.cut_after-- == 0) {
+        sim.power_lost = 1;
+        if (lrand48() & 1) {
+            return -1;
+        }
+    }
+    memset(&sim.cells[index], 0xFF, FLASH_LOG_PAGE_SIZE);
+    sim.erased++;
+    sim.busy_us += SIM_ERASE_US;
+    return sim.power_lost ? -1 : 0;
+}
+
+static const FLASH_Log_Ops sim_ops = {
+    Sim_Program,
+    Sim_ErasePage,
+};
+
+static void Sim_Reset(void)
+{
+    memset(sim.cells, 0xFF, sizeof(sim.cells));
+    sim.busy_us = 0.0;
+    sim.programmed = 0;
+    sim.erased = 0;
+    sim.violations = 0;
+    sim.cut_after = -1;
+    sim.power_lost = 0;
+}
+
+static FLASH_Log_Result Sim_Open(FLASH_Log_Context* ctx)
+{
+    return FLASH_Log_Init(ctx, (uintptr_t)sim.cells, SIM_PAGES, &sim_ops);
+}
+
+/**
+ * @brief 第 index 条记录：长度与内容都由序号决定，前 4 字节为序号
+ */
+static uint16_t Sim_Record(uint32_t index, uint16_t max_length, uint8_t* out)
+{
+    uint32_t x = index * 2654435761U + 12345U;
+    uint16_t length = (uint16_t)(4U + (x >> 8) % (max_length - 3U));
+    uint16_t i;
+
+    memcpy(out, &index, 4);
+    for (i = 4; i < length; i++) {
+        x = x * 1103515245U + 12345U;
+        out[i] = (uint8_t)(x >> 16);
+    }
+    return length;
+}
+
+/**
+ * @brief 读取一条记录并校验内容
+ * @retval 记录序号；-1 没有可读记录；-2 校验错误；-3 内容与序号不符
+ */
+static int64_t Sim_ReadRecord(FLASH_Log_Context* ctx, uint16_t max_length)
+{
+    uint8_t buffer[FLASH_LOG_MAX_RECORD];
+    uint8_t expect[FLASH_LOG_MAX_RECORD];
+    uint16_t length = sizeof(buffer);
+    uint32_t index;
+    FLASH_Log_Result result = FLASH_Log_Read(ctx, buffer, &length);
+
+    if (result == FLASH_LOG_EMPTY) {
+        return -1;
+    }
+    if (result != FLASH_LOG_OK) {
+        return -2;
+    }
+    memcpy(&index, buffer, 4);
+    if (length < 4 || Sim_Record(index, max_length, expect) != length || memcmp(buffer, expect, length) != 0) {
+        return -3;
+    }
+    return index;
+}
+
+/**
+ * @brief 每次追加后立即读到空：读者不得在记录尾部落盘前读到该记录，也不得跳过它
+ */
+static int Sim_Staged(void)
+{
+    static FLASH_Log_Context ctx;
+    uint8_t record[SIM_RECORD_MAX];
+    uint32_t next_read = 0, straddled = 0, index;
+    int64_t got;
+
+    Sim_Reset();
+    Sim_Open(&ctx);
+    for (index = 0; index < 20000U; index++) {
+        uint16_t length = Sim_Record(index, SIM_RECORD_MAX, record);
+
+        if (FLASH_Log_Append(&ctx, record, length) != FLASH_LOG_OK) {
+            printf("staged: append %u failed\n", index);
+            return 1;
+        }
+        // 行缓冲区在本记录中途编程：记录头已在 Flash 中，尾部仍在暂存区
+        if (ctx.row_count != 0U && ctx.row_count < 1U + (length + 7U) / 8U) {
+            straddled++;
+        }
+        while ((got = Sim_ReadRecord(&ctx, SIM_RECORD_MAX)) >= 0) {
+            if ((uint32_t)got != next_read) {
+                printf("staged: read %lld, expected %u\n", (long long)got, next_read);
+                return 1;
+            }
+            next_read++;
+        }
+        if (got != -1) {
+            printf("staged: record %u read error %lld (crc errors %u)\n", next_read, (long long)got, ctx.crc_error_count);
+            return 1;
+        }
+        // 暂存区为空时所有记录都已落盘，必须全部读到
+        if (ctx.row_count == 0U && next_read != index + 1U) {
+            printf("staged: reader stalled at %u, appended %u\n", next_read, index + 1U);
+            return 1;
+        }
+    }
+    FLASH_Log_Flush(&ctx);
+    while ((got = Sim_ReadRecord(&ctx, SIM_RECORD_MAX)) >= 0 && (uint32_t)got == next_read) {
+        next_read++;
+    }
+    printf("staged: %u records, %u read while their tail was staged, %u pages wrapped -> %s\n",
+           index, straddled, ctx.dropped_pages, (next_read == index && straddled > 0U) ? "PASS" : "FAIL");
+    return (next_read == index && straddled > 0U && sim.violations == 0U) ? 0 : 1;
+}
+
+/**
+ * @brief 从读指针读到空，要求序号连续且最后一条为 last
+ * @retval 读到的第一条序号，失败返回 -1
+ */
+static int64_t Sim_ReadRun(FLASH_Log_Context* ctx, uint32_t last, const char* name)
+{
+    int64_t first = -1, prev = -1, got;
+
+    while ((got = Sim_ReadRecord(ctx, SIM_RECORD_MAX)) >= 0) {
+        if (prev >= 0 && got != prev + 1) {
+            printf("%s: read %lld after %lld\n", name, (long long)got, (long long)prev);
+            return -1;
+        }
+        if (first < 0) {
+            first = got;
+        }
+        prev = got;
+    }
+    if (got != -1 || prev != (int64_t)last) {
+        printf("%s: stopped at %lld (status %lld), expected %u\n", name, (long long)prev, (long long)got, last);
+        return -1;
+    }
+    return first;
+}
+
+/**
+ * @brief 写满多圈：只保留最新的若干页，读指针被覆盖时从最旧记录继续，重新初始化后结果相同
+ */
+static int Sim_Wrap(void)
+{
+    static FLASH_Log_Context ctx;
+    uint8_t record[SIM_RECORD_MAX];
+    uint32_t index = 0, i;
+    int64_t first, again, resumed;
+
+    Sim_Reset();
+    Sim_Open(&ctx);
+    for (i = 0; i < 3000U; i++, index++) {
+        FLASH_Log_Append(&ctx, record, Sim_Record(index, SIM_RECORD_MAX, record));
+    }
+    FLASH_Log_Flush(&ctx);
+    first = Sim_ReadRun(&ctx, index - 1U, "wrap");
+
+    // 重新上电，按页序号恢复头尾
+    Sim_Open(&ctx);
+    again = Sim_ReadRun(&ctx, index - 1U, "wrap reinit");
+
+    // 读了几条后写入超过整个日志区的数据，读指针所在页被覆盖
+    FLASH_Log_Rewind(&ctx);
+    for (i = 0; i < 5U; i++) {
+        Sim_ReadRecord(&ctx, SIM_RECORD_MAX);
+    }
+    for (i = 0; i < 600U; i++, index++) {
+        FLASH_Log_Append(&ctx, record, Sim_Record(index, SIM_RECORD_MAX, record));
+    }
+    FLASH_Log_Flush(&ctx);
+    resumed = Sim_ReadRun(&ctx, index - 1U, "wrap resume");
+
+    printf("wrap: %u records, oldest kept %lld, after reinit %lld, reader resumed at %lld, dropped %u pages -> %s\n",
+           index, (long long)first, (long long)again, (long long)resumed, ctx.dropped_pages,
+           (first > 0 && again == first && resumed > first + 5 && sim.violations == 0U) ? "PASS" : "FAIL");
+    return (first > 0 && again == first && resumed > first + 5 && sim.violations == 0U) ? 0 : 1;
+}
+
+/**
+ * @brief 日志区被其他数据占用：初始化时整体擦除，之后正常追加和读取
+ */
+static int Sim_Foreign(void)
+{
+    static FLASH_Log_Context ctx;
+    uint8_t record[SIM_RECORD_MAX];
+    uint32_t i, erased;
+    int64_t first;
+
+    Sim_Reset();
+    for (i = 0; i < SIM_DWORDS * 7U / 8U; i++) {
+        sim.cells[i] = ((uint64_t)mrand48() << 32) ^ (uint64_t)mrand48();
+    }
+    Sim_Open(&ctx);
+    erased = sim.erased;
+    for (i = 0; i < 100U; i++) {
+        FLASH_Log_Append(&ctx, record, Sim_Record(i, SIM_RECORD_MAX, record));
+    }
+    FLASH_Log_Flush(&ctx);
+    first = Sim_ReadRun(&ctx, 99U, "foreign");
+
+    printf("foreign: %u pages erased at init, first record %lld -> %s\n", erased, (long long)first,
+           (erased == SIM_PAGES * 7U / 8U && first == 0 && sim.violations == 0U) ? "PASS" : "FAIL");
+    return (erased == SIM_PAGES * 7U / 8U && first == 0 && sim.violations == 0U) ? 0 : 1;
+}
+
+/**
+ * @brief 一次掉电试验
+ * @param cut 第几次编程 / 擦除时掉电
+ * @param appends 追加记录数，超过日志区容量时会环形覆盖
+ * @retval 0 通过
+ */
+static int Sim_PowerTrial(uint32_t cut, uint32_t appends, uint32_t* crc_errors)
+{
+    static FLASH_Log_Context ctx;
+    uint8_t record[SIM_RECORD_MAX];
+    uint32_t index, durable = 0, i;
+    int64_t got, prev = -1, first = -1;
+
+    Sim_Reset();
+    Sim_Open(&ctx);
+    sim.cut_after = cut;
+    for (index = 0; index < appends; index++) {
+        if (FLASH_Log_Append(&ctx, record, Sim_Record(index, SIM_RECORD_MAX, record)) != FLASH_LOG_OK) {
+            break;
+        }
+        if ((lrand48() % 8) == 0) {
+            if (FLASH_Log_Flush(&ctx) != FLASH_LOG_OK) {
+                break;
+            }
+            durable = index + 1U;
+        }
+    }
+
+    // 重新上电
+    sim.cut_after = -1;
+    sim.power_lost = 0;
+    if (Sim_Open(&ctx) != FLASH_LOG_OK) {
+        printf("power: cut %u, init failed\n", cut);
+        return 1;
+    }
+    for (;;) {
+        got = Sim_ReadRecord(&ctx, SIM_RECORD_MAX);
+        if (got == -1) {
+            break;
+        }
+        if (got == -2) {
+            (*crc_errors)++;
+            continue;
+        }
+        if (got < 0 || got <= prev || got > (int64_t)index) {
+            printf("power: cut %u, read %lld after %lld (appended %u)\n", cut, (long long)got, (long long)prev, index);
+            return 1;
+        }
+        // 环形覆盖只丢最旧的整页，之后已 Flush 的记录必须连续
+        if (prev >= 0 && got != prev + 1 && got <= (int64_t)durable) {
+            printf("power: cut %u, lost records %lld..%lld (durable %u)\n", cut, (long long)prev + 1, (long long)got - 1, durable);
+            return 1;
+        }
+        if (first < 0) {
+            first = got;
+        }
+        prev = got;
+    }
+    if (durable > 0U && (prev < (int64_t)durable - 1 || (ctx.dropped_pages == 0U && sim.erased == 0U && first != 0))) {
+        printf("power: cut %u, last read %lld, durable up to %u\n", cut, (long long)prev, durable);
+        return 1;
+    }
+
+    // 恢复后继续追加，新记录排在最后
+    for (i = 0; i < 3U; i++) {
+        if (FLASH_Log_Append(&ctx, record, Sim_Record(appends + i, SIM_RECORD_MAX, record)) != FLASH_LOG_OK) {
+            printf("power: cut %u, append after recovery failed\n", cut);
+            return 1;
+        }
+    }
+    FLASH_Log_Flush(&ctx);
+    while ((got = Sim_ReadRecord(&ctx, SIM_RECORD_MAX)) == -2) {
+        (*crc_errors)++;
+    }
+    for (i = 0; i < 3U && got == (int64_t)(appends + i); i++) {
+        got = Sim_ReadRecord(&ctx, SIM_RECORD_MAX);
+    }
+    if (i != 3U || got != -1 || sim.violations != 0U) {
+        printf("power: cut %u, records after recovery wrong (%u of 3, violations %u)\n", cut, i, sim.violations);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 随机掉电点：一半试验不回绕（校验一条不丢），一半写满多圈
+ */
+static int Sim_Power(uint32_t trials)
+{
+    uint32_t t, failed = 0, crc_errors = 0;
+
+    for (t = 0; t < trials; t++) {
+        uint32_t appends = (t & 1U) ? 1500U : 150U;
+        uint32_t cut = (uint32_t)(lrand48() % (appends * 20U));
+
+        failed += (uint32_t)Sim_PowerTrial(cut, appends, &crc_errors);
+    }
+    printf("power: %u trials, %u failed, %u torn records skipped by crc -> %s\n",
+           trials, failed, crc_errors, (failed == 0U) ? "PASS" : "FAIL");
+    return (failed == 0U) ? 0 : 1;
+}
+
+/**
+ * @brief 持续写入吞吐：模拟 Flash 时间下的有效数据速率，以及驱动本身的主机耗时
+ */
+static void Sim_Speed(void)
+{
+    static const uint16_t lengths[] = { 16, 64, 256, 1024 };
+    static FLASH_Log_Context ctx;
+    static uint8_t record[FLASH_LOG_MAX_RECORD];
+    uint32_t i, n;
+
+    printf("speed: record, KB/s (flash model), flash bytes per payload byte, erases, host MB/s (driver only)\n");
+    for (i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        uint32_t total = 0;
+        uint64_t start;
+        double cpu_ns;
+
+        memset(record, 0x5A, sizeof(record));
+        Sim_Reset();
+        Sim_Open(&ctx);
+        start = Sim_NowNs();
+        for (n = 0; total < 8U * SIM_PAGES * FLASH_LOG_PAGE_SIZE; n++) {
+            FLASH_Log_Append(&ctx, record, lengths[i]);
+            total += lengths[i];
+        }
+        FLASH_Log_Flush(&ctx);
+        cpu_ns = (double)(Sim_NowNs() - start);
+        printf("  %5u B  %6.1f  %5.3f  %5u  %7.1f\n", lengths[i],
+               total / 1024.0 / (sim.busy_us * 1e-6),
+               (sim.programmed * 8.0) / total, sim.erased,
+               total / 1048576.0 / (cpu_ns * 1e-9));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t trials = 2000;
+    const char* only = NULL;
+    int failed = 0;
+    int opt;
+
+    srand48(1);
+    while ((opt = getopt(argc, argv, "s:n:")) != -1) {
+        switch (opt) {
+        case 's': srand48(strtol(optarg, NULL, 0)); break;
+        case 'n': trials = (uint32_t)strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: flash_log_sim [-s seed] [-n power_trials] [staged|wrap|foreign|power|speed]\n");
+            return 2;
+        }
+    }
+    if (optind < argc) {
+        only = argv[optind];
+    }
+
+    if (only == NULL || strcmp(only, "staged") == 0) {
+        failed |= Sim_Staged();
+    }
+    if (only == NULL || strcmp(only, "wrap") == 0) {
+        failed |= Sim_Wrap();
+    }
+    if (only == NULL || strcmp(only, "foreign") == 0) {
+        failed |= Sim_Foreign();
+    }
+    if (only == NULL || strcmp(only, "power") == 0) {
+        failed |= Sim_Power(trials);
+    }
+    if (only == NULL || strcmp(only, "speed") == 0) {
+        Sim_Speed();
+    }
+    return failed;
+}
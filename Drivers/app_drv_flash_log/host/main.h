@@ -0,0 +1,81 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    main.h
+ * @brief   主机端替身：只提供 app_drv_flash_log.c 编译所需的 HAL 声明
+ * @note    主机模拟通过自定义 FLASH_Log_Ops 访问 RAM 中的 Flash 镜像，
+ *          这里的 HAL Flash 函数不会被调用，一律返回 HAL_ERROR
+ ******************************************************************************
+ */
+
+#ifndef HOST_MAIN_H_
+#define HOST_MAIN_H_
+
+#include <stdint.h>
+
+typedef enum {
+    HAL_OK = 0,
+    HAL_ERROR,
+    HAL_BUSY,
+    HAL_TIMEOUT,
+} HAL_StatusTypeDef;
+
+typedef struct {
+    volatile uint32_t MEMRMP;
+} SYSCFG_TypeDef;
+
+typedef struct {
+    uint32_t TypeErase;
+    uint32_t Banks;
+    uint32_t Page;
+    uint32_t NbPages;
+} FLASH_EraseInitTypeDef;
+
+static inline SYSCFG_TypeDef* Host_Syscfg(void)
+{
+    static SYSCFG_TypeDef syscfg;
+    return &syscfg;
+}
+
+#define SYSCFG                          (Host_Syscfg())
+#define SYSCFG_MEMRMP_FB_MODE           (1UL << 8)
+#define READ_BIT(reg, bit)              ((reg) & (bit))
+
+#define FLASH_BASE                      (0x08000000UL)
+#define FLASH_BANK_SIZE                 (0x00080000UL)
+#define FLASH_PAGE_SIZE                 (0x00000800UL)
+#define FLASH_BANK_1                    (1U)
+#define FLASH_BANK_2                    (2U)
+#define FLASH_TYPEERASE_PAGES           (0U)
+#define FLASH_TYPEPROGRAM_DOUBLEWORD    (0U)
+#define FLASH_FLAG_ALL_ERRORS           (0U)
+#define __HAL_FLASH_CLEAR_FLAG(flag)    ((void)(flag))
+
+static inline HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+    return HAL_ERROR;
+}
+
+static inline HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+    return HAL_ERROR;
+}
+
+static inline HAL_StatusTypeDef HAL_FLASH_Program(uint32_t type, uint32_t addr, uint64_t data)
+{
+    (void)type;
+    (void)addr;
+    (void)data;
+    return HAL_ERROR;
+}
+
+static inline HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef* erase, uint32_t* page_error)
+{
+    (void)erase;
+    *page_error = 0xFFFFFFFFUL;
+    return HAL_ERROR;
+}
+
+#endif /* HOST_MAIN_H_ */
@@ -0,0 +1,465 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    app_drv_fw_update.c
+ * @brief   串口固件升级驱动（双 Bank 快速编程）
+ * @note    接收第 N+1 块的同时以中断方式编程第 N 块，硬件 CRC 校验后切换启动 Bank
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include "app_drv_fw_update.h"
+
+// 帧解析状态
+#define FW_RX_SOF       0
+#define FW_RX_HEADER    1
+#define FW_RX_CTRL      2
+#define FW_RX_DATA      3
+#define FW_RX_CRC       4
+#define FW_RX_DISPATCH  5
+
+#define FW_UPDATE_ROW_ALIGN(x)  (((x) + FW_UPDATE_ROW_SIZE - 1U) & ~(FW_UPDATE_ROW_SIZE - 1U))
+
+static inline uint32_t FW_Update_GetU32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void FW_Update_PutU32(uint8_t* p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+static uint16_t FW_Update_Read(app_drv_fifo_t* fifo, uint8_t* dst, uint16_t want)
+{
+    uint16_t length = want;
+
+    if (app_drv_fifo_read(fifo, dst, &length) != APP_DRV_FIFO_RESULT_SUCCESS) {
+        return 0;
+    }
+    return length;
+}
+
+/**
+ * @brief 获取逻辑地址所在的物理 Bank（考虑 Bank 交换）
+ */
+static uint32_t FW_Update_GetBank(uint32_t addr)
+{
+    uint32_t in_bank1 = (addr < (FLASH_BASE + FW_UPDATE_BANK_SIZE)) ? 1U : 0U;
+
+    if (READ_BIT(SYSCFG->MEMRMP, SYSCFG_MEMRMP_FB_MODE) != 0U) {
+        in_bank1 = !in_bank1;
+    }
+    return in_bank1 ? FLASH_BANK_1 : FLASH_BANK_2;
+}
+
+/**
+ * @brief 发送应答帧
+ */
+static void FW_Update_SendAck(FW_Update_Context* ctx, uint8_t cmd, FW_Update_Status status)
+{
+    uint8_t* p = ctx->tx_buf;
+    uint32_t crc;
+
+    p[0] = FW_UPDATE_SOF;
+    p[1] = FW_UPDATE_CMD_ACK;
+    p[2] = 6;
+    p[3] = 0;
+    p[4] = cmd;
+    p[5] = (uint8_t)status;
+    FW_Update_PutU32(&p[6], ctx->next_offset);
+    crc = HAL_CRC_Calculate(ctx->hcrc, (uint32_t*)&p[1], 9) ^ 0xFFFFFFFFU;
+    FW_Update_PutU32(&p[10], crc);
+
+    if (ctx->send != NULL) {
+        ctx->send(ctx->send_user, p, 14);
+    }
+}
+
+/**
+ * @brief 计算当前帧的 CRC32（类型 + 长度 + 负载）
+ */
+static uint32_t FW_Update_FrameCrc(FW_Update_Context* ctx)
+{
+    uint8_t header[3];
+    uint16_t ctrl_len;
+    uint32_t crc;
+
+    header[0] = ctx->rx_type;
+    header[1] = (uint8_t)ctx->rx_length;
+    header[2] = (uint8_t)(ctx->rx_length >> 8);
+    crc = HAL_CRC_Calculate(ctx->hcrc, (uint32_t*)header, 3);
+
+    ctrl_len = (ctx->rx_type == FW_UPDATE_CMD_DATA) ? 4U : ctx->rx_length;
+    if (ctrl_len > 0) {
+        crc = HAL_CRC_Accumulate(ctx->hcrc, (uint32_t*)ctx->rx_ctrl, ctrl_len);
+    }
+    if (ctx->rx_type == FW_UPDATE_CMD_DATA && ctx->rx_length > 4U) {
+        crc = HAL_CRC_Accumulate(ctx->hcrc, (uint32_t*)ctx->rx_block->data, ctx->rx_length - 4U);
+    }
+    return crc ^ 0xFFFFFFFFU;
+}
+
+/**
+ * @brief 推进编程流水线：上一行完成后提交下一行
+ */
+static void FW_Update_Pump(FW_Update_Context* ctx)
+{
+    FW_Update_Block* blk;
+
+    if (ctx->flash_busy) {
+        return;
+    }
+
+    if (ctx->flash_error) {
+        ctx->blocks[0].ready = 0;
+        ctx->blocks[1].ready = 0;
+        ctx->prog_pos = 0;
+        return;
+    }
+
+    blk = &ctx->blocks[ctx->prog_index];
+    if (blk->ready && ctx->prog_pos >= FW_UPDATE_ROW_ALIGN(blk->length)) {
+        // 当前块编程完成，释放缓冲区
+        blk->ready = 0;
+        ctx->prog_pos = 0;
+        ctx->prog_index ^= 1U;
+        blk = &ctx->blocks[ctx->prog_index];
+    }
+    if (!blk->ready && ctx->blocks[ctx->prog_index ^ 1U].ready) {
+        ctx->prog_index ^= 1U;
+        blk = &ctx->blocks[ctx->prog_index];
+    }
+    if (!blk->ready) {
+        return;
+    }
+
+    if (ctx->prog_pos == 0) {
+        // 最后一块不足一行时用擦除值填充
+        memset(&blk->data[blk->length], 0xFF, FW_UPDATE_ROW_ALIGN(blk->length) - blk->length);
+    }
+
+    ctx->flash_busy = 1;
+    if (HAL_FLASH_Program_IT(FLASH_TYPEPROGRAM_FAST_AND_LAST,
+                             FW_UPDATE_TARGET_ADDR + blk->offset + ctx->prog_pos,
+                             (uint32_t)(uintptr_t)&blk->data[ctx->prog_pos]) != HAL_OK) {
+        ctx->flash_busy = 0;
+        ctx->flash_error = 1;
+        return;
+    }
+    ctx->prog_pos += FW_UPDATE_ROW_SIZE;
+}
+
+static uint8_t FW_Update_PipelineIdle(FW_Update_Context* ctx)
+{
+    return !ctx->flash_busy && !ctx->blocks[0].ready && !ctx->blocks[1].ready;
+}
+
+static void FW_Update_HandleStart(FW_Update_Context* ctx)
+{
+    FLASH_EraseInitTypeDef erase;
+    uint32_t page_error = 0;
+
+    ctx->state = FW_UPDATE_STATE_IDLE;
+    ctx->next_offset = 0;
+    ctx->flash_error = 0;
+
+    if (ctx->rx_length != 8U) {
+        FW_Update_SendAck(ctx, FW_UPDATE_CMD_START, FW_UPDATE_STATUS_SIZE_ERROR);
+        return;
+    }
+
+    ctx->image_size = FW_Update_GetU32(&ctx->rx_ctrl[0]);
+    ctx->image_crc = FW_Update_GetU32(&ctx->rx_ctrl[4]);
+    if (ctx->image_size == 0 || ctx->image_size > FW_UPDATE_IMAGE_MAX) {
+        FW_Update_SendAck(ctx, FW_UPDATE_CMD_START, FW_UPDATE_STATUS_SIZE_ERROR);
+        return;
+    }
+
+    // 快速编程前必须批量擦除整个非活动 Bank（代码在另一 Bank 运行，串口接收不中断）
+    erase.TypeErase = FLASH_TYPEERASE_MASSERASE;
+    erase.Banks = FW_Update_GetBank(FW_UPDATE_TARGET_ADDR);
+    erase.Page = 0;
+    erase.NbPages = 0;
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    if (HAL_FLASHEx_Erase(&erase, &page_error) != HAL_OK) {
+        HAL_FLASH_Lock();
+        FW_Update_SendAck(ctx, FW_UPDATE_CMD_START, FW_UPDATE_STATUS_FLASH_ERROR);
+        return;
+    }
+
+    // 日志区随 Bank 一起被擦除，丢弃其中的读写指针与暂存数据，之后从空日志重新开始
+    if (ctx->log != NULL) {
+        FLASH_Log_Format(ctx->log);
+    }
+
+    ctx->state = FW_UPDATE_STATE_RECEIVING;
+    FW_Update_SendAck(ctx, FW_UPDATE_CMD_START, FW_UPDATE_STATUS_OK);
+}
+
+static void FW_Update_HandleData(FW_Update_Context* ctx)
+{
+    FW_Update_Block* blk = ctx->rx_block;
+    uint32_t offset = FW_Update_GetU32(ctx->rx_ctrl);
+    uint16_t length = ctx->rx_length - 4U;
+    FW_Update_Status status = FW_UPDATE_STATUS_OK;
+
+    if (ctx->state != FW_UPDATE_STATE_RECEIVING) {
+        status = FW_UPDATE_STATUS_STATE_ERROR;
+    } else if (ctx->flash_error) {
+        status = FW_UPDATE_STATUS_FLASH_ERROR;
+        ctx->state = FW_UPDATE_STATE_IDLE;
+    } else if (offset != ctx->next_offset) {
+        // 之前的块丢失，让主机从期望偏移重发
+        status = FW_UPDATE_STATUS_SEQ_ERROR;
+        ctx->retransmit_count++;
+    } else if (length == 0 || (offset % FW_UPDATE_BLOCK_SIZE) != 0 || offset + length > ctx->image_size) {
+        status = FW_UPDATE_STATUS_SIZE_ERROR;
+    } else if (length != FW_UPDATE_BLOCK_SIZE && offset + length != ctx->image_size) {
+        // 只有最后一块可以不满，否则之后的偏移都不再按块对齐
+        status = FW_UPDATE_STATUS_SIZE_ERROR;
+    }
+
+    if (status == FW_UPDATE_STATUS_OK) {
+        blk->offset = offset;
+        blk->length = length;
+        blk->ready = 1;
+        ctx->next_offset += length;
+    }
+
+    // 先应答再编程，主机可立即发送下一块
+    FW_Update_SendAck(ctx, FW_UPDATE_CMD_DATA, status);
+    FW_Update_Pump(ctx);
+}
+
+static void FW_Update_HandleFinish(FW_Update_Context* ctx)
+{
+    FW_Update_Status status = FW_UPDATE_STATUS_OK;
+
+    HAL_FLASH_Lock();
+
+    if (ctx->state != FW_UPDATE_STATE_RECEIVING) {
+        status = FW_UPDATE_STATUS_STATE_ERROR;
+    } else if (ctx->flash_error) {
+        status = FW_UPDATE_STATUS_FLASH_ERROR;
+    } else if (ctx->next_offset != ctx->image_size) {
+        status = FW_UPDATE_STATUS_SIZE_ERROR;
+    } else if ((HAL_CRC_Calculate(ctx->hcrc, (uint32_t*)FW_UPDATE_TARGET_ADDR, ctx->image_size) ^ 0xFFFFFFFFU)
+               != ctx->image_crc) {
+        status = FW_UPDATE_STATUS_VERIFY_ERROR;
+    }
+
+    ctx->state = (status == FW_UPDATE_STATUS_OK) ? FW_UPDATE_STATE_READY_TO_SWAP : FW_UPDATE_STATE_IDLE;
+    FW_Update_SendAck(ctx, FW_UPDATE_CMD_FINISH, status);
+}
+
+/**
+ * @brief 处理一帧完整数据
+ * @retval 0 需要等待编程流水线空闲，稍后重试
+ */
+static uint8_t FW_Update_Dispatch(FW_Update_Context* ctx)
+{
+    if (FW_Update_GetU32(ctx->rx_crc) != FW_Update_FrameCrc(ctx)) {
+        ctx->frame_error_count++;
+        FW_Update_SendAck(ctx, ctx->rx_type, FW_UPDATE_STATUS_CRC_ERROR);
+        return 1;
+    }
+
+    switch (ctx->rx_type) {
+    case FW_UPDATE_CMD_START:
+        if (!FW_Update_PipelineIdle(ctx)) {
+            return 0;
+        }
+        FW_Update_HandleStart(ctx);
+        break;
+    case FW_UPDATE_CMD_DATA:
+        FW_Update_HandleData(ctx);
+        break;
+    case FW_UPDATE_CMD_FINISH:
+        // 等待所有数据块编程完成后再校验
+        if (!FW_Update_PipelineIdle(ctx)) {
+            return 0;
+        }
+        FW_Update_HandleFinish(ctx);
+        break;
+    default:
+        ctx->frame_error_count++;
+        break;
+    }
+    return 1;
+}
+
+/**
+ * @brief 初始化固件升级上下文
+ * @param ctx 指向 FW_Update_Context 结构体的指针
+ * @param hcrc 指向 CRC_HandleTypeDef 的指针（标准 CRC-32 配置）
+ * @param log 位于目标 Bank 末尾的 Flash 日志，START 擦除后重新格式化，可为 NULL
+ * @param send 应答发送函数
+ * @param user 传给发送函数的用户指针
+ * @note 同时使能 Flash 中断，中断函数中需调用 HAL_FLASH_IRQHandler；优先级由 IRQ_ApplyPriorities 的表统一设置
+ */
+void FW_Update_Init(FW_Update_Context* ctx, CRC_HandleTypeDef* hcrc, FLASH_Log_Context* log,
+                    FW_Update_Send_Func send, void* user)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->hcrc = hcrc;
+    ctx->log = log;
+    ctx->send = send;
+    ctx->send_user = user;
+    ctx->rx_state = FW_RX_SOF;
+
+    HAL_NVIC_EnableIRQ(FLASH_IRQn);
+}
+
+/**
+ * @brief 解析接收 FIFO 中的升级帧并推进编程流水线
+ * @param ctx 指向 FW_Update_Context 结构体的指针
+ * @param fifo 串口接收 FIFO（建议容量不小于 FW_UPDATE_BLOCK_SIZE）
+ * @retval 当前升级状态，FW_UPDATE_STATE_READY_TO_SWAP 时应在应答发送完成后调用 FW_Update_SwapBank
+ * @note DATA 负载直接从 FIFO 读入乒乓缓冲区，两个缓冲区都在使用时暂停解析
+ */
+FW_Update_State FW_Update_Process(FW_Update_Context* ctx, app_drv_fifo_t* fifo)
+{
+    uint8_t byte;
+    uint16_t ctrl_len;
+
+    FW_Update_Pump(ctx);
+
+    while (1) {
+        switch (ctx->rx_state) {
+        case FW_RX_SOF:
+            if (FW_Update_Read(fifo, &byte, 1) == 0) {
+                return ctx->state;
+            }
+            if (byte == FW_UPDATE_SOF) {
+                ctx->rx_state = FW_RX_HEADER;
+                ctx->rx_pos = 0;
+            }
+            break;
+
+        case FW_RX_HEADER:
+            ctx->rx_pos += FW_Update_Read(fifo, &ctx->rx_ctrl[ctx->rx_pos], 3U - ctx->rx_pos);
+            if (ctx->rx_pos < 3U) {
+                return ctx->state;
+            }
+            ctx->rx_type = ctx->rx_ctrl[0];
+            ctx->rx_length = (uint16_t)(ctx->rx_ctrl[1] | (ctx->rx_ctrl[2] << 8));
+            ctx->rx_pos = 0;
+            if (ctx->rx_type == FW_UPDATE_CMD_DATA) {
+                if (ctx->rx_length < 4U || ctx->rx_length > 4U + FW_UPDATE_BLOCK_SIZE) {
+                    ctx->frame_error_count++;
+                    ctx->rx_state = FW_RX_SOF;
+                    break;
+                }
+            } else if (ctx->rx_length > sizeof(ctx->rx_ctrl)) {
+                ctx->frame_error_count++;
+                ctx->rx_state = FW_RX_SOF;
+                break;
+            }
+            ctx->rx_state = FW_RX_CTRL;
+            break;
+
+        case FW_RX_CTRL:
+            ctrl_len = (ctx->rx_type == FW_UPDATE_CMD_DATA) ? 4U : ctx->rx_length;
+            ctx->rx_pos += FW_Update_Read(fifo, &ctx->rx_ctrl[ctx->rx_pos], ctrl_len - ctx->rx_pos);
+            if (ctx->rx_pos < ctrl_len) {
+                return ctx->state;
+            }
+            ctx->rx_pos = 0;
+            if (ctx->rx_type != FW_UPDATE_CMD_DATA) {
+                ctx->rx_state = FW_RX_CRC;
+                break;
+            }
+            // 选择空闲缓冲区，负载直接写入，无中间拷贝
+            if (!ctx->blocks[0].ready) {
+                ctx->rx_block = &ctx->blocks[0];
+            } else if (!ctx->blocks[1].ready) {
+                ctx->rx_block = &ctx->blocks[1];
+            } else {
+                ctx->rx_pos = ctrl_len;
+                FW_Update_Pump(ctx);
+                return ctx->state;
+            }
+            ctx->rx_state = FW_RX_DATA;
+            break;
+
+        case FW_RX_DATA:
+            ctx->rx_pos += FW_Update_Read(fifo, &ctx->rx_block->data[ctx->rx_pos], ctx->rx_length - 4U - ctx->rx_pos);
+            if (ctx->rx_pos < ctx->rx_length - 4U) {
+                FW_Update_Pump(ctx);
+                return ctx->state;
+            }
+            ctx->rx_pos = 0;
+            ctx->rx_state = FW_RX_CRC;
+            break;
+
+        case FW_RX_CRC:
+            ctx->rx_pos += FW_Update_Read(fifo, &ctx->rx_crc[ctx->rx_pos], 4U - ctx->rx_pos);
+            if (ctx->rx_pos < 4U) {
+                return ctx->state;
+            }
+            ctx->rx_state = FW_RX_DISPATCH;
+            break;
+
+        case FW_RX_DISPATCH:
+        default:
+            if (!FW_Update_Dispatch(ctx)) {
+                FW_Update_Pump(ctx);
+                return ctx->state;
+            }
+            ctx->rx_state = FW_RX_SOF;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Flash 编程完成/出错回调
+ * @param ctx 指向 FW_Update_Context 结构体的指针
+ * @param success 1：编程完成，0：编程出错
+ * @note 在中断上下文中调用，只更新标志，下一行由主循环提交
+ */
+void FW_Update_FlashCallback(FW_Update_Context* ctx, uint8_t success)
+{
+    if (!success) {
+        ctx->flash_error = 1;
+    }
+    ctx->flash_busy = 0;
+}
+
+/**
+ * @brief 切换启动 Bank 并复位
+ * @param ctx 指向 FW_Update_Context 结构体的指针
+ * @note 仅在 FW_UPDATE_STATE_READY_TO_SWAP 状态下生效
+ */
+void FW_Update_SwapBank(FW_Update_Context* ctx)
+{
+    FLASH_OBProgramInitTypeDef ob;
+
+    if (ctx->state != FW_UPDATE_STATE_READY_TO_SWAP) {
+        return;
+    }
+
+    memset(&ob, 0, sizeof(ob));
+    ob.OptionType = OPTIONBYTE_USER;
+    ob.USERType = OB_USER_BFB2;
+    // 新镜像位于当前非活动 Bank，翻转 BFB2 即从该 Bank 启动
+    ob.USERConfig = (READ_BIT(FLASH->OPTR, FLASH_OPTR_BFB2) != 0U) ? OB_BFB2_DISABLE : OB_BFB2_ENABLE;
+
+    HAL_FLASH_Unlock();
+    HAL_FLASH_OB_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    if (HAL_FLASHEx_OBProgram(&ob) == HAL_OK) {
+        HAL_FLASH_OB_Launch();  // 加载选项字节并复位
+    }
+    HAL_FLASH_OB_Lock();
+    HAL_FLASH_Lock();
+    ctx->state = FW_UPDATE_STATE_IDLE;
+}
@@ -0,0 +1,127 @@
+#ifndef APP_DRV_FW_UPDATE_H_
+#define APP_DRV_FW_UPDATE_H_
+
+#include <stdint.h>
+#include "main.h"
+#include "app_drv_fifo.h"
+#include "app_drv_flash_log.h"
+
+/*
+ * 串口固件升级（双 Bank）
+ *
+ * 帧格式（小端）：
+ *   0xA5 | 类型(1) | 长度(2) | 负载(长度) | CRC32(4，覆盖类型/长度/负载，与 zlib crc32 一致)
+ *
+ * 主机 -> 设备：
+ *   FW_UPDATE_CMD_START  负载：镜像长度(4) + 镜像 CRC32(4)，设备批量擦除非活动 Bank
+ *   FW_UPDATE_CMD_DATA   负载：偏移(4) + 数据(FW_UPDATE_BLOCK_SIZE，只有镜像最后一块可以更短；偏移按块对齐)
+ *   FW_UPDATE_CMD_FINISH 无负载，设备用硬件 CRC 校验整个镜像
+ * 设备 -> 主机：
+ *   FW_UPDATE_CMD_ACK    负载：命令(1) + 状态(1) + 期望的下一个偏移(4)
+ *
+ * 流水线：数据块校验通过后立即应答并进入乒乓缓冲区，随后以中断方式快速编程（每次一行 256 字节），
+ * 编程期间主循环继续从接收 FIFO 解析下一块，主机可保持 2 个数据块在途。
+ * 偏移不连续或帧校验失败时回复期望偏移，主机从该偏移重发（回退 N 帧）。
+ *
+ * 速度参考 (数据手册典型值)：快速编程约 1.91 ms / 行 (≈134 KB/s)，
+ * 高于 921600 波特率的 92 KB/s 线速，升级时间由串口速率决定。
+ *
+ * Flash 日志区 (app_drv_flash_log) 位于非活动 Bank 末尾 (逻辑地址 FLASH_LOG_START_ADDR)：
+ *   镜像不得超过 FW_UPDATE_IMAGE_MAX (448 KB)，两个 Bank 的末尾 64 KB 都不放代码，链接脚本中 FLASH 区域按此限制；
+ *   快速编程要求先批量擦除整个 Bank，START 时日志随之清空，FW_Update_Init 传入的日志上下文在擦除后重新格式化；
+ *   切换后日志地址落在旧固件所在 Bank 的末尾，FLASH_Log_Init 发现该区域不是日志时整体格式化。
+ *   升级期间不要追加日志：两者共用 Flash 控制器，日志编程结束时会给 Flash 上锁，使后续行编程失败。
+ */
+
+// 数据块大小，必须是 256 字节（一行）的整数倍
+#ifndef FW_UPDATE_BLOCK_SIZE
+  #define FW_UPDATE_BLOCK_SIZE  (2048U)
+#endif
+
+#define FW_UPDATE_ROW_SIZE      (256U)
+#define FW_UPDATE_BANK_SIZE     (0x80000UL)                       // 单个 Bank 大小
+#define FW_UPDATE_TARGET_ADDR   (FLASH_BASE + FW_UPDATE_BANK_SIZE) // 非活动 Bank 的逻辑地址
+#define FW_UPDATE_IMAGE_MAX     (FLASH_LOG_START_ADDR - FW_UPDATE_TARGET_ADDR) // 镜像上限，不覆盖日志区
+
+#define FW_UPDATE_SOF           (0xA5U)
+#define FW_UPDATE_CMD_START     (0x01U)
+#define FW_UPDATE_CMD_DATA      (0x02U)
+#define FW_UPDATE_CMD_FINISH    (0x03U)
+#define FW_UPDATE_CMD_ACK       (0x80U)
+
+typedef enum {
+    FW_UPDATE_STATUS_OK = 0,
+    FW_UPDATE_STATUS_CRC_ERROR,      // 帧校验失败
+    FW_UPDATE_STATUS_SEQ_ERROR,      // 偏移不是期望值
+    FW_UPDATE_STATUS_SIZE_ERROR,     // 长度非法或镜像过大
+    FW_UPDATE_STATUS_FLASH_ERROR,    // 擦除或编程失败
+    FW_UPDATE_STATUS_VERIFY_ERROR,   // 镜像 CRC 不一致
+    FW_UPDATE_STATUS_STATE_ERROR,    // 未收到 START
+} FW_Update_Status;
+
+typedef enum {
+    FW_UPDATE_STATE_IDLE = 0,        // 等待 START
+    FW_UPDATE_STATE_RECEIVING,       // 接收并编程数据块
+    FW_UPDATE_STATE_READY_TO_SWAP,   // 校验通过，等待切换 Bank
+} FW_Update_State;
+
+// 应答发送函数类型定义，返回 0 表示成功
+typedef int (*FW_Update_Send_Func)(void* user, const uint8_t* data, uint16_t length);
+
+// 乒乓缓冲区
+typedef struct {
+    uint8_t data[FW_UPDATE_BLOCK_SIZE] __attribute__((aligned(8)));
+    uint32_t offset;                 // 镜像内偏移
+    uint16_t length;                 // 有效数据长度
+    uint8_t ready;                   // 1：等待/正在编程
+} FW_Update_Block;
+
+// 固件升级上下文结构体
+typedef struct {
+    CRC_HandleTypeDef* hcrc;
+    FLASH_Log_Context* log;          // 与目标 Bank 共用的日志，可为 NULL
+    FW_Update_Send_Func send;
+    void* send_user;
+
+    FW_Update_State state;
+    uint32_t image_size;
+    uint32_t image_crc;
+    uint32_t next_offset;            // 期望接收的下一个偏移
+
+    // 帧解析
+    uint8_t rx_state;
+    uint16_t rx_pos;
+    uint8_t rx_type;
+    uint16_t rx_length;
+    uint8_t rx_ctrl[8];              // START 负载或 DATA 偏移
+    uint8_t rx_crc[4];
+    FW_Update_Block* rx_block;       // DATA 负载直接写入的缓冲区
+
+    // 编程流水线
+    FW_Update_Block blocks[2];
+    uint8_t prog_index;              // 正在编程的缓冲区
+    uint16_t prog_pos;               // 块内已提交编程的字节数
+    volatile uint8_t flash_busy;
+    volatile uint8_t flash_error;
+
+    uint8_t tx_buf[16];
+
+    // 统计
+    uint32_t frame_error_count;
+    uint32_t retransmit_count;
+} FW_Update_Context;
+
+// 初始化（hcrc 需配置为标准 CRC-32，见 MX_CRC_Init；log 为 FLASH_LOG_START_ADDR 处的日志，未使用时传 NULL）
+void FW_Update_Init(FW_Update_Context* ctx, CRC_HandleTypeDef* hcrc, FLASH_Log_Context* log,
+                    FW_Update_Send_Func send, void* user);
+
+// 主循环中调用：从接收 FIFO 解析帧并推进编程流水线
+FW_Update_State FW_Update_Process(FW_Update_Context* ctx, app_drv_fifo_t* fifo);
+
+// 在 HAL_FLASH_EndOfOperationCallback / HAL_FLASH_OperationErrorCallback 中调用
+void FW_Update_FlashCallback(FW_Update_Context* ctx, uint8_t success);
+
+// 校验通过且应答发送完成后调用：切换启动 Bank 并复位，不返回
+void FW_Update_SwapBank(FW_Update_Context* ctx);
+
+#endif /* APP_DRV_FW_UPDATE_H_ */
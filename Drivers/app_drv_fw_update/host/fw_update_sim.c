@@ -0,0 +1,1007 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    fw_update_sim.c
+ * @brief   双 Bank 固件升级主机端模拟（Linux）
+ * @note    与固件共用 app_drv_fw_update.c / app_drv_flash_log.c / app_drv_fifo.c，
+ *          同目录的 main.h 替代 HAL，编译：
+ *            cc -O2 -I. -I.. -I../../app_drv_flash_log -I../../app_drv_fifo -o fw_update_sim fw_update_sim.c \
+ *               ../app_drv_fw_update.c ../../app_drv_flash_log/app_drv_flash_log.c ../../app_drv_fifo/app_drv_fifo.c
+ *
+ *          驱动把 Flash 与缓冲区地址当作 32 位传给 HAL，因此 1 MB Flash 镜像映射在真实地址 0x08000000，
+ *          设备上下文放在映射到 0x20000000 的 "SRAM" 中。Flash 按 STM32L4 双 Bank 规则工作：
+ *          只能在擦除状态下编程 (否则 PROGERR)，上锁时编程/擦除失败，行编程 1.91 ms 后以"中断"完成，
+ *          批量擦除 22.1 ms 期间主循环停顿；选项字节 BFB2 翻转后复位，Bank 交换体现在逻辑地址映射上。
+ *          串口按波特率逐字节推进（全双工，10 位 / 字节），主机端保持 2 个数据块在途，
+ *          收到 SEQ/CRC/SIZE 错误从期望偏移重发，应答超时从最后确认的偏移重发。用例：
+ *            clean     921600 波特率完整升级：切换后从新 Bank 运行，旧固件末尾的日志区重新格式化
+ *            noisy     两个方向按误码率翻转比特，重传后镜像仍完整
+ *            short     镜像中间插入一个短块，设备回复 SIZE_ERROR，主机重发后完成
+ *            oversize  镜像超过 FW_UPDATE_IMAGE_MAX，START 即被拒绝，日志不被擦除
+ *            verify    一个 Flash 单元编程后仍保持 1，FINISH 校验失败且不切换 Bank
+ *            twice     连续升级两次，目标 Bank 交替，日志跟随逻辑地址
+ *            speed     不同波特率下的升级时间与吞吐
+ *
+ *            fw_update_sim [-b baud] [-e ber] [-n image_bytes] [-s seed]
+ *                          [clean|noisy|short|oversize|verify|twice|speed]
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "app_drv_fw_update.h"
+
+#define SIM_FLASH_SIZE          (2U * FW_UPDATE_BANK_SIZE)
+#define SIM_SRAM_ADDR           (0x20000000UL)
+#define SIM_ROW_US              (1910.0)    // 快速编程一行
+#define SIM_MASS_ERASE_US       (22100.0)   // 批量擦除一个 Bank
+#define SIM_PAGE_ERASE_US       (22020.0)   // 页擦除
+#define SIM_DWORD_US            (81.69)     // 双字编程
+#define SIM_RX_FIFO_SIZE        (4096U)     // 设备串口接收 FIFO
+#define SIM_TX_FIFO_SIZE        (16384U)    // 主机串口发送缓冲
+#define SIM_OLD_IMAGE           (480U * 1024U) // 旧固件大小（加上限之前的构建会占用 Bank 末尾）
+#define SIM_WINDOW              (2U)        // 主机在途数据块数
+#define SIM_NO_OFFSET           (0xFFFFFFFFUL)
+
+// 模拟的双 Bank Flash 与选项字节
+typedef struct {
+    uint8_t* mem;               // 逻辑地址 FLASH_BASE 起的 1 MB
+    uint8_t locked;
+    uint8_t ob_locked;
+    uint32_t ob_pending;        // 已编程、等待 OB_Launch 加载的 OPTR
+    double stall_us;            // 阻塞式擦除/编程占用的 CPU 时间
+    uint8_t busy;               // 中断方式的行编程进行中
+    uint8_t busy_ok;
+    double busy_until;
+    uint32_t rows;
+    uint32_t mass_erases;
+    uint32_t violations;        // 对未擦除单元编程 / 上锁时操作
+    uint32_t stuck_addr;        // 故障注入：该字节的最低位编程后仍为 1，0 不注入
+    jmp_buf reset;              // OB_Launch 复位
+} Sim_Flash;
+
+// 设备端：运行在 "SRAM" 中的上下文
+typedef struct {
+    FW_Update_Context fw;
+    FLASH_Log_Context log;
+    app_drv_fifo_t rx_fifo;
+    app_drv_fifo_t tx_fifo;
+    uint8_t rx_buf[SIM_RX_FIFO_SIZE];
+    uint8_t tx_buf[256];
+    uint32_t overruns;
+} Sim_Device;
+
+// 主机端升级流程
+typedef enum {
+    PEER_START = 0,
+    PEER_DATA,
+    PEER_FINISH,
+    PEER_WAIT_RESET,
+    PEER_DONE,
+    PEER_FAILED,
+} Peer_Phase;
+
+typedef struct {
+    const uint8_t* image;
+    uint32_t size;
+    uint32_t crc;
+    Peer_Phase phase;
+    uint32_t send_offset;
+    uint32_t acked;
+    uint32_t rewind_to;
+    uint16_t outstanding;       // 已发出尚未收到应答的数据帧数
+    uint16_t stale;             // 回退时仍在途的旧帧数，它们的错误应答不再触发回退
+    uint32_t short_at;          // 注入一次短块的偏移，SIM_NO_OFFSET 不注入
+    double deadline;
+    double timeout_us;
+    uint8_t status;             // 最后一个应答的状态
+    uint8_t status_cmd;
+    uint32_t resent_blocks;
+    uint32_t timeouts;
+    uint32_t silent;            // 连续超时次数
+    uint32_t rejected;
+    app_drv_fifo_t tx_fifo;
+    uint8_t tx_buf[SIM_TX_FIFO_SIZE];
+    uint8_t rx[14];
+    uint8_t rx_pos;
+} Peer_Host;
+
+// 一次升级的配置与结果
+typedef struct {
+    uint32_t baud;
+    double ber;
+    uint32_t short_at;
+    uint32_t stuck_offset;      // 镜像内注入故障的偏移，0 不注入
+} Sim_Config;
+
+typedef struct {
+    Peer_Phase phase;
+    uint8_t status;
+    uint8_t status_cmd;
+    uint8_t swapped;
+    double seconds;
+    uint32_t resent_blocks;
+    uint32_t timeouts;
+    uint32_t rejected;
+    uint32_t retransmit_count;
+    uint32_t frame_error_count;
+    uint32_t overruns;
+    uint32_t injected;
+} Sim_Result;
+
+SYSCFG_TypeDef host_syscfg;
+FLASH_TypeDef host_flash_regs;
+
+static Sim_Flash sim;
+static Sim_Device* dev;
+static CRC_HandleTypeDef sim_hcrc;
+static double now_us;
+
+/* ----------------------------------------------------------------------------
+ * HAL 替身
+ * ------------------------------------------------------------------------- */
+
+static uint32_t Sim_CrcUpdate(uint32_t reg, const uint8_t* data, uint32_t length)
+{
+    uint32_t i;
+    int bit;
+
+    for (i = 0; i < length; i++) {
+        reg ^= data[i];
+        for (bit = 0; bit < 8; bit++) {
+            reg = (reg >> 1) ^ (0xEDB88320UL & (0U - (reg & 1U)));
+        }
+    }
+    return reg;
+}
+
+static uint32_t Sim_Crc32(const uint8_t* data, uint32_t length)
+{
+    return Sim_CrcUpdate(0xFFFFFFFFUL, data, length) ^ 0xFFFFFFFFUL;
+}
+
+// 与 MX_CRC_Init 的配置一致：字节输入、输入输出按位反转、初值全 1、不做最终异或
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef* hcrc, uint32_t* buffer, uint32_t length)
+{
+    hcrc->Instance = Sim_CrcUpdate(0xFFFFFFFFUL, (const uint8_t*)buffer, length);
+    return hcrc->Instance;
+}
+
+uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef* hcrc, uint32_t* buffer, uint32_t length)
+{
+    hcrc->Instance = Sim_CrcUpdate(hcrc->Instance, (const uint8_t*)buffer, length);
+    return hcrc->Instance;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type irqn)
+{
+    (void)irqn;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+    sim.locked = 0;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+    sim.locked = 1;
+    return HAL_OK;
+}
+
+static uint8_t* Sim_Cell(uint32_t addr, uint32_t length)
+{
+    if (addr < FLASH_BASE || addr + length > FLASH_BASE + SIM_FLASH_SIZE) {
+        return NULL;
+    }
+    return &sim.mem[addr - FLASH_BASE];
+}
+
+static int Sim_IsErased(const uint8_t* p, uint32_t length)
+{
+    uint32_t i;
+
+    for (i = 0; i < length; i++) {
+        if (p[i] != 0xFF) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void Sim_Write(uint32_t addr, const uint8_t* src, uint32_t length)
+{
+    uint8_t* p = Sim_Cell(addr, length);
+
+    memcpy(p, src, length);
+    if (sim.stuck_addr >= addr && sim.stuck_addr < addr + length) {
+        p[sim.stuck_addr - addr] |= 0x01U;
+    }
+}
+
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t type, uint32_t addr, uint64_t data)
+{
+    uint8_t* p = Sim_Cell(addr, 8);
+
+    if (sim.locked || sim.busy || type != FLASH_TYPEPROGRAM_DOUBLEWORD || p == NULL || (addr & 7U) != 0U
+        || !Sim_IsErased(p, 8)) {
+        sim.violations++;
+        return HAL_ERROR;
+    }
+    Sim_Write(addr, (const uint8_t*)&data, 8);
+    sim.stall_us += SIM_DWORD_US;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Program_IT(uint32_t type, uint32_t addr, uint64_t data)
+{
+    uint8_t* p = Sim_Cell(addr, FW_UPDATE_ROW_SIZE);
+
+    if (sim.locked || sim.busy || type != FLASH_TYPEPROGRAM_FAST_AND_LAST || p == NULL
+        || (addr % FW_UPDATE_ROW_SIZE) != 0U) {
+        sim.violations++;
+        return HAL_ERROR;
+    }
+    // 行数据在调用时写入 Flash，完成后由中断报告结果
+    sim.busy_ok = (uint8_t)Sim_IsErased(p, FW_UPDATE_ROW_SIZE);
+    if (sim.busy_ok) {
+        Sim_Write(addr, (const uint8_t*)(uintptr_t)data, FW_UPDATE_ROW_SIZE);
+    } else {
+        sim.violations++;
+    }
+    sim.busy = 1;
+    sim.busy_until = now_us + SIM_ROW_US;
+    sim.rows++;
+    return HAL_OK;
+}
+
+// 物理 Bank 当前映射到的逻辑地址
+static uint32_t Sim_BankAddr(uint32_t bank)
+{
+    uint32_t upper = (bank == FLASH_BANK_2) ? 1U : 0U;
+
+    if (READ_BIT(SYSCFG->MEMRMP, SYSCFG_MEMRMP_FB_MODE) != 0U) {
+        upper = !upper;
+    }
+    return FLASH_BASE + upper * FW_UPDATE_BANK_SIZE;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef* erase, uint32_t* page_error)
+{
+    uint32_t base = Sim_BankAddr(erase->Banks);
+    uint32_t i;
+
+    *page_error = 0xFFFFFFFFUL;
+    if (sim.locked || sim.busy) {
+        sim.violations++;
+        return HAL_ERROR;
+    }
+    if (erase->TypeErase == FLASH_TYPEERASE_MASSERASE) {
+        memset(Sim_Cell(base, FW_UPDATE_BANK_SIZE), 0xFF, FW_UPDATE_BANK_SIZE);
+        sim.stall_us += SIM_MASS_ERASE_US;
+        sim.mass_erases++;
+        return HAL_OK;
+    }
+    for (i = 0; i < erase->NbPages; i++) {
+        if (erase->Page + i >= FW_UPDATE_BANK_SIZE / FLASH_PAGE_SIZE) {
+            *page_error = erase->Page + i;
+            return HAL_ERROR;
+        }
+        memset(Sim_Cell(base + (erase->Page + i) * FLASH_PAGE_SIZE, FLASH_PAGE_SIZE), 0xFF, FLASH_PAGE_SIZE);
+        sim.stall_us += SIM_PAGE_ERASE_US;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_OB_Unlock(void)
+{
+    if (sim.locked) {
+        return HAL_ERROR;
+    }
+    sim.ob_locked = 0;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_OB_Lock(void)
+{
+    sim.ob_locked = 1;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_OBProgram(FLASH_OBProgramInitTypeDef* ob)
+{
+    if (sim.locked || sim.ob_locked || ob->OptionType != OPTIONBYTE_USER || ob->USERType != OB_USER_BFB2) {
+        sim.violations++;
+        return HAL_ERROR;
+    }
+    sim.ob_pending = (FLASH->OPTR & ~FLASH_OPTR_BFB2) | (ob->USERConfig & FLASH_OPTR_BFB2);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_OB_Launch(void)
+{
+    FLASH->OPTR = sim.ob_pending;
+    longjmp(sim.reset, 1);
+}
+
+/* ----------------------------------------------------------------------------
+ * 设备端
+ * ------------------------------------------------------------------------- */
+
+static int Sim_DeviceSend(void* user, const uint8_t* data, uint16_t length)
+{
+    uint16_t n = length;
+
+    (void)user;
+    app_drv_fifo_write(&dev->tx_fifo, (uint8_t*)data, &n);
+    return (n == length) ? 0 : -1;
+}
+
+/**
+ * @brief 复位后启动：BFB2 置位时从 Bank2 启动 (FB_MODE = 1)，逻辑地址随之交换
+ */
+static void Sim_Boot(void)
+{
+    uint32_t fb_mode = (READ_BIT(FLASH->OPTR, FLASH_OPTR_BFB2) != 0U) ? SYSCFG_MEMRMP_FB_MODE : 0U;
+    static uint8_t half[FW_UPDATE_BANK_SIZE];
+
+    if (fb_mode != READ_BIT(SYSCFG->MEMRMP, SYSCFG_MEMRMP_FB_MODE)) {
+        memcpy(half, sim.mem, FW_UPDATE_BANK_SIZE);
+        memcpy(sim.mem, sim.mem + FW_UPDATE_BANK_SIZE, FW_UPDATE_BANK_SIZE);
+        memcpy(sim.mem + FW_UPDATE_BANK_SIZE, half, FW_UPDATE_BANK_SIZE);
+        SYSCFG->MEMRMP = fb_mode;
+    }
+    sim.locked = 1;
+    sim.ob_locked = 1;
+    sim.busy = 0;
+
+    memset(dev, 0, sizeof(*dev));
+    app_drv_fifo_init(&dev->rx_fifo, dev->rx_buf, sizeof(dev->rx_buf));
+    app_drv_fifo_init(&dev->tx_fifo, dev->tx_buf, sizeof(dev->tx_buf));
+    FLASH_Log_Init(&dev->log, FLASH_LOG_START_ADDR, FLASH_LOG_PAGE_COUNT, NULL);
+    FW_Update_Init(&dev->fw, &sim_hcrc, &dev->log, Sim_DeviceSend, NULL);
+}
+
+/**
+ * @brief 上电：Bank1 中是旧固件，Bank2 空白
+ */
+static void Sim_PowerOn(void)
+{
+    uint32_t i;
+
+    memset(sim.mem, 0xFF, SIM_FLASH_SIZE);
+    for (i = 0; i < SIM_OLD_IMAGE; i++) {
+        sim.mem[i] = (uint8_t)mrand48();
+    }
+    FLASH->OPTR = 0;
+    SYSCFG->MEMRMP = 0;
+    sim.stuck_addr = 0;
+    sim.rows = 0;
+    sim.mass_erases = 0;
+    sim.violations = 0;
+    Sim_Boot();
+}
+
+// 日志记录：序号 + 固定内容
+static uint16_t Sim_LogRecord(uint32_t index, uint8_t* record)
+{
+    memset(record, (int)(0x30U + index), 40);
+    memcpy(record, &index, sizeof(index));
+    return 40;
+}
+
+static uint32_t Sim_LogAppend(uint32_t first, uint32_t count)
+{
+    uint8_t record[40];
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        if (FLASH_Log_Append(&dev->log, record, Sim_LogRecord(first + i, record)) != FLASH_LOG_OK) {
+            return i;
+        }
+    }
+    FLASH_Log_Flush(&dev->log);
+    return count;
+}
+
+/**
+ * @brief 读出日志中的全部记录，检查是否恰好是 first 起的 count 条
+ */
+static int Sim_LogCheck(uint32_t first, uint32_t count)
+{
+    uint8_t record[64], expect[40];
+    uint16_t length;
+    uint32_t n = 0;
+    FLASH_Log_Result res;
+
+    FLASH_Log_Rewind(&dev->log);
+    for (;;) {
+        length = sizeof(record);
+        res = FLASH_Log_Read(&dev->log, record, &length);
+        if (res == FLASH_LOG_EMPTY) {
+            break;
+        }
+        if (res != FLASH_LOG_OK || n >= count || length != Sim_LogRecord(first + n, expect)
+            || memcmp(record, expect, length) != 0) {
+            return 0;
+        }
+        n++;
+    }
+    return n == count;
+}
+
+/* ----------------------------------------------------------------------------
+ * 主机端
+ * ------------------------------------------------------------------------- */
+
+static void Peer_PutU32(uint8_t* p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t Peer_GetU32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * @brief 组帧放入发送缓冲，空间不足时不发送
+ * @retval 1 已放入
+ */
+static int Peer_SendFrame(Peer_Host* host, uint8_t type, const uint8_t* ctrl, uint16_t ctrl_len,
+                          const uint8_t* data, uint16_t data_len)
+{
+    uint8_t frame[8 + 4 + FW_UPDATE_BLOCK_SIZE + 4];
+    uint16_t length = ctrl_len + data_len;
+    uint16_t total = 4U + length + 4U;
+
+    if (SIM_TX_FIFO_SIZE - app_drv_fifo_length(&host->tx_fifo) < total) {
+        return 0;
+    }
+    frame[0] = FW_UPDATE_SOF;
+    frame[1] = type;
+    frame[2] = (uint8_t)length;
+    frame[3] = (uint8_t)(length >> 8);
+    memcpy(&frame[4], ctrl, ctrl_len);
+    memcpy(&frame[4 + ctrl_len], data, data_len);
+    Peer_PutU32(&frame[4 + length], Sim_Crc32(&frame[1], 3U + length));
+    app_drv_fifo_write(&host->tx_fifo, frame, &total);
+    return 1;
+}
+
+static void Peer_SendStart(Peer_Host* host)
+{
+    uint8_t ctrl[8];
+
+    Peer_PutU32(&ctrl[0], host->size);
+    Peer_PutU32(&ctrl[4], host->crc);
+    Peer_SendFrame(host, FW_UPDATE_CMD_START, ctrl, 8, NULL, 0);
+    host->deadline = now_us + host->timeout_us;
+}
+
+static void Peer_SendFinish(Peer_Host* host)
+{
+    Peer_SendFrame(host, FW_UPDATE_CMD_FINISH, NULL, 0, NULL, 0);
+    host->deadline = now_us + host->timeout_us;
+}
+
+/**
+ * @brief 保持 SIM_WINDOW 个数据块在途
+ */
+static void Peer_SendData(Peer_Host* host)
+{
+    uint8_t ctrl[4];
+    uint16_t length;
+
+    while (host->send_offset < host->size && host->send_offset - host->acked < SIM_WINDOW * FW_UPDATE_BLOCK_SIZE) {
+        length = (host->size - host->send_offset < FW_UPDATE_BLOCK_SIZE) ? (uint16_t)(host->size - host->send_offset)
+                                                                          : FW_UPDATE_BLOCK_SIZE;
+        if (host->send_offset == host->short_at) {
+            length /= 2U;
+        }
+        Peer_PutU32(ctrl, host->send_offset);
+        if (!Peer_SendFrame(host, FW_UPDATE_CMD_DATA, ctrl, 4, &host->image[host->send_offset], length)) {
+            return;
+        }
+        host->outstanding++;
+        if (host->send_offset == host->short_at) {
+            host->short_at = SIM_NO_OFFSET;
+            length = FW_UPDATE_BLOCK_SIZE;
+        }
+        host->send_offset += length;
+    }
+}
+
+/**
+ * @brief 从设备期望的偏移重发；回退时已在途的旧帧会得到同一回退点的错误应答，忽略这些应答
+ */
+static void Peer_Rewind(Peer_Host* host, uint32_t next)
+{
+    if (next == host->rewind_to && host->stale > 0U) {
+        host->stale--;
+        return;
+    }
+    host->rewind_to = next;
+    host->stale = host->outstanding;
+    host->resent_blocks += (host->send_offset - next + FW_UPDATE_BLOCK_SIZE - 1U) / FW_UPDATE_BLOCK_SIZE;
+    host->send_offset = next;
+    host->acked = next;
+}
+
+static void Peer_HandleAck(Peer_Host* host, uint8_t cmd, uint8_t status, uint32_t next)
+{
+    host->deadline = now_us + host->timeout_us;
+    host->silent = 0;
+    host->status = status;
+    host->status_cmd = cmd;
+
+    switch (host->phase) {
+    case PEER_START:
+        if (cmd != FW_UPDATE_CMD_START || status == FW_UPDATE_STATUS_CRC_ERROR) {
+            Peer_SendStart(host);
+        } else if (status == FW_UPDATE_STATUS_OK) {
+            host->phase = PEER_DATA;
+            host->send_offset = 0;
+            host->acked = 0;
+            host->rewind_to = SIM_NO_OFFSET;
+        } else {
+            host->phase = PEER_FAILED;
+        }
+        break;
+
+    case PEER_DATA:
+        if (cmd == FW_UPDATE_CMD_START || cmd == FW_UPDATE_CMD_FINISH) {
+            break;
+        }
+        if (host->outstanding > 0U) {
+            host->outstanding--;
+        }
+        if (status == FW_UPDATE_STATUS_OK) {
+            if (next > host->acked) {
+                host->acked = next;
+            }
+            host->rewind_to = SIM_NO_OFFSET;
+            host->stale = 0;
+            if (host->acked >= host->size) {
+                host->phase = PEER_FINISH;
+                Peer_SendFinish(host);
+            }
+        } else if (status == FW_UPDATE_STATUS_SEQ_ERROR || status == FW_UPDATE_STATUS_CRC_ERROR) {
+            Peer_Rewind(host, next);
+        } else if (status == FW_UPDATE_STATUS_SIZE_ERROR && host->rejected < 8U) {
+            host->rejected++;
+            Peer_Rewind(host, next);
+        } else {
+            host->phase = PEER_FAILED;
+        }
+        break;
+
+    case PEER_FINISH:
+        if (cmd != FW_UPDATE_CMD_FINISH) {
+            break;
+        }
+        if (status == FW_UPDATE_STATUS_OK) {
+            host->phase = PEER_WAIT_RESET;
+        } else if (status == FW_UPDATE_STATUS_CRC_ERROR) {
+            Peer_SendFinish(host);
+        } else if (status == FW_UPDATE_STATUS_SIZE_ERROR) {
+            // 有数据块丢失，回到数据阶段
+            host->phase = PEER_DATA;
+            host->outstanding = 0;
+            host->stale = 0;
+            host->rewind_to = SIM_NO_OFFSET;
+            Peer_Rewind(host, next);
+        } else {
+            host->phase = PEER_FAILED;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief 逐字节解析设备应答（0xA5 | 0x80 | 6 | 0 | 命令 | 状态 | 偏移(4) | CRC32(4)）
+ */
+static void Peer_Receive(Peer_Host* host, uint8_t byte)
+{
+    host->rx[host->rx_pos++] = byte;
+    while (host->rx_pos > 0) {
+        if (host->rx[0] == FW_UPDATE_SOF && host->rx_pos < sizeof(host->rx)) {
+            return;
+        }
+        if (host->rx[0] == FW_UPDATE_SOF && host->rx[1] == FW_UPDATE_CMD_ACK && host->rx[2] == 6U && host->rx[3] == 0U
+            && Peer_GetU32(&host->rx[10]) == Sim_Crc32(&host->rx[1], 9)) {
+            Peer_HandleAck(host, host->rx[4], host->rx[5], Peer_GetU32(&host->rx[6]));
+            host->rx_pos = 0;
+            return;
+        }
+        // 不是有效帧：丢弃首字节，从下一个 SOF 重新同步
+        memmove(host->rx, host->rx + 1, --host->rx_pos);
+    }
+}
+
+static void Peer_CheckTimeout(Peer_Host* host)
+{
+    if (now_us < host->deadline) {
+        return;
+    }
+    host->timeouts++;
+    host->deadline = now_us + host->timeout_us;
+    if (++host->silent > 20U) {
+        host->phase = PEER_FAILED;
+        return;
+    }
+    switch (host->phase) {
+    case PEER_START:
+        Peer_SendStart(host);
+        break;
+    case PEER_DATA:
+        // 在途帧的应答都已丢失
+        host->outstanding = 0;
+        host->stale = 0;
+        host->rewind_to = SIM_NO_OFFSET;
+        Peer_Rewind(host, host->acked);
+        break;
+    case PEER_FINISH:
+        Peer_SendFinish(host);
+        break;
+    default:
+        break;
+    }
+}
+
+/* ----------------------------------------------------------------------------
+ * 链路与用例
+ * ------------------------------------------------------------------------- */
+
+static uint8_t Sim_Line(uint8_t byte, double ber, uint32_t* injected)
+{
+    if (ber > 0.0 && drand48() < ber * 8.0) {
+        byte ^= (uint8_t)(1U << (lrand48() & 7));
+        (*injected)++;
+    }
+    return byte;
+}
+
+/**
+ * @brief 执行一次完整升级：主机、串口与设备主循环按字节时间交替推进
+ */
+static void Sim_Run(const Sim_Config* cfg, const uint8_t* image, uint32_t size, Sim_Result* res)
+{
+    static Peer_Host host;
+    double byte_us = 10e6 / cfg->baud;
+    double stall_until = 0.0;
+    uint8_t byte;
+    uint16_t n;
+
+    memset(&host, 0, sizeof(host));
+    memset(res, 0, sizeof(*res));
+    app_drv_fifo_init(&host.tx_fifo, host.tx_buf, sizeof(host.tx_buf));
+    host.image = image;
+    host.size = size;
+    host.crc = Sim_Crc32(image, size);
+    host.short_at = cfg->short_at;
+    host.rewind_to = SIM_NO_OFFSET;
+    host.timeout_us = SIM_WINDOW * 2.0 * (FW_UPDATE_BLOCK_SIZE + 12U) * byte_us + 100000.0;
+    sim.stuck_addr = (cfg->stuck_offset != 0U) ? FW_UPDATE_TARGET_ADDR + cfg->stuck_offset : 0U;
+
+    // 启动时的日志格式化等阻塞时间不计入升级
+    sim.stall_us = 0.0;
+    now_us = 0.0;
+    Peer_SendStart(&host);
+    while (host.phase != PEER_DONE && host.phase != PEER_FAILED) {
+        // 串口：两个方向各传送一个字节
+        n = 1;
+        if (app_drv_fifo_read(&host.tx_fifo, &byte, &n) == APP_DRV_FIFO_RESULT_SUCCESS) {
+            byte = Sim_Line(byte, cfg->ber, &res->injected);
+            n = 1;
+            if (app_drv_fifo_write(&dev->rx_fifo, &byte, &n) != APP_DRV_FIFO_RESULT_SUCCESS) {
+                dev->overruns++;
+            }
+        }
+        n = 1;
+        if (app_drv_fifo_read(&dev->tx_fifo, &byte, &n) == APP_DRV_FIFO_RESULT_SUCCESS) {
+            Peer_Receive(&host, Sim_Line(byte, cfg->ber, &res->injected));
+        }
+
+        // Flash 行编程完成中断
+        if (sim.busy && now_us >= sim.busy_until) {
+            sim.busy = 0;
+            FW_Update_FlashCallback(&dev->fw, sim.busy_ok);
+        }
+
+        // 设备主循环（阻塞式擦除期间停顿）
+        if (now_us >= stall_until) {
+            if (FW_Update_Process(&dev->fw, &dev->rx_fifo) == FW_UPDATE_STATE_READY_TO_SWAP
+                && app_drv_fifo_is_empty(&dev->tx_fifo)) {
+                if (setjmp(sim.reset) == 0) {
+                    FW_Update_SwapBank(&dev->fw);
+                } else {
+                    res->swapped = 1;
+                    host.phase = (host.phase == PEER_WAIT_RESET) ? PEER_DONE : PEER_FAILED;
+                    break;
+                }
+            }
+            stall_until = now_us + sim.stall_us;
+            sim.stall_us = 0.0;
+        }
+
+        if (host.phase == PEER_DATA) {
+            Peer_SendData(&host);
+        }
+        if (host.phase != PEER_WAIT_RESET) {
+            Peer_CheckTimeout(&host);
+        }
+        now_us += byte_us;
+    }
+
+    res->phase = host.phase;
+    res->status = host.status;
+    res->status_cmd = host.status_cmd;
+    res->seconds = now_us * 1e-6;
+    res->resent_blocks = host.resent_blocks;
+    res->timeouts = host.timeouts;
+    res->rejected = host.rejected;
+    res->retransmit_count = dev->fw.retransmit_count;
+    res->frame_error_count = dev->fw.frame_error_count;
+    res->overruns = dev->overruns;
+    if (res->swapped) {
+        Sim_Boot();
+    }
+}
+
+static uint8_t* Sim_Image(uint32_t size)
+{
+    uint8_t* image = malloc(size);
+    uint32_t i;
+
+    for (i = 0; i < size; i++) {
+        image[i] = (uint8_t)mrand48();
+    }
+    return image;
+}
+
+static void Sim_Report(const char* name, const Sim_Config* cfg, uint32_t size, const Sim_Result* res)
+{
+    printf("%s: %u B at %u baud, %.2f s, %.1f KB/s (%.0f%% of line), resent %u blocks, timeouts %u, "
+           "device seq %u / frame errors %u, overruns %u, bit errors %u\n",
+           name, size, cfg->baud, res->seconds, size / 1024.0 / res->seconds,
+           100.0 * size / res->seconds / (cfg->baud / 10.0), res->resent_blocks, res->timeouts,
+           res->retransmit_count, res->frame_error_count, res->overruns, res->injected);
+}
+
+/**
+ * @brief 升级成功后的检查：从新 Bank 运行，日志区可用且只含切换后写入的记录
+ */
+static int Sim_CheckBooted(const uint8_t* image, uint32_t size, uint32_t bfb2_before, uint32_t log_first)
+{
+    if (memcmp(sim.mem, image, size) != 0) {
+        printf("  new image not at 0x%08lX after reset\n", (unsigned long)FLASH_BASE);
+        return 0;
+    }
+    if (READ_BIT(FLASH->OPTR, FLASH_OPTR_BFB2) == bfb2_before) {
+        printf("  BFB2 not toggled\n");
+        return 0;
+    }
+    if (!Sim_LogCheck(0, 0)) {
+        printf("  log after swap not empty\n");
+        return 0;
+    }
+    if (Sim_LogAppend(log_first, 20) != 20U || !Sim_LogCheck(log_first, 20)) {
+        printf("  log append/read after swap failed\n");
+        return 0;
+    }
+    if (sim.violations != 0U) {
+        printf("  %u flash violations\n", sim.violations);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief 完整升级：升级前日志中已有记录，START 后日志被清空，切换后旧固件末尾被格式化为日志
+ */
+static int Sim_Transfer(const char* name, const Sim_Config* cfg, uint32_t size)
+{
+    uint8_t* image = Sim_Image(size);
+    Sim_Result res;
+    int ok;
+
+    Sim_PowerOn();
+    ok = (Sim_LogAppend(1000, 50) == 50U && Sim_LogCheck(1000, 50));
+    Sim_Run(cfg, image, size, &res);
+    Sim_Report(name, cfg, size, &res);
+    ok = ok && res.phase == PEER_DONE && res.swapped && Sim_CheckBooted(image, size, 0, 0);
+    if (cfg->short_at != SIM_NO_OFFSET) {
+        ok = ok && res.rejected == 1U;
+    }
+    if (cfg->ber > 0.0) {
+        ok = ok && res.resent_blocks > 0U;
+    }
+    printf("%s: -> %s\n", name, ok ? "PASS" : "FAIL");
+    free(image);
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief 镜像超过上限：START 被拒绝，不擦除，日志保留
+ */
+static int Sim_Oversize(const Sim_Config* cfg)
+{
+    uint32_t size = FW_UPDATE_IMAGE_MAX + FW_UPDATE_ROW_SIZE;
+    uint8_t* image = Sim_Image(size);
+    Sim_Result res;
+    int ok;
+
+    Sim_PowerOn();
+    Sim_LogAppend(1000, 50);
+    Sim_Run(cfg, image, size, &res);
+    ok = res.phase == PEER_FAILED && res.status_cmd == FW_UPDATE_CMD_START
+         && res.status == FW_UPDATE_STATUS_SIZE_ERROR && sim.mass_erases == 0U && Sim_LogCheck(1000, 50);
+    printf("oversize: %u B (max %lu), START status %u, mass erases %u, log kept -> %s\n", size,
+           (unsigned long)FW_UPDATE_IMAGE_MAX, res.status, sim.mass_erases, ok ? "PASS" : "FAIL");
+    free(image);
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief 编程后一个单元仍为 1：FINISH 的 CRC 校验失败，不切换 Bank
+ */
+static int Sim_Verify(const Sim_Config* cfg, uint32_t size)
+{
+    uint8_t* image = Sim_Image(size);
+    Sim_Config faulty = *cfg;
+    Sim_Result res;
+    uint32_t offset = size / 2U;
+    int ok;
+
+    image[offset] &= 0xFEU;
+    faulty.stuck_offset = offset;
+    Sim_PowerOn();
+    Sim_Run(&faulty, image, size, &res);
+    ok = res.phase == PEER_FAILED && res.status_cmd == FW_UPDATE_CMD_FINISH
+         && res.status == FW_UPDATE_STATUS_VERIFY_ERROR && !res.swapped
+         && READ_BIT(FLASH->OPTR, FLASH_OPTR_BFB2) == 0U && dev->fw.state == FW_UPDATE_STATE_IDLE;
+    printf("verify: stuck bit at +%u, FINISH status %u, swapped %u -> %s\n", offset, res.status, res.swapped,
+           ok ? "PASS" : "FAIL");
+    free(image);
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief 连续升级两次：第二次的目标是第一次之前运行的 Bank
+ */
+static int Sim_Twice(const Sim_Config* cfg, uint32_t size)
+{
+    uint8_t* first = Sim_Image(size);
+    uint8_t* second = Sim_Image(size / 2U);
+    Sim_Result res;
+    int ok;
+
+    Sim_PowerOn();
+    Sim_Run(cfg, first, size, &res);
+    ok = res.phase == PEER_DONE && Sim_CheckBooted(first, size, 0, 0)
+         && READ_BIT(SYSCFG->MEMRMP, SYSCFG_MEMRMP_FB_MODE) != 0U;
+    Sim_Run(cfg, second, size / 2U, &res);
+    ok = ok && res.phase == PEER_DONE && Sim_CheckBooted(second, size / 2U, FLASH_OPTR_BFB2, 100)
+         && READ_BIT(SYSCFG->MEMRMP, SYSCFG_MEMRMP_FB_MODE) == 0U
+         && memcmp(sim.mem + FW_UPDATE_BANK_SIZE, first, size) == 0;
+    printf("twice: bank2 then bank1, FB_MODE back to %u, previous image kept in inactive bank -> %s\n",
+           (unsigned)(READ_BIT(SYSCFG->MEMRMP, SYSCFG_MEMRMP_FB_MODE) != 0U), ok ? "PASS" : "FAIL");
+    free(first);
+    free(second);
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief 不同波特率下的升级时间；超过约 1.3 Mbaud 后由行编程速度决定
+ */
+static void Sim_Speed(uint32_t size)
+{
+    static const uint32_t bauds[] = { 115200, 460800, 921600, 2000000, 4000000 };
+    uint8_t* image = Sim_Image(size);
+    Sim_Config cfg;
+    Sim_Result res;
+    uint32_t i;
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.short_at = SIM_NO_OFFSET;
+    printf("speed: baud, seconds, KB/s, %% of line rate, flash busy %%\n");
+    for (i = 0; i < sizeof(bauds) / sizeof(bauds[0]); i++) {
+        cfg.baud = bauds[i];
+        Sim_PowerOn();
+        Sim_Run(&cfg, image, size, &res);
+        printf("  %7u  %6.2f  %6.1f  %5.1f  %5.1f%s\n", bauds[i], res.seconds, size / 1024.0 / res.seconds,
+               100.0 * size / res.seconds / (bauds[i] / 10.0), 100.0 * sim.rows * SIM_ROW_US * 1e-6 / res.seconds,
+               (res.phase == PEER_DONE) ? "" : "  FAILED");
+    }
+    free(image);
+}
+
+int main(int argc, char* argv[])
+{
+    Sim_Config cfg;
+    uint32_t size = 400U * 1024U + 777U;
+    double ber = 1e-5;
+    const char* only = NULL;
+    int failed = 0;
+    int opt;
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.baud = 921600;
+    cfg.short_at = SIM_NO_OFFSET;
+    srand48(1);
+    while ((opt = getopt(argc, argv, "b:e:n:s:")) != -1) {
+        switch (opt) {
+        case 'b': cfg.baud = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'e': ber = strtod(optarg, NULL); break;
+        case 'n': size = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 's': srand48(strtol(optarg, NULL, 0)); break;
+        default:
+            fprintf(stderr, "usage: fw_update_sim [-b baud] [-e ber] [-n image_bytes] [-s seed]\n"
+                            "                     [clean|noisy|short|oversize|verify|twice|speed]\n");
+            return 2;
+        }
+    }
+    if (optind < argc) {
+        only = argv[optind];
+    }
+    if (size == 0U || size > FW_UPDATE_IMAGE_MAX) {
+        fprintf(stderr, "image size must be 1..%lu\n", (unsigned long)FW_UPDATE_IMAGE_MAX);
+        return 2;
+    }
+
+    // 驱动以 32 位地址访问 Flash 与缓冲区，两块区域都映射在真实地址
+    sim.mem = mmap((void*)FLASH_BASE, SIM_FLASH_SIZE, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    dev = mmap((void*)SIM_SRAM_ADDR, sizeof(Sim_Device), PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (sim.mem != (void*)FLASH_BASE || (void*)dev != (void*)SIM_SRAM_ADDR) {
+        fprintf(stderr, "cannot map flash at 0x%08lX / sram at 0x%08lX\n", (unsigned long)FLASH_BASE,
+                (unsigned long)SIM_SRAM_ADDR);
+        return 2;
+    }
+
+    if (only == NULL || strcmp(only, "clean") == 0) {
+        failed |= Sim_Transfer("clean", &cfg, size);
+    }
+    if (only == NULL || strcmp(only, "noisy") == 0) {
+        Sim_Config noisy = cfg;
+
+        noisy.ber = ber;
+        failed |= Sim_Transfer("noisy", &noisy, size);
+    }
+    if (only == NULL || strcmp(only, "short") == 0) {
+        Sim_Config shortened = cfg;
+
+        shortened.short_at = (size / 2U) & ~(FW_UPDATE_BLOCK_SIZE - 1U);
+        failed |= Sim_Transfer("short", &shortened, size);
+    }
+    if (only == NULL || strcmp(only, "oversize") == 0) {
+        failed |= Sim_Oversize(&cfg);
+    }
+    if (only == NULL || strcmp(only, "verify") == 0) {
+        failed |= Sim_Verify(&cfg, size);
+    }
+    if (only == NULL || strcmp(only, "twice") == 0) {
+        failed |= Sim_Twice(&cfg, size);
+    }
+    if (only == NULL || strcmp(only, "speed") == 0) {
+        Sim_Speed(size);
+    }
+    return failed;
+}
@@ -0,0 +1,92 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    main.h
+ * @brief   主机端替身：app_drv_fw_update.c / app_drv_flash_log.c 用到的 HAL 声明
+ * @note    函数由 fw_update_sim.c 实现，在映射到 0x08000000 的 RAM 上模拟双 Bank Flash
+ ******************************************************************************
+ */
+
+#ifndef HOST_MAIN_H_
+#define HOST_MAIN_H_
+
+#include <stdint.h>
+
+typedef enum {
+    HAL_OK = 0,
+    HAL_ERROR,
+    HAL_BUSY,
+    HAL_TIMEOUT,
+} HAL_StatusTypeDef;
+
+typedef enum {
+    FLASH_IRQn = 4,
+} IRQn_Type;
+
+typedef struct {
+    uint32_t Instance;
+} CRC_HandleTypeDef;
+
+typedef struct {
+    volatile uint32_t MEMRMP;
+} SYSCFG_TypeDef;
+
+typedef struct {
+    volatile uint32_t OPTR;
+} FLASH_TypeDef;
+
+typedef struct {
+    uint32_t TypeErase;
+    uint32_t Banks;
+    uint32_t Page;
+    uint32_t NbPages;
+} FLASH_EraseInitTypeDef;
+
+typedef struct {
+    uint32_t OptionType;
+    uint32_t USERType;
+    uint32_t USERConfig;
+} FLASH_OBProgramInitTypeDef;
+
+extern SYSCFG_TypeDef host_syscfg;
+extern FLASH_TypeDef host_flash_regs;
+
+#define SYSCFG                          (&host_syscfg)
+#define SYSCFG_MEMRMP_FB_MODE           (1UL << 8)
+#define FLASH                           (&host_flash_regs)
+#define FLASH_OPTR_BFB2                 (1UL << 20)
+#define READ_BIT(reg, bit)              ((reg) & (bit))
+
+#define FLASH_BASE                      (0x08000000UL)
+#define FLASH_BANK_SIZE                 (0x00080000UL)
+#define FLASH_PAGE_SIZE                 (0x00000800UL)
+#define FLASH_BANK_1                    (1U)
+#define FLASH_BANK_2                    (2U)
+#define FLASH_TYPEERASE_PAGES           (0U)
+#define FLASH_TYPEERASE_MASSERASE       (1U)
+#define FLASH_TYPEPROGRAM_DOUBLEWORD    (0U)
+#define FLASH_TYPEPROGRAM_FAST_AND_LAST (2U)
+#define FLASH_FLAG_ALL_ERRORS           (0U)
+#define __HAL_FLASH_CLEAR_FLAG(flag)    ((void)(flag))
+
+#define OPTIONBYTE_USER                 (4U)
+#define OB_USER_BFB2                    (0x100U)
+#define OB_BFB2_DISABLE                 (0U)
+#define OB_BFB2_ENABLE                  (FLASH_OPTR_BFB2)
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_Lock(void);
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t type, uint32_t addr, uint64_t data);
+HAL_StatusTypeDef HAL_FLASH_Program_IT(uint32_t type, uint32_t addr, uint64_t data);
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef* erase, uint32_t* page_error);
+HAL_StatusTypeDef HAL_FLASH_OB_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_OB_Lock(void);
+HAL_StatusTypeDef HAL_FLASH_OB_Launch(void);
+HAL_StatusTypeDef HAL_FLASHEx_OBProgram(FLASH_OBProgramInitTypeDef* ob);
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef* hcrc, uint32_t* buffer, uint32_t length);
+uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef* hcrc, uint32_t* buffer, uint32_t length);
+void HAL_NVIC_EnableIRQ(IRQn_Type irqn);
+
+#endif /* HOST_MAIN_H_ */
@@ -0,0 +1,126 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    app_drv_irq.c
+ * @brief   中断优先级配置与响应延迟测量
+ * @note    优先级集中配置；DWT 记录各向量执行时间，负载发生器探测最坏响应延迟
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include "app_drv_irq.h"
+
+/**
+ * @brief 初始化并按表设置全部优先级
+ * @param m 指向 IRQ_Monitor 结构体的指针
+ * @param config 优先级表
+ * @param count 表项数
+ * @note 在全部 MX_xxx_Init 之后调用；同时使能 DWT 周期计数器
+ */
+void IRQ_ApplyPriorities(IRQ_Monitor* m, const IRQ_Config* config, uint8_t count)
+{
+    memset(m, 0, sizeof(*m));
+    memset(m->slot, IRQ_SLOT_NONE, sizeof(m->slot));
+    if (count > IRQ_MAX_VECTORS) {
+        count = IRQ_MAX_VECTORS;
+    }
+    m->config = config;
+    m->count = count;
+    m->load_irqn = (IRQn_Type)-1;
+    m->rng = 1U;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (uint8_t i = 0; i < count; i++) {
+        m->slot[config[i].irqn] = i;
+        HAL_NVIC_SetPriority(config[i].irqn, config[i].preempt, 0);
+    }
+}
+
+/**
+ * @brief 读取向量当前的抢占优先级
+ */
+uint8_t IRQ_GetPriority(IRQn_Type irqn)
+{
+    uint32_t preempt;
+    uint32_t sub;
+
+    HAL_NVIC_GetPriority(irqn, HAL_NVIC_GetPriorityGrouping(), &preempt, &sub);
+    return (uint8_t)preempt;
+}
+
+/**
+ * @brief 设置 GPIO 指示引脚
+ * @param port GPIO 端口，引脚须已配置为推挽输出；NULL 关闭
+ * @param pin GPIO 引脚
+ */
+void IRQ_SetGpio(IRQ_Monitor* m, GPIO_TypeDef* port, uint16_t pin)
+{
+    m->gpio_pin = pin;
+    m->gpio_port = port;
+}
+
+/**
+ * @brief 设置负载发生器
+ * @param load_irqn 负载中断向量（由调用方按需要的频率启动）
+ * @param cycles 每次负载中断忙等周期，0 关闭负载与探测
+ */
+void IRQ_SetLoad(IRQ_Monitor* m, IRQn_Type load_irqn, uint32_t cycles)
+{
+    m->load_irqn = load_irqn;
+    m->load_cycles = cycles;
+}
+
+/**
+ * @brief 负载发生器中断处理
+ * @note 忙等 load_cycles 周期，期间随机时刻挂起下一个被测向量；
+ *       上一次探测尚未进入时不重复挂起，避免把两次挂起合并成一次
+ */
+void IRQ_LoadTick(IRQ_Monitor* m)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t cycles = m->load_cycles;
+    uint32_t at;
+    uint8_t slot;
+
+    if (cycles == 0U || m->count == 0U) {
+        return;
+    }
+
+    // 线性同余随机数选择挂起时刻
+    m->rng = m->rng * 1664525U + 1013904223U;
+    at = (m->rng >> 8) % cycles;
+
+    slot = m->probe_next;
+    m->probe_next = (uint8_t)((slot + 1U) % m->count);
+    if (m->config[slot].irqn == m->load_irqn) {
+        slot = IRQ_SLOT_NONE;
+    }
+
+    while (DWT->CYCCNT - start < at) {
+    }
+    if (slot != IRQ_SLOT_NONE && !m->stats[slot].probe_armed) {
+        m->stats[slot].probe_time = DWT->CYCCNT;
+        m->stats[slot].probe_armed = 1;
+        NVIC_SetPendingIRQ(m->config[slot].irqn);
+    }
+    while (DWT->CYCCNT - start < cycles) {
+    }
+    m->load_count++;
+}
+
+/**
+ * @brief 清除测量结果
+ */
+void IRQ_ResetStats(IRQ_Monitor* m)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    memset(m->stats, 0, sizeof(m->stats));
+    m->load_count = 0;
+    __set_PRIMASK(primask);
+}
@@ -0,0 +1,142 @@
+#ifndef APP_DRV_IRQ_H_
+#define APP_DRV_IRQ_H_
+
+#include <stdint.h>
+#include "main.h"
+
+/*
+ * 中断优先级配置与响应延迟测量
+ *
+ * 优先级：所有向量的抢占优先级集中在一张表中，外设初始化之后由 IRQ_ApplyPriorities 统一设置，
+ * 覆盖 CubeMX 生成代码中逐个外设写入的 0/0。HAL_Init 使用 NVIC_PRIORITYGROUP_4，子优先级恒为 0。
+ *
+ * 测量：中断入口/出口调用 IRQ_PROFILE_ENTER/EXIT，按 DWT 周期记录：
+ *   执行时间  出口 - 入口，含被更高优先级抢占的时间
+ *   响应延迟  挂起到入口。负载发生器中断在忙等期间的随机时刻挂起一个被测向量（NVIC_SetPendingIRQ），
+ *            优先级高于负载的向量立即抢占（约 12 周期），同级或更低的要等负载以及期间的其他中断结束
+ * 可选 GPIO：入口置位、出口清零，用逻辑分析仪观察。IRQ_PROFILE 为 0 时测量宏为空。
+ */
+
+#ifndef IRQ_PROFILE
+  #define IRQ_PROFILE           (1)
+#endif
+
+#ifndef IRQ_MAX_VECTORS
+  #define IRQ_MAX_VECTORS       (16U)    // 表中最多向量数
+#endif
+
+#ifndef IRQ_VECTOR_COUNT
+  #define IRQ_VECTOR_COUNT      (96U)    // 芯片外部中断数上限（STM32L496 为 91）
+#endif
+
+#define IRQ_SLOT_NONE           (0xFFU)
+
+// 优先级表项
+typedef struct {
+    IRQn_Type irqn;
+    uint8_t preempt;                // 抢占优先级，数值越小越高
+    const char* name;
+} IRQ_Config;
+
+// 单个向量的测量结果
+typedef struct {
+    uint32_t count;                 // 进入次数
+    uint32_t entry_time;            // 本次进入时刻
+    uint32_t duration_max;          // 最长执行时间，周期
+    uint32_t latency_max;           // 最长响应延迟，周期
+    uint32_t probe_count;           // 探测次数
+    uint32_t probe_time;            // 探测挂起时刻
+    volatile uint8_t probe_armed;   // 已挂起，等待进入
+} IRQ_Vector_Stats;
+
+// 中断监视上下文结构体
+typedef struct {
+    const IRQ_Config* config;
+    uint8_t count;
+    uint8_t slot[IRQ_VECTOR_COUNT];                 // IRQn -> 表中序号
+    IRQ_Vector_Stats stats[IRQ_MAX_VECTORS];
+
+    // 可选 GPIO 指示
+    GPIO_TypeDef* gpio_port;
+    uint16_t gpio_pin;
+
+    // 负载发生器
+    IRQn_Type load_irqn;            // 负载中断自身不参与探测
+    uint32_t load_cycles;           // 每次负载中断忙等周期，0 表示关闭
+    uint32_t load_count;
+    uint8_t probe_next;
+    uint32_t rng;
+} IRQ_Monitor;
+
+// 初始化并按表设置全部优先级，表须一直有效（count 不超过 IRQ_MAX_VECTORS）
+void IRQ_ApplyPriorities(IRQ_Monitor* m, const IRQ_Config* config, uint8_t count);
+
+// 读取向量当前的抢占优先级
+uint8_t IRQ_GetPriority(IRQn_Type irqn);
+
+// 设置 GPIO 指示引脚，port 为 NULL 时关闭
+void IRQ_SetGpio(IRQ_Monitor* m, GPIO_TypeDef* port, uint16_t pin);
+
+// 设置负载：每次负载中断忙等 cycles 周期并探测一个向量，0 关闭
+void IRQ_SetLoad(IRQ_Monitor* m, IRQn_Type load_irqn, uint32_t cycles);
+
+// 负载发生器中断中调用
+void IRQ_LoadTick(IRQ_Monitor* m);
+
+// 清除测量结果
+void IRQ_ResetStats(IRQ_Monitor* m);
+
+static inline void IRQ_Enter(IRQ_Monitor* m, IRQn_Type irqn)
+{
+    uint32_t now = DWT->CYCCNT;
+    uint8_t slot = m->slot[irqn];
+    IRQ_Vector_Stats* s;
+
+    if (slot == IRQ_SLOT_NONE) {
+        return;
+    }
+    s = &m->stats[slot];
+    s->entry_time = now;
+    if (s->probe_armed) {
+        uint32_t latency = now - s->probe_time;
+
+        if (latency > s->latency_max) {
+            s->latency_max = latency;
+        }
+        s->probe_count++;
+        s->probe_armed = 0;
+    }
+    if (m->gpio_port != NULL) {
+        m->gpio_port->BSRR = m->gpio_pin;
+    }
+}
+
+static inline void IRQ_Exit(IRQ_Monitor* m, IRQn_Type irqn)
+{
+    uint8_t slot = m->slot[irqn];
+    IRQ_Vector_Stats* s;
+    uint32_t duration;
+
+    if (slot == IRQ_SLOT_NONE) {
+        return;
+    }
+    s = &m->stats[slot];
+    duration = DWT->CYCCNT - s->entry_time;
+    if (duration > s->duration_max) {
+        s->duration_max = duration;
+    }
+    s->count++;
+    if (m->gpio_port != NULL) {
+        m->gpio_port->BRR = m->gpio_pin;
+    }
+}
+
+#if IRQ_PROFILE
+  #define IRQ_PROFILE_ENTER(m, irqn)    IRQ_Enter((m), (irqn))
+  #define IRQ_PROFILE_EXIT(m, irqn)     IRQ_Exit((m), (irqn))
+#else
+  #define IRQ_PROFILE_ENTER(m, irqn)    ((void)0)
+  #define IRQ_PROFILE_EXIT(m, irqn)     ((void)0)
+#endif
+
+#endif /* APP_DRV_IRQ_H_ */
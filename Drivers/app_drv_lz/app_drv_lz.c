@@ -0,0 +1,328 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    app_drv_lz.c
+ * @brief   流式 LZSS 压缩/解压
+ * @note    小窗口哈希链匹配，FIFO 到 FIFO 增量处理，内存占用固定
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include "app_drv_lz.h"
+
+#define LZ_NIL              (0xFFFFU)
+#define LZ_WINDOW_MASK      (LZ_WINDOW_SIZE - 1U)
+
+// 解压器状态
+#define LZ_DEC_TAG          (0U)
+#define LZ_DEC_LITERAL      (1U)
+#define LZ_DEC_DISTANCE     (2U)
+#define LZ_DEC_LENGTH       (3U)
+#define LZ_DEC_COPY         (4U)
+
+static inline uint8_t LZ_Hash(const uint8_t* p)
+{
+    return (uint8_t)(p[0] ^ (p[1] << 3) ^ (p[1] >> 5));
+}
+
+static inline uint16_t LZ_FifoFree(app_drv_fifo_t* fifo)
+{
+    return (uint16_t)(fifo->size - app_drv_fifo_length(fifo));
+}
+
+/**
+ * @brief 写入 count 位（count <= 16），凑满的字节写入输出 FIFO
+ * @note 调用前已确认输出 FIFO 至少有 3 字节空间
+ */
+static void LZ_PutBits(LZ_Encoder* enc, app_drv_fifo_t* out, uint32_t value, uint8_t count)
+{
+    enc->bit_buf |= value << (32U - enc->bit_count - count);
+    enc->bit_count += count;
+    while (enc->bit_count >= 8U) {
+        app_drv_fifo_push(out, (uint8_t)(enc->bit_buf >> 24));
+        enc->bit_buf <<= 8;
+        enc->bit_count -= 8U;
+        enc->out_bytes++;
+    }
+}
+
+/**
+ * @brief 把位置 p 插入哈希链（需要 p、p + 1 两个字节）
+ */
+static inline void LZ_Insert(LZ_Encoder* enc, uint16_t p)
+{
+    uint8_t h = LZ_Hash(&enc->buf[p]);
+
+    enc->prev[p & LZ_WINDOW_MASK] = enc->head[h];
+    enc->head[h] = p;
+}
+
+/**
+ * @brief 缓冲区后半满时整体前移一个窗口，并修正哈希表中的位置
+ */
+static void LZ_Slide(LZ_Encoder* enc)
+{
+    memmove(enc->buf, &enc->buf[LZ_WINDOW_SIZE], LZ_WINDOW_SIZE);
+    enc->pos -= LZ_WINDOW_SIZE;
+    enc->fill -= LZ_WINDOW_SIZE;
+
+    for (uint16_t i = 0; i < LZ_HASH_SIZE; i++) {
+        uint16_t v = enc->head[i];
+        enc->head[i] = (v == LZ_NIL || v < LZ_WINDOW_SIZE) ? LZ_NIL : (uint16_t)(v - LZ_WINDOW_SIZE);
+    }
+    for (uint16_t i = 0; i < LZ_WINDOW_SIZE; i++) {
+        uint16_t v = enc->prev[i];
+        enc->prev[i] = (v == LZ_NIL || v < LZ_WINDOW_SIZE) ? LZ_NIL : (uint16_t)(v - LZ_WINDOW_SIZE);
+    }
+}
+
+/**
+ * @brief 在窗口内查找当前位置的最长匹配
+ * @param limit 允许的最大匹配长度
+ * @param distance 输出参数，匹配距离
+ * @return 匹配长度（小于 LZ_MIN_MATCH 表示无匹配）
+ */
+static uint16_t LZ_FindMatch(LZ_Encoder* enc, uint16_t limit, uint16_t* distance)
+{
+    const uint8_t* cur = &enc->buf[enc->pos];
+    uint16_t candidate = enc->head[LZ_Hash(cur)];
+    uint16_t best = 0;
+    uint8_t chain = LZ_MAX_CHAIN;
+
+    while (candidate != LZ_NIL && chain-- > 0U) {
+        uint16_t dist = (uint16_t)(enc->pos - candidate);
+        const uint8_t* ref = &enc->buf[candidate];
+        uint16_t len = 0;
+
+        // 链上的位置只会越来越远
+        if (dist == 0U || dist >= LZ_WINDOW_SIZE) {
+            break;
+        }
+        // 先比较当前最长位置的字节，不可能更长的候选直接跳过
+        if (ref[best] == cur[best]) {
+            while (len < limit && ref[len] == cur[len]) {
+                len++;
+            }
+            if (len > best) {
+                best = len;
+                *distance = dist;
+                if (len == limit) {
+                    break;
+                }
+            }
+        }
+        candidate = enc->prev[candidate & LZ_WINDOW_MASK];
+    }
+    return best;
+}
+
+/**
+ * @brief 初始化压缩器
+ */
+void LZ_EncoderInit(LZ_Encoder* enc)
+{
+    memset(enc, 0, sizeof(*enc));
+    memset(enc->head, 0xFF, sizeof(enc->head));
+    memset(enc->prev, 0xFF, sizeof(enc->prev));
+}
+
+/**
+ * @brief 压缩
+ * @param enc 指向 LZ_Encoder 结构体的指针
+ * @param in 输入 FIFO
+ * @param out 输出 FIFO
+ * @param flush 1：送出全部已取数据并写入刷新标记
+ */
+void LZ_Compress(LZ_Encoder* enc, app_drv_fifo_t* in, app_drv_fifo_t* out, uint8_t flush)
+{
+    for (;;) {
+        uint16_t avail;
+        uint16_t length;
+        uint16_t distance = 0;
+
+        // 补充输入
+        if (enc->fill == 2U * LZ_WINDOW_SIZE && enc->pos >= LZ_WINDOW_SIZE) {
+            LZ_Slide(enc);
+        }
+        length = (uint16_t)(2U * LZ_WINDOW_SIZE - enc->fill);
+        if (length > 0U && app_drv_fifo_read(in, &enc->buf[enc->fill], &length) == APP_DRV_FIFO_RESULT_SUCCESS) {
+            enc->fill += length;
+            enc->in_bytes += length;
+        }
+
+        // 上次刷新时缓冲区最后一个字节无法计算哈希，新数据到达后补插
+        if (enc->insert_pending && enc->pos < enc->fill) {
+            LZ_Insert(enc, (uint16_t)(enc->pos - 1U));
+            enc->insert_pending = 0;
+        }
+
+        avail = (uint16_t)(enc->fill - enc->pos);
+        if (avail == 0U || (avail < LZ_MAX_MATCH && !flush) || LZ_FifoFree(out) < 3U) {
+            break;
+        }
+
+        length = (avail >= LZ_MIN_MATCH) ? LZ_FindMatch(enc, (avail < LZ_MAX_MATCH) ? avail : LZ_MAX_MATCH, &distance) : 0U;
+        if (length >= LZ_MIN_MATCH) {
+            LZ_PutBits(enc, out, ((uint32_t)distance << LZ_LENGTH_BITS) | (length - LZ_MIN_MATCH), LZ_BACKREF_BITS);
+        } else {
+            length = 1;
+            LZ_PutBits(enc, out, 0x100U | enc->buf[enc->pos], 9U);
+        }
+        enc->dirty = 1;
+
+        // 匹配覆盖的每个位置都加入哈希链；缓冲区最后一个字节（只在刷新时出现）
+        // 需等下一字节到达，由下次补充输入后补插
+        while (length-- > 0U) {
+            if (enc->pos + 1U < enc->fill) {
+                LZ_Insert(enc, enc->pos);
+            } else {
+                enc->insert_pending = 1;
+            }
+            enc->pos++;
+        }
+    }
+
+    // 全部输入已送出：写入刷新标记并补齐字节
+    if (flush && enc->dirty && enc->pos == enc->fill && app_drv_fifo_is_empty(in) && LZ_FifoFree(out) >= 3U) {
+        LZ_PutBits(enc, out, 0U, 1U + LZ_WINDOW_BITS);
+        if (enc->bit_count > 0U) {
+            LZ_PutBits(enc, out, 0U, 8U - enc->bit_count);
+        }
+        enc->dirty = 0;
+    }
+}
+
+/**
+ * @brief 初始化解压器
+ */
+void LZ_DecoderInit(LZ_Decoder* dec, app_drv_fifo_t* out)
+{
+    memset(dec, 0, sizeof(*dec));
+    dec->out = out;
+}
+
+/**
+ * @brief 从位缓冲区取 count 位
+ */
+static inline uint16_t LZ_GetBits(LZ_Decoder* dec, uint8_t count)
+{
+    uint16_t value = (uint16_t)(dec->bit_buf >> (32U - count));
+
+    dec->bit_buf <<= count;
+    dec->bit_count -= count;
+    return value;
+}
+
+static inline void LZ_Emit(LZ_Decoder* dec, uint8_t value)
+{
+    app_drv_fifo_push(dec->out, value);
+    dec->window[dec->wpos++ & LZ_WINDOW_MASK] = value;
+    dec->out_bytes++;
+}
+
+/**
+ * @brief 执行解压状态机，直到位不足或输出 FIFO 满
+ */
+static void LZ_DecodeRun(LZ_Decoder* dec)
+{
+    for (;;) {
+        switch (dec->state) {
+        case LZ_DEC_TAG:
+            if (dec->bit_count < 1U) {
+                return;
+            }
+            dec->state = LZ_GetBits(dec, 1) ? LZ_DEC_LITERAL : LZ_DEC_DISTANCE;
+            break;
+
+        case LZ_DEC_LITERAL:
+            if (dec->bit_count < 8U || app_drv_fifo_is_full(dec->out)) {
+                return;
+            }
+            LZ_Emit(dec, (uint8_t)LZ_GetBits(dec, 8));
+            dec->state = LZ_DEC_TAG;
+            break;
+
+        case LZ_DEC_DISTANCE:
+            if (dec->bit_count < LZ_WINDOW_BITS) {
+                return;
+            }
+            dec->distance = LZ_GetBits(dec, LZ_WINDOW_BITS);
+            if (dec->distance == 0U) {
+                // 刷新标记：丢弃补齐位
+                dec->bit_buf <<= (dec->bit_count & 7U);
+                dec->bit_count &= (uint8_t)~7U;
+                dec->state = LZ_DEC_TAG;
+            } else {
+                dec->state = LZ_DEC_LENGTH;
+            }
+            break;
+
+        case LZ_DEC_LENGTH:
+            if (dec->bit_count < LZ_LENGTH_BITS) {
+                return;
+            }
+            dec->count = (uint16_t)(LZ_GetBits(dec, LZ_LENGTH_BITS) + LZ_MIN_MATCH);
+            dec->state = LZ_DEC_COPY;
+            break;
+
+        default:
+            while (dec->count > 0U) {
+                if (app_drv_fifo_is_full(dec->out)) {
+                    return;
+                }
+                LZ_Emit(dec, dec->window[(uint16_t)(dec->wpos - dec->distance) & LZ_WINDOW_MASK]);
+                dec->count--;
+            }
+            dec->state = LZ_DEC_TAG;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief 解压
+ * @param dec 指向 LZ_Decoder 结构体的指针
+ * @param data 压缩数据
+ * @param length 数据长度
+ * @return 已接收的字节数，输出 FIFO 满时小于 length
+ */
+uint16_t LZ_Decompress(LZ_Decoder* dec, const uint8_t* data, uint16_t length)
+{
+    uint16_t used = 0;
+
+    for (;;) {
+        LZ_DecodeRun(dec);
+        // 位缓冲区还能容纳一个字节时才继续接收，输出满时缓冲区不会被取空
+        if (used == length || dec->bit_count > 24U) {
+            break;
+        }
+        dec->bit_buf |= (uint32_t)data[used++] << (24U - dec->bit_count);
+        dec->bit_count += 8U;
+        dec->in_bytes++;
+    }
+    return used;
+}
+
+/**
+ * @brief 串口接收队列写入：接收数据直接解压到解压器的输出 FIFO
+ */
+uint32_t LZ_Queue_Write(void* user_queue, uint8_t* data, uint16_t length)
+{
+    return LZ_Decompress((LZ_Decoder*)user_queue, data, length);
+}
+
+/**
+ * @brief 串口接收队列可用空间：按最坏展开倍数估算
+ */
+uint32_t LZ_Queue_Available(void* user_queue)
+{
+    LZ_Decoder* dec = (LZ_Decoder*)user_queue;
+    uint16_t space = LZ_FifoFree(dec->out);
+
+    if (space <= dec->count + LZ_MAX_MATCH) {
+        return 0;
+    }
+    return (uint32_t)(space - dec->count - LZ_MAX_MATCH) / LZ_MAX_EXPANSION;
+}
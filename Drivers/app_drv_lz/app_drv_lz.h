@@ -0,0 +1,102 @@
+#ifndef APP_DRV_LZ_H_
+#define APP_DRV_LZ_H_
+
+#include <stdint.h>
+#include "main.h"
+#include "app_drv_fifo.h"
+
+/*
+ * 流式 LZSS 压缩/解压（heatshrink 风格位流）
+ *
+ * 位流格式（高位在前）：
+ *   1 | 字面字节(8)
+ *   0 | 距离(LZ_WINDOW_BITS) | 长度 - LZ_MIN_MATCH (LZ_LENGTH_BITS)   回引，距离 1 ~ 窗口大小 - 1
+ *   0 | 0(LZ_WINDOW_BITS) | 补 0 到字节边界                          刷新标记
+ * 刷新标记让压缩器在任意时刻把已有输入完整送出而不结束流，历史窗口跨刷新保留；
+ * 位流本身没有重同步能力，丢字节后需由上层（如 app_drv_mux 的 CRC 帧）重新开始。
+ *
+ * 压缩器：2 倍窗口大小的滑动缓冲区 + 2 字节哈希链（链深 LZ_MAX_CHAIN），
+ * 从输入 FIFO 整块取数据、向输出 FIFO 逐字节写入，每次调用做尽可能多的工作后返回。
+ * 解压器：只需一个窗口大小的历史区，输出 FIFO 满时保存状态，下次从断点继续。
+ *
+ * 默认参数（窗口 512 B，最长匹配 17 B）的内存占用：
+ *   压缩器 1024 (缓冲区) + 512 (哈希头) + 1024 (链) ≈ 2.5 KiB，解压器 ≈ 0.5 KiB
+ */
+
+#ifndef LZ_WINDOW_BITS
+  #define LZ_WINDOW_BITS        (9U)     // 窗口 2^9 = 512 字节
+#endif
+
+#ifndef LZ_LENGTH_BITS
+  #define LZ_LENGTH_BITS        (4U)
+#endif
+
+#ifndef LZ_MAX_CHAIN
+  #define LZ_MAX_CHAIN          (16U)    // 每个位置最多比较的候选数
+#endif
+
+#define LZ_WINDOW_SIZE          (1U << LZ_WINDOW_BITS)
+#define LZ_MIN_MATCH            (2U)     // 回引 14 位，短于 2 字节不如字面量
+#define LZ_MAX_MATCH            (LZ_MIN_MATCH + (1U << LZ_LENGTH_BITS) - 1U)
+#define LZ_HASH_SIZE            (256U)
+#define LZ_BACKREF_BITS         (1U + LZ_WINDOW_BITS + LZ_LENGTH_BITS)
+
+// 每个压缩字节最多展开的输出字节数，用于估算解压器可接收的输入量
+#define LZ_MAX_EXPANSION        ((8U * LZ_MAX_MATCH + LZ_BACKREF_BITS - 1U) / LZ_BACKREF_BITS)
+
+// 压缩器上下文结构体
+typedef struct {
+    uint8_t buf[2U * LZ_WINDOW_SIZE];   // [0, pos) 为历史，[pos, fill) 为待压缩数据
+    uint16_t head[LZ_HASH_SIZE];        // 哈希 -> 最近位置
+    uint16_t prev[LZ_WINDOW_SIZE];      // 位置 -> 同哈希的上一位置
+    uint16_t pos;
+    uint16_t fill;
+    uint8_t insert_pending;             // pos - 1 尚未加入哈希链（当时下一字节未到）
+
+    uint32_t bit_buf;                   // 左对齐的未输出位
+    uint8_t bit_count;
+    uint8_t dirty;                      // 上次刷新后有新输出
+
+    // 统计
+    uint32_t in_bytes;
+    uint32_t out_bytes;
+} LZ_Encoder;
+
+// 解压器上下文结构体
+typedef struct {
+    uint8_t window[LZ_WINDOW_SIZE];
+    uint16_t wpos;
+    app_drv_fifo_t* out;
+
+    uint32_t bit_buf;                   // 左对齐的未处理位
+    uint8_t bit_count;
+    uint8_t state;
+    uint16_t distance;
+    uint16_t count;                     // 回引剩余待复制字节数
+
+    // 统计
+    uint32_t in_bytes;
+    uint32_t out_bytes;
+} LZ_Decoder;
+
+// 初始化压缩器
+void LZ_EncoderInit(LZ_Encoder* enc);
+
+/*
+ * 压缩：从 in 取数据，压缩结果写入 out
+ * flush 为 1 时压缩全部已取数据并写入刷新标记（out 空间不足时留待下次调用）；
+ * 为 0 时保留不足最长匹配的尾部等待后续输入，压缩率更高
+ */
+void LZ_Compress(LZ_Encoder* enc, app_drv_fifo_t* in, app_drv_fifo_t* out, uint8_t flush);
+
+// 初始化解压器，解压结果写入 out
+void LZ_DecoderInit(LZ_Decoder* dec, app_drv_fifo_t* out);
+
+// 解压：返回已接收的输入字节数（out 满时小于 length）
+uint16_t LZ_Decompress(LZ_Decoder* dec, const uint8_t* data, uint16_t length);
+
+// 串口接收队列接口：把解压器作为 USART_DMA_Context 的用户队列（user_queue 为 LZ_Decoder*）
+uint32_t LZ_Queue_Write(void* user_queue, uint8_t* data, uint16_t length);
+uint32_t LZ_Queue_Available(void* user_queue);
+
+#endif /* APP_DRV_LZ_H_ */
@@ -0,0 +1,240 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    lz_bench.c
+ * @brief   流式 LZSS 主机端压缩率与耗时测试（Linux / macOS）
+ * @note    与固件共用 app_drv_lz.c，同目录的 main.h 替代 HAL 头文件：
+ *            cc -O2 -I. -I.. -I../../app_drv_fifo -o lz_bench lz_bench.c \
+ *               ../app_drv_lz.c ../../app_drv_fifo/app_drv_fifo.c
+ *
+ *          默认输入 stream_bin_sample.bin：3000 条 "stream bin" 遥测记录（约 5 分钟），
+ *          由 app_drv_telemetry/host/tlm_stream -n 3000 -o 生成。也可用 -i 指定串口抓取的原始数据。
+ *          输入按块写入 256 B 明文 FIFO 后调用 LZ_Compress，压缩输出经 LZ_Decompress
+ *          还原并与输入逐字节比对；x86 上按 TSC 周期计时，其他平台按纳秒。按以下节奏各跑一遍：
+ *            stream    每块 12 B（约一条记录）压缩一次、每 10 块刷新一次，与 main.c 的 stream lz 相同
+ *            record    每块都刷新（每条记录立即送出）
+ *            bulk      整个输入只在结束时刷新，压缩率上限
+ *          还原内容不一致时 FAIL。
+ *
+ *            lz_bench [-i input] [-c chunk_bytes] [-f flush_every] [stream|record|bulk]
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "app_drv_lz.h"
+
+#define SIM_PLAIN_SIZE          (256U)      // main.c stream_plain_buffer
+#define SIM_OUT_SIZE            (1024U)
+#define SIM_RESTORE_SIZE        (4096U)
+
+static uint8_t plain_buffer[SIM_PLAIN_SIZE];
+static uint8_t out_buffer[SIM_OUT_SIZE];
+static uint8_t restore_buffer[SIM_RESTORE_SIZE];
+static app_drv_fifo_t plain_fifo;
+static app_drv_fifo_t out_fifo;
+static app_drv_fifo_t restore_fifo;
+static LZ_Encoder encoder;
+static LZ_Decoder decoder;
+
+static uint64_t Sim_Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+typedef struct {
+    const uint8_t* input;
+    uint32_t length;
+    uint8_t* packed;            // 压缩输出
+    uint32_t packed_length;
+    uint8_t* restored;
+    uint32_t restored_length;
+    uint64_t compress_cycles;
+    uint64_t decompress_cycles;
+} Sim_Run;
+
+// 取走压缩输出
+static void Sim_DrainOut(Sim_Run* run)
+{
+    uint16_t length = app_drv_fifo_length(&out_fifo);
+
+    if (length > 0U) {
+        app_drv_fifo_read(&out_fifo, &run->packed[run->packed_length], &length);
+        run->packed_length += length;
+    }
+}
+
+/**
+ * @brief 按块压缩整个输入，每 flush_every 块刷新一次（0：只在结束时刷新）
+ */
+static void Sim_Compress(Sim_Run* run, uint32_t chunk, uint32_t flush_every)
+{
+    uint32_t pos = 0;
+    uint32_t blocks = 0;
+    uint64_t start;
+
+    app_drv_fifo_init(&plain_fifo, plain_buffer, SIM_PLAIN_SIZE);
+    app_drv_fifo_init(&out_fifo, out_buffer, SIM_OUT_SIZE);
+    LZ_EncoderInit(&encoder);
+    run->packed_length = 0;
+    run->compress_cycles = 0;
+
+    while (pos < run->length || app_drv_fifo_length(&plain_fifo) > 0U || encoder.dirty) {
+        uint16_t length = (uint16_t)((run->length - pos < chunk) ? run->length - pos : chunk);
+        uint8_t flush;
+
+        if (length > 0U) {
+            app_drv_fifo_write(&plain_fifo, (uint8_t*)&run->input[pos], &length);
+            pos += length;
+            blocks++;
+        }
+        flush = (pos == run->length) || (flush_every != 0U && (blocks % flush_every) == 0U);
+
+        start = Sim_Cycles();
+        LZ_Compress(&encoder, &plain_fifo, &out_fifo, flush);
+        run->compress_cycles += Sim_Cycles() - start;
+        Sim_DrainOut(run);
+    }
+}
+
+static void Sim_Decompress(Sim_Run* run)
+{
+    uint32_t pos = 0;
+    uint64_t start;
+
+    app_drv_fifo_init(&restore_fifo, restore_buffer, SIM_RESTORE_SIZE);
+    LZ_DecoderInit(&decoder, &restore_fifo);
+    run->restored_length = 0;
+    run->decompress_cycles = 0;
+
+    while (pos < run->packed_length || app_drv_fifo_length(&restore_fifo) > 0U) {
+        uint16_t length = (uint16_t)((run->packed_length - pos < 256U) ? run->packed_length - pos : 256U);
+        uint16_t taken;
+
+        start = Sim_Cycles();
+        taken = LZ_Decompress(&decoder, &run->packed[pos], length);
+        run->decompress_cycles += Sim_Cycles() - start;
+        pos += taken;
+
+        length = app_drv_fifo_length(&restore_fifo);
+        if (length > 0U) {
+            app_drv_fifo_read(&restore_fifo, &run->restored[run->restored_length], &length);
+            run->restored_length += length;
+        } else if (taken == 0U) {
+            break;
+        }
+    }
+}
+
+static int Sim_Case(const char* name, Sim_Run* run, uint32_t chunk, uint32_t flush_every)
+{
+    char flush[24];
+    int bad;
+
+    Sim_Compress(run, chunk, flush_every);
+    Sim_Decompress(run);
+    bad = (run->restored_length != run->length || memcmp(run->restored, run->input, run->length) != 0);
+
+    if (flush_every == 0U) {
+        snprintf(flush, sizeof(flush), "at end");
+    } else {
+        snprintf(flush, sizeof(flush), "every %u chunk%s", flush_every, (flush_every > 1U) ? "s" : "");
+    }
+    printf("%s: chunk %u B, flush %s: %u -> %u bytes, ratio %.3f, compress %.1f, decompress %.1f %s/byte\n",
+           name, chunk, flush, run->length, run->packed_length, (double)run->packed_length / run->length,
+           (double)run->compress_cycles / run->length, (double)run->decompress_cycles / run->length,
+#if defined(__x86_64__) || defined(__i386__)
+           "cycles");
+#else
+           "ns");
+#endif
+    printf("%s: -> %s\n", name, bad ? "FAIL" : "PASS");
+    return bad;
+}
+
+int main(int argc, char* argv[])
+{
+    const char* only = NULL;
+    const char* path = "stream_bin_sample.bin";
+    uint32_t chunk = 12U;
+    uint32_t flush_every = 10U;
+    Sim_Run run;
+    uint8_t* data;
+    long length;
+    FILE* f;
+    int failed = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:c:f:")) != -1) {
+        switch (opt) {
+        case 'i': path = optarg; break;
+        case 'c': chunk = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'f': flush_every = (uint32_t)strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: lz_bench [-i input] [-c chunk_bytes] [-f flush_every] [stream|record|bulk]\n");
+            return 2;
+        }
+    }
+    if (optind < argc) {
+        only = argv[optind];
+    }
+    if (chunk == 0U || chunk > SIM_PLAIN_SIZE) {
+        fprintf(stderr, "chunk must be 1 .. %u bytes\n", SIM_PLAIN_SIZE);
+        return 2;
+    }
+
+    f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        return 2;
+    }
+    fseek(f, 0, SEEK_END);
+    length = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc((size_t)length);
+    if (length <= 0 || data == NULL || fread(data, 1, (size_t)length, f) != (size_t)length) {
+        fprintf(stderr, "%s: read failed\n", path);
+        fclose(f);
+        return 2;
+    }
+    fclose(f);
+
+    memset(&run, 0, sizeof(run));
+    run.input = data;
+    run.length = (uint32_t)length;
+    run.packed = malloc((size_t)length * 2U + 16U);
+    run.restored = malloc((size_t)length + SIM_RESTORE_SIZE);
+    printf("input %s, %ld bytes\n", path, length);
+
+    if (only == NULL || strcmp(only, "stream") == 0) {
+        failed |= Sim_Case("stream", &run, chunk, flush_every);
+    }
+    if (only == NULL || strcmp(only, "record") == 0) {
+        failed |= Sim_Case("record", &run, chunk, 1U);
+    }
+    if (only == NULL || strcmp(only, "bulk") == 0) {
+        failed |= Sim_Case("bulk", &run, SIM_PLAIN_SIZE, 0U);
+    }
+
+    free(run.packed);
+    free(run.restored);
+    free(data);
+    return failed;
+}
@@ -0,0 +1,454 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    app_drv_modbus.c
+ * @brief   Modbus RTU 从站驱动
+ * @note    USART 接收超时判定 t3.5 帧边界，中断中完成解析与应答
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include "app_drv_modbus.h"
+
+#define MODBUS_MIN_FRAME_SIZE   (4U)     // 地址 + 功能码 + CRC
+#define MODBUS_MAX_READ_COUNT   (125U)
+#define MODBUS_MAX_WRITE_COUNT  (123U)
+
+// CRC16 查找表（多项式 0xA001 反射形式），常量放在 Flash 中
+static const uint16_t MODBUS_CRC_Table[256] = {
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+    0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+    0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+    0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+    0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+    0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+    0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+    0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+    0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+    0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+    0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+    0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+    0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+    0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+    0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+    0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+    0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040,
+};
+
+static inline uint16_t MODBUS_GetU16(const uint8_t* p)
+{
+    return (uint16_t)(((uint16_t)p[0] << 8) | p[1]);
+}
+
+static inline void MODBUS_PutU16(uint8_t* p, uint16_t value)
+{
+    p[0] = (uint8_t)(value >> 8);
+    p[1] = (uint8_t)value;
+}
+
+/**
+ * @brief 计算 Modbus CRC16
+ * @param data 数据指针
+ * @param length 数据长度
+ * @return CRC16，发送时低字节在前
+ */
+uint16_t MODBUS_CRC16(const uint8_t* data, uint16_t length)
+{
+    uint16_t crc = 0xFFFFU;
+
+    while (length-- > 0U) {
+        crc = (uint16_t)((crc >> 8) ^ MODBUS_CRC_Table[(crc ^ *data++) & 0xFFU]);
+    }
+    return crc;
+}
+
+/**
+ * @brief 二分查找包含 address 的寄存器块
+ * @return 块索引，未找到返回 -1
+ */
+static int32_t MODBUS_FindBlock(const MODBUS_Register_Block* blocks, uint16_t count, uint16_t address)
+{
+    int32_t low = 0;
+    int32_t high = (int32_t)count - 1;
+
+    while (low <= high) {
+        int32_t mid = (low + high) >> 1;
+        const MODBUS_Register_Block* block = &blocks[mid];
+
+        if (address < block->address) {
+            high = mid - 1;
+        } else if ((uint32_t)address >= (uint32_t)block->address + block->count) {
+            low = mid + 1;
+        } else {
+            return mid;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief 检查 [address, address + quantity) 是否被连续的寄存器块完整覆盖
+ * @return 第一个块的索引，不满足返回 -1
+ */
+static int32_t MODBUS_CheckRange(const MODBUS_Register_Block* blocks, uint16_t count,
+                                 uint16_t address, uint16_t quantity, uint8_t write)
+{
+    int32_t first = MODBUS_FindBlock(blocks, count, address);
+    int32_t index = first;
+    uint32_t pos = address;
+    uint32_t end = (uint32_t)address + quantity;
+
+    if (first < 0) {
+        return -1;
+    }
+
+    while (pos < end) {
+        const MODBUS_Register_Block* block;
+
+        if (index >= (int32_t)count) {
+            return -1;
+        }
+        block = &blocks[index];
+        // 首块可从中间开始，其余块必须紧接上一块
+        if (index != first && block->address != pos) {
+            return -1;
+        }
+        if (write && !block->writable) {
+            return -1;
+        }
+        pos = (uint32_t)block->address + block->count;
+        index++;
+    }
+    return first;
+}
+
+/**
+ * @brief 读取寄存器到应答缓冲区（大端），范围已校验
+ */
+static void MODBUS_ReadRegisters(const MODBUS_Register_Block* blocks, int32_t index,
+                                 uint16_t address, uint16_t quantity, uint8_t* out)
+{
+    while (quantity > 0U) {
+        const MODBUS_Register_Block* block = &blocks[index++];
+        uint16_t offset = (uint16_t)(address - block->address);
+        uint16_t n = (uint16_t)(block->count - offset);
+
+        if (n > quantity) {
+            n = quantity;
+        }
+        for (uint16_t i = 0; i < n; i++) {
+            MODBUS_PutU16(out, block->data[offset + i]);
+            out += 2;
+        }
+        address = (uint16_t)(address + n);
+        quantity = (uint16_t)(quantity - n);
+    }
+}
+
+/**
+ * @brief 将请求中的寄存器值（大端）写入寄存器块，范围已校验
+ */
+static void MODBUS_WriteRegisters(const MODBUS_Register_Block* blocks, int32_t index,
+                                  uint16_t address, uint16_t quantity, const uint8_t* in)
+{
+    while (quantity > 0U) {
+        const MODBUS_Register_Block* block = &blocks[index++];
+        uint16_t offset = (uint16_t)(address - block->address);
+        uint16_t n = (uint16_t)(block->count - offset);
+
+        if (n > quantity) {
+            n = quantity;
+        }
+        for (uint16_t i = 0; i < n; i++) {
+            block->data[offset + i] = MODBUS_GetU16(in);
+            in += 2;
+        }
+        address = (uint16_t)(address + n);
+        quantity = (uint16_t)(quantity - n);
+    }
+}
+
+/**
+ * @brief 执行请求并在 tx_buf 中生成应答 PDU
+ * @param ctx 指向 MODBUS_Context 结构体的指针
+ * @param pdu 请求 PDU（功能码开始）
+ * @param pdu_len 请求 PDU 长度
+ * @return 应答 PDU 长度（不含地址和 CRC）
+ */
+static uint16_t MODBUS_Execute(MODBUS_Context* ctx, const uint8_t* pdu, uint16_t pdu_len)
+{
+    uint8_t* rsp = &ctx->tx_buf[1];
+    uint8_t function = pdu[0];
+    uint8_t exception = 0;
+    uint16_t address;
+    uint16_t quantity;
+    int32_t index;
+
+    switch (function) {
+    case MODBUS_FC_READ_HOLDING:
+    case MODBUS_FC_READ_INPUT: {
+        const MODBUS_Register_Block* blocks = (function == MODBUS_FC_READ_HOLDING) ? ctx->holding : ctx->input;
+        uint16_t count = (function == MODBUS_FC_READ_HOLDING) ? ctx->holding_count : ctx->input_count;
+
+        if (pdu_len != 5U) {
+            exception = MODBUS_EX_ILLEGAL_VALUE;
+            break;
+        }
+        address = MODBUS_GetU16(&pdu[1]);
+        quantity = MODBUS_GetU16(&pdu[3]);
+        if (quantity == 0U || quantity > MODBUS_MAX_READ_COUNT) {
+            exception = MODBUS_EX_ILLEGAL_VALUE;
+            break;
+        }
+        index = MODBUS_CheckRange(blocks, count, address, quantity, 0);
+        if (index < 0) {
+            exception = MODBUS_EX_ILLEGAL_ADDRESS;
+            break;
+        }
+        rsp[0] = function;
+        rsp[1] = (uint8_t)(quantity * 2U);
+        MODBUS_ReadRegisters(blocks, index, address, quantity, &rsp[2]);
+        return (uint16_t)(2U + quantity * 2U);
+    }
+
+    case MODBUS_FC_WRITE_SINGLE:
+        if (pdu_len != 5U) {
+            exception = MODBUS_EX_ILLEGAL_VALUE;
+            break;
+        }
+        address = MODBUS_GetU16(&pdu[1]);
+        index = MODBUS_CheckRange(ctx->holding, ctx->holding_count, address, 1U, 1);
+        if (index < 0) {
+            exception = MODBUS_EX_ILLEGAL_ADDRESS;
+            break;
+        }
+        MODBUS_WriteRegisters(ctx->holding, index, address, 1U, &pdu[3]);
+        if (ctx->write_notify != NULL) {
+            ctx->write_notify(ctx->user, address, 1U);
+        }
+        // 应答与请求相同
+        memcpy(rsp, pdu, 5U);
+        return 5U;
+
+    case MODBUS_FC_WRITE_MULTIPLE:
+        if (pdu_len < 6U) {
+            exception = MODBUS_EX_ILLEGAL_VALUE;
+            break;
+        }
+        address = MODBUS_GetU16(&pdu[1]);
+        quantity = MODBUS_GetU16(&pdu[3]);
+        if (quantity == 0U || quantity > MODBUS_MAX_WRITE_COUNT ||
+            pdu[5] != quantity * 2U || pdu_len != 6U + quantity * 2U) {
+            exception = MODBUS_EX_ILLEGAL_VALUE;
+            break;
+        }
+        index = MODBUS_CheckRange(ctx->holding, ctx->holding_count, address, quantity, 1);
+        if (index < 0) {
+            exception = MODBUS_EX_ILLEGAL_ADDRESS;
+            break;
+        }
+        MODBUS_WriteRegisters(ctx->holding, index, address, quantity, &pdu[6]);
+        if (ctx->write_notify != NULL) {
+            ctx->write_notify(ctx->user, address, quantity);
+        }
+        memcpy(rsp, pdu, 5U);
+        return 5U;
+
+    default:
+        exception = MODBUS_EX_ILLEGAL_FUNCTION;
+        break;
+    }
+
+    ctx->exception_count++;
+    rsp[0] = (uint8_t)(function | 0x80U);
+    rsp[1] = exception;
+    return 2U;
+}
+
+/**
+ * @brief 初始化 Modbus 从站上下文
+ * @param ctx 指向 MODBUS_Context 结构体的指针
+ * @param slave_address 从站地址 (1 ~ 247)
+ * @param send 应答发送函数
+ * @param user 传递给发送/写入通知函数的用户参数
+ */
+void MODBUS_Init(MODBUS_Context* ctx, uint8_t slave_address, MODBUS_Send_Func send, void* user)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->slave_address = slave_address;
+    ctx->send = send;
+    ctx->user = user;
+}
+
+/**
+ * @brief 设置寄存器映射
+ * @param ctx 指向 MODBUS_Context 结构体的指针
+ * @param holding 保持寄存器块表（可为 NULL）
+ * @param holding_count 保持寄存器块数量
+ * @param input 输入寄存器块表（可为 NULL）
+ * @param input_count 输入寄存器块数量
+ * @return 0 成功；-1 块未按地址升序排列、重叠或超出地址空间
+ */
+int MODBUS_SetRegisterMap(MODBUS_Context* ctx,
+                          const MODBUS_Register_Block* holding, uint16_t holding_count,
+                          const MODBUS_Register_Block* input, uint16_t input_count)
+{
+    const MODBUS_Register_Block* tables[2] = { holding, input };
+    uint16_t counts[2] = { holding_count, input_count };
+
+    for (uint8_t t = 0; t < 2U; t++) {
+        uint32_t next = 0;
+
+        for (uint16_t i = 0; i < counts[t]; i++) {
+            const MODBUS_Register_Block* block = &tables[t][i];
+            uint32_t end = (uint32_t)block->address + block->count;
+
+            if (block->count == 0U || block->address < next || end > 0x10000UL) {
+                return -1;
+            }
+            next = end;
+        }
+    }
+
+    ctx->holding = holding;
+    ctx->holding_count = holding_count;
+    ctx->input = input;
+    ctx->input_count = input_count;
+    return 0;
+}
+
+/**
+ * @brief 设置寄存器写入通知函数
+ */
+void MODBUS_SetWriteNotify(MODBUS_Context* ctx, MODBUS_Write_Notify_Func notify)
+{
+    ctx->write_notify = notify;
+}
+
+/**
+ * @brief 根据波特率计算 t3.5
+ * @param baud_rate 波特率
+ * @return t3.5 对应的位时间数
+ */
+uint32_t MODBUS_GetT35Bits(uint32_t baud_rate)
+{
+    if (baud_rate <= 19200U) {
+        // 3.5 个字符，每字符 11 位
+        return 39U;
+    }
+    // 固定 1750 us，向上取整
+    return (uint32_t)(((uint64_t)baud_rate * 1750U + 999999U) / 1000000U);
+}
+
+static void MODBUS_FrameTimeoutCallback(void* user)
+{
+    MODBUS_FrameEnd((MODBUS_Context*)user);
+}
+
+/**
+ * @brief 挂接到串口接收驱动
+ * @param ctx 指向 MODBUS_Context 结构体的指针
+ * @param serial 已通过 USART_Rx_DMA_Init 初始化的串口接收上下文
+ */
+void MODBUS_Attach(MODBUS_Context* ctx, USART_DMA_Context* serial)
+{
+    USART_RegisterQueueOps(serial, ctx, MODBUS_Queue_Write, MODBUS_Queue_Available);
+    USART_Rx_DMA_EnableFrameTimeout(serial,
+                                    MODBUS_GetT35Bits(serial->huart->Init.BaudRate),
+                                    MODBUS_FrameTimeoutCallback,
+                                    ctx);
+}
+
+/**
+ * @brief 追加接收数据到帧缓冲区
+ * @note 超出帧缓冲区的部分丢弃，并将整帧标记为超长
+ */
+uint32_t MODBUS_Queue_Write(void* user_queue, uint8_t* data, uint16_t length)
+{
+    MODBUS_Context* ctx = (MODBUS_Context*)user_queue;
+    uint16_t space = (uint16_t)(MODBUS_ADU_MAX_SIZE - ctx->rx_len);
+
+    if (length > space) {
+        ctx->rx_overflow = 1;
+        length = space;
+    }
+    memcpy(&ctx->rx_buf[ctx->rx_len], data, length);
+    ctx->rx_len = (uint16_t)(ctx->rx_len + length);
+    return length;
+}
+
+uint32_t MODBUS_Queue_Available(void* user_queue)
+{
+    (void)user_queue;
+    return MODBUS_ADU_MAX_SIZE;
+}
+
+/**
+ * @brief 处理一帧完整的请求
+ * @param ctx 指向 MODBUS_Context 结构体的指针
+ * @note 由 t3.5 接收超时中断调用；处理完成后清空帧缓冲区
+ */
+void MODBUS_FrameEnd(MODBUS_Context* ctx)
+{
+    uint16_t length = ctx->rx_len;
+    uint8_t address = ctx->rx_buf[0];
+
+    ctx->rx_len = 0;
+
+    if (ctx->rx_overflow) {
+        ctx->rx_overflow = 0;
+        ctx->overflow_count++;
+        return;
+    }
+    if (length < MODBUS_MIN_FRAME_SIZE) {
+        if (length > 0U) {
+            ctx->crc_error_count++;
+        }
+        return;
+    }
+
+    // 非本站地址直接忽略，不计算 CRC
+    if (address != ctx->slave_address && address != MODBUS_BROADCAST_ADDRESS) {
+        return;
+    }
+
+    // 对包含 CRC 的整帧计算，结果为 0 表示校验通过
+    if (MODBUS_CRC16(ctx->rx_buf, length) != 0U) {
+        ctx->crc_error_count++;
+        return;
+    }
+    ctx->frame_count++;
+
+    uint16_t pdu_len = MODBUS_Execute(ctx, &ctx->rx_buf[1], (uint16_t)(length - 3U));
+
+    // 广播请求不应答
+    if (address == MODBUS_BROADCAST_ADDRESS) {
+        return;
+    }
+
+    ctx->tx_buf[0] = ctx->slave_address;
+    uint16_t crc = MODBUS_CRC16(ctx->tx_buf, (uint16_t)(pdu_len + 1U));
+    ctx->tx_buf[pdu_len + 1U] = (uint8_t)crc;
+    ctx->tx_buf[pdu_len + 2U] = (uint8_t)(crc >> 8);
+
+    if (ctx->send == NULL || ctx->send(ctx->user, ctx->tx_buf, (uint16_t)(pdu_len + 3U)) != 0) {
+        ctx->send_error_count++;
+    }
+}
@@ -0,0 +1,109 @@
+#ifndef APP_DRV_MODBUS_H_
+#define APP_DRV_MODBUS_H_
+
+#include <stdint.h>
+#include "main.h"
+#include "app_drv_serial_rx.h"
+
+/*
+ * Modbus RTU 从站
+ *
+ * 帧边界由 USART 硬件接收超时 (RTOR) 判定：从最后一个字节的停止位开始计 t3.5，
+ * 波特率 <= 19200 时为 3.5 个字符 (按 11 位/字符计 39 位)，更高波特率固定 1.75 ms。
+ * 接收数据由 USART_DMA_Context 直接写入本模块的帧缓冲区 (作为其用户队列)，
+ * 超时中断中完成 CRC 校验、寄存器读写并启动应答发送，无需主循环参与。
+ *
+ * 支持的功能码：
+ *   0x03 读保持寄存器  0x04 读输入寄存器  0x06 写单个寄存器  0x10 写多个寄存器
+ * 其余功能码回复异常码 0x01；地址 0 为广播，只执行写操作且不应答。
+ *
+ * 寄存器映射为按起始地址升序排列的寄存器块表，二分查找定位；
+ * 跨块访问要求相邻块地址连续，写操作先校验整个范围再写入。
+ *
+ * 周转时间估算：读 10 个寄存器时请求 8 字节、应答 25 字节，查表 CRC 约 7 周期/字节，
+ * 加上查找与中断开销共约 600 个周期，HCLK 8 MHz 时约 75 us。
+ */
+
+#define MODBUS_ADU_MAX_SIZE         (256U)  // RTU 帧最大长度
+#define MODBUS_BROADCAST_ADDRESS    (0U)
+
+#define MODBUS_FC_READ_HOLDING      (0x03U)
+#define MODBUS_FC_READ_INPUT        (0x04U)
+#define MODBUS_FC_WRITE_SINGLE      (0x06U)
+#define MODBUS_FC_WRITE_MULTIPLE    (0x10U)
+
+#define MODBUS_EX_ILLEGAL_FUNCTION  (0x01U)
+#define MODBUS_EX_ILLEGAL_ADDRESS   (0x02U)
+#define MODBUS_EX_ILLEGAL_VALUE     (0x03U)
+
+// 应答发送函数类型定义（在中断中调用，需为非阻塞发送），返回 0 表示成功
+typedef int (*MODBUS_Send_Func)(void* user, const uint8_t* data, uint16_t length);
+
+// 寄存器写入通知函数类型定义（在中断中调用），可为 NULL
+typedef void (*MODBUS_Write_Notify_Func)(void* user, uint16_t address, uint16_t count);
+
+// 寄存器块
+typedef struct {
+    uint16_t address;        // 起始地址
+    uint16_t count;          // 寄存器数量
+    uint16_t* data;          // 寄存器存储
+    uint8_t writable;        // 1：允许 0x06/0x10 写入
+} MODBUS_Register_Block;
+
+// Modbus 从站上下文结构体
+typedef struct {
+    uint8_t slave_address;
+    MODBUS_Send_Func send;
+    MODBUS_Write_Notify_Func write_notify;
+    void* user;
+
+    // 寄存器映射（按 address 升序）
+    const MODBUS_Register_Block* holding;
+    uint16_t holding_count;
+    const MODBUS_Register_Block* input;
+    uint16_t input_count;
+
+    // 帧缓冲区
+    uint8_t rx_buf[MODBUS_ADU_MAX_SIZE];
+    uint16_t rx_len;
+    uint8_t rx_overflow;     // 帧超长，整帧丢弃
+    uint8_t tx_buf[MODBUS_ADU_MAX_SIZE];
+
+    // 统计
+    uint32_t frame_count;          // 发给本站且校验通过的帧数
+    uint32_t crc_error_count;      // CRC 错误或帧过短
+    uint32_t overflow_count;       // 超长帧
+    uint32_t exception_count;      // 异常应答数
+    uint32_t send_error_count;     // 发送函数返回失败
+} MODBUS_Context;
+
+// 初始化从站上下文
+void MODBUS_Init(MODBUS_Context* ctx, uint8_t slave_address, MODBUS_Send_Func send, void* user);
+
+// 设置寄存器映射（块需按起始地址升序且互不重叠），成功返回 0
+int MODBUS_SetRegisterMap(MODBUS_Context* ctx,
+                          const MODBUS_Register_Block* holding, uint16_t holding_count,
+                          const MODBUS_Register_Block* input, uint16_t input_count);
+
+// 设置寄存器写入通知函数
+void MODBUS_SetWriteNotify(MODBUS_Context* ctx, MODBUS_Write_Notify_Func notify);
+
+// 挂接到串口接收驱动：注册帧缓冲区为用户队列，并按波特率使能 t3.5 接收超时
+void MODBUS_Attach(MODBUS_Context* ctx, USART_DMA_Context* serial);
+
+// 根据波特率计算 t3.5 对应的位时间数
+uint32_t MODBUS_GetT35Bits(uint32_t baud_rate);
+
+// 处理一帧（由接收超时回调调用，也可用于主机端模拟主站）
+void MODBUS_FrameEnd(MODBUS_Context* ctx);
+
+// 追加接收数据（USART 队列写入函数），返回实际写入长度
+uint32_t MODBUS_Queue_Write(void* user_queue, uint8_t* data, uint16_t length);
+
+// 队列可用空间（始终返回帧缓冲区大小，超长部分在写入时丢弃并标记）
+uint32_t MODBUS_Queue_Available(void* user_queue);
+
+// Modbus CRC16（多项式 0xA001，初值 0xFFFF）
+uint16_t MODBUS_CRC16(const uint8_t* data, uint16_t length);
+
+#endif /* APP_DRV_MODBUS_H_ */
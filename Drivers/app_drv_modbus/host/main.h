@@ -0,0 +1,41 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    main.h
+ * @brief   主机端替身：只提供 app_drv_modbus.h / app_drv_serial_rx.h 编译所需的类型
+ * @note    协议核心不调用 HAL；USART_RegisterQueueOps / USART_Rx_DMA_EnableFrameTimeout
+ *          由 modbus_master_sim.c 中的串口接收模型实现
+ ******************************************************************************
+ */
+
+#ifndef HOST_MAIN_H_
+#define HOST_MAIN_H_
+
+#include <stdint.h>
+
+typedef enum {
+    HAL_OK = 0,
+    HAL_ERROR,
+    HAL_BUSY,
+    HAL_TIMEOUT,
+} HAL_StatusTypeDef;
+
+typedef struct {
+    uint32_t BaudRate;
+} UART_InitTypeDef;
+
+typedef struct {
+    UART_InitTypeDef Init;
+} UART_HandleTypeDef;
+
+typedef struct {
+    uint32_t Instance;
+} DMA_HandleTypeDef;
+
+typedef struct {
+    volatile uint32_t ODR;
+} GPIO_TypeDef;
+
+#endif /* HOST_MAIN_H_ */
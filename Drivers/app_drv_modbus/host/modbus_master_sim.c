@@ -0,0 +1,730 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    modbus_master_sim.c
+ * @brief   Modbus RTU 主站模拟（Linux / macOS）
+ * @note    与固件共用 app_drv_modbus.c（协议核心不依赖 HAL），同目录的 main.h 只提供类型，编译：
+ *            cc -O2 -I. -I.. -I../../app_drv_serial_rx -o modbus_master_sim modbus_master_sim.c ../app_drv_modbus.c -lm
+ *
+ *          串口接收按位时间建模，代替 app_drv_serial_rx：每字符 11 位，停止位结束后 1 个字符时间无新起始位
+ *          产生 IDLE，DMA 缓冲区半满/全满也搬运一次；接收超时 (RTOR) 从最后一个停止位开始计
+ *          MODBUS_GetT35Bits 个位时间，到期时先把剩余数据写入队列再调用帧结束回调，与驱动的中断处理顺序一致。
+ *          主站用独立实现的按位 CRC16 组帧，并用独立的寄存器参考模型计算期望应答。用例：
+ *            basic     跨块读写、写单个/多个寄存器、读输入寄存器，逐字节比对应答
+ *            except    非法功能码 / 地址 / 数量 / 字节数、写只读块的异常应答
+ *            crc       CRC 错误、其他站地址、广播写（执行但不应答）、超长帧后恢复
+ *            framing   帧内间隔小于 t3.5 不拆帧，达到 t3.5 拆成两段丢弃；两帧间隔不足 t3.5 合并丢弃；
+ *                      总线上其他从站的应答不影响本站
+ *            fuzz      随机请求（含错误数量、截断、坏 CRC、广播），应答与寄存器内容都与参考模型一致
+ *            timing    各波特率下 t3.5 与帧结束回调的主机耗时
+ *
+ *            modbus_master_sim [-s seed] [-n fuzz_requests] [basic|except|crc|framing|fuzz|timing]
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "app_drv_modbus.h"
+
+#define SIM_CHAR_BITS           (11U)       // 起始 + 8 数据 + 校验 + 停止
+#define SIM_SLAVE               (17U)
+#define SIM_OTHER_SLAVE         (5U)
+#define SIM_BLOCKS_MAX          (4U)
+
+// 串口接收模型
+typedef struct {
+    double bit_us;
+    uint32_t t35_bits;
+    double now;                 // 当前时刻
+    double line_free;           // 线路空闲、主站可以发送的时刻
+    double last_end;            // 最后一个字节停止位结束时刻
+    uint8_t idle_armed;
+    uint8_t rto_armed;
+    uint8_t dma[USART_DMA_BUFFER_SIZE];
+    uint16_t dma_len;
+    void* queue;
+    USART_Queue_Write_Func queue_write;
+    USART_Frame_Timeout_Func frame_timeout;
+    void* frame_timeout_user;
+    uint32_t frame_timeouts;
+    uint64_t isr_ns_sum;
+    uint64_t isr_ns_min;
+} Sim_Uart;
+
+// 从站应答
+typedef struct {
+    uint8_t data[MODBUS_ADU_MAX_SIZE];
+    uint16_t length;
+    double time;                // 从站调用发送函数的时刻
+    uint32_t count;
+} Sim_Response;
+
+// 参考模型中的寄存器块（与驱动的映射同布局，存储独立）
+typedef struct {
+    uint16_t address;
+    uint16_t count;
+    uint16_t* data;
+    uint8_t writable;
+} Ref_Block;
+
+static uint16_t hold_a[16], hold_b[8], hold_ro[4], hold_c[10];
+static uint16_t input_a[32], input_b[4];
+static uint16_t ref_hold_a[16], ref_hold_b[8], ref_hold_ro[4], ref_hold_c[10];
+static uint16_t ref_input_a[32], ref_input_b[4];
+
+// 0..23 由两个相邻块组成，100..103 只读，200..209 独立
+static const MODBUS_Register_Block holding_map[] = {
+    { 0, 16, hold_a, 1 },
+    { 16, 8, hold_b, 1 },
+    { 100, 4, hold_ro, 0 },
+    { 200, 10, hold_c, 1 },
+};
+static const MODBUS_Register_Block input_map[] = {
+    { 0, 32, input_a, 0 },
+    { 1000, 4, input_b, 0 },
+};
+static const Ref_Block ref_holding[] = {
+    { 0, 16, ref_hold_a, 1 },
+    { 16, 8, ref_hold_b, 1 },
+    { 100, 4, ref_hold_ro, 0 },
+    { 200, 10, ref_hold_c, 1 },
+};
+static const Ref_Block ref_input[] = {
+    { 0, 32, ref_input_a, 0 },
+    { 1000, 4, ref_input_b, 0 },
+};
+
+static MODBUS_Context slave;
+static USART_DMA_Context serial;
+static UART_HandleTypeDef sim_huart;
+static Sim_Uart uart;
+static Sim_Response rsp;
+static uint32_t ref_exceptions;
+
+static uint64_t Sim_NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+/* ----------------------------------------------------------------------------
+ * 串口接收模型（代替 app_drv_serial_rx 中 MODBUS_Attach 用到的两个函数）
+ * ------------------------------------------------------------------------- */
+
+void USART_RegisterQueueOps(USART_DMA_Context* ctx, void* user_queue,
+                            USART_Queue_Write_Func write_func, USART_Queue_Available_Func available_func)
+{
+    ctx->user_queue = user_queue;
+    ctx->queue_write = write_func;
+    ctx->queue_available = available_func;
+    uart.queue = user_queue;
+    uart.queue_write = write_func;
+}
+
+void USART_Rx_DMA_EnableFrameTimeout(USART_DMA_Context* ctx, uint32_t bit_times,
+                                     USART_Frame_Timeout_Func callback, void* user)
+{
+    ctx->frame_timeout = callback;
+    ctx->frame_timeout_user = user;
+    uart.t35_bits = bit_times;
+    uart.frame_timeout = callback;
+    uart.frame_timeout_user = user;
+}
+
+static void Sim_UartFlush(void)
+{
+    if (uart.dma_len > 0U) {
+        uart.queue_write(uart.queue, uart.dma, uart.dma_len);
+        uart.dma_len = 0;
+    }
+}
+
+/**
+ * @brief 线路保持空闲到 t：依次处理到期的 IDLE 与接收超时
+ */
+static void Sim_UartIdleUntil(double t)
+{
+    double idle_at = uart.last_end + SIM_CHAR_BITS * uart.bit_us;
+    double rto_at = uart.last_end + uart.t35_bits * uart.bit_us;
+
+    if (uart.idle_armed && idle_at <= t) {
+        uart.now = idle_at;
+        uart.idle_armed = 0;
+        Sim_UartFlush();
+    }
+    if (uart.rto_armed && rto_at <= t) {
+        uint64_t start, ns;
+
+        uart.now = rto_at;
+        uart.rto_armed = 0;
+        Sim_UartFlush();
+        start = Sim_NowNs();
+        uart.frame_timeout(uart.frame_timeout_user);
+        ns = Sim_NowNs() - start;
+        uart.isr_ns_sum += ns;
+        if (uart.isr_ns_min == 0U || ns < uart.isr_ns_min) {
+            uart.isr_ns_min = ns;
+        }
+        uart.frame_timeouts++;
+    }
+    if (t > uart.now) {
+        uart.now = t;
+    }
+}
+
+// 一个字节的起始位在 start 时刻开始
+static void Sim_UartByte(double start, uint8_t byte)
+{
+    Sim_UartIdleUntil(start);
+    uart.dma[uart.dma_len++] = byte;
+    if (uart.dma_len == USART_DMA_BUFFER_SIZE / 2U || uart.dma_len == USART_DMA_BUFFER_SIZE) {
+        // 半传输 / 传输完成
+        Sim_UartFlush();
+    }
+    uart.last_end = start + SIM_CHAR_BITS * uart.bit_us;
+    uart.now = uart.last_end;
+    uart.idle_armed = 1;
+    uart.rto_armed = 1;
+}
+
+static int Sim_Send(void* user, const uint8_t* data, uint16_t length)
+{
+    (void)user;
+    memcpy(rsp.data, data, length);
+    rsp.length = length;
+    rsp.time = uart.now;
+    rsp.count++;
+    return 0;
+}
+
+/**
+ * @brief 按波特率重新挂接从站，寄存器与参考模型恢复到相同的初值
+ */
+static void Sim_Open(uint32_t baud)
+{
+    uint32_t i;
+
+    memset(&uart, 0, sizeof(uart));
+    memset(&rsp, 0, sizeof(rsp));
+    uart.bit_us = 1e6 / baud;
+    for (i = 0; i < 16U; i++) {
+        hold_a[i] = ref_hold_a[i] = (uint16_t)(0x1000U + i);
+    }
+    for (i = 0; i < 8U; i++) {
+        hold_b[i] = ref_hold_b[i] = (uint16_t)(0x2000U + i);
+    }
+    for (i = 0; i < 4U; i++) {
+        hold_ro[i] = ref_hold_ro[i] = (uint16_t)(0x3000U + i);
+        input_b[i] = ref_input_b[i] = (uint16_t)(0x5000U + i);
+    }
+    for (i = 0; i < 10U; i++) {
+        hold_c[i] = ref_hold_c[i] = (uint16_t)(0x4000U + i);
+    }
+    for (i = 0; i < 32U; i++) {
+        input_a[i] = ref_input_a[i] = (uint16_t)(0x6000U + i * 3U);
+    }
+    ref_exceptions = 0;
+
+    sim_huart.Init.BaudRate = baud;
+    serial.huart = &sim_huart;
+    MODBUS_Init(&slave, SIM_SLAVE, Sim_Send, NULL);
+    MODBUS_SetRegisterMap(&slave, holding_map, 4, input_map, 2);
+    MODBUS_Attach(&slave, &serial);
+}
+
+/* ----------------------------------------------------------------------------
+ * 主站
+ * ------------------------------------------------------------------------- */
+
+// 按位计算的 CRC16，与驱动的查表实现相互独立
+static uint16_t Sim_Crc16(const uint8_t* data, uint16_t length)
+{
+    uint16_t crc = 0xFFFFU;
+    int bit;
+
+    while (length-- > 0U) {
+        crc ^= *data++;
+        for (bit = 0; bit < 8; bit++) {
+            crc = (crc & 1U) ? (uint16_t)((crc >> 1) ^ 0xA001U) : (uint16_t)(crc >> 1);
+        }
+    }
+    return crc;
+}
+
+static uint16_t Sim_AppendCrc(uint8_t* frame, uint16_t length)
+{
+    uint16_t crc = Sim_Crc16(frame, length);
+
+    frame[length] = (uint8_t)crc;
+    frame[length + 1U] = (uint8_t)(crc >> 8);
+    return (uint16_t)(length + 2U);
+}
+
+// 0x03 / 0x04 / 0x06 请求：地址 + 功能码 + 两个 16 位参数
+static uint16_t Sim_Request(uint8_t* frame, uint8_t slave_address, uint8_t function, uint16_t a, uint16_t b)
+{
+    frame[0] = slave_address;
+    frame[1] = function;
+    frame[2] = (uint8_t)(a >> 8);
+    frame[3] = (uint8_t)a;
+    frame[4] = (uint8_t)(b >> 8);
+    frame[5] = (uint8_t)b;
+    return Sim_AppendCrc(frame, 6);
+}
+
+static uint16_t Sim_WriteMultiple(uint8_t* frame, uint8_t slave_address, uint16_t address, uint16_t quantity,
+                                  const uint16_t* values)
+{
+    uint16_t i;
+
+    frame[0] = slave_address;
+    frame[1] = MODBUS_FC_WRITE_MULTIPLE;
+    frame[2] = (uint8_t)(address >> 8);
+    frame[3] = (uint8_t)address;
+    frame[4] = (uint8_t)(quantity >> 8);
+    frame[5] = (uint8_t)quantity;
+    frame[6] = (uint8_t)(quantity * 2U);
+    for (i = 0; i < quantity; i++) {
+        frame[7U + i * 2U] = (uint8_t)(values[i] >> 8);
+        frame[8U + i * 2U] = (uint8_t)values[i];
+    }
+    return Sim_AppendCrc(frame, (uint16_t)(7U + quantity * 2U));
+}
+
+/**
+ * @brief 发送一帧：第 gap_index 个字节前插入 gap_bits 位的空闲（gap_index 超出帧长则不插入）
+ */
+static void Sim_Transmit(const uint8_t* frame, uint16_t length, uint16_t gap_index, double gap_bits)
+{
+    double t = uart.line_free;
+    uint16_t i;
+
+    for (i = 0; i < length; i++) {
+        if (i == gap_index) {
+            t += gap_bits * uart.bit_us;
+        }
+        Sim_UartByte(t, frame[i]);
+        t += SIM_CHAR_BITS * uart.bit_us;
+    }
+    uart.line_free = t;
+}
+
+/**
+ * @brief 等待帧结束与可能的应答，之后线路空闲 t3.5
+ * @retval 1 收到应答
+ */
+static int Sim_Settle(uint32_t before)
+{
+    Sim_UartIdleUntil(uart.last_end + (uart.t35_bits + 1U) * uart.bit_us);
+    if (rsp.count != before) {
+        uart.line_free = rsp.time + (rsp.length * SIM_CHAR_BITS + uart.t35_bits) * uart.bit_us;
+        return 1;
+    }
+    uart.line_free = uart.now;
+    return 0;
+}
+
+static int Sim_Transact(const uint8_t* frame, uint16_t length, uint16_t gap_index, double gap_bits)
+{
+    uint32_t before = rsp.count;
+
+    Sim_Transmit(frame, length, gap_index, gap_bits);
+    return Sim_Settle(before);
+}
+
+/* ----------------------------------------------------------------------------
+ * 参考模型
+ * ------------------------------------------------------------------------- */
+
+static uint16_t* Ref_Register(const Ref_Block* blocks, uint16_t count, uint32_t address, uint8_t* writable)
+{
+    uint16_t i;
+
+    for (i = 0; i < count; i++) {
+        if (address >= blocks[i].address && address < (uint32_t)blocks[i].address + blocks[i].count) {
+            *writable = blocks[i].writable;
+            return &blocks[i].data[address - blocks[i].address];
+        }
+    }
+    return NULL;
+}
+
+// 范围内每个寄存器都存在（且可写）
+static int Ref_Covered(const Ref_Block* blocks, uint16_t count, uint32_t address, uint32_t quantity, uint8_t write)
+{
+    uint32_t a;
+    uint8_t writable;
+
+    for (a = address; a < address + quantity; a++) {
+        if (Ref_Register(blocks, count, a, &writable) == NULL || (write && !writable)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief 参考模型：执行请求并生成期望应答
+ * @return 期望应答长度（含 CRC），0 表示不应答
+ */
+static uint16_t Ref_Execute(const uint8_t* req, uint16_t length, uint8_t* out)
+{
+    const uint8_t* pdu = &req[1];
+    uint16_t pdu_len = (uint16_t)(length - 3U);
+    uint8_t function, exception = 0, writable;
+    uint32_t address, quantity, i;
+    uint16_t n = 0;
+
+    if (length < 4U || length > MODBUS_ADU_MAX_SIZE) {
+        return 0;
+    }
+    if (req[0] != SIM_SLAVE && req[0] != MODBUS_BROADCAST_ADDRESS) {
+        return 0;
+    }
+    if (Sim_Crc16(req, (uint16_t)(length - 2U)) != (uint16_t)(req[length - 2U] | (req[length - 1U] << 8))) {
+        return 0;
+    }
+
+    function = pdu[0];
+    address = (pdu_len >= 3U) ? ((uint32_t)pdu[1] << 8 | pdu[2]) : 0U;
+    quantity = (pdu_len >= 5U) ? ((uint32_t)pdu[3] << 8 | pdu[4]) : 0U;
+    out[1] = function;
+    switch (function) {
+    case MODBUS_FC_READ_HOLDING:
+    case MODBUS_FC_READ_INPUT: {
+        const Ref_Block* blocks = (function == MODBUS_FC_READ_HOLDING) ? ref_holding : ref_input;
+        uint16_t count = (function == MODBUS_FC_READ_HOLDING) ? 4U : 2U;
+
+        if (pdu_len != 5U || quantity == 0U || quantity > 125U) {
+            exception = MODBUS_EX_ILLEGAL_VALUE;
+        } else if (!Ref_Covered(blocks, count, address, quantity, 0)) {
+            exception = MODBUS_EX_ILLEGAL_ADDRESS;
+        } else {
+            out[2] = (uint8_t)(quantity * 2U);
+            for (i = 0; i < quantity; i++) {
+                uint16_t value = *Ref_Register(blocks, count, address + i, &writable);
+
+                out[3U + i * 2U] = (uint8_t)(value >> 8);
+                out[4U + i * 2U] = (uint8_t)value;
+            }
+            n = (uint16_t)(3U + quantity * 2U);
+        }
+        break;
+    }
+    case MODBUS_FC_WRITE_SINGLE:
+        if (pdu_len != 5U) {
+            exception = MODBUS_EX_ILLEGAL_VALUE;
+        } else if (!Ref_Covered(ref_holding, 4, address, 1, 1)) {
+            exception = MODBUS_EX_ILLEGAL_ADDRESS;
+        } else {
+            *Ref_Register(ref_holding, 4, address, &writable) = (uint16_t)quantity;
+            memcpy(&out[1], pdu, 5);
+            n = 6;
+        }
+        break;
+    case MODBUS_FC_WRITE_MULTIPLE:
+        if (pdu_len < 6U || quantity == 0U || quantity > 123U || pdu[5] != quantity * 2U
+            || pdu_len != 6U + quantity * 2U) {
+            exception = MODBUS_EX_ILLEGAL_VALUE;
+        } else if (!Ref_Covered(ref_holding, 4, address, quantity, 1)) {
+            exception = MODBUS_EX_ILLEGAL_ADDRESS;
+        } else {
+            for (i = 0; i < quantity; i++) {
+                *Ref_Register(ref_holding, 4, address + i, &writable) = (uint16_t)(pdu[6U + i * 2U] << 8 | pdu[7U + i * 2U]);
+            }
+            memcpy(&out[1], pdu, 5);
+            n = 6;
+        }
+        break;
+    default:
+        exception = MODBUS_EX_ILLEGAL_FUNCTION;
+        break;
+    }
+    if (exception != 0U) {
+        ref_exceptions++;
+        out[1] = (uint8_t)(function | 0x80U);
+        out[2] = exception;
+        n = 3;
+    }
+    if (req[0] == MODBUS_BROADCAST_ADDRESS) {
+        return 0;
+    }
+    out[0] = SIM_SLAVE;
+    return Sim_AppendCrc(out, n);
+}
+
+// 驱动与参考模型的寄存器内容一致
+static int Ref_Match(void)
+{
+    return memcmp(hold_a, ref_hold_a, sizeof(hold_a)) == 0 && memcmp(hold_b, ref_hold_b, sizeof(hold_b)) == 0
+           && memcmp(hold_ro, ref_hold_ro, sizeof(hold_ro)) == 0 && memcmp(hold_c, ref_hold_c, sizeof(hold_c)) == 0
+           && memcmp(input_a, ref_input_a, sizeof(input_a)) == 0 && memcmp(input_b, ref_input_b, sizeof(input_b)) == 0;
+}
+
+/**
+ * @brief 发送请求并与参考模型比对应答
+ * @retval 1 一致
+ */
+static int Sim_Check(const char* what, const uint8_t* frame, uint16_t length)
+{
+    uint8_t expect[MODBUS_ADU_MAX_SIZE + 2];
+    uint16_t expect_len = Ref_Execute(frame, length, expect);
+    int got = Sim_Transact(frame, length, 0xFFFFU, 0.0);
+
+    if (got != (expect_len != 0U) || (got && (rsp.length != expect_len || memcmp(rsp.data, expect, expect_len) != 0))
+        || !Ref_Match()) {
+        printf("  %s: response %s (%u bytes), expected %u bytes, registers %s\n", what, got ? "received" : "missing",
+               got ? rsp.length : 0U, expect_len, Ref_Match() ? "match" : "differ");
+        return 0;
+    }
+    return 1;
+}
+
+/* ----------------------------------------------------------------------------
+ * 用例
+ * ------------------------------------------------------------------------- */
+
+static int Sim_Basic(void)
+{
+    static const uint16_t values[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    uint8_t frame[MODBUS_ADU_MAX_SIZE];
+    int ok = 1;
+
+    Sim_Open(19200);
+    ok &= Sim_Check("read holding 0..23 across blocks", frame, Sim_Request(frame, SIM_SLAVE, 0x03, 0, 24));
+    ok &= Sim_Check("write multiple 12..21 across blocks", frame, Sim_WriteMultiple(frame, SIM_SLAVE, 12, 10, values));
+    ok &= Sim_Check("read back 10..23", frame, Sim_Request(frame, SIM_SLAVE, 0x03, 10, 14));
+    ok &= Sim_Check("write single 205", frame, Sim_Request(frame, SIM_SLAVE, 0x06, 205, 0xBEEF));
+    ok &= Sim_Check("read holding 200..209", frame, Sim_Request(frame, SIM_SLAVE, 0x03, 200, 10));
+    ok &= Sim_Check("read input 0..31", frame, Sim_Request(frame, SIM_SLAVE, 0x04, 0, 32));
+    ok &= Sim_Check("read input 1000..1003", frame, Sim_Request(frame, SIM_SLAVE, 0x04, 1000, 4));
+    ok &= Sim_Check("read holding 100..103 (read-only block)", frame, Sim_Request(frame, SIM_SLAVE, 0x03, 100, 4));
+    ok &= (slave.frame_count == 8U && slave.exception_count == 0U && slave.crc_error_count == 0U);
+    printf("basic: %u frames, %u responses -> %s\n", slave.frame_count, rsp.count, ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+static int Sim_Except(void)
+{
+    static const uint16_t values[4] = { 9, 9, 9, 9 };
+    uint8_t frame[MODBUS_ADU_MAX_SIZE];
+    uint16_t n;
+    int ok = 1;
+
+    Sim_Open(19200);
+    frame[0] = SIM_SLAVE;
+    frame[1] = 0x05;
+    memset(&frame[2], 0, 4);
+    ok &= Sim_Check("function 0x05", frame, Sim_AppendCrc(frame, 6));
+    ok &= Sim_Check("read 20..29 runs into a gap", frame, Sim_Request(frame, SIM_SLAVE, 0x03, 20, 10));
+    ok &= Sim_Check("read unmapped 50", frame, Sim_Request(frame, SIM_SLAVE, 0x03, 50, 1));
+    ok &= Sim_Check("read quantity 0", frame, Sim_Request(frame, SIM_SLAVE, 0x03, 0, 0));
+    ok &= Sim_Check("read quantity 126", frame, Sim_Request(frame, SIM_SLAVE, 0x04, 0, 126));
+    ok &= Sim_Check("write single read-only 101", frame, Sim_Request(frame, SIM_SLAVE, 0x06, 101, 1));
+    ok &= Sim_Check("write multiple 22..25 into a gap", frame, Sim_WriteMultiple(frame, SIM_SLAVE, 22, 4, values));
+    n = Sim_WriteMultiple(frame, SIM_SLAVE, 0, 4, values);
+    frame[6] = 7;
+    ok &= Sim_Check("write multiple byte count 7 for 4 registers", frame, Sim_AppendCrc(frame, (uint16_t)(n - 2U)));
+    ok &= Sim_Check("read input with 4-byte pdu", frame, (uint16_t)(Sim_AppendCrc(frame, 5)));
+    ok &= (slave.exception_count == ref_exceptions && ref_exceptions == 9U);
+    printf("except: %u exception responses (reference %u) -> %s\n", slave.exception_count, ref_exceptions,
+           ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+static int Sim_Crc(void)
+{
+    uint8_t frame[MODBUS_ADU_MAX_SIZE + 64];
+    uint16_t n;
+    int ok = 1;
+
+    Sim_Open(19200);
+    n = Sim_Request(frame, SIM_SLAVE, 0x03, 0, 2);
+    frame[n - 1U] ^= 0x01U;
+    ok &= !Sim_Transact(frame, n, 0xFFFFU, 0.0) && slave.crc_error_count == 1U;
+
+    n = Sim_Request(frame, SIM_SLAVE, 0x03, 0, 2);
+    frame[3] ^= 0x40U;
+    ok &= !Sim_Transact(frame, n, 0xFFFFU, 0.0) && slave.crc_error_count == 2U;
+
+    ok &= Sim_Check("other slave", frame, Sim_Request(frame, SIM_OTHER_SLAVE, 0x06, 0, 0x1234));
+    ok &= Sim_Check("broadcast write single", frame, Sim_Request(frame, MODBUS_BROADCAST_ADDRESS, 0x06, 3, 0x5A5A));
+    ok &= (hold_a[3] == 0x5A5AU);
+
+    memset(frame, 0x11, sizeof(frame));
+    frame[0] = SIM_SLAVE;
+    ok &= !Sim_Transact(frame, MODBUS_ADU_MAX_SIZE + 40U, 0xFFFFU, 0.0) && slave.overflow_count == 1U;
+    ok &= Sim_Check("request after oversize frame", frame, Sim_Request(frame, SIM_SLAVE, 0x03, 0, 4));
+    ok &= (slave.crc_error_count == 2U && slave.frame_count == 2U);
+    printf("crc: crc errors %u, overflow %u, frames %u, broadcast applied without response -> %s\n",
+           slave.crc_error_count, slave.overflow_count, slave.frame_count, ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief 帧间隔：驱动只按 t3.5 判定帧边界（不按 t1.5 丢弃帧内停顿）
+ */
+static int Sim_FramingAt(uint32_t baud)
+{
+    uint8_t frame[16], other[16];
+    uint16_t n;
+    uint32_t t35;
+    uint32_t before;
+    int ok = 1;
+
+    Sim_Open(baud);
+    t35 = uart.t35_bits;
+    n = Sim_Request(frame, SIM_SLAVE, 0x03, 0, 4);
+
+    // 帧内 1.5 个字符与 t3.5 - 1 位的停顿都不拆帧，应答在最后一个停止位之后 t3.5 发出
+    ok &= Sim_Transact(frame, n, 3, 1.5 * SIM_CHAR_BITS);
+    ok &= Sim_Transact(frame, n, 3, t35 - 1.0) && fabs(rsp.time - uart.last_end - t35 * uart.bit_us) < 1e-6;
+
+    // 停顿达到 t3.5：拆成 3 字节与 5 字节两段，都按 CRC 错误丢弃
+    ok &= !Sim_Transact(frame, n, 3, t35) && slave.crc_error_count == 2U;
+
+    // 两帧间隔不足 t3.5：合并成一帧，CRC 错误
+    before = rsp.count;
+    Sim_Transmit(frame, n, 0xFFFFU, 0.0);
+    Sim_Transmit(frame, n, 0, t35 - 1.0);
+    ok &= !Sim_Settle(before) && slave.crc_error_count == 3U;
+
+    // 总线上其他从站的请求与应答，之后本站请求
+    Sim_Transmit(other, Sim_Request(other, SIM_OTHER_SLAVE, 0x03, 0, 1), 0xFFFFU, 0.0);
+    Sim_Transmit(other, Sim_AppendCrc((uint8_t[]){ SIM_OTHER_SLAVE, 0x03, 2, 0x12, 0x34, 0, 0 }, 5), 0, t35);
+    ok &= Sim_Transact(frame, n, 0, t35) && rsp.count == 3U && slave.crc_error_count == 3U;
+
+    printf("framing: %6u baud, t3.5 = %3u bits (%.0f us): gaps < t3.5 kept, = t3.5 split, "
+           "frames %u, crc errors %u -> %s\n", baud, t35, t35 * uart.bit_us, slave.frame_count,
+           slave.crc_error_count, ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+static int Sim_Framing(void)
+{
+    return Sim_FramingAt(9600) | Sim_FramingAt(19200) | Sim_FramingAt(115200);
+}
+
+/**
+ * @brief 随机请求与参考模型比对
+ */
+static int Sim_Fuzz(uint32_t count)
+{
+    static const uint8_t functions[] = { 0x03, 0x04, 0x06, 0x10, 0x03, 0x10, 0x01, 0x2B };
+    uint8_t frame[MODBUS_ADU_MAX_SIZE + 8];
+    uint16_t values[130];
+    uint32_t i, failed = 0, responses = 0;
+    uint16_t n, address, quantity;
+    uint8_t slave_address, function;
+
+    Sim_Open(115200);
+    for (i = 0; i < count; i++) {
+        uint32_t r = (uint32_t)lrand48();
+        uint32_t before = rsp.count;
+
+        slave_address = ((r & 0x1FU) == 0U) ? MODBUS_BROADCAST_ADDRESS : ((r & 0x1FU) == 1U) ? SIM_OTHER_SLAVE : SIM_SLAVE;
+        function = functions[(r >> 5) & 7U];
+        address = ((r >> 8) & 1U) ? (uint16_t)(lrand48() % 260) : (uint16_t)(lrand48() & 0xFFFF);
+        quantity = (uint16_t)(lrand48() % 131);
+        for (n = 0; n < 130U; n++) {
+            values[n] = (uint16_t)lrand48();
+        }
+
+        if (function == MODBUS_FC_WRITE_MULTIPLE) {
+            n = Sim_WriteMultiple(frame, slave_address, address, (quantity > 124U) ? 124U : quantity, values);
+        } else {
+            n = Sim_Request(frame, slave_address, function, address, (function == MODBUS_FC_WRITE_SINGLE) ? values[0] : quantity);
+        }
+        // 偶尔截断（CRC 重新计算）或破坏一个字节
+        if (((r >> 12) & 0xFU) == 0U && n > 5U) {
+            n = Sim_AppendCrc(frame, (uint16_t)(n - 3U));
+        } else if (((r >> 12) & 0xFU) == 1U) {
+            frame[lrand48() % n] ^= (uint8_t)(1U << (lrand48() & 7));
+        }
+        if (!Sim_Check("fuzz", frame, n)) {
+            failed++;
+        }
+        responses += (rsp.count != before);
+    }
+    printf("fuzz: %u requests, %u responses, %u exceptions, %u crc errors, %u mismatches -> %s\n", count, responses,
+           slave.exception_count, slave.crc_error_count, failed, (failed == 0U) ? "PASS" : "FAIL");
+    return (failed == 0U) ? 0 : 1;
+}
+
+/**
+ * @brief 周转时间：t3.5 由协议规定，其后是帧结束回调（校验、查表、组帧）的处理时间
+ */
+static void Sim_Timing(void)
+{
+    static const uint32_t bauds[] = { 9600, 19200, 115200 };
+    uint8_t frame[MODBUS_ADU_MAX_SIZE];
+    uint32_t i, k;
+
+    printf("timing: baud, t3.5 us, read 10 registers: request + response line time us, "
+           "frame end callback host ns mean / min\n");
+    for (i = 0; i < sizeof(bauds) / sizeof(bauds[0]); i++) {
+        uint16_t n;
+
+        Sim_Open(bauds[i]);
+        n = Sim_Request(frame, SIM_SLAVE, 0x03, 5, 10);
+        for (k = 0; k < 100000U; k++) {
+            Sim_Transact(frame, n, 0xFFFFU, 0.0);
+        }
+        printf("  %6u  %7.0f  %7.0f  %5.0f / %5.0f\n", bauds[i], uart.t35_bits * uart.bit_us,
+               (n + rsp.length) * SIM_CHAR_BITS * uart.bit_us,
+               (double)uart.isr_ns_sum / uart.frame_timeouts, (double)uart.isr_ns_min);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t fuzz = 20000;
+    const char* only = NULL;
+    int failed = 0;
+    int opt;
+
+    srand48(1);
+    while ((opt = getopt(argc, argv, "s:n:")) != -1) {
+        switch (opt) {
+        case 's': srand48(strtol(optarg, NULL, 0)); break;
+        case 'n': fuzz = (uint32_t)strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: modbus_master_sim [-s seed] [-n fuzz_requests] "
+                            "[basic|except|crc|framing|fuzz|timing]\n");
+            return 2;
+        }
+    }
+    if (optind < argc) {
+        only = argv[optind];
+    }
+
+    if (only == NULL || strcmp(only, "basic") == 0) {
+        failed |= Sim_Basic();
+    }
+    if (only == NULL || strcmp(only, "except") == 0) {
+        failed |= Sim_Except();
+    }
+    if (only == NULL || strcmp(only, "crc") == 0) {
+        failed |= Sim_Crc();
+    }
+    if (only == NULL || strcmp(only, "framing") == 0) {
+        failed |= Sim_Framing();
+    }
+    if (only == NULL || strcmp(only, "fuzz") == 0) {
+        failed |= Sim_Fuzz(fuzz);
+    }
+    if (only == NULL || strcmp(only, "timing") == 0) {
+        Sim_Timing();
+    }
+    return failed;
+}
@@ -0,0 +1,389 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    app_drv_mux.c
+ * @brief   单串口逻辑通道复用驱动
+ * @note    按通道拆分到各自的 FIFO，信用流控，发送端赤字轮询调度
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include "app_drv_mux.h"
+
+// 帧解析状态
+#define MUX_RX_SOF      0
+#define MUX_RX_HEADER   1
+#define MUX_RX_PAYLOAD  2
+
+// 缓冲区剩余空间不足以放下整帧时，最少拆出的负载长度
+#define MUX_MIN_SPLIT   (32U)
+
+static const uint16_t crc16_nibble_table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+static uint16_t MUX_CRC16(uint16_t crc, const uint8_t* data, uint16_t length)
+{
+    while (length-- > 0U) {
+        uint8_t byte = *data++;
+        crc = (uint16_t)((crc << 4) ^ crc16_nibble_table[(crc >> 12) ^ (byte >> 4)]);
+        crc = (uint16_t)((crc << 4) ^ crc16_nibble_table[(crc >> 12) ^ (byte & 0x0FU)]);
+    }
+    return crc;
+}
+
+static inline uint32_t MUX_GetU32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void MUX_PutU32(uint8_t* p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+static inline uint32_t MUX_Min(uint32_t a, uint32_t b)
+{
+    return (a < b) ? a : b;
+}
+
+/**
+ * @brief 计算通道当前的接收信用上限
+ */
+static uint32_t MUX_RxLimit(MUX_Channel* ch)
+{
+    return ch->rx_delivered - app_drv_fifo_length(ch->rx_fifo) + ch->rx_fifo->size;
+}
+
+/**
+ * @brief 补全帧头和 CRC，负载需已位于 frame[3] 处
+ * @return 整帧长度
+ */
+static uint16_t MUX_SealFrame(uint8_t* frame, uint8_t type, uint8_t channel, uint8_t length)
+{
+    uint16_t crc;
+
+    frame[0] = MUX_SOF;
+    frame[1] = (uint8_t)((type << 4) | channel);
+    frame[2] = length;
+    crc = MUX_CRC16(0xFFFFU, &frame[1], (uint16_t)(length + 2U));
+    frame[3U + length] = (uint8_t)(crc >> 8);
+    frame[4U + length] = (uint8_t)crc;
+    return (uint16_t)(length + MUX_FRAME_OVERHEAD);
+}
+
+/**
+ * @brief 启动发送填充完成的缓冲区（调用方保证发送空闲）
+ */
+static void MUX_StartTx(MUX_Context* ctx)
+{
+    uint8_t index = ctx->tx_fill;
+
+    if (ctx->send(ctx->send_user, ctx->tx_buf[index], ctx->tx_len[index]) == 0) {
+        ctx->tx_busy = 1;
+        ctx->tx_bytes += ctx->tx_len[index];
+        ctx->tx_fill = (uint8_t)(index ^ 1U);
+    }
+}
+
+/**
+ * @brief 按优先级和 DRR 调度填充一个发送缓冲区
+ * @return 填充的字节数
+ */
+static uint16_t MUX_FillTxBuffer(MUX_Context* ctx, uint8_t* buf)
+{
+    uint16_t pos = 0;
+    uint8_t idle = 0;
+
+    // 控制帧优先
+    for (uint8_t i = 0; i < MUX_CHANNEL_COUNT; i++) {
+        MUX_Channel* ch = &ctx->channels[i];
+
+        if (ch->credit_pending && pos + MUX_FRAME_OVERHEAD + 4U <= MUX_TX_BUFFER_SIZE) {
+            uint32_t limit = MUX_RxLimit(ch);
+
+            MUX_PutU32(&buf[pos + 3U], limit);
+            pos += MUX_SealFrame(&buf[pos], MUX_TYPE_CREDIT, i, 4U);
+            ch->rx_advertised = limit;
+            ch->credit_pending = 0;
+        }
+        if (ch->probe_pending && pos + MUX_FRAME_OVERHEAD + 4U <= MUX_TX_BUFFER_SIZE) {
+            MUX_PutU32(&buf[pos + 3U], ch->tx_sent);
+            pos += MUX_SealFrame(&buf[pos], MUX_TYPE_PROBE, i, 4U);
+            ch->probe_pending = 0;
+        }
+    }
+
+    // 数据帧：赤字轮询，连续一整轮以上没有通道可发时结束
+    while (idle < 2U * MUX_CHANNEL_COUNT) {
+        MUX_Channel* ch = &ctx->channels[ctx->tx_rr];
+        uint32_t pending = (ch->tx_fifo != NULL) ? app_drv_fifo_length(ch->tx_fifo) : 0U;
+        uint32_t n = MUX_Min(pending, ch->tx_limit - ch->tx_sent);
+
+        if (n == 0U) {
+            // 无数据或无信用的通道不积累配额
+            ch->deficit = 0;
+        } else {
+            if (ctx->tx_rr_fresh) {
+                ch->deficit += (uint32_t)ch->weight * MUX_MAX_PAYLOAD;
+                ctx->tx_rr_fresh = 0;
+            }
+            n = MUX_Min(MUX_Min(n, ch->deficit), MUX_MAX_PAYLOAD);
+        }
+
+        if (n == 0U) {
+            ctx->tx_rr = (uint8_t)((ctx->tx_rr + 1U) % MUX_CHANNEL_COUNT);
+            ctx->tx_rr_fresh = 1;
+            idle++;
+            continue;
+        }
+
+        uint16_t room = (uint16_t)(MUX_TX_BUFFER_SIZE - pos);
+        if (room < MUX_FRAME_OVERHEAD + n) {
+            if (room < MUX_FRAME_OVERHEAD + MUX_MIN_SPLIT) {
+                // 缓冲区已满，下次从当前通道继续
+                break;
+            }
+            n = room - MUX_FRAME_OVERHEAD;
+        }
+
+        uint16_t length = (uint16_t)n;
+        app_drv_fifo_read(ch->tx_fifo, &buf[pos + 3U], &length);
+        pos += MUX_SealFrame(&buf[pos], MUX_TYPE_DATA, ctx->tx_rr, (uint8_t)length);
+        ch->tx_sent += length;
+        ch->deficit -= length;
+        ctx->tx_payload_bytes += length;
+        idle = 0;
+    }
+
+    return pos;
+}
+
+/**
+ * @brief 处理一帧校验通过的数据
+ */
+static void MUX_Dispatch(MUX_Context* ctx, uint8_t type, uint8_t channel, uint8_t length)
+{
+    MUX_Channel* ch;
+
+    if (channel >= MUX_CHANNEL_COUNT) {
+        ctx->frame_error_count++;
+        return;
+    }
+    ch = &ctx->channels[channel];
+
+    switch (type) {
+    case MUX_TYPE_DATA:
+        if (ch->rx_fifo == NULL) {
+            ch->rx_dropped += length;
+            break;
+        }
+        {
+            uint16_t written = length;
+            if (app_drv_fifo_write(ch->rx_fifo, ctx->rx_payload, &written) != APP_DRV_FIFO_RESULT_SUCCESS) {
+                written = 0;
+            }
+            ch->rx_delivered += written;
+            ch->rx_dropped += (uint32_t)(length - written);
+        }
+        break;
+
+    case MUX_TYPE_CREDIT:
+        if (length == 4U) {
+            uint32_t limit = MUX_GetU32(ctx->rx_payload);
+            // 只接受前进的上限（计数器允许回绕）
+            if ((int32_t)(limit - ch->tx_limit) > 0) {
+                ch->tx_limit = limit;
+            }
+        }
+        break;
+
+    case MUX_TYPE_PROBE:
+        if (ch->rx_fifo != NULL && length == 4U) {
+            // 链路按序传输，探测帧之前发送的数据已全部处理，差值即为校验失败丢弃的字节
+            uint32_t lost = MUX_GetU32(ctx->rx_payload) - ch->rx_delivered;
+            if ((int32_t)lost > 0) {
+                ch->rx_delivered += lost;
+                ch->rx_dropped += lost;
+            }
+            ch->credit_pending = 1;
+        }
+        break;
+
+    default:
+        ctx->frame_error_count++;
+        break;
+    }
+}
+
+/**
+ * @brief 从链路接收 FIFO 解析帧
+ */
+static void MUX_ParseRx(MUX_Context* ctx, app_drv_fifo_t* link_rx)
+{
+    uint16_t length;
+
+    while (1) {
+        switch (ctx->rx_state) {
+        case MUX_RX_SOF:
+            if (app_drv_fifo_length(link_rx) == 0U) {
+                return;
+            }
+            if (app_drv_fifo_pop(link_rx) == MUX_SOF) {
+                ctx->rx_state = MUX_RX_HEADER;
+                ctx->rx_pos = 0;
+            }
+            break;
+
+        case MUX_RX_HEADER:
+            length = (uint16_t)(2U - ctx->rx_pos);
+            if (app_drv_fifo_read(link_rx, &ctx->rx_header[ctx->rx_pos], &length) != APP_DRV_FIFO_RESULT_SUCCESS) {
+                return;
+            }
+            ctx->rx_pos += length;
+            if (ctx->rx_pos < 2U) {
+                return;
+            }
+            ctx->rx_pos = 0;
+            ctx->rx_state = MUX_RX_PAYLOAD;
+            break;
+
+        case MUX_RX_PAYLOAD:
+        default: {
+            uint16_t total = (uint16_t)(ctx->rx_header[1] + 2U);
+            uint16_t crc;
+
+            length = (uint16_t)(total - ctx->rx_pos);
+            if (app_drv_fifo_read(link_rx, &ctx->rx_payload[ctx->rx_pos], &length) != APP_DRV_FIFO_RESULT_SUCCESS) {
+                return;
+            }
+            ctx->rx_pos += length;
+            if (ctx->rx_pos < total) {
+                return;
+            }
+
+            crc = MUX_CRC16(0xFFFFU, ctx->rx_header, 2U);
+            crc = MUX_CRC16(crc, ctx->rx_payload, ctx->rx_header[1]);
+            if (crc == (uint16_t)((ctx->rx_payload[total - 2U] << 8) | ctx->rx_payload[total - 1U])) {
+                MUX_Dispatch(ctx, (uint8_t)(ctx->rx_header[0] >> 4), (uint8_t)(ctx->rx_header[0] & 0x0FU), ctx->rx_header[1]);
+            } else {
+                ctx->frame_error_count++;
+            }
+            ctx->rx_state = MUX_RX_SOF;
+            break;
+        }
+        }
+    }
+}
+
+/**
+ * @brief 初始化复用上下文
+ * @param ctx 指向 MUX_Context 结构体的指针
+ * @param send 非阻塞发送函数
+ * @param user 传递给发送函数的用户参数
+ */
+void MUX_Init(MUX_Context* ctx, MUX_Send_Func send, void* user)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->send = send;
+    ctx->send_user = user;
+    ctx->tx_rr_fresh = 1;
+}
+
+/**
+ * @brief 配置逻辑通道
+ * @param ctx 指向 MUX_Context 结构体的指针
+ * @param channel 通道号
+ * @param rx_fifo 接收 FIFO，大小即为通告给对端的初始信用
+ * @param tx_fifo 发送 FIFO，应用写入后由 MUX_Process 调度发送
+ * @param weight 调度权重
+ */
+void MUX_ConfigChannel(MUX_Context* ctx, uint8_t channel,
+                       app_drv_fifo_t* rx_fifo, app_drv_fifo_t* tx_fifo, uint8_t weight)
+{
+    MUX_Channel* ch;
+
+    if (channel >= MUX_CHANNEL_COUNT) {
+        return;
+    }
+    ch = &ctx->channels[channel];
+    memset(ch, 0, sizeof(*ch));
+    ch->rx_fifo = rx_fifo;
+    ch->tx_fifo = tx_fifo;
+    ch->weight = (weight == 0U) ? 1U : weight;
+    // 上电后立即通告初始信用
+    ch->credit_pending = (rx_fifo != NULL) ? 1U : 0U;
+}
+
+/**
+ * @brief 复用层主处理函数
+ * @param ctx 指向 MUX_Context 结构体的指针
+ * @param link_rx 串口接收 FIFO（由 app_drv_serial_rx 写入）
+ * @param now_ms 当前时间（毫秒），用于信用探测
+ */
+void MUX_Process(MUX_Context* ctx, app_drv_fifo_t* link_rx, uint32_t now_ms)
+{
+    uint8_t fill;
+
+    MUX_ParseRx(ctx, link_rx);
+
+    // 更新信用
+    for (uint8_t i = 0; i < MUX_CHANNEL_COUNT; i++) {
+        MUX_Channel* ch = &ctx->channels[i];
+
+        if (ch->rx_fifo != NULL && MUX_RxLimit(ch) - ch->rx_advertised >= ch->rx_fifo->size / 4U) {
+            ch->credit_pending = 1;
+        }
+        if (ch->tx_fifo != NULL && ch->tx_limit == ch->tx_sent &&
+            app_drv_fifo_length(ch->tx_fifo) > 0U &&
+            now_ms - ch->last_probe_ms >= MUX_PROBE_INTERVAL_MS) {
+            ch->probe_pending = 1;
+            ch->last_probe_ms = now_ms;
+        }
+    }
+
+    // 填充空闲的发送缓冲区，发送完成中断只会切换到已填充的缓冲区
+    fill = ctx->tx_fill;
+    if (ctx->tx_len[fill] == 0U) {
+        ctx->tx_len[fill] = MUX_FillTxBuffer(ctx, ctx->tx_buf[fill]);
+    }
+
+    // 链路空闲时启动发送
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (!ctx->tx_busy && ctx->tx_len[ctx->tx_fill] > 0U) {
+        MUX_StartTx(ctx);
+    }
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief 发送完成处理
+ * @param ctx 指向 MUX_Context 结构体的指针
+ * @note 在中断上下文中调用，已填充的缓冲区立即接续发送
+ */
+void MUX_TxComplete(MUX_Context* ctx)
+{
+    ctx->tx_len[ctx->tx_fill ^ 1U] = 0;
+    ctx->tx_busy = 0;
+    if (ctx->tx_len[ctx->tx_fill] > 0U) {
+        MUX_StartTx(ctx);
+    }
+}
+
+/**
+ * @brief 获取通道当前可发送的信用字节数
+ */
+uint32_t MUX_GetTxCredit(MUX_Context* ctx, uint8_t channel)
+{
+    if (channel >= MUX_CHANNEL_COUNT) {
+        return 0;
+    }
+    return ctx->channels[channel].tx_limit - ctx->channels[channel].tx_sent;
+}
@@ -0,0 +1,34 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    main.h
+ * @brief   主机端替身：只提供 app_drv_mux.c 编译所需的中断屏蔽函数
+ * @note    模拟中发送完成"中断"与主循环在同一线程中顺序执行，屏蔽函数只保存状态
+ ******************************************************************************
+ */
+
+#ifndef HOST_MAIN_H_
+#define HOST_MAIN_H_
+
+#include <stdint.h>
+
+static uint32_t host_primask;
+
+static inline uint32_t __get_PRIMASK(void)
+{
+    return host_primask;
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+    host_primask = primask;
+}
+
+static inline void __disable_irq(void)
+{
+    host_primask = 1U;
+}
+
+#endif /* HOST_MAIN_H_ */
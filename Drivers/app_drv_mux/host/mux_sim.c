@@ -0,0 +1,466 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    mux_sim.c
+ * @brief   通道复用双端模拟（Linux / macOS）
+ * @note    两端都运行 app_drv_mux.c，同目录的 main.h 只提供中断屏蔽函数，编译：
+ *            cc -O2 -I. -I.. -I../../app_drv_fifo -o mux_sim mux_sim.c ../app_drv_mux.c ../../app_drv_fifo/app_drv_fifo.c -lm
+ *
+ *          链路为全双工 8N1 串口，每字节 10 位：发送函数启动"DMA"，字节按线速逐个进入对端的链路接收 FIFO，
+ *          最后一个字节的停止位结束时调用 MUX_TxComplete（发送完成中断），其中接续的缓冲区从同一时刻开始发送。
+ *          两端主循环每 poll_us 运行一次：应用写满批量通道的发送 FIFO、按设定速率读取接收 FIFO 并逐字节校验，
+ *          然后调用 MUX_Process。通道 0 为控制台（权重 1），每 100 ms 写入一行 24 字节；通道 1、2 为批量通道
+ *          （权重 4，接收 FIFO 即信用窗口，默认 2048 字节）。
+ *          利用率 = 预热 0.5 s 后接收端交付的通道数据字节数 / 线路容量 (baud / 10)，帧头、CRC 与 CREDIT/PROBE 控制帧都算开销。
+ *          控制台延迟从写入发送 FIFO 到对端收齐整行计，上限为正在发送与已填好的两个缓冲区、各批量通道一轮 DRR 配额
+ *          与一行的线路时间再加两次轮询；结束前超过该上限写入的行都必须收齐。用例：
+ *            bulk      A -> B 两个批量通道写满，B -> A 只有控制台；A -> B 利用率 >= 95%，控制台延迟有界
+ *            duplex    两个方向都有两个批量通道与控制台，各方向利用率 >= 95%（同时承载对向的 CREDIT 帧）
+ *            slow      B 端应用以 4000 B/s 读取批量通道：信用限速，无丢弃，读取方不缺数据，控制台延迟有界
+ *
+ *            mux_sim [-b baud] [-f fifo_bytes] [-p poll_us] [-t seconds] [bulk|duplex|slow]
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "app_drv_mux.h"
+
+#define SIM_CHAR_BITS           (10U)       // 起始 + 8 数据 + 停止
+#define SIM_CONSOLE             (0U)
+#define SIM_BULK_FIRST          (1U)
+#define SIM_BULK_COUNT          (2U)
+#define SIM_CHANNELS            (SIM_BULK_FIRST + SIM_BULK_COUNT)
+#define SIM_BULK_WEIGHT         (4U)
+#define SIM_LINE_LENGTH         (24U)
+#define SIM_LINE_PERIOD         (0.100)
+#define SIM_LINES_MAX           (4096U)
+#define SIM_WARMUP              (0.5)       // 统计利用率前的预热时间
+#define SIM_MIN_UTILISATION     (0.95)
+#define SIM_FIFO_MAX            (8192U)
+
+// 单向链路（发送 DMA + 线路）
+typedef struct {
+    MUX_Context* sender;
+    app_drv_fifo_t* peer_rx;    // 对端链路接收 FIFO
+    const uint8_t* data;
+    uint16_t length;
+    uint16_t delivered;         // 已进入对端 FIFO 的字节数
+    uint8_t active;
+    double start;
+    double busy;                // 线路占用时间
+    uint32_t overflow;          // 对端链路接收 FIFO 溢出字节数
+} Sim_Link;
+
+// 控制台行的写入时刻与延迟
+typedef struct {
+    double written[SIM_LINES_MAX];
+    uint32_t sent;              // 已写入的行数
+    uint32_t skipped;           // 发送 FIFO 放不下而跳过的行数
+    uint32_t received_bytes;
+    uint32_t mismatch;
+    double latency_max;
+    double latency_sum;
+} Sim_Console;
+
+// 一端（设备或主机）
+typedef struct {
+    const char* name;
+    MUX_Context mux;
+    Sim_Link link;              // 本端发出的链路
+    uint8_t link_rx_buf[1024];
+    app_drv_fifo_t link_rx;
+    uint8_t rx_buf[SIM_CHANNELS][SIM_FIFO_MAX];
+    uint8_t tx_buf[SIM_CHANNELS][1024];
+    app_drv_fifo_t rx[SIM_CHANNELS];
+    app_drv_fifo_t tx[SIM_CHANNELS];
+    uint8_t bulk_tx;            // 1：批量通道保持写满
+    double drain_rate;          // 批量通道读取速率 B/s，0 表示不限
+    double drain_budget;
+    uint32_t bulk_written[SIM_CHANNELS];
+    uint32_t bulk_read[SIM_CHANNELS];
+    uint32_t bulk_mismatch;
+    Sim_Console console;        // 本端写入、对端接收的控制台行
+    uint32_t delivered_mark;    // 预热结束时对端已交付的字节数
+} Sim_End;
+
+static double sim_baud = 115200.0;
+static double sim_poll = 100e-6;
+static double sim_seconds = 10.0;
+static uint16_t sim_fifo = 2048;         // 批量通道接收 FIFO 大小，即通告的信用窗口
+static double sim_now;
+static Sim_End end_a, end_b;
+
+/* ----------------------------------------------------------------------------
+ * 链路
+ * ------------------------------------------------------------------------- */
+
+static double Sim_ByteTime(void)
+{
+    return SIM_CHAR_BITS / sim_baud;
+}
+
+static int Sim_Send(void* user, const uint8_t* data, uint16_t length)
+{
+    Sim_Link* link = (Sim_Link*)user;
+
+    if (link->active) {
+        return -1;
+    }
+    link->data = data;
+    link->length = length;
+    link->delivered = 0;
+    link->start = sim_now;
+    link->active = 1;
+    return 0;
+}
+
+/**
+ * @brief 推进链路到时刻 t：停止位已结束的字节进入对端 FIFO，发送完成时调用 MUX_TxComplete
+ */
+static void Sim_LinkAdvance(Sim_Link* link, double t)
+{
+    double byte_time = Sim_ByteTime();
+
+    while (link->active) {
+        double due = floor((t - link->start) / byte_time + 1e-9);
+        uint16_t count = (due >= link->length) ? link->length : (uint16_t)due;
+
+        while (link->delivered < count) {
+            if (app_drv_fifo_is_full(link->peer_rx)) {
+                link->overflow++;
+            } else {
+                app_drv_fifo_push(link->peer_rx, link->data[link->delivered]);
+            }
+            link->delivered++;
+        }
+        if (link->delivered < link->length) {
+            return;
+        }
+
+        // 发送完成中断：接续的缓冲区从最后一个停止位结束时开始发送
+        sim_now = link->start + link->length * byte_time;
+        link->busy += link->length * byte_time;
+        link->active = 0;
+        MUX_TxComplete(link->sender);
+    }
+}
+
+/* ----------------------------------------------------------------------------
+ * 应用
+ * ------------------------------------------------------------------------- */
+
+static uint8_t Sim_Pattern(uint8_t channel, uint32_t offset)
+{
+    uint32_t x = (offset + ((uint32_t)channel << 24)) * 0x9E3779B1U;
+
+    return (uint8_t)((x ^ (x >> 15)) >> 24);
+}
+
+static void Sim_EndInit(Sim_End* end, const char* name, Sim_End* peer)
+{
+    memset(end, 0, sizeof(*end));
+    end->name = name;
+    app_drv_fifo_init(&end->link_rx, end->link_rx_buf, sizeof(end->link_rx_buf));
+    MUX_Init(&end->mux, Sim_Send, &end->link);
+    end->link.sender = &end->mux;
+    end->link.peer_rx = &peer->link_rx;
+    for (uint8_t i = 0; i < SIM_CHANNELS; i++) {
+        app_drv_fifo_init(&end->rx[i], end->rx_buf[i], (i == SIM_CONSOLE) ? 256U : sim_fifo);
+        app_drv_fifo_init(&end->tx[i], end->tx_buf[i], (i == SIM_CONSOLE) ? 256U : sizeof(end->tx_buf[i]));
+        MUX_ConfigChannel(&end->mux, i, &end->rx[i], &end->tx[i], (i == SIM_CONSOLE) ? 1U : SIM_BULK_WEIGHT);
+    }
+}
+
+/**
+ * @brief 本端应用：写入控制台行与批量数据
+ */
+static void Sim_AppWrite(Sim_End* end, double t)
+{
+    Sim_Console* con = &end->console;
+    uint8_t chunk[256];
+
+    if (t >= (con->sent + con->skipped) * SIM_LINE_PERIOD && con->sent + con->skipped < SIM_LINES_MAX) {
+        uint16_t length = SIM_LINE_LENGTH;
+
+        if (end->tx[SIM_CONSOLE].size - app_drv_fifo_length(&end->tx[SIM_CONSOLE]) < (uint16_t)SIM_LINE_LENGTH) {
+            con->skipped++;
+        } else {
+            for (uint16_t i = 0; i < SIM_LINE_LENGTH; i++) {
+                chunk[i] = Sim_Pattern(SIM_CONSOLE, con->sent * SIM_LINE_LENGTH + i);
+            }
+            app_drv_fifo_write(&end->tx[SIM_CONSOLE], chunk, &length);
+            con->written[con->sent++] = t;
+        }
+    }
+
+    for (uint8_t ch = SIM_BULK_FIRST; end->bulk_tx && ch < SIM_CHANNELS; ch++) {
+        uint16_t room = (uint16_t)(end->tx[ch].size - app_drv_fifo_length(&end->tx[ch]));
+
+        while (room > 0U) {
+            uint16_t length = (room < sizeof(chunk)) ? room : (uint16_t)sizeof(chunk);
+
+            for (uint16_t i = 0; i < length; i++) {
+                chunk[i] = Sim_Pattern(ch, end->bulk_written[ch] + i);
+            }
+            app_drv_fifo_write(&end->tx[ch], chunk, &length);
+            end->bulk_written[ch] += length;
+            room -= length;
+        }
+    }
+}
+
+/**
+ * @brief 本端应用：读取对端发来的控制台行与批量数据并校验
+ */
+static void Sim_AppRead(Sim_End* end, Sim_End* peer, double t)
+{
+    Sim_Console* con = &peer->console;
+    uint8_t chunk[256];
+    uint16_t length;
+
+    length = sizeof(chunk);
+    while (app_drv_fifo_read(&end->rx[SIM_CONSOLE], chunk, &length) == APP_DRV_FIFO_RESULT_SUCCESS && length > 0U) {
+        for (uint16_t i = 0; i < length; i++) {
+            con->mismatch += (chunk[i] != Sim_Pattern(SIM_CONSOLE, con->received_bytes));
+            con->received_bytes++;
+            if (con->received_bytes % SIM_LINE_LENGTH == 0U) {
+                double latency = t - con->written[con->received_bytes / SIM_LINE_LENGTH - 1U];
+
+                con->latency_sum += latency;
+                if (latency > con->latency_max) {
+                    con->latency_max = latency;
+                }
+            }
+        }
+        length = sizeof(chunk);
+    }
+
+    if (end->drain_rate > 0.0) {
+        end->drain_budget += end->drain_rate * sim_poll;
+    }
+    for (uint8_t ch = SIM_BULK_FIRST; ch < SIM_CHANNELS; ch++) {
+        length = sizeof(chunk);
+        if (end->drain_rate > 0.0) {
+            // 限速读取：预算按通道轮流使用
+            if (end->drain_budget < 1.0) {
+                break;
+            }
+            if (length > end->drain_budget) {
+                length = (uint16_t)end->drain_budget;
+            }
+        }
+        if (app_drv_fifo_read(&end->rx[ch], chunk, &length) != APP_DRV_FIFO_RESULT_SUCCESS) {
+            continue;
+        }
+        for (uint16_t i = 0; i < length; i++) {
+            end->bulk_mismatch += (chunk[i] != Sim_Pattern(ch, end->bulk_read[ch] + i));
+        }
+        end->bulk_read[ch] += length;
+        if (end->drain_rate > 0.0) {
+            end->drain_budget -= length;
+        }
+    }
+}
+
+static uint32_t Sim_Delivered(Sim_End* receiver)
+{
+    uint32_t total = 0;
+
+    for (uint8_t i = 0; i < SIM_CHANNELS; i++) {
+        total += receiver->mux.channels[i].rx_delivered;
+    }
+    return total;
+}
+
+static uint32_t Sim_Dropped(Sim_End* receiver)
+{
+    uint32_t total = 0;
+
+    for (uint8_t i = 0; i < SIM_CHANNELS; i++) {
+        total += receiver->mux.channels[i].rx_dropped;
+    }
+    return total;
+}
+
+/**
+ * @brief 运行两端直到 sim_seconds
+ */
+static void Sim_Run(void)
+{
+    uint64_t steps = (uint64_t)(sim_seconds / sim_poll);
+
+    for (uint64_t k = 0; k <= steps; k++) {
+        double t = k * sim_poll;
+
+        if (k == (uint64_t)(SIM_WARMUP / sim_poll)) {
+            end_a.delivered_mark = Sim_Delivered(&end_b);
+            end_b.delivered_mark = Sim_Delivered(&end_a);
+        }
+        Sim_LinkAdvance(&end_a.link, t);
+        Sim_LinkAdvance(&end_b.link, t);
+        sim_now = t;
+
+        Sim_AppWrite(&end_a, t);
+        Sim_AppWrite(&end_b, t);
+        Sim_AppRead(&end_a, &end_b, t);
+        Sim_AppRead(&end_b, &end_a, t);
+        MUX_Process(&end_a.mux, &end_a.link_rx, (uint32_t)(t * 1000.0));
+        MUX_Process(&end_b.mux, &end_b.link_rx, (uint32_t)(t * 1000.0));
+    }
+}
+
+/**
+ * @brief 检查一个方向 (sender -> receiver) 的结果
+ * @param min_utilisation 利用率下限，0 表示不检查
+ */
+static int Sim_Report(Sim_End* sender, Sim_End* receiver, double min_utilisation)
+{
+    Sim_Console* con = &sender->console;
+    double window = sim_seconds - SIM_WARMUP;
+    double capacity = sim_baud / SIM_CHAR_BITS;
+    double utilisation = (Sim_Delivered(receiver) - sender->delivered_mark) / (window * capacity);
+    // 控制台最多等待：正在发送与已填好的两个缓冲区、各批量通道一轮的配额（含帧开销与控制帧）、本行，再加两次轮询
+    double bound = (2.0 * MUX_TX_BUFFER_SIZE
+                    + SIM_BULK_COUNT * SIM_BULK_WEIGHT * (MUX_MAX_PAYLOAD + 2.0 * MUX_FRAME_OVERHEAD)
+                    + 2.0 * SIM_CHANNELS * (MUX_FRAME_OVERHEAD + 4.0)
+                    + SIM_LINE_LENGTH + MUX_FRAME_OVERHEAD) * Sim_ByteTime() + 2.0 * sim_poll;
+    uint32_t lines = con->received_bytes / SIM_LINE_LENGTH;
+    uint32_t due = 0;
+    uint32_t bulk = 0;
+    int ok = 1;
+
+    for (uint8_t ch = SIM_BULK_FIRST; ch < SIM_CHANNELS; ch++) {
+        bulk += receiver->bulk_read[ch];
+    }
+
+    ok &= (min_utilisation == 0.0 || utilisation >= min_utilisation);
+    // 结束前超过延迟上限写入的行都应已收齐
+    while (due < con->sent && con->written[due] + bound <= sim_seconds) {
+        due++;
+    }
+    ok &= (lines >= due && con->skipped == 0U && con->mismatch == 0U && con->latency_max <= bound);
+    ok &= (receiver->bulk_mismatch == 0U && Sim_Dropped(receiver) == 0U && sender->link.overflow == 0U);
+    ok &= (receiver->mux.frame_error_count == 0U);
+
+    printf("  %s -> %s: %.1f%% of %.0f B/s delivered, line busy %.1f%%, bulk %u bytes read, "
+           "console %u/%u lines, latency mean %.1f ms max %.1f ms (bound %.1f ms)\n",
+           sender->name, receiver->name, utilisation * 100.0, capacity, sender->link.busy / sim_seconds * 100.0,
+           bulk, lines, con->sent, (lines != 0U) ? con->latency_sum / lines * 1000.0 : 0.0,
+           con->latency_max * 1000.0, bound * 1000.0);
+    if (!ok) {
+        printf("    skipped %u, console mismatch %u, bulk mismatch %u, dropped %u, link overflow %u, frame errors %u\n",
+               con->skipped, con->mismatch, receiver->bulk_mismatch, Sim_Dropped(receiver), sender->link.overflow,
+               receiver->mux.frame_error_count);
+    }
+    return ok;
+}
+
+static void Sim_Open(void)
+{
+    Sim_EndInit(&end_a, "A", &end_b);
+    Sim_EndInit(&end_b, "B", &end_a);
+    sim_now = 0.0;
+}
+
+/* ----------------------------------------------------------------------------
+ * 用例
+ * ------------------------------------------------------------------------- */
+
+static int Sim_Bulk(void)
+{
+    int ok = 1;
+
+    Sim_Open();
+    end_a.bulk_tx = 1;
+    Sim_Run();
+    printf("bulk: %.0f baud, %.1f s, two bulk channels A -> B, console both ways\n", sim_baud, sim_seconds);
+    ok &= Sim_Report(&end_a, &end_b, SIM_MIN_UTILISATION);
+    ok &= Sim_Report(&end_b, &end_a, 0.0);
+    printf("bulk: -> %s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+static int Sim_Duplex(void)
+{
+    int ok = 1;
+
+    Sim_Open();
+    end_a.bulk_tx = 1;
+    end_b.bulk_tx = 1;
+    Sim_Run();
+    printf("duplex: %.0f baud, %.1f s, two bulk channels and console each way\n", sim_baud, sim_seconds);
+    ok &= Sim_Report(&end_a, &end_b, SIM_MIN_UTILISATION);
+    ok &= Sim_Report(&end_b, &end_a, SIM_MIN_UTILISATION);
+    printf("duplex: -> %s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+static int Sim_Slow(void)
+{
+    const double rate = 4000.0;
+    uint32_t read = 0;
+    int ok = 1;
+
+    Sim_Open();
+    end_a.bulk_tx = 1;
+    end_b.drain_rate = rate;
+    Sim_Run();
+    for (uint8_t ch = SIM_BULK_FIRST; ch < SIM_CHANNELS; ch++) {
+        read += end_b.bulk_read[ch];
+    }
+    printf("slow: %.0f baud, B reads bulk at %.0f B/s, %u bytes read in %.1f s\n", sim_baud, rate, read, sim_seconds);
+    // 发送方不超出信用（接收端无丢弃），信用及时归还，读取方从不等待数据
+    ok &= Sim_Report(&end_a, &end_b, 0.0);
+    ok &= (read >= 0.99 * rate * sim_seconds);
+    printf("slow: -> %s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char* argv[])
+{
+    const char* only = NULL;
+    int failed = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "b:f:p:t:")) != -1) {
+        switch (opt) {
+        case 'b': sim_baud = strtod(optarg, NULL); break;
+        case 'f': sim_fifo = (uint16_t)strtoul(optarg, NULL, 0); break;
+        case 'p': sim_poll = strtod(optarg, NULL) * 1e-6; break;
+        case 't': sim_seconds = strtod(optarg, NULL); break;
+        default:
+            fprintf(stderr, "usage: mux_sim [-b baud] [-f fifo_bytes] [-p poll_us] [-t seconds] [bulk|duplex|slow]\n");
+            return 2;
+        }
+    }
+    if (sim_fifo < 256U || sim_fifo > SIM_FIFO_MAX || (sim_fifo & (sim_fifo - 1U)) != 0U) {
+        fprintf(stderr, "fifo_bytes must be a power of two from 256 to %u\n", SIM_FIFO_MAX);
+        return 2;
+    }
+    if (optind < argc) {
+        only = argv[optind];
+    }
+    if (sim_seconds * 1.0 / SIM_LINE_PERIOD >= SIM_LINES_MAX || sim_seconds <= SIM_WARMUP) {
+        fprintf(stderr, "seconds must be between %.1f and %.0f\n", SIM_WARMUP, SIM_LINES_MAX * SIM_LINE_PERIOD);
+        return 2;
+    }
+
+    if (only == NULL || strcmp(only, "bulk") == 0) {
+        failed |= Sim_Bulk();
+    }
+    if (only == NULL || strcmp(only, "duplex") == 0) {
+        failed |= Sim_Duplex();
+    }
+    if (only == NULL || strcmp(only, "slow") == 0) {
+        failed |= Sim_Slow();
+    }
+    return failed;
+}
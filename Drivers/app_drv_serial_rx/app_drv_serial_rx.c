@@ -27,11 +27,29 @@ void USART_Rx_DMA_Init(USART_DMA_Context* ctx, UART_HandleTypeDef* huart, DMA_Ha
     ctx->last_count = 0;
     ctx->queue_write = NULL;
     ctx->queue_available = NULL;
+    ctx->frame_timeout = NULL;
+    ctx->frame_timeout_user = NULL;
+    ctx->rx_ready = NULL;
+    ctx->rx_ready_user = NULL;
+    ctx->span_pending = 0;
+    ctx->span_reset = 0;
+    ctx->flow_mode = USART_FLOW_NONE;
+    ctx->flow_stopped = 0;
+    ctx->flow_rts_port = NULL;
+    ctx->flow_send = NULL;
+    ctx->flow_stop_count = 0;
+    ctx->ts_counter = NULL;
+    ctx->ts_dropped = 0;
+    ctx->autobaud = USART_AUTOBAUD_OFF;
+    ctx->autobaud_errors = 0;
 
     // 初始化统计信息
     ctx->total_received_bytes = 0;
     ctx->total_dropped_bytes = 0;
     ctx->queue_overflow_count = 0;
+    ctx->isr_count = 0;
+    ctx->isr_cycles_last = 0;
+    ctx->isr_cycles_max = 0;
     
     // 配置 USART IDLE 中断
     __HAL_UART_CLEAR_IDLEFLAG(ctx->huart);
@@ -61,20 +79,237 @@ void USART_RegisterQueueOps(USART_DMA_Context* ctx,
 }
 
 /**
- * @brief 处理 USART DMA 中断
+ * @brief 使能接收超时（帧结束）检测
  * @param ctx 指向 USART_DMA_Context 结构体的指针
- * @note 在 DMA 传输完成/中断回调中调用，用于处理接收到的数据
+ * @param bit_times 超时时间，单位为位时间（从最后一个字节的停止位开始计时）
+ * @param callback 帧结束回调函数，在中断中调用
+ * @param user 传递给回调函数的用户参数
+ * @note IDLE 只能检测 1 个字符时间的空闲，用于 Modbus t3.5 等更长的帧间隔时使用硬件接收超时；
+ *       回调前会先把 DMA 缓冲区中剩余的数据写入队列，回调中可直接处理完整的帧
  */
-void USART_Rx_DMA_IRQHandler_Process(USART_DMA_Context* ctx)
+void USART_Rx_DMA_EnableFrameTimeout(USART_DMA_Context* ctx,
+                                     uint32_t bit_times,
+                                     USART_Frame_Timeout_Func callback,
+                                     void* user)
+{
+    ctx->frame_timeout = callback;
+    ctx->frame_timeout_user = user;
+
+    HAL_UART_ReceiverTimeout_Config(ctx->huart, bit_times);
+    HAL_UART_EnableReceiverTimeout(ctx->huart);
+
+    // HAL_UART_IRQHandler 会把 RTOF 当作错误并终止 DMA 接收，因此必须先在本驱动中清除
+    __HAL_UART_CLEAR_FLAG(ctx->huart, UART_CLEAR_RTOF);
+    __HAL_UART_ENABLE_IT(ctx->huart, UART_IT_RTO);
+}
+
+/**
+ * @brief 使能零拷贝模式
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @param ready 新数据到达回调函数，在中断中调用
+ * @param user 传递给回调函数的用户参数
+ * @note 接收数据不再写入用户队列，而是留在 DMA 缓冲区中，由使用者通过 USART_Rx_DMA_PeekSpan
+ *       直接取用（如作为另一个串口 DMA 发送的源地址），处理完后 USART_Rx_DMA_ConsumeSpan 释放；
+ *       DMA 缓冲区即为接收队列，未释放的数据被 DMA 绕圈覆盖时计入丢弃并重新同步
+ */
+void USART_Rx_DMA_EnableSpan(USART_DMA_Context* ctx, USART_Rx_Ready_Func ready, void* user)
+{
+    ctx->span_pending = 0;
+    ctx->span_reset = 0;
+    ctx->last_count = USART_DMA_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(ctx->hdma);
+    ctx->rx_ready_user = user;
+    ctx->rx_ready = ready;
+}
+
+/**
+ * @brief 零拷贝模式：按 DMA 当前位置更新未释放字节数并检查溢出
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @return 新到达的字节数
+ */
+static uint16_t USART_Rx_DMA_SpanUpdate(USART_DMA_Context* ctx)
+{
+    uint32_t thisCount = USART_DMA_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(ctx->hdma);
+    uint16_t pending = (uint16_t)((thisCount + USART_DMA_BUFFER_SIZE - ctx->last_count) % USART_DMA_BUFFER_SIZE);
+    uint16_t arrived;
+
+    if (pending >= ctx->span_pending) {
+        arrived = pending - ctx->span_pending;
+        ctx->span_pending = pending;
+        ctx->total_received_bytes += arrived;
+        return arrived;
+    }
+
+    // 未释放字节数只会因释放而减少，变小说明 DMA 已绕过一整圈覆盖了未释放的数据，
+    // 缓冲区中的数据全部作废，从 DMA 当前位置重新开始（HT/TC 中断保证每半圈至少检查一次）
+    arrived = (uint16_t)(USART_DMA_BUFFER_SIZE + pending - ctx->span_pending);
+    ctx->total_received_bytes += arrived;
+    ctx->total_dropped_bytes += USART_DMA_BUFFER_SIZE + pending;
+    ctx->queue_overflow_count++;
+    ctx->last_count = thisCount;
+    ctx->span_pending = 0;
+    ctx->span_reset = 1;
+    return 0;
+}
+
+/**
+ * @brief 零拷贝模式：获取最早未释放的连续数据段
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @param data 输出参数，数据段在 DMA 缓冲区中的起始地址
+ * @return 数据段长度，数据环绕缓冲区末尾时只返回到末尾的部分
+ * @note 在中断中调用，或在主循环中关中断调用；取用下一段前须先释放上一段
+ */
+uint16_t USART_Rx_DMA_PeekSpan(USART_DMA_Context* ctx, uint8_t** data)
+{
+    uint16_t length;
+
+    USART_Rx_DMA_SpanUpdate(ctx);
+    ctx->span_reset = 0;
+
+    length = ctx->span_pending;
+    if (length > USART_DMA_BUFFER_SIZE - ctx->last_count) {
+        length = USART_DMA_BUFFER_SIZE - ctx->last_count;
+    }
+    *data = &ctx->dma_buffer[ctx->last_count];
+    return length;
+}
+
+/**
+ * @brief 零拷贝模式：释放已处理的数据
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @param length 释放的字节数（不超过 USART_Rx_DMA_PeekSpan 返回的长度）
+ * @note 取用后发生过溢出重新同步时，手中的数据段已作废，本次释放被忽略
+ */
+void USART_Rx_DMA_ConsumeSpan(USART_DMA_Context* ctx, uint16_t length)
+{
+    if (ctx->span_reset) {
+        ctx->span_reset = 0;
+        return;
+    }
+    if (length > ctx->span_pending) {
+        length = ctx->span_pending;
+    }
+    ctx->last_count = (ctx->last_count + length) % USART_DMA_BUFFER_SIZE;
+    ctx->span_pending -= length;
+}
+
+/**
+ * @brief 默认 XON/XOFF 发送：发送数据寄存器空时直接写入
+ * @note 只适用于发送端不使用 DMA 的串口，否则会与 DMA 写 TDR 冲突
+ */
+static int USART_Rx_DMA_FlowSendDirect(void* user, uint8_t ch)
 {
+    UART_HandleTypeDef* huart = (UART_HandleTypeDef*)user;
+
+    if (RESET == __HAL_UART_GET_FLAG(huart, UART_FLAG_TXE)) {
+        return -1;
+    }
+    huart->Instance->TDR = ch;
+    return 0;
+}
+
+/**
+ * @brief 按用户队列可用空间和 DMA 缓冲区中的积压更新流控状态
+ */
+static void USART_Rx_DMA_FlowUpdate(USART_DMA_Context* ctx)
+{
+    uint32_t available = ctx->queue_available(ctx->user_queue);
+    uint8_t stop;
+
+    // 积压未清空前不恢复，迟滞区间内保持原状态
+    if (ctx->span_pending > 0U) {
+        stop = 1;
+    } else if (ctx->flow_stopped) {
+        stop = (available < ctx->flow_resume_free) ? 1U : 0U;
+    } else {
+        stop = (available < ctx->flow_stop_free) ? 1U : 0U;
+    }
+    if (stop == ctx->flow_stopped) {
+        return;
+    }
+
+    switch (ctx->flow_mode) {
+    case USART_FLOW_RTS_GPIO:
+        HAL_GPIO_WritePin(ctx->flow_rts_port, ctx->flow_rts_pin, stop ? GPIO_PIN_SET : GPIO_PIN_RESET);
+        break;
+    case USART_FLOW_RTS_HW:
+        // DMA 不再读取 RDR，RDR 满后硬件在当前字符结束时撤销 RTS
+        if (stop) {
+            ATOMIC_CLEAR_BIT(ctx->huart->Instance->CR3, USART_CR3_DMAR);
+        } else {
+            ATOMIC_SET_BIT(ctx->huart->Instance->CR3, USART_CR3_DMAR);
+        }
+        break;
+    default:
+        if (ctx->flow_send(ctx->flow_send_user, stop ? USART_XOFF : USART_XON) != 0) {
+            // 发送端忙，下次中断或 USART_Rx_DMA_FlowPoll 时重试
+            return;
+        }
+        break;
+    }
+    ctx->flow_stopped = stop;
+    if (stop) {
+        ctx->flow_stop_count++;
+    }
+}
+
+/**
+ * @brief 流控模式：把 DMA 缓冲区中的数据写入用户队列，写不下的留在缓冲区中
+ * @note 按 span_pending 计数积压，只有 DMA 绕圈覆盖了未写入的数据才计入丢弃
+ */
+static void USART_Rx_DMA_TransferHeld(USART_DMA_Context* ctx)
+{
+    USART_Rx_DMA_SpanUpdate(ctx);
+    ctx->span_reset = 0;
+
+    while (ctx->span_pending > 0U) {
+        uint16_t length = ctx->span_pending;
+        uint32_t available = ctx->queue_available(ctx->user_queue);
+
+        if (length > USART_DMA_BUFFER_SIZE - ctx->last_count) {
+            length = USART_DMA_BUFFER_SIZE - ctx->last_count;
+        }
+        if (length > available) {
+            length = (uint16_t)available;
+        }
+        if (length == 0U) {
+            break;
+        }
+        length = (uint16_t)ctx->queue_write(ctx->user_queue, &ctx->dma_buffer[ctx->last_count], length);
+        if (length == 0U) {
+            break;
+        }
+        ctx->last_count = (ctx->last_count + length) % USART_DMA_BUFFER_SIZE;
+        ctx->span_pending -= length;
+    }
+
+    USART_Rx_DMA_FlowUpdate(ctx);
+}
+
+/**
+ * @brief 将 DMA 缓冲区中的新数据写入用户队列
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ */
+static void USART_Rx_DMA_Transfer(USART_DMA_Context* ctx)
+{
+    // 零拷贝模式：数据留在 DMA 缓冲区，只通知使用者
+    if (ctx->rx_ready != NULL) {
+        if (USART_Rx_DMA_SpanUpdate(ctx) > 0U) {
+            ctx->rx_ready(ctx->rx_ready_user);
+        }
+        return;
+    }
+
+    // 流控模式：队列写不下的数据不丢弃
+    if (ctx->flow_mode != USART_FLOW_NONE) {
+        USART_Rx_DMA_TransferHeld(ctx);
+        return;
+    }
+
     // 获取当前缓冲区索引并计算接收到的数据长度
     uint32_t thisCount = USART_DMA_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(ctx->hdma);
 
     if (ctx->last_count == thisCount) {
-        // 没有新数据，只清除 IDLE 标志
-        if (RESET != __HAL_UART_GET_FLAG(ctx->huart, UART_FLAG_IDLE)) {
-            __HAL_UART_CLEAR_IDLEFLAG(ctx->huart);
-        }
+        // 没有新数据
         return;
     }
 
@@ -94,9 +329,6 @@ void USART_Rx_DMA_IRQHandler_Process(USART_DMA_Context* ctx)
     // 如果没有注册队列操作函数，只更新 last_count
     if (ctx->queue_write == NULL || ctx->queue_available == NULL) {
         ctx->last_count = thisCount;
-        if (RESET != __HAL_UART_GET_FLAG(ctx->huart, UART_FLAG_IDLE)) {
-            __HAL_UART_CLEAR_IDLEFLAG(ctx->huart);
-        }
         return;
     }
 
@@ -153,11 +385,391 @@ void USART_Rx_DMA_IRQHandler_Process(USART_DMA_Context* ctx)
         ctx->total_dropped_bytes += (total_data_len - bytes_written);
         ctx->queue_overflow_count++;
     }
+}
+
+/**
+ * @brief 设置 GPIO RTS 引脚
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @param port GPIO 端口，引脚须已配置为推挽输出
+ * @param pin GPIO 引脚
+ */
+void USART_Rx_DMA_SetRtsPin(USART_DMA_Context* ctx, GPIO_TypeDef* port, uint16_t pin)
+{
+    ctx->flow_rts_port = port;
+    ctx->flow_rts_pin = pin;
+}
+
+/**
+ * @brief 设置 XON/XOFF 发送函数
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @param send 发送函数，在中断中调用，不能阻塞；返回非 0 时稍后重试
+ * @param user 传递给发送函数的用户参数
+ */
+void USART_Rx_DMA_SetFlowSender(USART_DMA_Context* ctx, USART_Flow_Send_Func send, void* user)
+{
+    ctx->flow_send = send;
+    ctx->flow_send_user = user;
+}
+
+/**
+ * @brief 使能接收流控
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @param mode USART_FLOW_RTS_GPIO / USART_FLOW_RTS_HW / USART_FLOW_XONXOFF，USART_FLOW_NONE 关闭
+ * @param stop_free 用户队列可用空间低于该值时要求对端停止（高水位）
+ * @param resume_free 可用空间恢复到该值以上时允许对端发送（低水位）
+ * @note GPIO RTS / XON/XOFF：stop_free 加上 DMA 缓冲区大小须能容纳对端的停止延迟
+ *       （GPIO RTS 为对端发送 FIFO 深度，XOFF 还要加上一个往返）。
+ *       硬件 RTS：DMA 停止后只有 RDR 能缓存一个字节，对端须在当前字符结束时停止（硬件 CTS），
+ *       带发送 FIFO 的对端多发的字节覆盖 RDR 而丢失，不计入 total_dropped_bytes，这种对端改用 GPIO RTS。
+ *       停止期间写不下的数据留在 DMA 缓冲区中，total_dropped_bytes 只统计 DMA 绕圈覆盖的数据，
+ *       对端遵守流控时保持为 0（主机端验证见 app_drv_bridge/host/flow_sim.c）
+ */
+void USART_Rx_DMA_EnableFlowControl(USART_DMA_Context* ctx, uint8_t mode, uint16_t stop_free, uint16_t resume_free)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    USART_Rx_DMA_Transfer(ctx);
+
+    // 从 DMA 当前位置开始按积压计数（已在流控模式时保留积压）
+    if (ctx->flow_mode == USART_FLOW_NONE) {
+        ctx->last_count = USART_DMA_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(ctx->hdma);
+        ctx->span_pending = 0;
+        ctx->span_reset = 0;
+    }
+
+    // 解除原方式的停止状态
+    if (ctx->flow_mode == USART_FLOW_RTS_HW) {
+        ATOMIC_SET_BIT(ctx->huart->Instance->CR3, USART_CR3_DMAR);
+    } else if (ctx->flow_mode == USART_FLOW_RTS_GPIO) {
+        HAL_GPIO_WritePin(ctx->flow_rts_port, ctx->flow_rts_pin, GPIO_PIN_RESET);
+    }
+    ctx->flow_stop_free = stop_free;
+    ctx->flow_resume_free = (resume_free > stop_free) ? resume_free : stop_free;
+    ctx->flow_stopped = 0;
+
+    if (mode == USART_FLOW_RTS_GPIO) {
+        HAL_GPIO_WritePin(ctx->flow_rts_port, ctx->flow_rts_pin, GPIO_PIN_RESET);
+    } else if (mode == USART_FLOW_RTS_HW) {
+        // 对端不理会 RTS 时新字节覆盖 RDR 而不置 ORE，否则 HAL_UART_IRQHandler 会终止 DMA 接收；
+        // OVRDIS 只能在 UE = 0 时修改
+        __HAL_UART_DISABLE(ctx->huart);
+        SET_BIT(ctx->huart->Instance->CR3, USART_CR3_OVRDIS);
+        __HAL_UART_ENABLE(ctx->huart);
+    } else if (mode == USART_FLOW_XONXOFF && ctx->flow_send == NULL) {
+        ctx->flow_send = USART_Rx_DMA_FlowSendDirect;
+        ctx->flow_send_user = ctx->huart;
+    }
+    ctx->flow_mode = (ctx->queue_write != NULL && ctx->queue_available != NULL) ? mode : USART_FLOW_NONE;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief 流控主循环处理
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @note 对端停止后不再有接收中断，留在 DMA 缓冲区中的数据和恢复发送都由这里推动
+ */
+void USART_Rx_DMA_FlowPoll(USART_DMA_Context* ctx)
+{
+    uint32_t primask;
+
+    if (ctx->flow_mode == USART_FLOW_NONE) {
+        return;
+    }
+    primask = __get_PRIMASK();
+    __disable_irq();
+    USART_Rx_DMA_TransferHeld(ctx);
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief 使能接收时间戳
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @param counter 自由运行计数器地址（如 &TIM2->CNT、&DWT->CYCCNT），分辨率即时间戳分辨率
+ * @param queue 侧队列存储区
+ * @param size 侧队列记录数，须为 2 的幂
+ * @note 每次 IDLE/HT/TC 中断在入口锁存计数器，有新数据时写入一条记录，只记录位置不拷贝数据；
+ *       记录的 end 与用户队列中的字节一一对应的前提是接收没有丢弃（如使能了流控）；
+ *       硬件 RTS 下 DMA 恢复时从 RDR 取走的字节不产生中断，要到下一条记录才被覆盖
+ */
+void USART_Rx_DMA_EnableTimestamp(USART_DMA_Context* ctx,
+                                  const volatile uint32_t* counter,
+                                  USART_Rx_Timestamp* queue,
+                                  uint16_t size)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    ctx->ts_queue = queue;
+    ctx->ts_mask = size - 1U;
+    ctx->ts_head = 0;
+    ctx->ts_tail = 0;
+    ctx->ts_dma_last = USART_DMA_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(ctx->hdma);
+    ctx->ts_stream_pos = 0;
+    ctx->ts_dropped = 0;
+    ctx->ts_counter = counter;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief 取出最早的时间戳记录
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @param ts 输出参数
+ * @return 1：取到记录，0：侧队列为空
+ */
+uint8_t USART_Rx_DMA_GetTimestamp(USART_DMA_Context* ctx, USART_Rx_Timestamp* ts)
+{
+    uint16_t tail = ctx->ts_tail;
+
+    if (tail == ctx->ts_head) {
+        return 0;
+    }
+    *ts = ctx->ts_queue[tail & ctx->ts_mask];
+    __DMB();
+    ctx->ts_tail = tail + 1U;
+    return 1;
+}
+
+/**
+ * @brief 有新数据时写入一条时间戳记录
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @param time 中断入口锁存的计数器值
+ * @note 须在清除 IDLE 标志前、HAL_DMA_IRQHandler 清除 DMA 标志前调用，用于区分事件
+ */
+static void USART_Rx_DMA_Timestamp(USART_DMA_Context* ctx, uint32_t time)
+{
+    uint16_t dma = (uint16_t)(USART_DMA_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(ctx->hdma));
+    uint16_t arrived = (uint16_t)((dma + USART_DMA_BUFFER_SIZE - ctx->ts_dma_last) % USART_DMA_BUFFER_SIZE);
+    uint16_t head = ctx->ts_head;
+    USART_Rx_Timestamp* ts;
+
+    // HT/TC 保证两次记录之间不超过半个缓冲区，差值不会绕圈
+    if (arrived == 0U) {
+        return;
+    }
+    ctx->ts_dma_last = dma;
+    ctx->ts_stream_pos += arrived;
+
+    if ((uint16_t)(head - ctx->ts_tail) > ctx->ts_mask) {
+        // 记录丢弃后下一条记录的范围自然覆盖这一段
+        ctx->ts_dropped++;
+        return;
+    }
+    ts = &ctx->ts_queue[head & ctx->ts_mask];
+    ts->time = time;
+    ts->end = ctx->ts_stream_pos;
+    if (RESET != __HAL_UART_GET_FLAG(ctx->huart, UART_FLAG_IDLE)) {
+        ts->event = USART_TS_IDLE;
+    } else if (__HAL_DMA_GET_FLAG(ctx->hdma, __HAL_DMA_GET_TC_FLAG_INDEX(ctx->hdma)) != 0U) {
+        ts->event = USART_TS_TC;
+    } else if (__HAL_DMA_GET_FLAG(ctx->hdma, __HAL_DMA_GET_HT_FLAG_INDEX(ctx->hdma)) != 0U) {
+        ts->event = USART_TS_HT;
+    } else {
+        ts->event = USART_TS_OTHER;
+    }
+    __DMB();
+    ctx->ts_head = head + 1U;
+}
+
+/**
+ * @brief 处理 USART DMA 中断
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @note 在 DMA 传输完成/中断回调中调用，用于处理接收到的数据
+ */
+void USART_Rx_DMA_IRQHandler_Process(USART_DMA_Context* ctx)
+{
+    uint32_t start = DWT->CYCCNT;
+    // 先锁存时间，不计入后面的数据搬运耗时
+    uint32_t stamp = (ctx->ts_counter != NULL) ? *ctx->ts_counter : 0U;
+
+    USART_Rx_DMA_Transfer(ctx);
+
+    if (ctx->ts_counter != NULL) {
+        USART_Rx_DMA_Timestamp(ctx, stamp);
+    }
 
     // 清除 IDLE 标志
     if (RESET != __HAL_UART_GET_FLAG(ctx->huart, UART_FLAG_IDLE)) {
         __HAL_UART_CLEAR_IDLEFLAG(ctx->huart);
     }
+
+    // 自动波特率检测结果（检测字符本身正常接收，随后的 IDLE 中断中检查）
+    if (ctx->autobaud == USART_AUTOBAUD_WAIT) {
+        if (RESET != __HAL_UART_GET_FLAG(ctx->huart, UART_FLAG_ABRE)) {
+            ctx->autobaud_errors++;
+            __HAL_UART_SEND_REQ(ctx->huart, UART_AUTOBAUD_REQUEST);
+        } else if (RESET != __HAL_UART_GET_FLAG(ctx->huart, UART_FLAG_ABRF)) {
+            ctx->huart->Init.BaudRate = USART_Rx_DMA_GetBaudRate(ctx);
+            ctx->autobaud = USART_AUTOBAUD_DONE;
+        }
+    }
+
+    // 接收超时：帧结束，数据已全部进入队列
+    if (RESET != __HAL_UART_GET_FLAG(ctx->huart, UART_FLAG_RTOF)) {
+        __HAL_UART_CLEAR_FLAG(ctx->huart, UART_CLEAR_RTOF);
+        if (ctx->frame_timeout != NULL) {
+            ctx->frame_timeout(ctx->frame_timeout_user);
+        }
+    }
+
+    // 记录中断处理耗时（含帧结束回调）
+    ctx->isr_cycles_last = DWT->CYCCNT - start;
+    if (ctx->isr_cycles_last > ctx->isr_cycles_max) {
+        ctx->isr_cycles_max = ctx->isr_cycles_last;
+    }
+    ctx->isr_count++;
+}
+
+/**
+ * @brief 获取串口内核时钟频率
+ */
+static uint32_t USART_Rx_DMA_KernelClock(UART_HandleTypeDef* huart)
+{
+    UART_ClockSourceTypeDef source;
+
+    UART_GETCLOCKSOURCE(huart, source);
+    switch (source) {
+    case UART_CLOCKSOURCE_PCLK1:
+        return HAL_RCC_GetPCLK1Freq();
+    case UART_CLOCKSOURCE_PCLK2:
+        return HAL_RCC_GetPCLK2Freq();
+    case UART_CLOCKSOURCE_HSI:
+        return HSI_VALUE;
+    case UART_CLOCKSOURCE_SYSCLK:
+        return HAL_RCC_GetSysClockFreq();
+    case UART_CLOCKSOURCE_LSE:
+        return LSE_VALUE;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief 按 BRR 和内核时钟计算当前波特率
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @return 波特率，时钟未知时返回 0
+ */
+uint32_t USART_Rx_DMA_GetBaudRate(USART_DMA_Context* ctx)
+{
+    UART_HandleTypeDef* huart = ctx->huart;
+    uint32_t clock = USART_Rx_DMA_KernelClock(huart);
+    uint32_t brr = huart->Instance->BRR;
+    uint32_t div;
+
+    if (clock == 0U || brr == 0U) {
+        return 0;
+    }
+    if (UART_INSTANCE_LOWPOWER(huart)) {
+        return (uint32_t)(((uint64_t)clock * 256U + brr / 2U) / brr);
+    }
+    if (READ_BIT(huart->Instance->CR1, USART_CR1_OVER8) != 0U) {
+        // 8 倍过采样：BRR[2:0] 为分频值 [3:1]
+        div = (brr & 0xFFF0U) | ((brr & 0x7U) << 1);
+        return (2U * clock + div / 2U) / div;
+    }
+    return (clock + brr / 2U) / brr;
+}
+
+/**
+ * @brief 运行时切换波特率
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @param baud 新波特率，最高为内核时钟 / 8（USART）或 / 3（LPUART）
+ * @return HAL_OK：已切换；HAL_BUSY：正在接收字节，稍后重试；
+ *         HAL_TIMEOUT：发送未完成；HAL_ERROR：超出范围，保持原波特率
+ * @note 不调用 HAL_UART_DeInit：只在 UE = 0 期间重写 BRR/过采样，DMA 通道与 CNDTR 不动，
+ *       last_count 保持有效。切换前先把已接收的数据交给队列，调用方负责在切换期间不启动发送，
+ *       并通过握手保证线路空闲（对端在收到应答后再切换）
+ */
+HAL_StatusTypeDef USART_Rx_DMA_SetBaudRate(USART_DMA_Context* ctx, uint32_t baud)
+{
+    UART_HandleTypeDef* huart = ctx->huart;
+    uint32_t old_baud = huart->Init.BaudRate;
+    uint32_t old_sampling = huart->Init.OverSampling;
+    uint32_t primask;
+    uint32_t start;
+    HAL_StatusTypeDef status;
+
+    // 等待发送移位寄存器清空，旧波特率的最后一个字节完整发出
+    start = HAL_GetTick();
+    while (RESET == __HAL_UART_GET_FLAG(huart, UART_FLAG_TC)) {
+        if (HAL_GetTick() - start > USART_BAUD_SWITCH_TIMEOUT_MS) {
+            return HAL_TIMEOUT;
+        }
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    // 正在接收的字节会被截断
+    if (RESET != __HAL_UART_GET_FLAG(huart, UART_FLAG_BUSY)) {
+        __set_PRIMASK(primask);
+        return HAL_BUSY;
+    }
+    USART_Rx_DMA_Transfer(ctx);
+
+    // BRR 只能在 UE = 0 时写入
+    __HAL_UART_DISABLE(huart);
+    huart->Init.BaudRate = baud;
+    huart->Init.OverSampling = UART_OVERSAMPLING_16;
+    status = UART_SetConfig(huart);
+    if (status != HAL_OK && !UART_INSTANCE_LOWPOWER(huart)) {
+        // 16 倍过采样分频不足时改用 8 倍
+        huart->Init.OverSampling = UART_OVERSAMPLING_8;
+        status = UART_SetConfig(huart);
+    }
+    if (status != HAL_OK) {
+        huart->Init.BaudRate = old_baud;
+        huart->Init.OverSampling = old_sampling;
+        (void)UART_SetConfig(huart);
+    }
+    __HAL_UART_ENABLE(huart);
+    __set_PRIMASK(primask);
+
+    // 等待接收重新使能
+    start = HAL_GetTick();
+    while (RESET == __HAL_UART_GET_FLAG(huart, UART_FLAG_REACK)) {
+        if (HAL_GetTick() - start > USART_BAUD_SWITCH_TIMEOUT_MS) {
+            return HAL_TIMEOUT;
+        }
+    }
+    return status;
+}
+
+/**
+ * @brief 启动硬件自动波特率检测
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @param mode UART_ADVFEATURE_AUTOBAUDRATE_ONSTARTBIT / ONFALLINGEDGE / ON0X7FFRAME / ON0X55FRAME
+ * @return HAL_ERROR 表示该串口不支持自动波特率（如 LPUART）
+ * @note 下一个接收字符用于测量并更新 BRR，该字符本身正常进入 DMA 缓冲区；
+ *       检测完成后 ctx->autobaud 变为 USART_AUTOBAUD_DONE，失败时自动重新检测
+ */
+HAL_StatusTypeDef USART_Rx_DMA_StartAutoBaud(USART_DMA_Context* ctx, uint32_t mode)
+{
+    UART_HandleTypeDef* huart = ctx->huart;
+    uint32_t primask;
+
+    if (!IS_USART_AUTOBAUDRATE_DETECTION_INSTANCE(huart->Instance)) {
+        return HAL_ERROR;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    USART_Rx_DMA_Transfer(ctx);
+
+    // ABREN/ABRMODE 只能在 UE = 0 时修改，DMA 通道不动
+    if (READ_BIT(huart->Instance->CR2, USART_CR2_ABREN | USART_CR2_ABRMODE) != (USART_CR2_ABREN | mode)) {
+        __HAL_UART_DISABLE(huart);
+        huart->AdvancedInit.AdvFeatureInit |= UART_ADVFEATURE_AUTOBAUDRATE_INIT;
+        huart->AdvancedInit.AutoBaudRateEnable = UART_ADVFEATURE_AUTOBAUDRATE_ENABLE;
+        huart->AdvancedInit.AutoBaudRateMode = mode;
+        UART_AdvFeatureConfig(huart);
+        __HAL_UART_ENABLE(huart);
+    }
+    // 清除上次结果，在下一个字符上重新检测
+    __HAL_UART_SEND_REQ(huart, UART_AUTOBAUD_REQUEST);
+    ctx->autobaud = USART_AUTOBAUD_WAIT;
+    __set_PRIMASK(primask);
+    return HAL_OK;
 }
 
 /**
@@ -183,6 +795,29 @@ void USART_GetStatistics(USART_DMA_Context* ctx,
     }
 }
 
+/**
+ * @brief 获取中断处理耗时统计
+ * @param ctx 指向 USART_DMA_Context 结构体的指针
+ * @param count 中断处理次数输出指针（可为 NULL）
+ * @param cycles_last 最近一次耗时输出指针（可为 NULL）
+ * @param cycles_max 最大耗时输出指针（可为 NULL）
+ */
+void USART_GetIsrTiming(USART_DMA_Context* ctx,
+                        uint32_t* count,
+                        uint32_t* cycles_last,
+                        uint32_t* cycles_max)
+{
+    if (count != NULL) {
+        *count = ctx->isr_count;
+    }
+    if (cycles_last != NULL) {
+        *cycles_last = ctx->isr_cycles_last;
+    }
+    if (cycles_max != NULL) {
+        *cycles_max = ctx->isr_cycles_max;
+    }
+}
+
 /**
  * @brief 重置统计信息
  * @param ctx 指向 USART_DMA_Context 结构体的指针
@@ -192,4 +827,8 @@ void USART_ResetStatistics(USART_DMA_Context* ctx)
     ctx->total_received_bytes = 0;
     ctx->total_dropped_bytes = 0;
     ctx->queue_overflow_count = 0;
+    ctx->flow_stop_count = 0;
+    ctx->isr_count = 0;
+    ctx->isr_cycles_last = 0;
+    ctx->isr_cycles_max = 0;
 }
@@ -9,9 +9,43 @@
   #define USART_DMA_BUFFER_SIZE  (64)
 #endif
 
+#ifndef USART_BAUD_SWITCH_TIMEOUT_MS
+  #define USART_BAUD_SWITCH_TIMEOUT_MS  (100U)   // 切换波特率前等待发送完成的超时
+#endif
+
+// 自动波特率检测状态
+#define USART_AUTOBAUD_OFF      (0U)
+#define USART_AUTOBAUD_WAIT     (1U)    // 等待检测字符
+#define USART_AUTOBAUD_DONE     (2U)    // 已检测，huart->Init.BaudRate 已更新
+
+// 接收流控方式
+#define USART_FLOW_NONE         (0U)
+#define USART_FLOW_RTS_GPIO     (1U)    // GPIO 作 RTS，高电平要求对端停止发送
+#define USART_FLOW_RTS_HW       (2U)    // 硬件 RTS（UART_HWCONTROL_RTS），暂停接收 DMA 请求使 RTS 撤销
+#define USART_FLOW_XONXOFF      (3U)    // 软件流控，发送 XOFF/XON
+
+#define USART_XON               (0x11U)
+#define USART_XOFF              (0x13U)
+
+// 接收时间戳事件
+#define USART_TS_IDLE           (0U)    // 空闲线：最后一个字节在锁存时刻前一个字符时间结束
+#define USART_TS_HT             (1U)    // DMA 半传输
+#define USART_TS_TC             (2U)    // DMA 传输完成
+#define USART_TS_OTHER          (3U)    // 接收超时等其他中断
+
+// 接收时间戳：一段数据的结束位置和到达时刻，数据本身仍在接收队列中
+typedef struct {
+    uint32_t time;                    // 事件时刻的计数器值
+    uint16_t end;                     // 该段结束后的字节位置（自使能起自由计数，按 uint16_t 回绕）
+    uint8_t event;                    // USART_TS_xxx
+} USART_Rx_Timestamp;
+
 // 用户自定义队列操作函数类型定义（批量操作）
 typedef uint32_t (*USART_Queue_Write_Func)(void* user_queue, uint8_t* data, uint16_t length);  // 批量写入队列，返回实际写入长度
 typedef uint32_t (*USART_Queue_Available_Func)(void* user_queue);                       // 检查队列可用空间
+typedef void (*USART_Frame_Timeout_Func)(void* user);                                     // 接收超时（帧结束）回调，中断中调用
+typedef void (*USART_Rx_Ready_Func)(void* user);                                          // 零拷贝模式新数据到达回调，中断中调用
+typedef int (*USART_Flow_Send_Func)(void* user, uint8_t ch);                              // 发送 XON/XOFF，返回 0 表示已发送
 
 // USART DMA 上下文结构体
 typedef struct {
@@ -25,10 +59,51 @@ typedef struct {
     USART_Queue_Write_Func queue_write;      // 批量写入队列
     USART_Queue_Available_Func queue_available; // 检查队列可用空间
 
+    // 接收超时（帧结束）回调，可为 NULL
+    USART_Frame_Timeout_Func frame_timeout;
+    void* frame_timeout_user;
+
+    // 零拷贝模式：数据留在 DMA 缓冲区，由使用者按段取用后释放（不使用用户队列）
+    USART_Rx_Ready_Func rx_ready;
+    void* rx_ready_user;
+    uint16_t span_pending;            // 未释放的字节数（含使用者正在处理的数据段）
+    uint8_t span_reset;               // 溢出后已重新同步，使用者手中的数据段作废
+
+    // 接收流控：用户队列可用空间低于 stop_free 时要求对端停止，恢复到 resume_free 以上时允许；
+    // 停止期间仍在途的字节留在 DMA 缓冲区中（span_pending 计数），队列有空间后再写入
+    uint8_t flow_mode;                // USART_FLOW_xxx
+    uint8_t flow_stopped;             // 已要求对端停止发送
+    uint16_t flow_stop_free;
+    uint16_t flow_resume_free;
+    GPIO_TypeDef* flow_rts_port;      // USART_FLOW_RTS_GPIO
+    uint16_t flow_rts_pin;
+    USART_Flow_Send_Func flow_send;   // USART_FLOW_XONXOFF，默认在 TXE 时直接写 TDR
+    void* flow_send_user;
+    uint32_t flow_stop_count;         // 要求对端停止的次数
+
+    // 接收时间戳：中断入口锁存计数器，与字节位置一起写入侧队列，起点为上一条记录的 end
+    const volatile uint32_t* ts_counter;  // 自由运行计数器（如 &TIM2->CNT），NULL 表示不记录
+    USART_Rx_Timestamp* ts_queue;
+    uint16_t ts_mask;                 // 侧队列大小 - 1（大小为 2 的幂）
+    volatile uint16_t ts_head;        // 中断写入
+    volatile uint16_t ts_tail;        // 主循环读取
+    uint16_t ts_dma_last;             // 上次记录时的 DMA 位置
+    uint16_t ts_stream_pos;           // 自使能起到达的字节数
+    uint32_t ts_dropped;              // 侧队列满丢弃的记录数
+
+    // 自动波特率检测
+    uint8_t autobaud;                 // USART_AUTOBAUD_xxx
+    uint32_t autobaud_errors;         // 检测失败（字符不符或超出范围）次数
+
     // 错误统计
     uint32_t total_received_bytes;    // 总接收字节数
     uint32_t total_dropped_bytes;     // 因队列满丢弃的字节数
     uint32_t queue_overflow_count;    // 队列溢出次数
+
+    // 中断处理耗时（DWT 周期，需使能 DWT->CYCCNT）
+    uint32_t isr_count;               // 中断处理次数
+    uint32_t isr_cycles_last;         // 最近一次耗时
+    uint32_t isr_cycles_max;          // 最大耗时
 } USART_DMA_Context;
 
 // 初始化和控制函数
@@ -41,12 +116,64 @@ void USART_RegisterQueueOps(USART_DMA_Context* ctx,
                            USART_Queue_Write_Func write_func,
                            USART_Queue_Available_Func available_func);
 
+// 使能接收超时检测，bit_times 为超时位时间数（如 Modbus t3.5）
+void USART_Rx_DMA_EnableFrameTimeout(USART_DMA_Context* ctx,
+                                     uint32_t bit_times,
+                                     USART_Frame_Timeout_Func callback,
+                                     void* user);
+
+// 使能零拷贝模式：新数据到达时调用 ready，数据由 USART_Rx_DMA_PeekSpan/ConsumeSpan 取用
+void USART_Rx_DMA_EnableSpan(USART_DMA_Context* ctx, USART_Rx_Ready_Func ready, void* user);
+
+// 零拷贝模式：获取最早未释放的连续数据段，返回长度（0 表示无数据）
+uint16_t USART_Rx_DMA_PeekSpan(USART_DMA_Context* ctx, uint8_t** data);
+
+// 零拷贝模式：释放已处理的 length 字节，DMA 才能覆盖这部分缓冲区
+void USART_Rx_DMA_ConsumeSpan(USART_DMA_Context* ctx, uint16_t length);
+
+// 设置 GPIO RTS 引脚（USART_FLOW_RTS_GPIO，在使能流控前调用）
+void USART_Rx_DMA_SetRtsPin(USART_DMA_Context* ctx, GPIO_TypeDef* port, uint16_t pin);
+
+// 设置 XON/XOFF 发送函数（USART_FLOW_XONXOFF，发送端使用 DMA 时必须提供，在使能流控前调用）
+void USART_Rx_DMA_SetFlowSender(USART_DMA_Context* ctx, USART_Flow_Send_Func send, void* user);
+
+// 使能接收流控（须已注册用户队列），resume_free 应大于 stop_free 以形成迟滞
+void USART_Rx_DMA_EnableFlowControl(USART_DMA_Context* ctx, uint8_t mode, uint16_t stop_free, uint16_t resume_free);
+
+// 主循环中从用户队列取走数据后调用：写入留在 DMA 缓冲区中的数据，空间恢复后允许对端发送
+void USART_Rx_DMA_FlowPoll(USART_DMA_Context* ctx);
+
+// 使能接收时间戳，counter 为自由运行计数器地址，queue 大小须为 2 的幂
+void USART_Rx_DMA_EnableTimestamp(USART_DMA_Context* ctx,
+                                  const volatile uint32_t* counter,
+                                  USART_Rx_Timestamp* queue,
+                                  uint16_t size);
+
+// 取出最早的时间戳记录，返回 1 表示取到
+uint8_t USART_Rx_DMA_GetTimestamp(USART_DMA_Context* ctx, USART_Rx_Timestamp* ts);
+
+// 运行时切换波特率：不停止 DMA，切换前后的数据在环形缓冲区中连续，不丢失也不重复
+// 返回 HAL_BUSY 表示正在接收字节，稍后重试；HAL_ERROR 表示波特率超出范围，保持原波特率
+HAL_StatusTypeDef USART_Rx_DMA_SetBaudRate(USART_DMA_Context* ctx, uint32_t baud);
+
+// 启动硬件自动波特率检测，mode 为 UART_ADVFEATURE_AUTOBAUDRATE_xxx（如 ON0X55FRAME）
+HAL_StatusTypeDef USART_Rx_DMA_StartAutoBaud(USART_DMA_Context* ctx, uint32_t mode);
+
+// 按 BRR 和内核时钟计算当前波特率
+uint32_t USART_Rx_DMA_GetBaudRate(USART_DMA_Context* ctx);
+
 // 获取接收统计信息
 void USART_GetStatistics(USART_DMA_Context* ctx,
                         uint32_t* total_received,
                         uint32_t* total_dropped,
                         uint32_t* overflow_count);
 
+// 获取中断处理耗时统计
+void USART_GetIsrTiming(USART_DMA_Context* ctx,
+                        uint32_t* count,
+                        uint32_t* cycles_last,
+                        uint32_t* cycles_max);
+
 // 重置统计信息
 void USART_ResetStatistics(USART_DMA_Context* ctx);
 
@@ -0,0 +1,320 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    app_drv_telemetry.c
+ * @brief   紧凑二进制遥测编码
+ * @note    varint / zigzag / CBOR 子集 / 差分，直接写入发送 FIFO 存储区
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include "app_drv_telemetry.h"
+
+/**
+ * @brief 从 FIFO 连续区启动发送（调用方保证链路空闲）
+ */
+static void TLM_StartTx(TLM_Context* ctx)
+{
+    app_drv_fifo_t* fifo = ctx->fifo;
+    uint16_t length = (uint16_t)(fifo->end - fifo->begin);
+    uint16_t offset = fifo->begin & fifo->size_mask;
+
+    if (length == 0U) {
+        return;
+    }
+    // 只发送到存储区末尾，回绕部分由发送完成中断接续
+    if (length > fifo->size - offset) {
+        length = fifo->size - offset;
+    }
+    ctx->tx_len = length;
+    if (ctx->send(ctx->send_user, &fifo->data[offset], length) != 0) {
+        ctx->tx_len = 0;
+    }
+}
+
+/**
+ * @brief 初始化遥测发送上下文
+ * @param ctx 指向 TLM_Context 结构体的指针
+ * @param fifo 发送 FIFO
+ * @param send 非阻塞发送函数，可为 NULL（只写入 FIFO）
+ * @param user 传递给发送函数的用户参数
+ */
+void TLM_Init(TLM_Context* ctx, app_drv_fifo_t* fifo, TLM_Send_Func send, void* user)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->fifo = fifo;
+    ctx->send = send;
+    ctx->send_user = user;
+}
+
+/**
+ * @brief 开始一条记录
+ * @note 只在主循环中调用；发送中断只会让可写空间变大，开始时的上限始终有效
+ */
+void TLM_Begin(TLM_Writer* w, TLM_Context* ctx)
+{
+    w->ctx = ctx;
+    w->pos = ctx->fifo->end;
+    w->limit = (uint16_t)(ctx->fifo->begin + ctx->fifo->size);
+    w->overflow = 0;
+}
+
+/**
+ * @brief 提交记录并尝试启动发送
+ * @return 0：已提交，-1：空间不足，整条丢弃
+ */
+int TLM_End(TLM_Writer* w)
+{
+    TLM_Context* ctx = w->ctx;
+
+    if (w->overflow) {
+        ctx->dropped_count++;
+        return -1;
+    }
+
+    // 数据写完后再发布 end，发送中断看到的总是完整记录
+    __DMB();
+    ctx->fifo->end = w->pos;
+    ctx->record_count++;
+
+    TLM_Kick(ctx);
+    return 0;
+}
+
+/**
+ * @brief 链路空闲时启动发送
+ */
+void TLM_Kick(TLM_Context* ctx)
+{
+    uint32_t primask;
+
+    // 无发送函数：记录留在 FIFO 中由后级（如压缩）取走
+    if (ctx->send == NULL) {
+        return;
+    }
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (ctx->tx_len == 0U) {
+        TLM_StartTx(ctx);
+    }
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief 发送完成处理
+ * @note 在中断上下文中调用，释放已发送区域并接续发送剩余数据
+ */
+void TLM_TxComplete(TLM_Context* ctx)
+{
+    if (ctx->tx_len == 0U) {
+        return;
+    }
+    ctx->fifo->begin += ctx->tx_len;
+    ctx->tx_bytes += ctx->tx_len;
+    ctx->tx_len = 0;
+    TLM_StartTx(ctx);
+}
+
+/**
+ * @brief 无符号 varint（LEB128）
+ */
+void TLM_PutVarint(TLM_Writer* w, uint32_t value)
+{
+    while (value >= 0x80U) {
+        TLM_PutByte(w, (uint8_t)(value | 0x80U));
+        value >>= 7;
+    }
+    TLM_PutByte(w, (uint8_t)value);
+}
+
+/**
+ * @brief 有符号 zigzag varint
+ */
+void TLM_PutZigzag(TLM_Writer* w, int32_t value)
+{
+    TLM_PutVarint(w, ((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+}
+
+/**
+ * @brief 差分 zigzag varint（关键帧发送绝对值）
+ */
+void TLM_PutDelta(TLM_Writer* w, TLM_Delta* delta, int32_t value, uint8_t keyframe)
+{
+    TLM_PutZigzag(w, keyframe ? value : (int32_t)((uint32_t)value - (uint32_t)delta->last));
+    delta->last = value;
+}
+
+/**
+ * @brief CBOR 头部：主类型 + 参数（0 ~ 23 内联，否则 1/2/4 字节大端）
+ */
+void TLM_CborHead(TLM_Writer* w, uint8_t major, uint32_t value)
+{
+    uint8_t type = (uint8_t)(major << 5);
+
+    if (value < 24U) {
+        TLM_PutByte(w, type | (uint8_t)value);
+    } else if (value <= 0xFFU) {
+        TLM_PutByte(w, type | 24U);
+        TLM_PutByte(w, (uint8_t)value);
+    } else if (value <= 0xFFFFU) {
+        TLM_PutByte(w, type | 25U);
+        TLM_PutByte(w, (uint8_t)(value >> 8));
+        TLM_PutByte(w, (uint8_t)value);
+    } else {
+        TLM_PutByte(w, type | 26U);
+        TLM_PutByte(w, (uint8_t)(value >> 24));
+        TLM_PutByte(w, (uint8_t)(value >> 16));
+        TLM_PutByte(w, (uint8_t)(value >> 8));
+        TLM_PutByte(w, (uint8_t)value);
+    }
+}
+
+/**
+ * @brief CBOR 有符号整数（负数编码为主类型 1，参数 -1 - n）
+ */
+void TLM_CborInt(TLM_Writer* w, int32_t value)
+{
+    if (value >= 0) {
+        TLM_CborHead(w, TLM_CBOR_UINT, (uint32_t)value);
+    } else {
+        TLM_CborHead(w, TLM_CBOR_NINT, ~(uint32_t)value);
+    }
+}
+
+/**
+ * @brief CBOR 字节串/文本串
+ * @param major TLM_CBOR_BYTES 或 TLM_CBOR_TEXT
+ */
+void TLM_CborBytes(TLM_Writer* w, uint8_t major, const void* data, uint16_t length)
+{
+    const uint8_t* p = (const uint8_t*)data;
+
+    TLM_CborHead(w, major, length);
+    for (uint16_t i = 0; i < length; i++) {
+        TLM_PutByte(w, p[i]);
+    }
+}
+
+/**
+ * @brief CBOR 差分整数（关键帧发送绝对值）
+ */
+void TLM_CborDelta(TLM_Writer* w, TLM_Delta* delta, int32_t value, uint8_t keyframe)
+{
+    TLM_CborInt(w, keyframe ? value : (int32_t)((uint32_t)value - (uint32_t)delta->last));
+    delta->last = value;
+}
+
+/**
+ * @brief 初始化读取游标
+ */
+void TLM_ReaderInit(TLM_Reader* r, const uint8_t* data, uint16_t length)
+{
+    r->data = data;
+    r->length = length;
+    r->pos = 0;
+    r->error = 0;
+}
+
+static uint8_t TLM_GetByte(TLM_Reader* r)
+{
+    if (r->pos >= r->length) {
+        r->error = 1;
+        return 0;
+    }
+    return r->data[r->pos++];
+}
+
+/**
+ * @brief 读取无符号 varint（最多 5 字节）
+ */
+uint32_t TLM_GetVarint(TLM_Reader* r)
+{
+    uint32_t value = 0;
+
+    for (uint8_t shift = 0; shift < 35U; shift += 7U) {
+        uint8_t b = TLM_GetByte(r);
+        value |= (uint32_t)(b & 0x7FU) << shift;
+        if ((b & 0x80U) == 0U || r->error) {
+            return value;
+        }
+    }
+    r->error = 1;
+    return value;
+}
+
+/**
+ * @brief 读取 zigzag varint
+ */
+int32_t TLM_GetZigzag(TLM_Reader* r)
+{
+    uint32_t value = TLM_GetVarint(r);
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1U);
+}
+
+/**
+ * @brief 读取 CBOR 头部
+ * @param value 输出参数（简单值时为简单值编号）
+ * @return 主类型，出错时返回 TLM_READ_ERROR
+ */
+uint8_t TLM_CborGetHead(TLM_Reader* r, uint32_t* value)
+{
+    uint8_t initial = TLM_GetByte(r);
+    uint8_t info = initial & 0x1FU;
+    uint8_t count;
+
+    if (info < 24U) {
+        *value = info;
+    } else if (info <= 26U) {
+        count = (uint8_t)(1U << (info - 24U));
+        *value = 0;
+        while (count-- > 0U) {
+            *value = (*value << 8) | TLM_GetByte(r);
+        }
+    } else {
+        // 64 位参数、不定长编码不在子集内
+        r->error = 1;
+    }
+    return r->error ? TLM_READ_ERROR : (uint8_t)(initial >> 5);
+}
+
+/**
+ * @brief 读取 CBOR 整数（主类型 0/1）
+ */
+int32_t TLM_CborGetInt(TLM_Reader* r)
+{
+    uint32_t value;
+    uint8_t major = TLM_CborGetHead(r, &value);
+
+    if (major == TLM_CBOR_UINT) {
+        return (int32_t)value;
+    }
+    if (major == TLM_CBOR_NINT) {
+        return (int32_t)~value;
+    }
+    r->error = 1;
+    return 0;
+}
+
+/**
+ * @brief 差分还原
+ * @param delta 接收端差分状态
+ * @param coded 收到的值（关键帧为绝对值，否则为差值）
+ * @param keyframe 是否为关键帧
+ * @param value 输出参数
+ * @return 1：value 有效，0：尚未收到关键帧
+ */
+uint8_t TLM_DeltaDecode(TLM_Delta* delta, int32_t coded, uint8_t keyframe, int32_t* value)
+{
+    if (keyframe) {
+        delta->last = coded;
+        delta->valid = 1;
+    } else if (delta->valid) {
+        delta->last = (int32_t)((uint32_t)delta->last + (uint32_t)coded);
+    } else {
+        return 0;
+    }
+    *value = delta->last;
+    return 1;
+}
@@ -0,0 +1,135 @@
+#ifndef APP_DRV_TELEMETRY_H_
+#define APP_DRV_TELEMETRY_H_
+
+#include <stdint.h>
+#include "main.h"
+#include "app_drv_fifo.h"
+
+/*
+ * 紧凑二进制遥测编码
+ *
+ * 编码器直接写入发送 FIFO 的存储区：写位置从 fifo->end 开始前进，整条记录编码完成后
+ * 由 TLM_End 一次性提交 end；中途空间不足则整条丢弃，FIFO 中不会出现半条记录。
+ * 发送时从 FIFO 的连续区直接启动 DMA，编码到发送全程没有中间缓冲区拷贝。
+ *
+ * 编码原语：
+ *   varint  无符号 LEB128，每字节 7 位，低位在前，0 ~ 127 占 1 字节
+ *   zigzag  有符号映射 (n << 1) ^ (n >> 31) 后按 varint 编码，-64 ~ 63 占 1 字节
+ *   CBOR    RFC 8949 子集：无符号/负整数、字节串、文本串、数组、映射、false/true/null，
+ *           -24 ~ 23 的整数和短数组头都只占 1 字节
+ *   delta   缓变量只发送与上一值的差；关键帧（TLM_IsKeyframe）发送绝对值，
+ *           接收端丢帧后等下一个关键帧即可恢复
+ *
+ * 同一套读取函数（TLM_Reader）既可在设备上解析下行数据，也可在主机上解码遥测流。
+ */
+
+#ifndef TLM_KEYFRAME_INTERVAL
+  #define TLM_KEYFRAME_INTERVAL     (16U)    // 每多少条记录发送一次绝对值
+#endif
+
+// CBOR 主类型
+#define TLM_CBOR_UINT               (0U)
+#define TLM_CBOR_NINT               (1U)
+#define TLM_CBOR_BYTES              (2U)
+#define TLM_CBOR_TEXT               (3U)
+#define TLM_CBOR_ARRAY              (4U)
+#define TLM_CBOR_MAP                (5U)
+#define TLM_CBOR_SIMPLE             (7U)
+
+#define TLM_CBOR_FALSE              (20U)
+#define TLM_CBOR_TRUE               (21U)
+#define TLM_CBOR_NULL               (22U)
+
+#define TLM_READ_ERROR              (0xFFU)
+
+// 发送函数类型定义（非阻塞，如 HAL_UART_Transmit_DMA），返回 0 表示已启动发送
+typedef int (*TLM_Send_Func)(void* user, const uint8_t* data, uint16_t length);
+
+// 遥测发送上下文结构体
+typedef struct {
+    app_drv_fifo_t* fifo;           // 发送 FIFO，编码器直接写入其存储区
+    TLM_Send_Func send;
+    void* send_user;
+    volatile uint16_t tx_len;       // 正在发送的字节数，0 表示空闲
+
+    // 统计
+    uint32_t record_count;          // 已提交的记录数
+    uint32_t dropped_count;         // 空间不足丢弃的记录数
+    uint32_t tx_bytes;              // 已发送字节数
+} TLM_Context;
+
+// 记录写入游标
+typedef struct {
+    TLM_Context* ctx;
+    uint16_t pos;                   // 下一个写入位置（与 fifo->end 同一自由运行计数）
+    uint16_t limit;                 // 开始时的可写上限
+    uint8_t overflow;
+} TLM_Writer;
+
+// 记录读取游标
+typedef struct {
+    const uint8_t* data;
+    uint16_t length;
+    uint16_t pos;
+    uint8_t error;                  // 数据不足或类型不符
+} TLM_Reader;
+
+// 缓变量差分状态（发送端与接收端各一份）
+typedef struct {
+    int32_t last;
+    uint8_t valid;                  // 接收端：已收到关键帧，序号不连续时由调用方清 0
+} TLM_Delta;
+
+// 初始化，fifo 大小须为 2 的幂（app_drv_fifo 要求）；send 为 NULL 时记录只写入 FIFO
+void TLM_Init(TLM_Context* ctx, app_drv_fifo_t* fifo, TLM_Send_Func send, void* user);
+
+// 开始/结束一条记录，TLM_End 返回 0 表示已提交并尝试启动发送，-1 表示空间不足已丢弃
+void TLM_Begin(TLM_Writer* w, TLM_Context* ctx);
+int TLM_End(TLM_Writer* w);
+
+// 主循环中调用：链路空闲且 FIFO 有数据时启动发送
+void TLM_Kick(TLM_Context* ctx);
+
+// 在 HAL_UART_TxCpltCallback 中调用
+void TLM_TxComplete(TLM_Context* ctx);
+
+// 写入原语
+static inline void TLM_PutByte(TLM_Writer* w, uint8_t value)
+{
+    if (w->pos != w->limit) {
+        w->ctx->fifo->data[w->pos & w->ctx->fifo->size_mask] = value;
+        w->pos++;
+    } else {
+        w->overflow = 1;
+    }
+}
+
+void TLM_PutVarint(TLM_Writer* w, uint32_t value);
+void TLM_PutZigzag(TLM_Writer* w, int32_t value);
+void TLM_PutDelta(TLM_Writer* w, TLM_Delta* delta, int32_t value, uint8_t keyframe);
+
+void TLM_CborHead(TLM_Writer* w, uint8_t major, uint32_t value);
+void TLM_CborInt(TLM_Writer* w, int32_t value);
+void TLM_CborBytes(TLM_Writer* w, uint8_t major, const void* data, uint16_t length);
+void TLM_CborDelta(TLM_Writer* w, TLM_Delta* delta, int32_t value, uint8_t keyframe);
+
+#define TLM_CborUint(w, v)          TLM_CborHead((w), TLM_CBOR_UINT, (v))
+#define TLM_CborArray(w, n)         TLM_CborHead((w), TLM_CBOR_ARRAY, (n))
+#define TLM_CborMap(w, n)           TLM_CborHead((w), TLM_CBOR_MAP, (n))
+#define TLM_CborBool(w, b)          TLM_PutByte((w), (uint8_t)(0xE0U | ((b) ? TLM_CBOR_TRUE : TLM_CBOR_FALSE)))
+#define TLM_CborNull(w)             TLM_PutByte((w), (uint8_t)(0xE0U | TLM_CBOR_NULL))
+
+// 关键帧判定：按记录序号
+#define TLM_IsKeyframe(seq)         (((seq) % TLM_KEYFRAME_INTERVAL) == 0U)
+
+// 读取原语（设备与主机共用）
+void TLM_ReaderInit(TLM_Reader* r, const uint8_t* data, uint16_t length);
+uint32_t TLM_GetVarint(TLM_Reader* r);
+int32_t TLM_GetZigzag(TLM_Reader* r);
+uint8_t TLM_CborGetHead(TLM_Reader* r, uint32_t* value);
+int32_t TLM_CborGetInt(TLM_Reader* r);
+
+// 差分还原：keyframe 时 coded 为绝对值，返回 0 表示尚未收到关键帧，value 无效
+uint8_t TLM_DeltaDecode(TLM_Delta* delta, int32_t coded, uint8_t keyframe, int32_t* value);
+
+#endif /* APP_DRV_TELEMETRY_H_ */
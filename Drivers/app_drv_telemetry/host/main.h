@@ -0,0 +1,39 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    main.h
+ * @brief   主机端替身：只提供 app_drv_telemetry.c 编译所需的屏障与中断屏蔽函数
+ * @note    主机工具中没有发送中断，屏蔽函数只保存状态
+ ******************************************************************************
+ */
+
+#ifndef HOST_MAIN_H_
+#define HOST_MAIN_H_
+
+#include <stdint.h>
+
+static uint32_t host_primask;
+
+static inline void __DMB(void)
+{
+    __sync_synchronize();
+}
+
+static inline uint32_t __get_PRIMASK(void)
+{
+    return host_primask;
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+    host_primask = primask;
+}
+
+static inline void __disable_irq(void)
+{
+    host_primask = 1U;
+}
+
+#endif /* HOST_MAIN_H_ */
@@ -0,0 +1,504 @@
+/********************************** (C) COPYRIGHT *******************************
+ * Copyright (c) 2026 createskyblue@outlook.com MIT
+*******************************************************************************/
+/**
+ ******************************************************************************
+ * @file    tlm_stream.c
+ * @brief   遥测流主机端解码与编码开销测试（Linux / macOS）
+ * @note    与固件共用 app_drv_telemetry.c，同目录的 main.h 替代 CMSIS：
+ *            cc -O2 -I. -I.. -I../../app_drv_fifo -o tlm_stream tlm_stream.c \
+ *               ../app_drv_telemetry.c ../../app_drv_fifo/app_drv_fifo.c
+ *
+ *          记录格式与 main.c 的 Telemetry_Record 相同：CBOR 数组 [序号, 时间 ms, 温度 1/256 °C,
+ *          输入电平 q15, 接收字节数]，时间、温度、接收字节数为 delta 编码，序号为
+ *          TLM_KEYFRAME_INTERVAL 整数倍的记录为关键帧（绝对值）。
+ *
+ *          解码：tlm_stream -d capture.bin > stream.csv
+ *            读取串口抓取的 "stream bin" 原始字节（可含控制台回显与提示符），逐字节寻找
+ *            数组头重新同步；记录后面紧跟的不是下一条记录头（记录内丢字节）时丢弃该记录，
+ *            序号不连续或丢弃记录后清除差分状态，直到下一个关键帧前的记录只计数不输出。
+ *            输出与 "stream text" 相同的 CSV：序号,时间,温度 (°C),电平 (满量程),接收字节数
+ *
+ *          用例（合成信号：100 ms 周期、温度缓变加噪声、接收字节突发）：
+ *            bench      每条记录的字节数与耗时：CBOR delta 记录（区分关键帧）对比
+ *                       Telemetry_Record 文本路径的 snprintf 同格式输出
+ *            roundtrip  编码后再解码，逐条核对全部字段；前面加控制台回显也须正确同步
+ *            loss       丢失整条记录（TLM_End 空间不足时的丢弃方式）：丢失后到下一个关键帧前
+ *                       不得输出，其余全部正确；另统计在记录中间丢字节时输出错误值的记录数
+ *
+ *            tlm_stream [-n records] [-s seed] [-o capture.bin] [bench|roundtrip|loss]
+ *            tlm_stream -d capture.bin
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "app_drv_telemetry.h"
+
+#define SIM_PERIOD_MS           (100U)      // STREAM_PERIOD_MS
+#define SIM_TEMP_LSB_PER_C      (256)       // ADC_PIPE_TEMP_LSB_PER_C
+#define SIM_FIFO_SIZE           (256U)
+#define SIM_RECORD_ARRAY        (0x85U)     // CBOR 数组头，5 个元素
+
+// 一条记录的原始值
+typedef struct {
+    uint32_t seq;
+    uint32_t ms;
+    int32_t temp;               // 1/256 °C
+    int32_t rms;                // q15，对应固件 rms >> 16
+    uint32_t received;
+} Sim_Record;
+
+// 解码统计
+typedef struct {
+    uint32_t records;           // 输出的记录数
+    uint32_t waiting;           // 等待关键帧、未输出的记录数
+    uint32_t gaps;              // 序号不连续次数
+    uint32_t rejected;          // 解析成功但后面不是下一条记录头、判为受损的记录数
+    uint32_t skipped_bytes;     // 同步时跳过的字节数
+} Sim_DecodeStats;
+
+typedef void (*Sim_Record_Func)(void* user, const Sim_Record* record);
+
+static uint8_t sim_fifo_buffer[SIM_FIFO_SIZE];
+static app_drv_fifo_t sim_fifo;
+static TLM_Context sim_tlm;
+
+static uint64_t Sim_Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/* ----------------------------------------------------------------------------
+ * 解码
+ * ------------------------------------------------------------------------- */
+
+/**
+ * @brief 解码一段抓取数据，每条可还原的记录调用一次 func
+ */
+static void Sim_Decode(const uint8_t* data, uint32_t length, Sim_Record_Func func, void* user,
+                       Sim_DecodeStats* stats)
+{
+    TLM_Delta tick = { 0 }, temp = { 0 }, rx = { 0 };
+    uint32_t expected = 0;
+    uint8_t started = 0;
+    uint32_t pos = 0;
+
+    memset(stats, 0, sizeof(*stats));
+    while (pos < length) {
+        TLM_Reader r;
+        Sim_Record rec;
+        uint32_t seq, count;
+        int32_t coded_ms, coded_temp, coded_rx, value;
+        uint8_t key, ok;
+
+        if (data[pos] != SIM_RECORD_ARRAY) {
+            stats->skipped_bytes++;
+            pos++;
+            continue;
+        }
+        TLM_ReaderInit(&r, &data[pos], (uint16_t)((length - pos > 0xFFFFU) ? 0xFFFFU : length - pos));
+        if (TLM_CborGetHead(&r, &count) != TLM_CBOR_ARRAY || count != 5U
+            || TLM_CborGetHead(&r, &seq) != TLM_CBOR_UINT) {
+            stats->skipped_bytes++;
+            pos++;
+            continue;
+        }
+        coded_ms = TLM_CborGetInt(&r);
+        coded_temp = TLM_CborGetInt(&r);
+        rec.rms = TLM_CborGetInt(&r);
+        coded_rx = TLM_CborGetInt(&r);
+        if (r.error) {
+            stats->skipped_bytes++;
+            pos++;
+            continue;
+        }
+        pos += r.pos;
+
+        // 记录之间没有分隔：记录内丢字节时会吞掉下一条记录的开头，解析仍可能成功，
+        // 因此后面紧跟的不是下一条记录头时整条丢弃，并按丢帧处理
+        if (pos < length && data[pos] != SIM_RECORD_ARRAY) {
+            stats->rejected++;
+            started = 0;
+            tick.valid = 0;
+            temp.valid = 0;
+            rx.valid = 0;
+            continue;
+        }
+
+        // 序号不连续：中间记录丢失，差分基准失效
+        if (started && seq != expected) {
+            stats->gaps++;
+            tick.valid = 0;
+            temp.valid = 0;
+            rx.valid = 0;
+        }
+        started = 1;
+        expected = seq + 1U;
+
+        key = TLM_IsKeyframe(seq);
+        rec.seq = seq;
+        ok = TLM_DeltaDecode(&tick, coded_ms, key, &value);
+        rec.ms = (uint32_t)value;
+        ok &= TLM_DeltaDecode(&temp, coded_temp, key, &rec.temp);
+        ok &= TLM_DeltaDecode(&rx, coded_rx, key, &value);
+        rec.received = (uint32_t)value;
+        if (!ok) {
+            stats->waiting++;
+            continue;
+        }
+        stats->records++;
+        func(user, &rec);
+    }
+}
+
+static int Sim_FormatText(char* buffer, size_t size, const Sim_Record* rec)
+{
+    // 与 Telemetry_Record 的文本格式相同，rms 还原为 q31 后换算
+    return snprintf(buffer, size, "%lu,%lu,%.2f,%.5f,%lu\r\n", (unsigned long)rec->seq, (unsigned long)rec->ms,
+                    rec->temp / (float)SIM_TEMP_LSB_PER_C, (float)((int64_t)rec->rms << 16) / 2147483648.0f,
+                    (unsigned long)rec->received);
+}
+
+static void Sim_PrintCsv(void* user, const Sim_Record* rec)
+{
+    char line[64];
+
+    (void)user;
+    if (Sim_FormatText(line, sizeof(line), rec) > 0) {
+        line[strcspn(line, "\r")] = '\0';
+        puts(line);
+    }
+}
+
+static int Sim_DecodeFile(const char* path)
+{
+    Sim_DecodeStats stats;
+    uint8_t* data;
+    long length;
+    FILE* f = fopen(path, "rb");
+
+    if (f == NULL) {
+        perror(path);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    length = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc((size_t)length + 1U);
+    if (data == NULL || fread(data, 1, (size_t)length, f) != (size_t)length) {
+        fprintf(stderr, "%s: read failed\n", path);
+        fclose(f);
+        free(data);
+        return 1;
+    }
+    fclose(f);
+
+    Sim_Decode(data, (uint32_t)length, Sim_PrintCsv, NULL, &stats);
+    fprintf(stderr, "%s: %ld bytes, %u records, %u waiting for keyframe, %u gaps, %u rejected, %u bytes skipped\n",
+            path, length, stats.records, stats.waiting, stats.gaps, stats.rejected, stats.skipped_bytes);
+    free(data);
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * 编码
+ * ------------------------------------------------------------------------- */
+
+// 合成与固件相同字段的记录：主循环抖动、温度缓变加噪声、电平、接收字节突发
+static void Sim_Generate(Sim_Record* records, uint32_t count)
+{
+    uint32_t received = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        double t = i * (SIM_PERIOD_MS / 1000.0);
+
+        records[i].seq = i;
+        records[i].ms = 1200U + i * SIM_PERIOD_MS + (uint32_t)(drand48() < 0.3);
+        records[i].temp = (int32_t)(SIM_TEMP_LSB_PER_C * (27.0 + 2.0 * t / (t + 60.0)) + (drand48() - 0.5) * 24.0);
+        records[i].rms = (int32_t)(3277.0 + 300.0 * drand48());
+        if (drand48() < 0.2) {
+            received += 1U + (uint32_t)(drand48() * 300.0);
+        }
+        records[i].received = received;
+    }
+}
+
+/**
+ * @brief 按 Telemetry_Record 的二进制路径编码一条记录，返回记录字节数
+ */
+static uint16_t Sim_EncodeRecord(const Sim_Record* rec, TLM_Delta deltas[3], uint8_t* out)
+{
+    TLM_Writer w;
+    uint8_t key = TLM_IsKeyframe(rec->seq);
+    uint16_t length;
+
+    TLM_Begin(&w, &sim_tlm);
+    TLM_CborArray(&w, 5);
+    TLM_CborUint(&w, rec->seq);
+    TLM_CborDelta(&w, &deltas[0], (int32_t)rec->ms, key);
+    TLM_CborDelta(&w, &deltas[1], rec->temp, key);
+    TLM_CborInt(&w, rec->rms);
+    TLM_CborDelta(&w, &deltas[2], (int32_t)rec->received, key);
+    if (TLM_End(&w) != 0) {
+        return 0;
+    }
+    length = app_drv_fifo_length(&sim_fifo);
+    app_drv_fifo_read(&sim_fifo, out, &length);
+    return length;
+}
+
+// 编码全部记录，offsets 为每条记录在抓取中的起始位置，返回抓取字节数
+static uint32_t Sim_EncodeAll(const Sim_Record* records, uint32_t count, uint8_t* out, uint32_t* offsets)
+{
+    TLM_Delta deltas[3];
+    uint32_t length = 0;
+
+    memset(deltas, 0, sizeof(deltas));
+    app_drv_fifo_init(&sim_fifo, sim_fifo_buffer, SIM_FIFO_SIZE);
+    TLM_Init(&sim_tlm, &sim_fifo, NULL, NULL);
+    for (uint32_t i = 0; i < count; i++) {
+        offsets[i] = length;
+        length += Sim_EncodeRecord(&records[i], deltas, &out[length]);
+    }
+    offsets[count] = length;
+    return length;
+}
+
+/* ----------------------------------------------------------------------------
+ * 用例
+ * ------------------------------------------------------------------------- */
+
+static int Sim_Bench(const Sim_Record* records, uint32_t count)
+{
+    static uint8_t out[64];
+    static char text[64];
+    TLM_Delta deltas[3];
+    uint64_t cycles[2] = { 0 }, bytes[2] = { 0 }, n[2] = { 0 };
+    uint64_t text_cycles = 0, text_bytes = 0;
+    uint64_t start;
+
+    memset(deltas, 0, sizeof(deltas));
+    app_drv_fifo_init(&sim_fifo, sim_fifo_buffer, SIM_FIFO_SIZE);
+    TLM_Init(&sim_tlm, &sim_fifo, NULL, NULL);
+    for (uint32_t i = 0; i < count; i++) {
+        uint8_t key = TLM_IsKeyframe(records[i].seq) ? 1U : 0U;
+        uint16_t length;
+
+        start = Sim_Cycles();
+        length = Sim_EncodeRecord(&records[i], deltas, out);
+        cycles[key] += Sim_Cycles() - start;
+        bytes[key] += length;
+        n[key]++;
+
+        start = Sim_Cycles();
+        length = (uint16_t)Sim_FormatText(text, sizeof(text), &records[i]);
+        text_cycles += Sim_Cycles() - start;
+        text_bytes += length;
+    }
+
+    printf("bench: %u records, keyframe every %u, %s per record (bin includes draining the FIFO)\n", count,
+           TLM_KEYFRAME_INTERVAL,
+#if defined(__x86_64__) || defined(__i386__)
+           "TSC cycles");
+#else
+           "ns");
+#endif
+    printf("  %-16s %8s %10s\n", "path", "bytes", "cycles");
+    printf("  %-16s %8.2f %10.1f\n", "bin delta", (double)bytes[0] / n[0], (double)cycles[0] / n[0]);
+    printf("  %-16s %8.2f %10.1f\n", "bin keyframe", (double)bytes[1] / n[1], (double)cycles[1] / n[1]);
+    printf("  %-16s %8.2f %10.1f\n", "bin mean", (double)(bytes[0] + bytes[1]) / count,
+           (double)(cycles[0] + cycles[1]) / count);
+    printf("  %-16s %8.2f %10.1f\n", "text snprintf", (double)text_bytes / count, (double)text_cycles / count);
+    printf("  bin / text: %.1f%% of the bytes, %.1f%% of the cycles\n",
+           100.0 * (bytes[0] + bytes[1]) / text_bytes, 100.0 * (cycles[0] + cycles[1]) / text_cycles);
+    return 0;
+}
+
+// 逐条核对解码结果
+typedef struct {
+    const Sim_Record* expected;
+    uint32_t count;
+    uint32_t skip_first;        // [skip_first, skip_end) 内的记录不应输出
+    uint32_t skip_end;
+    uint32_t mismatch;
+    uint32_t seen;
+} Sim_Check;
+
+static void Sim_CheckRecord(void* user, const Sim_Record* rec)
+{
+    Sim_Check* check = user;
+    const Sim_Record* e;
+
+    check->seen++;
+    if (rec->seq >= check->count || (rec->seq >= check->skip_first && rec->seq < check->skip_end)) {
+        check->mismatch++;
+        return;
+    }
+    e = &check->expected[rec->seq];
+    if (rec->ms != e->ms || rec->temp != e->temp || rec->rms != e->rms || rec->received != e->received) {
+        if (check->mismatch++ < 4U) {
+            printf("    seq %u: got %u,%d,%d,%u expected %u,%d,%d,%u\n", rec->seq, rec->ms, rec->temp, rec->rms,
+                   rec->received, e->ms, e->temp, e->rms, e->received);
+        }
+    }
+}
+
+static int Sim_Roundtrip(const Sim_Record* records, uint32_t count, const uint8_t* capture, uint32_t length)
+{
+    static const char echo[] = "> stream bin\r\n> ";
+    uint8_t* data = malloc(length + sizeof(echo));
+    Sim_DecodeStats stats;
+    Sim_Check check = { records, count, 0, 0, 0, 0 };
+    int bad;
+
+    memcpy(data, echo, sizeof(echo) - 1U);
+    memcpy(&data[sizeof(echo) - 1U], capture, length);
+    Sim_Decode(data, length + sizeof(echo) - 1U, Sim_CheckRecord, &check, &stats);
+    bad = (check.mismatch != 0U || check.seen != count || stats.gaps != 0U
+           || stats.skipped_bytes != sizeof(echo) - 1U);
+    printf("roundtrip: %u bytes (%.2f per record), %u records decoded, %u mismatched, %u bytes of echo skipped\n",
+           length, (double)length / count, check.seen, check.mismatch, stats.skipped_bytes);
+    printf("roundtrip: -> %s\n", bad ? "FAIL" : "PASS");
+    free(data);
+    return bad;
+}
+
+// 删除抓取中 [cut, cut + lost) 的字节后解码，返回输出错误值的记录数，missing 为多丢弃的记录数
+static uint32_t Sim_LossTrial(const Sim_Record* records, uint32_t count, const uint8_t* capture,
+                              const uint32_t* offsets, uint8_t* data, uint32_t cut, uint32_t lost, uint32_t* missing)
+{
+    uint32_t length = offsets[count];
+    Sim_DecodeStats stats;
+    Sim_Check check = { records, count, 0, 0, 0, 0 };
+    uint32_t expected;
+
+    memcpy(data, capture, cut);
+    memcpy(&data[cut], &capture[cut + lost], length - cut - lost);
+
+    // 第一条受损记录到丢失区之后的第一个关键帧之间不应输出
+    while (offsets[check.skip_first + 1U] <= cut) {
+        check.skip_first++;
+    }
+    check.skip_end = check.skip_first;
+    while (offsets[check.skip_end] < cut + lost || !TLM_IsKeyframe(check.skip_end)) {
+        check.skip_end++;
+    }
+    expected = count - (check.skip_end - check.skip_first);
+
+    Sim_Decode(data, length - lost, Sim_CheckRecord, &check, &stats);
+    *missing = (check.seen + check.mismatch < expected) ? expected - check.seen - check.mismatch : 0U;
+    printf("  cut %3u bytes at %6u: records %u-%u held back, %u decoded (expected %u), "
+           "%u waiting, %u rejected, %u wrong\n", lost, cut, check.skip_first, check.skip_end - 1U,
+           check.seen, expected, stats.waiting, stats.rejected, check.mismatch);
+    return check.mismatch;
+}
+
+static int Sim_Loss(const Sim_Record* records, uint32_t count, const uint8_t* capture, const uint32_t* offsets)
+{
+    uint8_t* data = malloc(offsets[count]);
+    uint32_t bad = 0, wrong = 0, wrong_cuts = 0, missing = 0, trials = 16U;
+
+    // 固件中空间不足时 TLM_End 整条丢弃，链路上只会缺整条记录：解码必须精确
+    printf("loss: whole records dropped, records up to the next keyframe must be held back\n");
+    for (uint32_t trial = 0; trial < trials; trial++) {
+        uint32_t first = count / 4U + (uint32_t)(drand48() * count / 2U);
+        uint32_t n = 1U + (uint32_t)(drand48() * 5.0);
+        uint32_t m;
+
+        bad += Sim_LossTrial(records, count, capture, offsets, data, offsets[first],
+                             offsets[first + n] - offsets[first], &m);
+        bad += m;
+    }
+    printf("loss: -> %s\n", bad ? "FAIL" : "PASS");
+
+    // 串口接收端溢出可能在记录中间丢字节：格式没有逐条校验，只能发现结构损坏，
+    // 恰好仍能解析的残缺记录会输出错误值，这里只给出统计
+    printf("loss: arbitrary bytes dropped (no per-record check, reported only)\n");
+    for (uint32_t trial = 0; trial < trials; trial++) {
+        uint32_t cut = offsets[count] / 4U + (uint32_t)(drand48() * offsets[count] / 2U);
+        uint32_t w, m;
+
+        w = Sim_LossTrial(records, count, capture, offsets, data, cut, 1U + (uint32_t)(drand48() * 40.0), &m);
+        wrong += w;
+        wrong_cuts += (w != 0U);
+        missing += m;
+    }
+    printf("loss: %u of %u cuts output %u wrong records; %u intact records rejected next to a cut\n",
+           wrong_cuts, trials, wrong, missing);
+    free(data);
+    return bad ? 1 : 0;
+}
+
+int main(int argc, char* argv[])
+{
+    const char* only = NULL;
+    const char* output = NULL;
+    uint32_t count = 10000U;
+    Sim_Record* records;
+    uint8_t* capture;
+    uint32_t* offsets;
+    uint32_t length;
+    int failed = 0;
+    int opt;
+
+    srand48(1);
+    while ((opt = getopt(argc, argv, "n:s:o:d:")) != -1) {
+        switch (opt) {
+        case 'n': count = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 's': srand48(strtol(optarg, NULL, 0)); break;
+        case 'o': output = optarg; break;
+        case 'd': return Sim_DecodeFile(optarg);
+        default:
+            fprintf(stderr, "usage: tlm_stream [-n records] [-s seed] [-o capture.bin] [bench|roundtrip|loss]\n"
+                            "       tlm_stream -d capture.bin\n");
+            return 2;
+        }
+    }
+    if (optind < argc) {
+        only = argv[optind];
+    }
+
+    records = malloc(count * sizeof(*records));
+    capture = malloc(count * 32U);
+    offsets = malloc((count + 1U) * sizeof(*offsets));
+    Sim_Generate(records, count);
+    length = Sim_EncodeAll(records, count, capture, offsets);
+    if (output != NULL) {
+        FILE* f = fopen(output, "wb");
+        if (f == NULL || fwrite(capture, 1, length, f) != length) {
+            perror(output);
+            return 1;
+        }
+        fclose(f);
+    }
+
+    if (only == NULL || strcmp(only, "bench") == 0) {
+        failed |= Sim_Bench(records, count);
+    }
+    if (only == NULL || strcmp(only, "roundtrip") == 0) {
+        failed |= Sim_Roundtrip(records, count, capture, length);
+    }
+    if (only == NULL || strcmp(only, "loss") == 0) {
+        failed |= Sim_Loss(records, count, capture, offsets);
+    }
+    free(records);
+    free(capture);
+    free(offsets);
+    return failed;
+}